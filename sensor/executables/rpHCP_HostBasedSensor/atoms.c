@@ -19,37 +19,515 @@ limitations under the License.
 
 #define RPAL_FILE_ID            111
 
-#define _CLEANUP_EVERY          50
 #define _ATOM_GRACE_MS          10000
 #define _PROCESS_UNCERTAINTY_MS 1000
 
-static rBTree g_atoms = NULL;
-static RU32 g_nextCleanup = _CLEANUP_EVERY;
+// Atoms live in a sharded open-addressing table keyed by Atom.key with a
+// secondary table mapping atom ids back to keys. Expired atoms are tracked
+// in buckets per second of expiredOn so that cleanup only ever touches atoms
+// that actually expired.
+#define _ATOMS_N_SHARDS         16
+#define _ATOMS_MIN_SLOTS        64
+#define _ATOMS_BUCKET_MIN_KEYS  16
+
+#define _SLOT_EMPTY             0
+#define _SLOT_DELETED           1
+
+#define _ATOM_KEY_SIZE          sizeof( ( (Atom*)NULL )->key )
+#define _FIELD_OFFSET(t,f)      ( (RU32)(RSIZET)&( ( (t*)NULL )->f ) )
+
+typedef struct
+{
+    RU64 hash;
+    Atom atom;
+} _AtomSlot;
+
+typedef struct
+{
+    RU64 hash;
+    RU8 id[ HBS_ATOM_ID_SIZE ];
+    RU8 key[ _ATOM_KEY_SIZE ];
+} _IdSlot;
+
+typedef struct
+{
+    rRwLock lock;
+    RU32 slotSize;
+    RU32 keyOffset;
+    RU32 keySize;
+    RU32 nSlots;
+    RU32 nUsed;
+    RU32 nDeleted;
+    RPU8 slots;
+} _AtomTable;
+
+typedef struct
+{
+    RU64 second;
+    RU32 nKeys;
+    RU32 nAlloc;
+    RPU8 keys;
+} _ExpiryBucket;
+
+static _AtomTable g_keyShards[ _ATOMS_N_SHARDS ] = { 0 };
+static _AtomTable g_idShards[ _ATOMS_N_SHARDS ] = { 0 };
+static rMutex g_expiryLock = NULL;
+static rBTree g_expiry = NULL;
+static RBOOL g_isInitialized = FALSE;
+
+#define _SLOT_AT(table,i)       ( (table)->slots + ( (RSIZET)(i) * (table)->slotSize ) )
+#define _SLOT_HASH(slot)        ( *(RU64*)(slot) )
+#define _SLOT_KEY(table,slot)   ( (RPU8)(slot) + (table)->keyOffset )
+#define _SHARD_OF(hash)         ( (RU32)( (hash) >> 60 ) & ( _ATOMS_N_SHARDS - 1 ) )
+
+RPRIVATE RU64
+    _hashBytes
+    (
+        RPVOID buffer,
+        RU32 size
+    )
+{
+    RU64 hash = 0xcbf29ce484222325ULL;
+    RPU8 p = (RPU8)buffer;
+    RU32 i = 0;
+
+    for( i = 0; i < size; i++ )
+    {
+        hash ^= p[ i ];
+        hash *= 0x100000001b3ULL;
+    }
+
+    // Spread the low bits into the high bits used for sharding and
+    // keep clear of the values reserved for empty and deleted slots.
+    hash ^= hash >> 29;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 32;
+
+    if( _SLOT_DELETED >= hash )
+    {
+        hash += _SLOT_DELETED + 1;
+    }
+
+    return hash;
+}
 
 RPRIVATE RS32
-    _compareAtomKeys
+    _compareBuckets
     (
-        Atom* atom1,
-        Atom* atom2
+        _ExpiryBucket* bucket1,
+        _ExpiryBucket* bucket2
     )
 {
     RS32 ret = 0;
 
-    if( NULL != atom1 && NULL != atom2 )
+    if( bucket1->second < bucket2->second )
+    {
+        ret = -1;
+    }
+    else if( bucket1->second > bucket2->second )
     {
-        ret = rpal_memory_memcmp( &(atom1->key), &(atom2->key), sizeof( atom1->key ) );
+        ret = 1;
     }
 
     return ret;
 }
 
+RPRIVATE RBOOL
+    _tableInit
+    (
+        _AtomTable* table,
+        RU32 slotSize,
+        RU32 keyOffset,
+        RU32 keySize
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    rpal_memory_zero( table, sizeof( *table ) );
+    table->slotSize = slotSize;
+    table->keyOffset = keyOffset;
+    table->keySize = keySize;
+    table->nSlots = _ATOMS_MIN_SLOTS;
+
+    if( NULL != ( table->lock = rRwLock_create() ) )
+    {
+        if( NULL != ( table->slots = rpal_memory_alloc( table->nSlots * slotSize ) ) )
+        {
+            rpal_memory_zero( table->slots, table->nSlots * slotSize );
+            isSuccess = TRUE;
+        }
+        else
+        {
+            rRwLock_free( table->lock );
+            table->lock = NULL;
+        }
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE RVOID
+    _tableDeinit
+    (
+        _AtomTable* table
+    )
+{
+    if( NULL != table->lock )
+    {
+        rRwLock_free( table->lock );
+    }
+
+    rpal_memory_free( table->slots );
+    rpal_memory_zero( table, sizeof( *table ) );
+}
+
+// Returns the slot holding the key or NULL, table must be locked.
+RPRIVATE RPU8
+    _tableFind
+    (
+        _AtomTable* table,
+        RU64 hash,
+        RPVOID key
+    )
+{
+    RU32 mask = table->nSlots - 1;
+    RU32 i = (RU32)hash & mask;
+    RPU8 slot = NULL;
+
+    while( _SLOT_EMPTY != _SLOT_HASH( ( slot = _SLOT_AT( table, i ) ) ) )
+    {
+        if( hash == _SLOT_HASH( slot ) &&
+            0 == rpal_memory_memcmp( _SLOT_KEY( table, slot ), key, table->keySize ) )
+        {
+            return slot;
+        }
+
+        i = ( i + 1 ) & mask;
+    }
+
+    return NULL;
+}
+
+// Rebuilds the table with a new number of slots, dropping deleted markers.
+RPRIVATE RBOOL
+    _tableResize
+    (
+        _AtomTable* table,
+        RU32 nSlots
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RPU8 oldSlots = table->slots;
+    RU32 nOldSlots = table->nSlots;
+    RPU8 slot = NULL;
+    RU32 mask = nSlots - 1;
+    RU32 i = 0;
+    RU32 j = 0;
+
+    if( NULL != ( table->slots = rpal_memory_alloc( (RSIZET)nSlots * table->slotSize ) ) )
+    {
+        rpal_memory_zero( table->slots, (RSIZET)nSlots * table->slotSize );
+        table->nSlots = nSlots;
+        table->nDeleted = 0;
+
+        for( i = 0; i < nOldSlots; i++ )
+        {
+            slot = oldSlots + ( (RSIZET)i * table->slotSize );
+            if( _SLOT_DELETED >= _SLOT_HASH( slot ) )
+            {
+                continue;
+            }
+
+            j = (RU32)_SLOT_HASH( slot ) & mask;
+            while( _SLOT_EMPTY != _SLOT_HASH( _SLOT_AT( table, j ) ) )
+            {
+                j = ( j + 1 ) & mask;
+            }
+            rpal_memory_memcpy( _SLOT_AT( table, j ), slot, table->slotSize );
+        }
+
+        rpal_memory_free( oldSlots );
+        isSuccess = TRUE;
+    }
+    else
+    {
+        table->slots = oldSlots;
+    }
+
+    return isSuccess;
+}
+
+// Inserts or replaces the slot content with the same key, table must be
+// write locked. The slot content must already hold the hash.
+RPRIVATE RPU8
+    _tableSet
+    (
+        _AtomTable* table,
+        RPU8 content
+    )
+{
+    RU64 hash = _SLOT_HASH( content );
+    RPU8 slot = NULL;
+    RU32 mask = 0;
+    RU32 i = 0;
+    RU32 nSlots = table->nSlots;
+
+    if( NULL == ( slot = _tableFind( table, hash, _SLOT_KEY( table, content ) ) ) )
+    {
+        // Keep the load, including deleted markers, under 3/4.
+        if( ( table->nUsed + table->nDeleted + 1 ) * 4 > table->nSlots * 3 )
+        {
+            while( ( table->nUsed + 1 ) * 2 > nSlots )
+            {
+                nSlots *= 2;
+            }
+
+            if( !_tableResize( table, nSlots ) )
+            {
+                return NULL;
+            }
+        }
+
+        mask = table->nSlots - 1;
+        i = (RU32)hash & mask;
+        while( _SLOT_DELETED < _SLOT_HASH( ( slot = _SLOT_AT( table, i ) ) ) )
+        {
+            i = ( i + 1 ) & mask;
+        }
+
+        if( _SLOT_DELETED == _SLOT_HASH( slot ) )
+        {
+            table->nDeleted--;
+        }
+        table->nUsed++;
+    }
+
+    rpal_memory_memcpy( slot, content, table->slotSize );
+
+    return slot;
+}
+
+// Removes a slot returned by _tableFind, table must be write locked.
 RPRIVATE RVOID
-    _freeAtom
+    _tableDelete
     (
-        Atom* atom
+        _AtomTable* table,
+        RPU8 slot
     )
 {
-    rpal_memory_zero( atom, sizeof( *atom ) );
+    RU32 nSlots = table->nSlots;
+
+    rpal_memory_zero( slot, table->slotSize );
+    _SLOT_HASH( slot ) = _SLOT_DELETED;
+    table->nUsed--;
+    table->nDeleted++;
+
+    // Give memory back once a burst of atoms is gone.
+    if( _ATOMS_MIN_SLOTS < nSlots &&
+        table->nUsed * 8 < nSlots )
+    {
+        while( _ATOMS_MIN_SLOTS < nSlots &&
+               table->nUsed * 4 < nSlots )
+        {
+            nSlots /= 2;
+        }
+
+        _tableResize( table, nSlots );
+    }
+}
+
+// Id index maintenance, called with the key shard write locked.
+RPRIVATE RVOID
+    _indexRemove
+    (
+        RU8 id[ HBS_ATOM_ID_SIZE ]
+    )
+{
+    RU64 hash = _hashBytes( id, HBS_ATOM_ID_SIZE );
+    _AtomTable* table = &g_idShards[ _SHARD_OF( hash ) ];
+    RPU8 slot = NULL;
+
+    if( rRwLock_write_lock( table->lock ) )
+    {
+        if( NULL != ( slot = _tableFind( table, hash, id ) ) )
+        {
+            _tableDelete( table, slot );
+        }
+
+        rRwLock_write_unlock( table->lock );
+    }
+}
+
+RPRIVATE RBOOL
+    _indexAdd
+    (
+        Atom* pAtom
+    )
+{
+    RBOOL isSuccess = FALSE;
+    _IdSlot entry = { 0 };
+    _AtomTable* table = NULL;
+
+    entry.hash = _hashBytes( pAtom->id, HBS_ATOM_ID_SIZE );
+    rpal_memory_memcpy( entry.id, pAtom->id, sizeof( entry.id ) );
+    rpal_memory_memcpy( entry.key, &pAtom->key, sizeof( entry.key ) );
+    table = &g_idShards[ _SHARD_OF( entry.hash ) ];
+
+    if( rRwLock_write_lock( table->lock ) )
+    {
+        isSuccess = ( NULL != _tableSet( table, (RPU8)&entry ) );
+        rRwLock_write_unlock( table->lock );
+    }
+
+    return isSuccess;
+}
+
+// Stores the atom under its key, replacing any previous atom and keeping
+// the id index in sync. If isMustExist, only an existing atom is replaced.
+RPRIVATE RBOOL
+    _setAtom
+    (
+        Atom* pAtom,
+        RBOOL isMustExist
+    )
+{
+    RBOOL isSuccess = FALSE;
+    _AtomSlot entry = { 0 };
+    _AtomSlot* slot = NULL;
+    _AtomTable* table = NULL;
+
+    entry.hash = _hashBytes( &pAtom->key, _ATOM_KEY_SIZE );
+    rpal_memory_memcpy( &entry.atom, pAtom, sizeof( entry.atom ) );
+    table = &g_keyShards[ _SHARD_OF( entry.hash ) ];
+
+    if( rRwLock_write_lock( table->lock ) )
+    {
+        if( NULL != ( slot = (_AtomSlot*)_tableFind( table, entry.hash, &pAtom->key ) ) )
+        {
+            if( 0 != rpal_memory_memcmp( slot->atom.id, pAtom->id, sizeof( pAtom->id ) ) )
+            {
+                _indexRemove( slot->atom.id );
+                _indexAdd( pAtom );
+            }
+
+            rpal_memory_memcpy( &slot->atom, pAtom, sizeof( slot->atom ) );
+            isSuccess = TRUE;
+        }
+        else if( !isMustExist &&
+                 NULL != _tableSet( table, (RPU8)&entry ) )
+        {
+            if( _indexAdd( pAtom ) )
+            {
+                isSuccess = TRUE;
+            }
+            else
+            {
+                _tableDelete( table, _tableFind( table, entry.hash, &pAtom->key ) );
+            }
+        }
+
+        rRwLock_write_unlock( table->lock );
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE RVOID
+    _trackExpiry
+    (
+        Atom* pAtom
+    )
+{
+    _ExpiryBucket bucket = { 0 };
+    RPU8 tmpKeys = NULL;
+
+    bucket.second = pAtom->expiredOn / 1000;
+
+    if( rMutex_lock( g_expiryLock ) )
+    {
+        if( rpal_btree_search( g_expiry, &bucket, &bucket, TRUE ) )
+        {
+            if( bucket.nKeys == bucket.nAlloc )
+            {
+                if( NULL != ( tmpKeys = rpal_memory_realloc( bucket.keys, bucket.nAlloc * 2 * _ATOM_KEY_SIZE ) ) )
+                {
+                    bucket.keys = tmpKeys;
+                    bucket.nAlloc *= 2;
+                }
+            }
+
+            if( bucket.nKeys < bucket.nAlloc )
+            {
+                rpal_memory_memcpy( bucket.keys + ( bucket.nKeys * _ATOM_KEY_SIZE ), &pAtom->key, _ATOM_KEY_SIZE );
+                bucket.nKeys++;
+                rpal_btree_update( g_expiry, &bucket, &bucket, TRUE );
+            }
+        }
+        else if( NULL != ( bucket.keys = rpal_memory_alloc( _ATOMS_BUCKET_MIN_KEYS * _ATOM_KEY_SIZE ) ) )
+        {
+            bucket.nAlloc = _ATOMS_BUCKET_MIN_KEYS;
+            bucket.nKeys = 1;
+            rpal_memory_memcpy( bucket.keys, &pAtom->key, _ATOM_KEY_SIZE );
+
+            if( !rpal_btree_add( g_expiry, &bucket, TRUE ) )
+            {
+                rpal_memory_free( bucket.keys );
+            }
+        }
+
+        rMutex_unlock( g_expiryLock );
+    }
+}
+
+// Drops every atom in the buckets whose grace period is over. Atoms that
+// were registered again or had their expiry pushed back since are kept.
+RPRIVATE RVOID
+    _expireAtoms
+    (
+        RU64 curTime
+    )
+{
+    _ExpiryBucket bucket = { 0 };
+    _AtomTable* table = NULL;
+    _AtomSlot* slot = NULL;
+    RPU8 key = NULL;
+    RU64 hash = 0;
+    RU32 i = 0;
+
+    while( rMutex_lock( g_expiryLock ) )
+    {
+        if( !rpal_btree_minimum( g_expiry, &bucket, TRUE ) ||
+            curTime <= ( ( bucket.second + 1 ) * 1000 ) + _ATOM_GRACE_MS )
+        {
+            rMutex_unlock( g_expiryLock );
+            break;
+        }
+
+        rpal_btree_remove( g_expiry, &bucket, NULL, TRUE );
+        rMutex_unlock( g_expiryLock );
+
+        for( i = 0; i < bucket.nKeys; i++ )
+        {
+            key = bucket.keys + ( i * _ATOM_KEY_SIZE );
+            hash = _hashBytes( key, _ATOM_KEY_SIZE );
+            table = &g_keyShards[ _SHARD_OF( hash ) ];
+
+            if( rRwLock_write_lock( table->lock ) )
+            {
+                if( NULL != ( slot = (_AtomSlot*)_tableFind( table, hash, key ) ) &&
+                    0 != slot->atom.expiredOn &&
+                    curTime > slot->atom.expiredOn + _ATOM_GRACE_MS )
+                {
+                    _indexRemove( slot->atom.id );
+                    _tableDelete( table, (RPU8)slot );
+                }
+
+                rRwLock_write_unlock( table->lock );
+            }
+        }
+
+        rpal_memory_free( bucket.keys );
+    }
 }
 
 RBOOL
@@ -59,12 +537,36 @@ RBOOL
     )
 {
     RBOOL isSuccess = FALSE;
+    RU32 i = 0;
 
-    if( NULL != ( g_atoms = rpal_btree_create( sizeof( Atom ), 
-                                               (rpal_btree_comp_f)_compareAtomKeys, 
-                                               (rpal_btree_free_f)_freeAtom ) ) )
+    if( g_isInitialized )
+    {
+        return TRUE;
+    }
+
+    if( NULL != ( g_expiryLock = rMutex_create() ) &&
+        NULL != ( g_expiry = rpal_btree_create( sizeof( _ExpiryBucket ),
+                                                (rpal_btree_comp_f)_compareBuckets,
+                                                NULL ) ) )
     {
         isSuccess = TRUE;
+
+        for( i = 0; i < _ATOMS_N_SHARDS; i++ )
+        {
+            if( !_tableInit( &g_keyShards[ i ], sizeof( _AtomSlot ), _FIELD_OFFSET( _AtomSlot, atom.key ), _ATOM_KEY_SIZE ) ||
+                !_tableInit( &g_idShards[ i ], sizeof( _IdSlot ), _FIELD_OFFSET( _IdSlot, id ), HBS_ATOM_ID_SIZE ) )
+            {
+                isSuccess = FALSE;
+                break;
+            }
+        }
+    }
+
+    g_isInitialized = TRUE;
+
+    if( !isSuccess )
+    {
+        atoms_deinit();
     }
 
     return isSuccess;
@@ -77,10 +579,36 @@ RBOOL
     )
 {
     RBOOL isSuccess = FALSE;
+    _ExpiryBucket bucket = { 0 };
+    RU32 i = 0;
 
-    if( NULL != g_atoms )
+    if( g_isInitialized )
     {
-        rpal_btree_destroy( g_atoms, FALSE );
+        g_isInitialized = FALSE;
+
+        for( i = 0; i < _ATOMS_N_SHARDS; i++ )
+        {
+            _tableDeinit( &g_keyShards[ i ] );
+            _tableDeinit( &g_idShards[ i ] );
+        }
+
+        if( NULL != g_expiry )
+        {
+            while( rpal_btree_minimum( g_expiry, &bucket, TRUE ) )
+            {
+                rpal_btree_remove( g_expiry, &bucket, NULL, TRUE );
+                rpal_memory_free( bucket.keys );
+            }
+            rpal_btree_destroy( g_expiry, TRUE );
+            g_expiry = NULL;
+        }
+
+        if( NULL != g_expiryLock )
+        {
+            rMutex_free( g_expiryLock );
+            g_expiryLock = NULL;
+        }
+
         isSuccess = TRUE;
     }
 
@@ -97,13 +625,9 @@ RBOOL
 
     if( NULL != pAtom )
     {
-        if( CryptoLib_genRandomBytes( pAtom->id, sizeof( pAtom->id ) ) )
+        if( CryptoLib_genUniqueId( pAtom->id ) )
         {
-            isSuccess = rpal_btree_add( g_atoms, pAtom, FALSE );
-            if( !isSuccess )
-            {
-                isSuccess = rpal_btree_update( g_atoms, pAtom, pAtom, FALSE );
-            }
+            isSuccess = _setAtom( pAtom, FALSE );
         }
 
         if( !isSuccess )
@@ -125,7 +649,7 @@ RBOOL
 
     if( NULL != pAtom )
     {
-        isSuccess = rpal_btree_update( g_atoms, pAtom, pAtom, FALSE );
+        isSuccess = _setAtom( pAtom, TRUE );
     }
 
     return isSuccess;
@@ -141,10 +665,26 @@ RBOOL
     )
 {
     RBOOL isSuccess = FALSE;
+    RU64 hash = 0;
+    _AtomTable* table = NULL;
+    _AtomSlot* slot = NULL;
 
     if( NULL != pAtom )
     {
-        isSuccess = rpal_btree_search( g_atoms, pAtom, pAtom, FALSE );
+        hash = _hashBytes( &pAtom->key, _ATOM_KEY_SIZE );
+        table = &g_keyShards[ _SHARD_OF( hash ) ];
+
+        if( rRwLock_read_lock( table->lock ) )
+        {
+            if( NULL != ( slot = (_AtomSlot*)_tableFind( table, hash, &pAtom->key ) ) )
+            {
+                rpal_memory_memcpy( pAtom, &slot->atom, sizeof( *pAtom ) );
+                isSuccess = TRUE;
+            }
+
+            rRwLock_read_unlock( table->lock );
+        }
+
         if( !isSuccess )
         {
             rpal_debug_warning( "atom not found (%d:%d)", fromFileId, fromLineNumber );
@@ -169,43 +709,37 @@ RBOOL
     )
 {
     RBOOL isSuccess = FALSE;
-    Atom tmpAtom = { 0 };
-    RU64 curTime = 0;
+    RU64 hash = 0;
+    _AtomTable* table = NULL;
+    _AtomSlot* slot = NULL;
 
     if( NULL != pAtom )
     {
         pAtom->expiredOn = expiredOn;
-        isSuccess = rpal_btree_update( g_atoms, pAtom, pAtom, FALSE );
-        if( !isSuccess )
-        {
-            rpal_debug_error( "atom not found" );
-        }
+        hash = _hashBytes( &pAtom->key, _ATOM_KEY_SIZE );
+        table = &g_keyShards[ _SHARD_OF( hash ) ];
 
-        if( 0 == g_nextCleanup )
+        if( rRwLock_write_lock( table->lock ) )
         {
-            g_nextCleanup = _CLEANUP_EVERY;
-
-            if( rpal_btree_minimum( g_atoms, &tmpAtom, FALSE ) )
+            if( NULL != ( slot = (_AtomSlot*)_tableFind( table, hash, &pAtom->key ) ) )
             {
-                curTime = rpal_time_getGlobalPreciseTime();
-
-                do
-                {
-                    if( 0 != tmpAtom.expiredOn &&
-                        curTime > tmpAtom.expiredOn + _ATOM_GRACE_MS )
-                    {
-                        rpal_btree_remove( g_atoms, &tmpAtom, NULL, FALSE );
-                    }
-                }
-                while( rpal_btree_after( g_atoms, &tmpAtom, &tmpAtom, FALSE ) );
+                slot->atom.expiredOn = expiredOn;
+                isSuccess = TRUE;
             }
 
-            rpal_debug_info( "atom cleanup finished, %d left", rpal_btree_getSize( g_atoms, FALSE ) );
+            rRwLock_write_unlock( table->lock );
+        }
+
+        if( isSuccess )
+        {
+            _trackExpiry( pAtom );
         }
         else
         {
-            g_nextCleanup--;
+            rpal_debug_error( "atom not found" );
         }
+
+        _expireAtoms( rpal_time_getGlobalPreciseTime() );
     }
 
     return isSuccess;
@@ -221,7 +755,7 @@ RBOOL
 
     if( NULL != pAtom )
     {
-        isSuccess = CryptoLib_genRandomBytes( pAtom->id, sizeof( pAtom->id ) );
+        isSuccess = CryptoLib_genUniqueId( pAtom->id );
     }
 
     return isSuccess;
@@ -234,23 +768,25 @@ RU32
     )
 {
     RU32 pid = 0;
+    RU64 hash = 0;
+    _AtomTable* table = NULL;
+    _IdSlot* slot = NULL;
     Atom tmpAtom = { 0 };
 
     if( NULL != pAtomId )
     {
-        if( rpal_btree_minimum( g_atoms, &tmpAtom, FALSE ) )
+        hash = _hashBytes( pAtomId, HBS_ATOM_ID_SIZE );
+        table = &g_idShards[ _SHARD_OF( hash ) ];
+
+        if( rRwLock_read_lock( table->lock ) )
         {
-            do
+            if( NULL != ( slot = (_IdSlot*)_tableFind( table, hash, pAtomId ) ) )
             {
-                if( 0 == rpal_memory_memcmp( tmpAtom.id,
-                                             pAtomId, 
-                                             sizeof( tmpAtom.id ) ) )
-                {
-                    pid = tmpAtom.key.process.pid;
-                    break;
-                }
+                rpal_memory_memcpy( &tmpAtom.key, slot->key, sizeof( tmpAtom.key ) );
+                pid = tmpAtom.key.process.pid;
             }
-            while( rpal_btree_next( g_atoms, &tmpAtom, &tmpAtom, FALSE ) );
+
+            rRwLock_read_unlock( table->lock );
         }
     }
 
@@ -264,33 +800,52 @@ rBlob
     )
 {
     rBlob matches = NULL;
-
-    Atom tmpAtom = { 0 };
+    RBOOL isError = FALSE;
+    _AtomTable* table = NULL;
+    _AtomSlot* slot = NULL;
+    RU32 i = 0;
+    RU32 j = 0;
 
     if( NULL != parentAtom )
     {
-        if( rpal_btree_minimum( g_atoms, &tmpAtom, FALSE ) )
+        for( i = 0; i < _ATOMS_N_SHARDS && !isError; i++ )
         {
-            do
+            table = &g_keyShards[ i ];
+
+            if( !rRwLock_read_lock( table->lock ) )
             {
-                if( 0 == rpal_memory_memcmp( tmpAtom.parentId,
+                continue;
+            }
+
+            for( j = 0; j < table->nSlots; j++ )
+            {
+                slot = (_AtomSlot*)_SLOT_AT( table, j );
+
+                if( _SLOT_DELETED >= slot->hash ||
+                    0 != rpal_memory_memcmp( slot->atom.parentId,
                                              parentAtom,
-                                             sizeof( tmpAtom.id ) ) )
+                                             sizeof( slot->atom.parentId ) ) )
                 {
-                    if( NULL == matches &&
-                        NULL == ( matches = rpal_blob_create( 0, 0 ) ) )
-                    {
-                        break;
-                    }
-
-                    if( !rpal_blob_add( matches, tmpAtom.id, sizeof( tmpAtom.id ) ) )
-                    {
-                        rpal_blob_free( matches );
-                        matches = NULL;
-                        break;
-                    }
+                    continue;
                 }
-            } while( rpal_btree_next( g_atoms, &tmpAtom, &tmpAtom, FALSE ) );
+
+                if( NULL == matches &&
+                    NULL == ( matches = rpal_blob_create( 0, 0 ) ) )
+                {
+                    isError = TRUE;
+                    break;
+                }
+
+                if( !rpal_blob_add( matches, slot->atom.id, sizeof( slot->atom.id ) ) )
+                {
+                    rpal_blob_free( matches );
+                    matches = NULL;
+                    isError = TRUE;
+                    break;
+                }
+            }
+
+            rRwLock_read_unlock( table->lock );
         }
     }
 
@@ -0,0 +1,1167 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <rpal/rpal.h>
+#include <librpcm/librpcm.h>
+#include <rpHostCommonPlatformLib/rTags.h>
+#include <math.h>
+#include "code_meta.h"
+
+#define RPAL_FILE_ID        115
+
+// Total bytes read from a single file, everything below is clamped to it.
+#define _IO_BUDGET                  (1024 * 1024)
+#define _MAX_COMMANDS_SIZE          (64 * 1024)
+#define _MAX_DYNAMIC_SIZE           (16 * 1024)
+#define _MAX_NOTES_SIZE             (4 * 1024)
+#define _MAX_SECTION_NAMES_SIZE     (8 * 1024)
+#define _MAX_SECTIONS               96
+#define _MAX_SEGMENTS               64
+#define _MAX_IMPORTS                128
+#define _MAX_DEBUG_ENTRIES          16
+#define _MAX_NAME_SIZE              256
+#define _ENTROPY_SAMPLE_SIZE        (64 * 1024)
+#define _ENTROPY_MIN_SAMPLE         512
+#define _MAX_ENTROPY_SECTIONS       12
+// Compressed or encrypted data is close to 8 bits per byte, code is ~6.
+#define _HIGH_ENTROPY               720
+
+typedef struct
+{
+    rFile hFile;
+    RPU8 buffer;
+    RU64 base;
+    RU64 size;
+    RU32 budget;
+    RBOOL isBigEndian;
+    RBOOL is64;
+} _Reader;
+
+typedef struct
+{
+    RCHAR name[ 17 ];
+    RU64 address;
+    RU64 addressSize;
+    RU64 offset;
+    RU64 size;
+    RBOOL isExec;
+    RBOOL isWrite;
+} _Section;
+
+// Section names used by common packers and protectors.
+RPRIVATE const RCHAR* g_packerSections[] = { "UPX0", "UPX1", "UPX2", "__XHDR",
+                                             ".aspack", ".adata", ".petite",
+                                             ".MPRESS1", ".MPRESS2", ".nsp0",
+                                             ".nsp1", ".themida", ".vmp0",
+                                             ".vmp1", ".enigma1", ".packed" };
+
+//=============================================================================
+//  Bounded reads
+//=============================================================================
+RPRIVATE
+RBOOL
+    _readAt
+    (
+        _Reader* r,
+        RU64 offset,
+        RU32 size,
+        RPVOID out
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    if( 0 == size ||
+        size > r->budget ||
+        offset >= r->size ||
+        size > r->size - offset )
+    {
+        return FALSE;
+    }
+
+    r->budget -= size;
+
+    if( NULL != r->buffer )
+    {
+        rpal_memory_memcpy( out, r->buffer + r->base + offset, size );
+        isSuccess = TRUE;
+    }
+    else if( r->base + offset == rFile_seek( r->hFile, r->base + offset, rFileSeek_SET ) &&
+             rFile_read( r->hFile, size, out ) )
+    {
+        isSuccess = TRUE;
+    }
+
+    return isSuccess;
+}
+
+// Reads as much as available up to maxSize, returns the size read.
+RPRIVATE
+RU32
+    _readUpTo
+    (
+        _Reader* r,
+        RU64 offset,
+        RU32 maxSize,
+        RPVOID out
+    )
+{
+    RU32 size = 0;
+
+    if( offset < r->size )
+    {
+        size = (RU32)MIN_OF( (RU64)maxSize, r->size - offset );
+        size = MIN_OF( size, r->budget );
+
+        if( !_readAt( r, offset, size, out ) )
+        {
+            size = 0;
+        }
+    }
+
+    return size;
+}
+
+RPRIVATE
+RBOOL
+    _readString
+    (
+        _Reader* r,
+        RU64 offset,
+        RPCHAR out,
+        RU32 outSize
+    )
+{
+    RU32 size = 0;
+
+    if( 0 != ( size = _readUpTo( r, offset, outSize - 1, out ) ) )
+    {
+        out[ size ] = 0;
+    }
+
+    return 0 != size && 0 != out[ 0 ];
+}
+
+RPRIVATE
+RU16
+    _u16
+    (
+        _Reader* r,
+        RPU8 p
+    )
+{
+    return r->isBigEndian ? (RU16)( ( p[ 0 ] << 8 ) | p[ 1 ] ) :
+                            (RU16)( ( p[ 1 ] << 8 ) | p[ 0 ] );
+}
+
+RPRIVATE
+RU32
+    _u32
+    (
+        _Reader* r,
+        RPU8 p
+    )
+{
+    return r->isBigEndian ? ( (RU32)p[ 0 ] << 24 ) | ( (RU32)p[ 1 ] << 16 ) | ( (RU32)p[ 2 ] << 8 ) | p[ 3 ] :
+                            ( (RU32)p[ 3 ] << 24 ) | ( (RU32)p[ 2 ] << 16 ) | ( (RU32)p[ 1 ] << 8 ) | p[ 0 ];
+}
+
+RPRIVATE
+RU64
+    _u64
+    (
+        _Reader* r,
+        RPU8 p
+    )
+{
+    return r->isBigEndian ? ( (RU64)_u32( r, p ) << 32 ) | _u32( r, p + 4 ) :
+                            ( (RU64)_u32( r, p + 4 ) << 32 ) | _u32( r, p );
+}
+
+// Reads a native word, 32 or 64 bits depending on the binary.
+RPRIVATE
+RU64
+    _uWord
+    (
+        _Reader* r,
+        RPU8 p
+    )
+{
+    return r->is64 ? _u64( r, p ) : _u32( r, p );
+}
+
+//=============================================================================
+//  Common analysis
+//=============================================================================
+RPRIVATE
+RVOID
+    _addImport
+    (
+        HbsCodeMeta* pMeta,
+        RPCHAR name
+    )
+{
+    RU32 size = rpal_string_strlenA( name ) + 1;
+
+    pMeta->nImports++;
+
+    if( sizeof( pMeta->imports ) - pMeta->importsSize >= size )
+    {
+        rpal_memory_memcpy( pMeta->imports + pMeta->importsSize, name, size );
+        pMeta->importsSize += (RU16)size;
+    }
+    else
+    {
+        pMeta->isImportsTruncated = TRUE;
+    }
+}
+
+RPRIVATE
+RVOID
+    _setBuildId
+    (
+        HbsCodeMeta* pMeta,
+        RPU8 buildId,
+        RU32 size
+    )
+{
+    pMeta->buildIdSize = (RU8)MIN_OF( size, sizeof( pMeta->buildId ) );
+    rpal_memory_memcpy( pMeta->buildId, buildId, pMeta->buildIdSize );
+}
+
+RPRIVATE
+RBOOL
+    _addressToOffset
+    (
+        _Section* sections,
+        RU32 nSections,
+        RU64 address,
+        RU64* pOffset
+    )
+{
+    RU32 i = 0;
+
+    for( i = 0; i < nSections; i++ )
+    {
+        if( address >= sections[ i ].address &&
+            address - sections[ i ].address < sections[ i ].addressSize &&
+            address - sections[ i ].address < sections[ i ].size )
+        {
+            *pOffset = sections[ i ].offset + ( address - sections[ i ].address );
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+RPRIVATE
+RU32
+    _entropy
+    (
+        RPU8 buffer,
+        RU32 size
+    )
+{
+    RU32 counts[ 256 ] = { 0 };
+    RDOUBLE entropy = 0;
+    RDOUBLE p = 0;
+    RU32 i = 0;
+
+    for( i = 0; i < size; i++ )
+    {
+        counts[ buffer[ i ] ]++;
+    }
+
+    for( i = 0; i < ARRAY_N_ELEM( counts ); i++ )
+    {
+        if( 0 != counts[ i ] )
+        {
+            p = (RDOUBLE)counts[ i ] / size;
+            entropy -= p * log( p );
+        }
+    }
+
+    return (RU32)( ( entropy / log( 2.0 ) ) * 100 + 0.5 );
+}
+
+RPRIVATE
+RVOID
+    _analyzeSections
+    (
+        _Reader* r,
+        HbsCodeMeta* pMeta,
+        _Section* sections,
+        RU32 nSections
+    )
+{
+    RPU8 sample = NULL;
+    RU32 sampleSize = 0;
+    RU32 nSampled = 0;
+    RU32 entropy = 0;
+    RU32 i = 0;
+    RU32 j = 0;
+
+    sample = rpal_memory_alloc( _ENTROPY_SAMPLE_SIZE );
+
+    for( i = 0; i < nSections; i++ )
+    {
+        if( sections[ i ].isExec &&
+            sections[ i ].isWrite )
+        {
+            pMeta->packerFlags |= HBS_CODE_META_PACKER_WRITABLE_CODE;
+        }
+
+        for( j = 0; j < ARRAY_N_ELEM( g_packerSections ); j++ )
+        {
+            if( 0 == rpal_string_strcmpA( sections[ i ].name, (RPCHAR)g_packerSections[ j ] ) )
+            {
+                pMeta->packerFlags |= HBS_CODE_META_PACKER_SECTION_NAME;
+            }
+        }
+
+        // Only the start of each section is sampled to keep the I/O bounded.
+        if( NULL != sample &&
+            _MAX_ENTROPY_SECTIONS > nSampled &&
+            _ENTROPY_MIN_SAMPLE <= sections[ i ].size &&
+            _ENTROPY_MIN_SAMPLE <= ( sampleSize = _readUpTo( r,
+                                                             sections[ i ].offset,
+                                                             (RU32)MIN_OF( sections[ i ].size, _ENTROPY_SAMPLE_SIZE ),
+                                                             sample ) ) )
+        {
+            nSampled++;
+            entropy = _entropy( sample, sampleSize );
+            pMeta->maxEntropy = (RU16)MAX_OF( pMeta->maxEntropy, entropy );
+
+            if( _HIGH_ENTROPY <= entropy )
+            {
+                pMeta->nHighEntropySections++;
+                pMeta->packerFlags |= HBS_CODE_META_PACKER_HIGH_ENTROPY;
+            }
+        }
+    }
+
+    rpal_memory_free( sample );
+}
+
+RPRIVATE
+RVOID
+    _evaluatePacker
+    (
+        HbsCodeMeta* pMeta
+    )
+{
+    // A known packer section is enough, otherwise high entropy needs to be
+    // backed by another sign since resources are often compressed.
+    if( IS_FLAG_ENABLED( pMeta->packerFlags, HBS_CODE_META_PACKER_SECTION_NAME ) ||
+        ( IS_FLAG_ENABLED( pMeta->packerFlags, HBS_CODE_META_PACKER_HIGH_ENTROPY ) &&
+          ( IS_FLAG_ENABLED( pMeta->packerFlags, HBS_CODE_META_PACKER_WRITABLE_CODE ) ||
+            IS_FLAG_ENABLED( pMeta->packerFlags, HBS_CODE_META_PACKER_FEW_IMPORTS ) ||
+            IS_FLAG_ENABLED( pMeta->packerFlags, HBS_CODE_META_PACKER_NO_SECTIONS ) ) ) )
+    {
+        pMeta->isPacked = TRUE;
+    }
+}
+
+//=============================================================================
+//  PE
+//=============================================================================
+RPRIVATE
+RBOOL
+    _parsePe
+    (
+        _Reader* r,
+        HbsCodeMeta* pMeta,
+        _Section* sections
+    )
+{
+    RU8 hdr[ 24 ] = { 0 };
+    RU8 opt[ 240 ] = { 0 };
+    RU8 raw[ 40 ] = { 0 };
+    RU8 codeView[ 24 ] = { 0 };
+    RCHAR name[ _MAX_NAME_SIZE ] = { 0 };
+    RU32 ntOffset = 0;
+    RU32 nSections = 0;
+    RU32 optSize = 0;
+    RU32 nDirs = 0;
+    RU32 dirsOffset = 0;
+    RU32 importRva = 0;
+    RU32 debugRva = 0;
+    RU32 debugSize = 0;
+    RU64 offset = 0;
+    RU64 nameOffset = 0;
+    RU32 i = 0;
+
+    if( !_readAt( r, 0x3C, sizeof( RU32 ), hdr ) )
+    {
+        return FALSE;
+    }
+    ntOffset = _u32( r, hdr );
+
+    if( !_readAt( r, ntOffset, sizeof( hdr ), hdr ) ||
+        'P' != hdr[ 0 ] || 'E' != hdr[ 1 ] || 0 != hdr[ 2 ] || 0 != hdr[ 3 ] )
+    {
+        return FALSE;
+    }
+
+    pMeta->format = HBS_CODE_META_FORMAT_PE;
+
+    switch( _u16( r, hdr + 4 ) )
+    {
+        case 0x014C: pMeta->arch = HBS_CODE_META_ARCH_X86; break;
+        case 0x8664: pMeta->arch = HBS_CODE_META_ARCH_X64; break;
+        case 0x01C0:
+        case 0x01C4: pMeta->arch = HBS_CODE_META_ARCH_ARM; break;
+        case 0xAA64: pMeta->arch = HBS_CODE_META_ARCH_ARM64; break;
+        default: break;
+    }
+
+    nSections = _u16( r, hdr + 6 );
+    optSize = _u16( r, hdr + 20 );
+    pMeta->nSections = (RU16)nSections;
+
+    // Data directories, 1 is imports and 6 is debug.
+    if( 0 != _readUpTo( r, ntOffset + sizeof( hdr ), MIN_OF( optSize, sizeof( opt ) ), opt ) )
+    {
+        if( 0x10B == _u16( r, opt ) )
+        {
+            nDirs = _u32( r, opt + 92 );
+            dirsOffset = 96;
+        }
+        else if( 0x20B == _u16( r, opt ) )
+        {
+            nDirs = _u32( r, opt + 108 );
+            dirsOffset = 112;
+        }
+
+        if( 0 != dirsOffset )
+        {
+            if( 1 < nDirs &&
+                dirsOffset + 16 <= MIN_OF( optSize, sizeof( opt ) ) )
+            {
+                importRva = _u32( r, opt + dirsOffset + 8 );
+            }
+            if( 6 < nDirs &&
+                dirsOffset + 56 <= MIN_OF( optSize, sizeof( opt ) ) )
+            {
+                debugRva = _u32( r, opt + dirsOffset + 48 );
+                debugSize = _u32( r, opt + dirsOffset + 52 );
+            }
+        }
+    }
+
+    nSections = MIN_OF( nSections, _MAX_SECTIONS );
+    offset = ntOffset + sizeof( hdr ) + optSize;
+
+    for( i = 0; i < nSections; i++ )
+    {
+        if( !_readAt( r, offset + ( i * sizeof( raw ) ), sizeof( raw ), raw ) )
+        {
+            nSections = i;
+            break;
+        }
+
+        rpal_memory_zero( &sections[ i ], sizeof( sections[ i ] ) );
+        rpal_memory_memcpy( sections[ i ].name, raw, 8 );
+        sections[ i ].addressSize = MAX_OF( _u32( r, raw + 8 ), _u32( r, raw + 16 ) );
+        sections[ i ].address = _u32( r, raw + 12 );
+        sections[ i ].size = _u32( r, raw + 16 );
+        sections[ i ].offset = _u32( r, raw + 20 );
+        sections[ i ].isExec = IS_FLAG_ENABLED( _u32( r, raw + 36 ), 0x20000000 );
+        sections[ i ].isWrite = IS_FLAG_ENABLED( _u32( r, raw + 36 ), 0x80000000 );
+    }
+
+    // Import descriptors are 20 bytes with the name RVA at 12.
+    if( 0 != importRva &&
+        _addressToOffset( sections, nSections, importRva, &offset ) )
+    {
+        for( i = 0; i < _MAX_IMPORTS; i++ )
+        {
+            if( !_readAt( r, offset + ( i * 20 ), 20, raw ) ||
+                0 == _u32( r, raw + 12 ) )
+            {
+                break;
+            }
+
+            if( _addressToOffset( sections, nSections, _u32( r, raw + 12 ), &nameOffset ) &&
+                _readString( r, nameOffset, name, sizeof( name ) ) )
+            {
+                _addImport( pMeta, name );
+            }
+        }
+    }
+
+    if( 1 >= pMeta->nImports )
+    {
+        pMeta->packerFlags |= HBS_CODE_META_PACKER_FEW_IMPORTS;
+    }
+
+    // The CodeView entry holds the PDB GUID and age matching the symbols.
+    if( 0 != debugRva &&
+        _addressToOffset( sections, nSections, debugRva, &offset ) )
+    {
+        for( i = 0; i < MIN_OF( debugSize / 28, _MAX_DEBUG_ENTRIES ); i++ )
+        {
+            if( !_readAt( r, offset + ( i * 28 ), 28, raw ) )
+            {
+                break;
+            }
+
+            if( 2 == _u32( r, raw + 12 ) &&
+                sizeof( codeView ) <= _u32( r, raw + 16 ) &&
+                _readAt( r, _u32( r, raw + 24 ), sizeof( codeView ), codeView ) &&
+                0 == rpal_memory_memcmp( codeView, "RSDS", 4 ) )
+            {
+                _setBuildId( pMeta, codeView + 4, 20 );
+                break;
+            }
+        }
+    }
+
+    _analyzeSections( r, pMeta, sections, nSections );
+
+    return TRUE;
+}
+
+//=============================================================================
+//  ELF
+//=============================================================================
+RPRIVATE
+RVOID
+    _parseElfNotes
+    (
+        _Reader* r,
+        HbsCodeMeta* pMeta,
+        RU64 offset,
+        RU64 size
+    )
+{
+    RU8 notes[ _MAX_NOTES_SIZE ] = { 0 };
+    RU32 notesSize = 0;
+    RU32 nameSize = 0;
+    RU32 descSize = 0;
+    RU32 i = 0;
+
+    notesSize = _readUpTo( r, offset, (RU32)MIN_OF( size, sizeof( notes ) ), notes );
+
+    while( i + 12 <= notesSize )
+    {
+        nameSize = _u32( r, notes + i );
+        descSize = _u32( r, notes + i + 4 );
+
+        if( nameSize > notesSize || descSize > notesSize )
+        {
+            break;
+        }
+
+        // NT_GNU_BUILD_ID
+        if( 3 == _u32( r, notes + i + 8 ) &&
+            4 == nameSize &&
+            i + 16 + descSize <= notesSize &&
+            0 == rpal_memory_memcmp( notes + i + 12, "GNU", 4 ) )
+        {
+            _setBuildId( pMeta, notes + i + 16, descSize );
+            break;
+        }
+
+        i += 12 + ( ( nameSize + 3 ) & ~3 ) + ( ( descSize + 3 ) & ~3 );
+    }
+}
+
+RPRIVATE
+RVOID
+    _parseElfDynamic
+    (
+        _Reader* r,
+        HbsCodeMeta* pMeta,
+        RU64 offset,
+        RU64 size,
+        _Section* segments,
+        RU32 nSegments
+    )
+{
+    RU8 dynamic[ _MAX_DYNAMIC_SIZE ] = { 0 };
+    RCHAR name[ _MAX_NAME_SIZE ] = { 0 };
+    RU64 needed[ _MAX_IMPORTS ] = { 0 };
+    RU32 nNeeded = 0;
+    RU32 dynamicSize = 0;
+    RU32 entrySize = r->is64 ? 16 : 8;
+    RU64 tag = 0;
+    RU64 strTab = 0;
+    RU64 strTabOffset = 0;
+    RU32 i = 0;
+
+    dynamicSize = _readUpTo( r, offset, (RU32)MIN_OF( size, sizeof( dynamic ) ), dynamic );
+
+    for( i = 0; i + entrySize <= dynamicSize; i += entrySize )
+    {
+        tag = _uWord( r, dynamic + i );
+
+        if( 0 == tag )
+        {
+            break;
+        }
+        else if( 1 == tag )
+        {
+            // DT_NEEDED entries are offsets into DT_STRTAB which may come later.
+            if( _MAX_IMPORTS > nNeeded )
+            {
+                needed[ nNeeded++ ] = _uWord( r, dynamic + i + ( entrySize / 2 ) );
+            }
+            else
+            {
+                pMeta->isImportsTruncated = TRUE;
+            }
+        }
+        else if( 5 == tag )
+        {
+            strTab = _uWord( r, dynamic + i + ( entrySize / 2 ) );
+        }
+    }
+
+    if( 0 == nNeeded ||
+        !_addressToOffset( segments, nSegments, strTab, &strTabOffset ) )
+    {
+        return;
+    }
+
+    for( i = 0; i < nNeeded; i++ )
+    {
+        if( _readString( r, strTabOffset + needed[ i ], name, sizeof( name ) ) )
+        {
+            _addImport( pMeta, name );
+        }
+    }
+}
+
+RPRIVATE
+RBOOL
+    _parseElf
+    (
+        _Reader* r,
+        HbsCodeMeta* pMeta,
+        _Section* sections
+    )
+{
+    RU8 hdr[ 64 ] = { 0 };
+    RU8 raw[ 64 ] = { 0 };
+    RCHAR names[ _MAX_SECTION_NAMES_SIZE ] = { 0 };
+    _Section segments[ _MAX_SEGMENTS ] = { 0 };
+    RU32 namesSize = 0;
+    RU32 nSegments = 0;
+    RU32 nSections = 0;
+    RU64 phOffset = 0;
+    RU64 shOffset = 0;
+    RU32 phEntSize = 0;
+    RU32 phNum = 0;
+    RU32 shEntSize = 0;
+    RU32 shNum = 0;
+    RU32 shStrIndex = 0;
+    RU64 dynOffset = 0;
+    RU64 dynSize = 0;
+    RU32 type = 0;
+    RU32 flags = 0;
+    RU32 i = 0;
+    RU32 j = 0;
+    RU32 k = 0;
+
+    if( !_readAt( r, 0, 16, hdr ) ||
+        ( 1 != hdr[ 4 ] && 2 != hdr[ 4 ] ) ||
+        ( 1 != hdr[ 5 ] && 2 != hdr[ 5 ] ) )
+    {
+        return FALSE;
+    }
+
+    r->is64 = ( 2 == hdr[ 4 ] );
+    r->isBigEndian = ( 2 == hdr[ 5 ] );
+
+    if( !_readAt( r, 16, r->is64 ? 48 : 36, hdr + 16 ) )
+    {
+        return FALSE;
+    }
+
+    pMeta->format = HBS_CODE_META_FORMAT_ELF;
+
+    switch( _u16( r, hdr + 18 ) )
+    {
+        case 3: pMeta->arch = HBS_CODE_META_ARCH_X86; break;
+        case 62: pMeta->arch = HBS_CODE_META_ARCH_X64; break;
+        case 40: pMeta->arch = HBS_CODE_META_ARCH_ARM; break;
+        case 183: pMeta->arch = HBS_CODE_META_ARCH_ARM64; break;
+        default: break;
+    }
+
+    if( r->is64 )
+    {
+        phOffset = _u64( r, hdr + 32 );
+        shOffset = _u64( r, hdr + 40 );
+        phEntSize = _u16( r, hdr + 54 );
+        phNum = _u16( r, hdr + 56 );
+        shEntSize = _u16( r, hdr + 58 );
+        shNum = _u16( r, hdr + 60 );
+        shStrIndex = _u16( r, hdr + 62 );
+    }
+    else
+    {
+        phOffset = _u32( r, hdr + 28 );
+        shOffset = _u32( r, hdr + 32 );
+        phEntSize = _u16( r, hdr + 42 );
+        phNum = _u16( r, hdr + 44 );
+        shEntSize = _u16( r, hdr + 46 );
+        shNum = _u16( r, hdr + 48 );
+        shStrIndex = _u16( r, hdr + 50 );
+    }
+
+    // Program headers give the loadable segments, the notes and the dynamic table.
+    if( ( r->is64 ? 56 : 32 ) <= phEntSize )
+    {
+        for( i = 0; i < MIN_OF( phNum, _MAX_SEGMENTS ); i++ )
+        {
+            if( !_readAt( r, phOffset + ( (RU64)i * phEntSize ), r->is64 ? 56 : 32, raw ) )
+            {
+                break;
+            }
+
+            type = _u32( r, raw );
+
+            if( 1 == type )
+            {
+                rpal_memory_zero( &segments[ nSegments ], sizeof( segments[ nSegments ] ) );
+                flags = _u32( r, raw + ( r->is64 ? 4 : 24 ) );
+                segments[ nSegments ].offset = r->is64 ? _u64( r, raw + 8 ) : _u32( r, raw + 4 );
+                segments[ nSegments ].address = r->is64 ? _u64( r, raw + 16 ) : _u32( r, raw + 8 );
+                segments[ nSegments ].size = r->is64 ? _u64( r, raw + 32 ) : _u32( r, raw + 16 );
+                segments[ nSegments ].addressSize = segments[ nSegments ].size;
+                segments[ nSegments ].isExec = IS_FLAG_ENABLED( flags, 1 );
+                segments[ nSegments ].isWrite = IS_FLAG_ENABLED( flags, 2 );
+                nSegments++;
+            }
+            else if( 2 == type )
+            {
+                dynOffset = r->is64 ? _u64( r, raw + 8 ) : _u32( r, raw + 4 );
+                dynSize = r->is64 ? _u64( r, raw + 32 ) : _u32( r, raw + 16 );
+            }
+            else if( 4 == type &&
+                     0 == pMeta->buildIdSize )
+            {
+                _parseElfNotes( r,
+                                pMeta,
+                                r->is64 ? _u64( r, raw + 8 ) : _u32( r, raw + 4 ),
+                                r->is64 ? _u64( r, raw + 32 ) : _u32( r, raw + 16 ) );
+            }
+        }
+    }
+
+    if( 0 != dynSize )
+    {
+        _parseElfDynamic( r, pMeta, dynOffset, dynSize, segments, nSegments );
+    }
+
+    // Section headers are optional at runtime, packers routinely drop them.
+    if( 0 == shOffset ||
+        0 == shNum ||
+        ( r->is64 ? 64 : 40 ) > shEntSize )
+    {
+        pMeta->packerFlags |= HBS_CODE_META_PACKER_NO_SECTIONS;
+        pMeta->nSections = 0;
+        _analyzeSections( r, pMeta, segments, nSegments );
+        return TRUE;
+    }
+
+    pMeta->nSections = (RU16)shNum;
+
+    if( shStrIndex < shNum &&
+        _readAt( r, shOffset + ( (RU64)shStrIndex * shEntSize ), r->is64 ? 64 : 40, raw ) )
+    {
+        namesSize = _readUpTo( r,
+                               r->is64 ? _u64( r, raw + 24 ) : _u32( r, raw + 16 ),
+                               (RU32)MIN_OF( r->is64 ? _u64( r, raw + 32 ) : _u32( r, raw + 20 ),
+                                             sizeof( names ) - 1 ),
+                               names );
+        names[ namesSize ] = 0;
+    }
+
+    for( i = 0; i < MIN_OF( shNum, _MAX_SECTIONS ); i++ )
+    {
+        if( !_readAt( r, shOffset + ( (RU64)i * shEntSize ), r->is64 ? 64 : 40, raw ) )
+        {
+            break;
+        }
+
+        type = _u32( r, raw + 4 );
+
+        // Skip SHT_NULL and SHT_NOBITS, they have nothing in the file.
+        if( 0 == type || 8 == type )
+        {
+            continue;
+        }
+
+        rpal_memory_zero( &sections[ nSections ], sizeof( sections[ nSections ] ) );
+
+        for( j = _u32( r, raw ), k = 0;
+             j < namesSize && 0 != names[ j ] && k < sizeof( sections[ nSections ].name ) - 1;
+             j++, k++ )
+        {
+            sections[ nSections ].name[ k ] = names[ j ];
+        }
+
+        flags = (RU32)_uWord( r, raw + 8 );
+        sections[ nSections ].address = _uWord( r, raw + ( r->is64 ? 16 : 12 ) );
+        sections[ nSections ].offset = _uWord( r, raw + ( r->is64 ? 24 : 16 ) );
+        sections[ nSections ].size = _uWord( r, raw + ( r->is64 ? 32 : 20 ) );
+        sections[ nSections ].addressSize = sections[ nSections ].size;
+        sections[ nSections ].isExec = IS_FLAG_ENABLED( flags, 4 );
+        sections[ nSections ].isWrite = IS_FLAG_ENABLED( flags, 1 );
+        nSections++;
+    }
+
+    _analyzeSections( r, pMeta, sections, nSections );
+
+    return TRUE;
+}
+
+//=============================================================================
+//  Mach-O
+//=============================================================================
+RPRIVATE
+RBOOL
+    _parseMachO
+    (
+        _Reader* r,
+        HbsCodeMeta* pMeta,
+        _Section* sections
+    )
+{
+    RU8 hdr[ 32 ] = { 0 };
+    RPU8 commands = NULL;
+    RU32 commandsSize = 0;
+    RU32 headerSize = 0;
+    RU32 nCommands = 0;
+    RU32 offset = 0;
+    RU32 cmd = 0;
+    RU32 cmdSize = 0;
+    RU32 nameOffset = 0;
+    RU32 nSections = 0;
+    RU32 nSegSections = 0;
+    RU32 sectionSize = 0;
+    RU32 segHeaderSize = 0;
+    RU32 initProt = 0;
+    RU32 sectionFlags = 0;
+    RPU8 sect = NULL;
+    RU32 i = 0;
+    RU32 j = 0;
+
+    if( !_readAt( r, 0, sizeof( RU32 ), hdr ) )
+    {
+        return FALSE;
+    }
+
+    // Universal binaries are always big endian, report on the first slice.
+    if( 0xCA == hdr[ 0 ] && 0xFE == hdr[ 1 ] && 0xBA == hdr[ 2 ] && 0xBE == hdr[ 3 ] )
+    {
+        r->isBigEndian = TRUE;
+
+        if( !_readAt( r, 4, 12, hdr ) ||
+            0 == _u32( r, hdr ) ||
+            20 < _u32( r, hdr ) ||
+            r->size <= _u32( r, hdr + 12 ) )
+        {
+            return FALSE;
+        }
+
+        r->base = _u32( r, hdr + 12 );
+        r->size -= r->base;
+
+        if( !_readAt( r, 0, sizeof( RU32 ), hdr ) )
+        {
+            return FALSE;
+        }
+    }
+
+    r->isBigEndian = FALSE;
+
+    switch( _u32( r, hdr ) )
+    {
+        case 0xFEEDFACE: break;
+        case 0xFEEDFACF: r->is64 = TRUE; break;
+        case 0xCEFAEDFE: r->isBigEndian = TRUE; break;
+        case 0xCFFAEDFE: r->isBigEndian = TRUE; r->is64 = TRUE; break;
+        default: return FALSE;
+    }
+
+    headerSize = r->is64 ? 32 : 28;
+
+    if( !_readAt( r, 0, headerSize, hdr ) )
+    {
+        return FALSE;
+    }
+
+    pMeta->format = HBS_CODE_META_FORMAT_MACHO;
+
+    switch( _u32( r, hdr + 4 ) )
+    {
+        case 7: pMeta->arch = HBS_CODE_META_ARCH_X86; break;
+        case 0x01000007: pMeta->arch = HBS_CODE_META_ARCH_X64; break;
+        case 12: pMeta->arch = HBS_CODE_META_ARCH_ARM; break;
+        case 0x0100000C: pMeta->arch = HBS_CODE_META_ARCH_ARM64; break;
+        default: break;
+    }
+
+    nCommands = _u32( r, hdr + 16 );
+    commandsSize = MIN_OF( _u32( r, hdr + 20 ), _MAX_COMMANDS_SIZE );
+
+    if( NULL == ( commands = rpal_memory_alloc( commandsSize + 1 ) ) )
+    {
+        return TRUE;
+    }
+
+    commandsSize = _readUpTo( r, headerSize, commandsSize, commands );
+    segHeaderSize = r->is64 ? 72 : 56;
+    sectionSize = r->is64 ? 80 : 68;
+
+    for( i = 0; i < nCommands && offset + 8 <= commandsSize; i++ )
+    {
+        cmd = _u32( r, commands + offset );
+        cmdSize = _u32( r, commands + offset + 4 );
+
+        if( 8 > cmdSize ||
+            cmdSize > commandsSize - offset )
+        {
+            break;
+        }
+
+        if( 0x1B == cmd &&
+            24 <= cmdSize )
+        {
+            _setBuildId( pMeta, commands + offset + 8, 16 );
+        }
+        else if( 0x0C == cmd ||
+                 0x20 == cmd ||
+                 0x80000018 == cmd ||
+                 0x8000001F == cmd ||
+                 0x80000023 == cmd )
+        {
+            // The dylib name is NULL terminated within the command.
+            nameOffset = _u32( r, commands + offset + 8 );
+            for( j = nameOffset; j < cmdSize && 0 != commands[ offset + j ]; j++ );
+            if( j < cmdSize &&
+                j != nameOffset )
+            {
+                _addImport( pMeta, (RPCHAR)commands + offset + nameOffset );
+            }
+        }
+        else if( ( r->is64 ? 0x19 : 0x01 ) == cmd &&
+                 segHeaderSize <= cmdSize )
+        {
+            initProt = _u32( r, commands + offset + ( r->is64 ? 60 : 44 ) );
+            nSegSections = _u32( r, commands + offset + ( r->is64 ? 64 : 48 ) );
+            pMeta->nSections += (RU16)nSegSections;
+
+            for( j = 0;
+                 j < nSegSections &&
+                 _MAX_SECTIONS > nSections &&
+                 segHeaderSize + ( ( j + 1 ) * sectionSize ) <= cmdSize;
+                 j++ )
+            {
+                sect = commands + offset + segHeaderSize + ( j * sectionSize );
+                sectionFlags = _u32( r, sect + ( r->is64 ? 64 : 56 ) );
+
+                rpal_memory_zero( &sections[ nSections ], sizeof( sections[ nSections ] ) );
+                rpal_memory_memcpy( sections[ nSections ].name, sect, 16 );
+                sections[ nSections ].address = _uWord( r, sect + 32 );
+                sections[ nSections ].offset = _u32( r, sect + ( r->is64 ? 48 : 40 ) );
+                sections[ nSections ].isExec = IS_FLAG_ENABLED( sectionFlags, 0x80000400 );
+                sections[ nSections ].isWrite = IS_FLAG_ENABLED( initProt, 2 );
+
+                // Zero fill sections have no data in the file.
+                if( 0x01 != ( sectionFlags & 0xFF ) &&
+                    0x0C != ( sectionFlags & 0xFF ) &&
+                    0x12 != ( sectionFlags & 0xFF ) )
+                {
+                    sections[ nSections ].size = r->is64 ? _u64( r, sect + 40 ) : _u32( r, sect + 36 );
+                }
+
+                sections[ nSections ].addressSize = sections[ nSections ].size;
+                nSections++;
+            }
+        }
+
+        offset += cmdSize;
+    }
+
+    rpal_memory_free( commands );
+
+    _analyzeSections( r, pMeta, sections, nSections );
+
+    return TRUE;
+}
+
+//=============================================================================
+//  API
+//=============================================================================
+RPRIVATE
+RBOOL
+    _parse
+    (
+        _Reader* r,
+        HbsCodeMeta* pMeta
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RU8 magic[ 4 ] = { 0 };
+    _Section* sections = NULL;
+
+    rpal_memory_zero( pMeta, sizeof( *pMeta ) );
+
+    if( !_readAt( r, 0, sizeof( magic ), magic ) ||
+        NULL == ( sections = rpal_memory_alloc( sizeof( *sections ) * _MAX_SECTIONS ) ) )
+    {
+        return FALSE;
+    }
+
+    if( 'M' == magic[ 0 ] && 'Z' == magic[ 1 ] )
+    {
+        isSuccess = _parsePe( r, pMeta, sections );
+    }
+    else if( 0x7F == magic[ 0 ] && 'E' == magic[ 1 ] && 'L' == magic[ 2 ] && 'F' == magic[ 3 ] )
+    {
+        isSuccess = _parseElf( r, pMeta, sections );
+    }
+    else
+    {
+        isSuccess = _parseMachO( r, pMeta, sections );
+    }
+
+    rpal_memory_free( sections );
+
+    if( isSuccess )
+    {
+        _evaluatePacker( pMeta );
+    }
+
+    return isSuccess;
+}
+
+RBOOL
+    HbsCodeMeta_parseFile
+    (
+        RPNCHAR filePath,
+        HbsCodeMeta* pMeta
+    )
+{
+    RBOOL isSuccess = FALSE;
+    _Reader r = { 0 };
+
+    if( NULL != filePath &&
+        NULL != pMeta )
+    {
+        if( rFile_open( filePath, &r.hFile, RPAL_FILE_OPEN_READ |
+                                            RPAL_FILE_OPEN_EXISTING |
+                                            RPAL_FILE_OPEN_AVOID_TIMESTAMPS ) )
+        {
+            r.budget = _IO_BUDGET;
+            r.size = rFile_seek( r.hFile, 0, rFileSeek_END );
+
+            if( (RU64)(-1) != r.size &&
+                (RU32)(-1) != r.size )
+            {
+                isSuccess = _parse( &r, pMeta );
+            }
+
+            rFile_close( r.hFile );
+        }
+    }
+
+    return isSuccess;
+}
+
+RBOOL
+    HbsCodeMeta_parseBuffer
+    (
+        RPU8 buffer,
+        RU32 bufferSize,
+        HbsCodeMeta* pMeta
+    )
+{
+    RBOOL isSuccess = FALSE;
+    _Reader r = { 0 };
+
+    if( NULL != buffer &&
+        NULL != pMeta )
+    {
+        r.buffer = buffer;
+        r.size = bufferSize;
+        r.budget = _IO_BUDGET;
+
+        isSuccess = _parse( &r, pMeta );
+    }
+
+    return isSuccess;
+}
+
+RBOOL
+    HbsCodeMeta_toSequence
+    (
+        HbsCodeMeta* pMeta,
+        rSequence seq
+    )
+{
+    RBOOL isSuccess = FALSE;
+    rList imports = NULL;
+    RU32 i = 0;
+
+    if( NULL != pMeta &&
+        NULL != seq &&
+        HBS_CODE_META_FORMAT_UNKNOWN != pMeta->format )
+    {
+        isSuccess = rSequence_addRU8( seq, RP_TAGS_BINARY_FORMAT, pMeta->format ) &&
+                    rSequence_addRU8( seq, RP_TAGS_ARCHITECTURE, pMeta->arch ) &&
+                    rSequence_addRU32( seq, RP_TAGS_SECTION_COUNT, pMeta->nSections ) &&
+                    rSequence_addRU32( seq, RP_TAGS_HIGH_ENTROPY_SECTIONS, pMeta->nHighEntropySections ) &&
+                    rSequence_addRU32( seq, RP_TAGS_MAX_SECTION_ENTROPY, pMeta->maxEntropy ) &&
+                    rSequence_addRU32( seq, RP_TAGS_PACKER_FLAGS, pMeta->packerFlags ) &&
+                    rSequence_addRU8( seq, RP_TAGS_IS_PACKED, pMeta->isPacked );
+
+        if( isSuccess &&
+            0 != pMeta->buildIdSize )
+        {
+            isSuccess = rSequence_addBUFFER( seq, RP_TAGS_BUILD_ID, pMeta->buildId, pMeta->buildIdSize );
+        }
+
+        if( isSuccess &&
+            0 != pMeta->importsSize &&
+            NULL != ( imports = rList_new( RP_TAGS_MODULE_NAME, RPCM_STRINGA ) ) )
+        {
+            while( i < pMeta->importsSize )
+            {
+                rList_addSTRINGA( imports, pMeta->imports + i );
+                i += rpal_string_strlenA( pMeta->imports + i ) + 1;
+            }
+
+            if( !rSequence_addLIST( seq, RP_TAGS_IMPORTS, imports ) )
+            {
+                rList_free( imports );
+            }
+        }
+
+        if( isSuccess &&
+            pMeta->isImportsTruncated )
+        {
+            rSequence_addRU8( seq, RP_TAGS_IS_TRUNCATED, TRUE );
+        }
+    }
+
+    return isSuccess;
+}
@@ -0,0 +1,93 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _HBS_CODE_META_H
+#define _HBS_CODE_META_H
+
+#include <rpal.h>
+#include <librpcm/librpcm.h>
+
+//=============================================================================
+//  Header level metadata of executables (PE, ELF and Mach-O) reported with
+//  code identity. Only the headers and a few selected tables are read, every
+//  read is bounded and the total I/O per file is capped, so parsing a huge or
+//  malformed file stays cheap. The result is a fixed size structure meant to
+//  be cached alongside the code identity.
+//=============================================================================
+#define HBS_CODE_META_FORMAT_UNKNOWN        0
+#define HBS_CODE_META_FORMAT_PE             1
+#define HBS_CODE_META_FORMAT_ELF            2
+#define HBS_CODE_META_FORMAT_MACHO          3
+
+#define HBS_CODE_META_ARCH_UNKNOWN          0
+#define HBS_CODE_META_ARCH_X86              1
+#define HBS_CODE_META_ARCH_X64              2
+#define HBS_CODE_META_ARCH_ARM              3
+#define HBS_CODE_META_ARCH_ARM64            4
+
+// Reasons contributing to the packer heuristic.
+#define HBS_CODE_META_PACKER_HIGH_ENTROPY   0x00000001
+#define HBS_CODE_META_PACKER_WRITABLE_CODE  0x00000002
+#define HBS_CODE_META_PACKER_SECTION_NAME   0x00000004
+#define HBS_CODE_META_PACKER_FEW_IMPORTS    0x00000008
+#define HBS_CODE_META_PACKER_NO_SECTIONS    0x00000010
+
+#define HBS_CODE_META_MAX_BUILD_ID_SIZE     32
+#define HBS_CODE_META_MAX_IMPORTS_SIZE      512
+
+typedef struct
+{
+    RU8 format;
+    RU8 arch;
+    RU8 isPacked;
+    RU8 isImportsTruncated;
+    RU32 packerFlags;
+    // GNU build-id for ELF, CodeView GUID and age for PE, LC_UUID for Mach-O.
+    RU8 buildIdSize;
+    RU8 buildId[ HBS_CODE_META_MAX_BUILD_ID_SIZE ];
+    RU16 nSections;
+    RU16 nHighEntropySections;
+    // Shannon entropy in hundredths of a bit per byte.
+    RU16 maxEntropy;
+    RU16 nImports;
+    // Imported library names, each one NULL terminated, back to back.
+    RU16 importsSize;
+    RCHAR imports[ HBS_CODE_META_MAX_IMPORTS_SIZE ];
+} HbsCodeMeta;
+
+RBOOL
+    HbsCodeMeta_parseFile
+    (
+        RPNCHAR filePath,
+        HbsCodeMeta* pMeta
+    );
+
+RBOOL
+    HbsCodeMeta_parseBuffer
+    (
+        RPU8 buffer,
+        RU32 bufferSize,
+        HbsCodeMeta* pMeta
+    );
+
+RBOOL
+    HbsCodeMeta_toSequence
+    (
+        HbsCodeMeta* pMeta,
+        rSequence seq
+    );
+
+#endif
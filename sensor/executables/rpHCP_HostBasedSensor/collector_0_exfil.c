@@ -19,6 +19,7 @@ limitations under the License.
 #include <rpal/rpal.h>
 #include <librpcm/librpcm.h>
 #include "collectors.h"
+#include "spool.h"
 #include <notificationsLib/notificationsLib.h>
 #include <rpHostCommonPlatformLib/rTags.h>
 
@@ -685,6 +686,8 @@ rpcm_tag collector_0_events[] = { RP_TAGS_NOTIFICATION_GET_EXFIL_EVENT_REP,
                                   RP_TAGS_NOTIFICATION_HISTORY_DUMP_REP,
                                   0 };
 
+RU32 collector_0_dependencies = 0;
+
 RBOOL
     collector_0_init
     ( 
@@ -1147,6 +1150,320 @@ HBS_DECLARE_TEST( history )
     }
 }
 
+RPRIVATE
+rList
+    _newSpoolTestFrame
+    (
+        RU32 frameId,
+        RU32 contentSize
+    )
+{
+    rList frame = NULL;
+    rSequence message = NULL;
+    RPU8 content = NULL;
+
+    if( NULL != ( frame = rList_new( RP_TAGS_MESSAGE, RPCM_SEQUENCE ) ) )
+    {
+        if( NULL != ( message = rSequence_new() ) )
+        {
+            rSequence_addRU32( message, RP_TAGS_HBS_NOTIFICATION_ID, frameId );
+
+            // Random content so compression can't make the records trivially small.
+            if( 0 != contentSize &&
+                NULL != ( content = rpal_memory_alloc( contentSize ) ) )
+            {
+                CryptoLib_genRandomBytes( content, contentSize );
+                rSequence_addBUFFER( message, RP_TAGS_FILE_CONTENT, content, contentSize );
+                rpal_memory_free( content );
+            }
+
+            if( !rList_addSEQUENCE( frame, message ) )
+            {
+                rSequence_free( message );
+            }
+        }
+    }
+
+    return frame;
+}
+
+RPRIVATE
+RBOOL
+    _readSpoolTestFrame
+    (
+        HbsSpool spool,
+        RU32* pFrameId
+    )
+{
+    RBOOL isRead = FALSE;
+    rList frame = NULL;
+    rSequence message = NULL;
+
+    if( HbsSpool_read( spool, &frame ) )
+    {
+        if( rList_getSEQUENCE( frame, RP_TAGS_MESSAGE, &message ) &&
+            rSequence_getRU32( message, RP_TAGS_HBS_NOTIFICATION_ID, pFrameId ) )
+        {
+            isRead = TRUE;
+        }
+
+        rList_free( frame );
+    }
+
+    return isRead;
+}
+
+HBS_DECLARE_TEST( spool )
+{
+    RPNCHAR spoolDir = _NC( "./hbs_test_spool" );
+    RPNCHAR segmentPath = _NC( "./hbs_test_spool/1.spl" );
+    RU8 tornRecord[] = { 0x40, 0x00, 0x00, 0x00, 0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x02 };
+    RU8 keyMaterial[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    RU8 otherKeyMaterial[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09 };
+    HbsSpool spool = NULL;
+    rList frame = NULL;
+    rFile hFile = NULL;
+    RU32 i = 0;
+    RU32 frameId = 0;
+    RU32 lastFrameId = 0;
+    RU32 segmentSize = 0;
+    RU32 nRead = 0;
+
+    rpal_file_delete( spoolDir, FALSE );
+
+    // Frames come back in the order they were written and only go
+    // away once committed.
+    if( HBS_ASSERT_TRUE( NULL != ( spool = HbsSpool_open( spoolDir, 1024 * 1024 * 10, keyMaterial, sizeof( keyMaterial ) ) ) ) )
+    {
+        HBS_ASSERT_TRUE( HbsSpool_isEmpty( spool ) );
+        HBS_ASSERT_FALSE( _readSpoolTestFrame( spool, &frameId ) );
+
+        for( i = 0; i < 10; i++ )
+        {
+            if( HBS_ASSERT_TRUE( NULL != ( frame = _newSpoolTestFrame( i, 0 ) ) ) )
+            {
+                HBS_ASSERT_TRUE( HbsSpool_write( spool, frame ) );
+                rList_free( frame );
+            }
+        }
+
+        HBS_ASSERT_FALSE( HbsSpool_isEmpty( spool ) );
+
+        HBS_ASSERT_TRUE( _readSpoolTestFrame( spool, &frameId ) );
+        HBS_ASSERT_TRUE( 0 == frameId );
+        HBS_ASSERT_TRUE( _readSpoolTestFrame( spool, &frameId ) );
+        HBS_ASSERT_TRUE( 0 == frameId );
+
+        for( i = 0; i < 5; i++ )
+        {
+            HBS_ASSERT_TRUE( _readSpoolTestFrame( spool, &frameId ) );
+            HBS_ASSERT_TRUE( i == frameId );
+            HBS_ASSERT_TRUE( HbsSpool_commit( spool ) );
+        }
+
+        HbsSpool_close( spool );
+    }
+
+    // A record torn by a crash is cut on startup and the replay position
+    // from the clean shutdown is kept.
+    segmentSize = rpal_file_getSize( segmentPath, FALSE );
+    if( HBS_ASSERT_TRUE( rFile_open( segmentPath, &hFile, RPAL_FILE_OPEN_ALWAYS | RPAL_FILE_OPEN_WRITE ) ) )
+    {
+        rFile_seek( hFile, 0, rFileSeek_END );
+        HBS_ASSERT_TRUE( rFile_write( hFile, sizeof( tornRecord ), tornRecord ) );
+        rFile_close( hFile );
+    }
+    HBS_ASSERT_TRUE( segmentSize + sizeof( tornRecord ) == rpal_file_getSize( segmentPath, FALSE ) );
+
+    if( HBS_ASSERT_TRUE( NULL != ( spool = HbsSpool_open( spoolDir, 1024 * 1024 * 10, keyMaterial, sizeof( keyMaterial ) ) ) ) )
+    {
+        HBS_ASSERT_TRUE( segmentSize == rpal_file_getSize( segmentPath, FALSE ) );
+
+        if( HBS_ASSERT_TRUE( NULL != ( frame = _newSpoolTestFrame( 10, 0 ) ) ) )
+        {
+            HBS_ASSERT_TRUE( HbsSpool_write( spool, frame ) );
+            rList_free( frame );
+        }
+
+        for( i = 5; i <= 10; i++ )
+        {
+            HBS_ASSERT_TRUE( _readSpoolTestFrame( spool, &frameId ) );
+            HBS_ASSERT_TRUE( i == frameId );
+            HBS_ASSERT_TRUE( HbsSpool_commit( spool ) );
+        }
+
+        HBS_ASSERT_FALSE( _readSpoolTestFrame( spool, &frameId ) );
+        HBS_ASSERT_TRUE( HbsSpool_isEmpty( spool ) );
+        HBS_ASSERT_TRUE( 0 == HbsSpool_getSize( spool ) );
+
+        HbsSpool_close( spool );
+    }
+
+    rpal_file_delete( spoolDir, FALSE );
+
+    // Going over the disk budget evicts the oldest frames first.
+    if( HBS_ASSERT_TRUE( NULL != ( spool = HbsSpool_open( spoolDir, 1024 * 1024 * 3, keyMaterial, sizeof( keyMaterial ) ) ) ) )
+    {
+        for( i = 0; i < 100; i++ )
+        {
+            if( HBS_ASSERT_TRUE( NULL != ( frame = _newSpoolTestFrame( i, 1024 * 64 ) ) ) )
+            {
+                HBS_ASSERT_TRUE( HbsSpool_write( spool, frame ) );
+                rList_free( frame );
+            }
+
+            HBS_ASSERT_TRUE( 1024 * 1024 * 3 >= HbsSpool_getSize( spool ) );
+        }
+
+        HBS_ASSERT_TRUE( _readSpoolTestFrame( spool, &frameId ) );
+        HBS_ASSERT_TRUE( 0 != frameId );
+        lastFrameId = frameId;
+        HBS_ASSERT_TRUE( HbsSpool_commit( spool ) );
+        nRead = 1;
+
+        while( _readSpoolTestFrame( spool, &frameId ) )
+        {
+            HBS_ASSERT_TRUE( lastFrameId + 1 == frameId );
+            lastFrameId = frameId;
+            HbsSpool_commit( spool );
+            nRead++;
+        }
+
+        HBS_ASSERT_TRUE( 99 == lastFrameId );
+        HBS_ASSERT_TRUE( 30 < nRead );
+
+        HbsSpool_close( spool );
+    }
+
+    rpal_file_delete( spoolDir, FALSE );
+
+    // Frames can only be read back with the key material they were written
+    // with, anything else is discarded.
+    if( HBS_ASSERT_TRUE( NULL != ( spool = HbsSpool_open( spoolDir, 1024 * 1024 * 10, keyMaterial, sizeof( keyMaterial ) ) ) ) )
+    {
+        for( i = 0; i < 3; i++ )
+        {
+            if( HBS_ASSERT_TRUE( NULL != ( frame = _newSpoolTestFrame( i, 0 ) ) ) )
+            {
+                HBS_ASSERT_TRUE( HbsSpool_write( spool, frame ) );
+                rList_free( frame );
+            }
+        }
+
+        HbsSpool_close( spool );
+    }
+
+    if( HBS_ASSERT_TRUE( NULL != ( spool = HbsSpool_open( spoolDir, 1024 * 1024 * 10, otherKeyMaterial, sizeof( otherKeyMaterial ) ) ) ) )
+    {
+        HBS_ASSERT_FALSE( _readSpoolTestFrame( spool, &frameId ) );
+        HBS_ASSERT_TRUE( HbsSpool_isEmpty( spool ) );
+
+        if( HBS_ASSERT_TRUE( NULL != ( frame = _newSpoolTestFrame( 3, 0 ) ) ) )
+        {
+            HBS_ASSERT_TRUE( HbsSpool_write( spool, frame ) );
+            rList_free( frame );
+        }
+
+        HBS_ASSERT_TRUE( _readSpoolTestFrame( spool, &frameId ) );
+        HBS_ASSERT_TRUE( 3 == frameId );
+
+        HbsSpool_close( spool );
+    }
+
+    rpal_file_delete( spoolDir, FALSE );
+}
+
+#define _STARTUP_TEST_FAILING_COLLECTOR  3
+
+RPRIVATE volatile RU32 g_startup_sequence = 0;
+RPRIVATE RU32 g_startup_started[ 10 ] = { 0 };
+RPRIVATE RU32 g_startup_ended[ 10 ] = { 0 };
+
+RPRIVATE
+RBOOL
+    _fakeCollectorInit
+    (
+        HbsState* hbsState,
+        rSequence config
+    )
+{
+    RU32 collectorId = 0;
+
+    UNREFERENCED_PARAMETER( hbsState );
+
+    if( !rSequence_getRU32( config, RP_TAGS_COLLECTOR_ID, &collectorId ) ||
+        ARRAY_N_ELEM( g_startup_started ) <= collectorId )
+    {
+        return FALSE;
+    }
+
+    g_startup_started[ collectorId ] = rInterlocked_increment32( &g_startup_sequence );
+    rpal_thread_sleep( 200 );
+    g_startup_ended[ collectorId ] = rInterlocked_increment32( &g_startup_sequence );
+
+    return _STARTUP_TEST_FAILING_COLLECTOR != collectorId;
+}
+
+HBS_DECLARE_TEST( collectorStartup )
+{
+    HbsState* state = NULL;
+    RU32 dependencies[ ARRAY_N_ELEM( state->collectors ) ] = { 0 };
+    RU32 i = 0;
+
+    // 1 and 2 depend on 0 and can start together, 3 fails but 4 still
+    // starts after it, 5 and 6 are circular and 7 depends on the disabled 8.
+    dependencies[ 1 ] = COLLECTOR_DEPENDENCY( 0 );
+    dependencies[ 2 ] = COLLECTOR_DEPENDENCY( 0 );
+    dependencies[ 3 ] = COLLECTOR_DEPENDENCY( 1 ) | COLLECTOR_DEPENDENCY( 2 );
+    dependencies[ 4 ] = COLLECTOR_DEPENDENCY( 3 );
+    dependencies[ 5 ] = COLLECTOR_DEPENDENCY( 6 );
+    dependencies[ 6 ] = COLLECTOR_DEPENDENCY( 5 );
+    dependencies[ 7 ] = COLLECTOR_DEPENDENCY( 8 );
+
+    if( HBS_ASSERT_TRUE( NULL != ( state = rpal_memory_alloc( sizeof( *state ) ) ) ) )
+    {
+        rpal_memory_zero( state, sizeof( *state ) );
+
+        for( i = 0; i < ARRAY_N_ELEM( state->collectors ); i++ )
+        {
+            state->collectors[ i ].isEnabled = ( 8 > i );
+            state->collectors[ i ].init = _fakeCollectorInit;
+            state->collectors[ i ].dependencies = &dependencies[ i ];
+            if( NULL != ( state->collectors[ i ].conf = rSequence_new() ) )
+            {
+                rSequence_addRU32( state->collectors[ i ].conf, RP_TAGS_COLLECTOR_ID, i );
+            }
+        }
+
+        HBS_ASSERT_FALSE( hbs_initCollectors( state, 4 ) );
+
+        for( i = 0; i < 8; i++ )
+        {
+            HBS_ASSERT_TRUE( 0 != g_startup_started[ i ] );
+            HBS_ASSERT_TRUE( 100 <= state->collectors[ i ].initTime );
+            HBS_ASSERT_TRUE( ( _STARTUP_TEST_FAILING_COLLECTOR == i ) == state->collectors[ i ].isInitFailed );
+        }
+        HBS_ASSERT_TRUE( 0 == g_startup_started[ 8 ] );
+        HBS_ASSERT_TRUE( 0 == state->collectors[ 8 ].initTime );
+
+        HBS_ASSERT_TRUE( g_startup_ended[ 0 ] < g_startup_started[ 1 ] );
+        HBS_ASSERT_TRUE( g_startup_ended[ 0 ] < g_startup_started[ 2 ] );
+        HBS_ASSERT_TRUE( g_startup_ended[ 1 ] < g_startup_started[ 3 ] );
+        HBS_ASSERT_TRUE( g_startup_ended[ 2 ] < g_startup_started[ 3 ] );
+        HBS_ASSERT_TRUE( g_startup_ended[ 3 ] < g_startup_started[ 4 ] );
+
+        // Independent collectors initialize concurrently.
+        HBS_ASSERT_TRUE( g_startup_started[ 1 ] < g_startup_ended[ 2 ] &&
+                         g_startup_started[ 2 ] < g_startup_ended[ 1 ] );
+
+        for( i = 0; i < ARRAY_N_ELEM( state->collectors ); i++ )
+        {
+            rSequence_free( state->collectors[ i ].conf );
+        }
+        rpal_memory_free( state );
+    }
+}
+
 HBS_TEST_SUITE( 0 )
 {
     RBOOL isSuccess = FALSE;
@@ -1156,6 +1473,8 @@ HBS_TEST_SUITE( 0 )
     {
         HBS_RUN_TEST( adhocExfil );
         HBS_RUN_TEST( history );
+        HBS_RUN_TEST( spool );
+        HBS_RUN_TEST( collectorStartup );
 
         isSuccess = TRUE;
     }
@@ -23,6 +23,119 @@ limitations under the License.
 
 #define RPAL_FILE_ID                            65
 
+// Strings longer than this are never reported.
+#define _MAX_STRING_LENGTH                      128
+
+// Handle listings are cached between tasks so repeated ones only resolve
+// the handles that are new since the last time.
+RPRIVATE processLibHandleCache g_handleCache = NULL;
+
+typedef struct
+{
+    rList stringsAList;
+    rList stringsWList;
+} _StringsListContext;
+
+typedef struct
+{
+    RU32 hash;
+    RU32 length;
+    RPWCHAR str;
+} _LiteralString;
+
+// Search strings without wildcards are looked up by hash, the
+// ones with wildcards still need to be matched one by one.
+typedef struct
+{
+    _LiteralString* literals;
+    RU32 nSlots;
+    RPWCHAR* patterns;
+    RU32 nPatterns;
+} _SearchSet;
+
+typedef struct
+{
+    rList stringsFound;
+    _SearchSet* searchSet;
+    RU64 baseAddr;
+} _SearchContext;
+
+#define _HASH_INIT          0x811C9DC5
+#define _HASH_STEP(h,c)     ( ( (h) ^ (RU32)(c) ) * 0x01000193 )
+
+// Copy a span into a NULL terminated wide string, the span
+// must not be longer than _MAX_STRING_LENGTH.
+RPRIVATE
+RVOID
+    _spanToWide
+    (
+        RPU8 pBuff,
+        rpal_string_span* span,
+        RWCHAR out[ _MAX_STRING_LENGTH + 1 ]
+    )
+{
+    RU32 i = 0;
+    RPU8 pStr = pBuff + span->offset;
+
+    for( i = 0; i < span->length; i++ )
+    {
+        // Printable UTF-16LE units have a zero high byte.
+        out[ i ] = (RWCHAR)( RPAL_STRING_EXTRACT_UTF16LE == span->encoding ? pStr[ i * 2 ] : pStr[ i ] );
+    }
+
+    out[ i ] = 0;
+}
+
+RPRIVATE
+RBOOL
+    _isNullTerminated
+    (
+        RPU8 pBuff,
+        rpal_string_span* span
+    )
+{
+    RBOOL isTerminated = FALSE;
+
+    if( RPAL_STRING_EXTRACT_UTF16LE == span->encoding )
+    {
+        isTerminated = ( 0 == *(RPU16)( pBuff + span->offset + ( span->length * 2 ) ) );
+    }
+    else
+    {
+        isTerminated = ( 0 == pBuff[ span->offset + span->length ] );
+    }
+
+    return isTerminated;
+}
+
+RPRIVATE
+RBOOL
+    _addToStringsList
+    (
+        _StringsListContext* ctx,
+        RPU8 pBuff,
+        rpal_string_span* span
+    )
+{
+    RWCHAR tmpStr[ _MAX_STRING_LENGTH + 1 ] = { 0 };
+
+    // currently we only deal with NULL terminated strings
+    if( _isNullTerminated( pBuff, span ) )
+    {
+        if( RPAL_STRING_EXTRACT_ASCII == span->encoding )
+        {
+            rList_addSTRINGA( ctx->stringsAList, (RPCHAR)( pBuff + span->offset ) );
+        }
+        else
+        {
+            _spanToWide( pBuff, span, tmpStr );
+            rList_addSTRINGW( ctx->stringsWList, tmpStr );
+        }
+    }
+
+    return TRUE;
+}
+
 RPRIVATE
 RVOID
     _getStringsList
@@ -35,207 +148,229 @@ RVOID
         RU32 maxLength
     )
 {
-    RPU8 pCurr;
-    RPU8 pEnd;
-    RPCHAR pStartStr = NULL;
-    RBOOL isChar;
-    RPU16 pwCurr;
-    RPU16 pwEnd;
-    RBOOL isWChar;
-    RPWCHAR pwStartStr = NULL;
-
-    pCurr = pBuff;
-    pEnd = pBuff + size;
+    _StringsListContext ctx = { 0 };
+
+    ctx.stringsAList = stringsAList;
+    ctx.stringsWList = stringsWList;
+
+    rpal_string_extractSpans( pBuff, 
+                              size, 
+                              RPAL_STRING_EXTRACT_ASCII | RPAL_STRING_EXTRACT_UTF16LE, 
+                              minLength, 
+                              MIN_OF( maxLength, _MAX_STRING_LENGTH ), 
+                              (rpal_string_span_f)_addToStringsList, 
+                              &ctx );
+}
 
-    // currently we only deal with NULL terminated strings
-    // start with ascii strings...
-    while( pCurr < pEnd )
+RPRIVATE
+RVOID
+    _freeSearchSet
+    (
+        _SearchSet* set
+    )
+{
+    if( NULL != set )
+    {
+        rpal_memory_free( set->literals );
+        rpal_memory_free( set->patterns );
+        rpal_memory_free( set );
+    }
+}
+
+RPRIVATE
+_SearchSet*
+    _newSearchSet
+    (
+        rList searchStrings
+    )
+{
+    _SearchSet* set = NULL;
+    RPWCHAR strVal = NULL;
+    RU32 nStrings = 0;
+    RU32 hash = 0;
+    RU32 length = 0;
+    RU32 slot = 0;
+    RBOOL isPattern = FALSE;
+
+    if( NULL != searchStrings &&
+        NULL != ( set = rpal_memory_alloc( sizeof( *set ) ) ) )
     {
-        isChar = rpal_string_isprintA( *pCurr );
+        nStrings = rList_getNumElements( searchStrings );
+
+        // Keep the table at most half full.
+        set->nSlots = 16;
+        while( set->nSlots < nStrings * 2 )
+        {
+            set->nSlots *= 2;
+        }
 
-        if( NULL == pStartStr && isChar )  // found the begining of a string
+        if( NULL == ( set->literals = rpal_memory_alloc( sizeof( *set->literals ) * set->nSlots ) ) ||
+            NULL == ( set->patterns = rpal_memory_alloc( sizeof( *set->patterns ) * ( nStrings + 1 ) ) ) )
         {
-            pStartStr = (RPCHAR)pCurr;
+            _freeSearchSet( set );
+            return NULL;
         }
-        else if( NULL != pStartStr && ( !isChar || 0 == *pCurr ) ) // found the end of a string
+
+        rList_resetIterator( searchStrings );
+        while( rList_getSTRINGW( searchStrings, RP_TAGS_STRING, &strVal ) )
         {
-            // is string NULL terminated
-            if( 0 == *pCurr )
+            hash = _HASH_INIT;
+            isPattern = FALSE;
+
+            for( length = 0; 0 != strVal[ length ]; length++ )
             {
-                // strlen is really pCurr - pStartStr
-                if( (RU32)( (RPCHAR)pCurr - pStartStr ) >= minLength &&
-                    (RU32)( (RPCHAR)pCurr - pStartStr ) <= maxLength ) // is string long enough
+                if( _WCH( '*' ) == strVal[ length ] ||
+                    _WCH( '?' ) == strVal[ length ] ||
+                    _WCH( '+' ) == strVal[ length ] ||
+                    _WCH( '\\' ) == strVal[ length ] )
                 {
-                    rList_addSTRINGA( stringsAList, pStartStr );
+                    isPattern = TRUE;
+                    break;
                 }
+
+                hash = _HASH_STEP( hash, strVal[ length ] );
             }
-            pStartStr = NULL;
-        }
-        pCurr++;
-    }
-    // Now look for Unicode strings
-    pwCurr = (RPU16)pBuff;
-    pwEnd = pwCurr + ( size / 2 );
-    while( pwCurr < pwEnd )
-    {
-        isWChar = rpal_string_isprintW( *pwCurr );
 
-        if( NULL == pwStartStr && isWChar )  // found the begining of a string
-        {
-            pwStartStr = (RPWCHAR)pwCurr;
-        }
-        else if( NULL != pwStartStr && ( !isWChar || 0 == *pwCurr ) ) // found the end of a string
-        {
-            // is string NULL terminated
-            if( 0 == *pwCurr )
+            if( isPattern )
+            {
+                set->patterns[ set->nPatterns ] = strVal;
+                set->nPatterns++;
+            }
+            else
             {
-                // wcslen is really pCurr - pStartStr
-                if( (RU32)( (RPWCHAR)pwCurr - pwStartStr ) >= minLength &&
-                    (RU32)( (RPWCHAR)pwCurr - pwStartStr ) <= maxLength ) // is string long enough
+                slot = hash & ( set->nSlots - 1 );
+                while( NULL != set->literals[ slot ].str )
                 {
-                    rList_addSTRINGW( stringsWList, pwStartStr );
+                    slot = ( slot + 1 ) & ( set->nSlots - 1 );
                 }
+
+                set->literals[ slot ].hash = hash;
+                set->literals[ slot ].length = length;
+                set->literals[ slot ].str = strVal;
             }
-            pwStartStr = NULL;
         }
-        pwCurr++;
     }
+
+    return set;
 }
 
 RPRIVATE
 RBOOL
-    _isStringInList
+    _isSpanInSearchSet
     (
-        rList searchStrings,
-        RPWCHAR str
+        _SearchSet* set,
+        RPU8 pBuff,
+        rpal_string_span* span,
+        RWCHAR tmpStr[ _MAX_STRING_LENGTH + 1 ]
     )
 {
-    RBOOL found = FALSE;
-    RPWCHAR strVal;
+    RBOOL isFound = FALSE;
+    RU32 hash = _HASH_INIT;
+    RU32 i = 0;
+    RU32 slot = 0;
+    _LiteralString* literal = NULL;
+
+    _spanToWide( pBuff, span, tmpStr );
 
-    if( NULL != searchStrings && NULL != str )
+    for( i = 0; i < span->length; i++ )
     {
-        rList_resetIterator( searchStrings );
-        while( rList_getSTRINGW( searchStrings, RP_TAGS_STRING, &strVal ) )
+        hash = _HASH_STEP( hash, tmpStr[ i ] );
+    }
+
+    slot = hash & ( set->nSlots - 1 );
+    while( NULL != ( literal = &set->literals[ slot ] )->str )
+    {
+        if( literal->hash == hash &&
+            literal->length == span->length &&
+            0 == rpal_memory_memcmp( literal->str, tmpStr, span->length * sizeof( RWCHAR ) ) )
         {
-            if( rpal_string_matchW( strVal, str, TRUE ) )
-            {
-                found = TRUE;
-                break;
-            }
+            isFound = TRUE;
+            break;
+        }
+
+        slot = ( slot + 1 ) & ( set->nSlots - 1 );
+    }
+
+    for( i = 0; !isFound && i < set->nPatterns; i++ )
+    {
+        if( rpal_string_matchW( set->patterns[ i ], tmpStr, TRUE ) )
+        {
+            isFound = TRUE;
         }
     }
 
-    return found;
+    return isFound;
 }
 
 RPRIVATE
-RVOID
-    _searchForStrings
+RBOOL
+    _checkFoundString
     (
-        rList stringsFound,
-        rList searchStrings,
+        _SearchContext* ctx,
         RPU8 pBuff,
-        RU64 size,
-        RU64 baseAddr,
-        RU32 minLength,
-        RU32 maxLength
+        rpal_string_span* span
     )
 {
-    RPU8 pCurr;
-    RPU8 pEnd;
-    RPCHAR pStartStr = NULL;
-    RBOOL isChar;
-    RPU16 pwCurr;
-    RPU16 pwEnd;
-    RBOOL isWChar;
-    RPWCHAR pwStartStr = NULL;
-    RPWCHAR thisStrW = NULL;
-    rSequence newFoundStr;
-
-    pCurr = pBuff;
-    pEnd = pBuff + size;
+    RWCHAR tmpStr[ _MAX_STRING_LENGTH + 1 ] = { 0 };
+    rSequence newFoundStr = NULL;
+    RU8 terminator = 0;
 
-    // currently we only deal with NULL terminated strings
-    // start with ascii strings...
-    while( pCurr < pEnd )
+    // ASCII strings can be NULL or Non-Ascii terminated, Unicode strings
+    // have to be NULL terminated.
+    if( RPAL_STRING_EXTRACT_ASCII == span->encoding )
     {
-        isChar = rpal_string_isprint( *pCurr );
-
-        if( NULL == pStartStr && isChar )  // found the begining of a string
-        {
-            pStartStr = (RPCHAR)pCurr;
-        }
-        else if( NULL != pStartStr && ( !isChar || 0 == *pCurr ) ) // found the end of a string
+        terminator = pBuff[ span->offset + span->length ];
+        if( 0 != terminator && rpal_string_charIsAscii( terminator ) )
         {
-            // is string NULL or Non-Ascii terminated
-            if( 0 == *pCurr || !rpal_string_charIsAscii( *pCurr ) )
-            {
-                // Null terminate it so we can use it like a normal string
-                *pCurr = 0;
-
-                // strlen is really pCurr - pStartStr
-                if( (RU32)( (RPCHAR)pCurr - pStartStr ) >= minLength &&
-                    (RU32)( (RPCHAR)pCurr - pStartStr ) <= maxLength ) // is string long enough
-                {
-                    // convert string to wide char for comparision
-                    if( NULL != ( thisStrW = rpal_string_atow( pStartStr ) ) )
-                    {
-                        if( _isStringInList( searchStrings, thisStrW ) && NULL != ( newFoundStr = rSequence_new() ) )
-                        {
-                            rSequence_addSTRINGW( newFoundStr, RP_TAGS_STRING, thisStrW );
-                            rSequence_addRU64( newFoundStr, RP_TAGS_MEMORY_ADDRESS, baseAddr + ( (RPU8)pStartStr - pBuff ) );
-
-                            if( !rList_addSEQUENCE( stringsFound, newFoundStr ) )
-                            {
-                                rSequence_free( newFoundStr );
-                            }
-                        }
-                        rpal_memory_free( thisStrW );
-                    }
-                }
-            }
-            pStartStr = NULL;
+            return TRUE;
         }
-        pCurr++;
     }
-    // Now look for Unicode strings
-    pwCurr = (RPU16)pBuff;
-    pwEnd = pwCurr + ( size / 2 );
-    while( pwCurr < pwEnd )
+    else if( !_isNullTerminated( pBuff, span ) )
+    {
+        return TRUE;
+    }
+
+    if( _isSpanInSearchSet( ctx->searchSet, pBuff, span, tmpStr ) && 
+        NULL != ( newFoundStr = rSequence_new() ) )
     {
-        isWChar = rpal_string_isprintW( *pwCurr );
+        rSequence_addSTRINGW( newFoundStr, RP_TAGS_STRING, tmpStr );
+        rSequence_addRU64( newFoundStr, RP_TAGS_MEMORY_ADDRESS, ctx->baseAddr + span->offset );
 
-        if( NULL == pwStartStr && isWChar )  // found the begining of a string
+        if( !rList_addSEQUENCE( ctx->stringsFound, newFoundStr ) )
         {
-            pwStartStr = (RPWCHAR)pwCurr;
+            rSequence_free( newFoundStr );
         }
-        else if( NULL != pwStartStr && ( !isWChar || 0 == *pwCurr ) ) // found the end of a string
-        {
-            // is string NULL terminated
-            if( 0 == *pwCurr )
-            {
-                // wcslen is really pCurr - pStartStr
-                if( (RU32)( (RPWCHAR)pwCurr - pwStartStr ) >= minLength &&
-                    (RU32)( (RPWCHAR)pwCurr - pwStartStr ) <= maxLength ) // is string long enough
-                {
+    }
 
-                    if( _isStringInList( searchStrings, pwStartStr ) && NULL != ( newFoundStr = rSequence_new() ) )
-                    {
-                        rSequence_addSTRINGW( newFoundStr, RP_TAGS_STRING, pwStartStr );
-                        rSequence_addRU64( newFoundStr, RP_TAGS_MEMORY_ADDRESS, baseAddr + ( (RPU8)pwStartStr - pBuff ) );
+    return TRUE;
+}
 
-                        if( !rList_addSEQUENCE( stringsFound, newFoundStr ) )
-                        {
-                            rSequence_free( newFoundStr );
-                        }
-                    }
-                }
-            }
-            pwStartStr = NULL;
-        }
-        pwCurr++;
-    }
+RPRIVATE
+RVOID
+    _searchForStrings
+    (
+        rList stringsFound,
+        _SearchSet* searchSet,
+        RPU8 pBuff,
+        RU64 size,
+        RU64 baseAddr,
+        RU32 minLength,
+        RU32 maxLength
+    )
+{
+    _SearchContext ctx = { 0 };
+
+    ctx.stringsFound = stringsFound;
+    ctx.searchSet = searchSet;
+    ctx.baseAddr = baseAddr;
+
+    rpal_string_extractSpans( pBuff, 
+                              size, 
+                              RPAL_STRING_EXTRACT_ASCII | RPAL_STRING_EXTRACT_UTF16LE, 
+                              minLength, 
+                              MIN_OF( maxLength, _MAX_STRING_LENGTH ), 
+                              (rpal_string_span_f)_checkFoundString, 
+                              &ctx );
 }
 
 
@@ -244,7 +379,7 @@ rSequence
     _findStringsInProcess
     (
         RU32 pid,
-        rList searchStrings,
+        _SearchSet* searchSet,
         RU32 minLength,
         RU32 maxLength
     )
@@ -258,7 +393,7 @@ rSequence
     RPU8 pRegion = NULL;
     rList stringsFound = NULL;
 
-    if( NULL != searchStrings )
+    if( NULL != searchSet )
     {
         if( NULL != ( info = rSequence_new() ) )
         {
@@ -280,7 +415,7 @@ rSequence
                         {
                             // now search for strings inside this region
                             _searchForStrings( stringsFound, 
-                                               searchStrings, 
+                                               searchSet, 
                                                pRegion, 
                                                memSize, 
                                                memBase, 
@@ -490,7 +625,7 @@ RVOID
               HBS_ATOM_ID_SIZE == atomSize &&
               0 != ( pid = atoms_getPid( atom ) ) ) )
         {
-            if( NULL != ( handleList = processLib_getHandles( pid, TRUE, NULL ) ) )
+            if( NULL != ( handleList = processLib_getHandlesEx( pid, TRUE, NULL, PROCESSLIB_HANDLES_WITH_FDINFO, g_handleCache ) ) )
             {
                 if( !rSequence_addLIST( event, RP_TAGS_HANDLES, handleList ) )
                 {
@@ -527,7 +662,7 @@ RVOID
         {
             rSequence_unTaintRead( event );
 
-            if( NULL != ( handleList = processLib_getHandles( 0, TRUE, needle ) ) )
+            if( NULL != ( handleList = processLib_getHandlesEx( 0, TRUE, needle, 0, g_handleCache ) ) )
             {
                 if( !rSequence_addLIST( event, RP_TAGS_HANDLES, handleList ) )
                 {
@@ -563,7 +698,7 @@ RVOID
     rList stringsAList = NULL;
     rList stringsWList = NULL;
     RU32 minLength = 5;
-    RU32 maxLength = 128;
+    RU32 maxLength = _MAX_STRING_LENGTH;
 
     RPU8 atom = NULL;
     RU32 atomSize = 0;
@@ -637,12 +772,13 @@ RVOID
     RU32 pid = 0;
     RU32 currentPid = 0;
     rList searchStrings = NULL;
+    _SearchSet* searchSet = NULL;
     rList processes = NULL;
     rSequence process = NULL;
     processLibProcEntry* pids = NULL;
     RU32 nCurrent = 0;
     RU32 minLength = 5;
-    RU32 maxLength = 128;
+    RU32 maxLength = _MAX_STRING_LENGTH;
 
     RPU8 atom = NULL;
     RU32 atomSize = 0;
@@ -655,7 +791,8 @@ RVOID
               ( rSequence_getBUFFER( event, RP_TAGS_HBS_THIS_ATOM, &atom, &atomSize ) &&
                 HBS_ATOM_ID_SIZE == atomSize &&
                 0 != ( pid = atoms_getPid( atom ) ) ) ) &&
-            rSequence_getLIST( event, RP_TAGS_STRINGSW, &searchStrings ) )
+            rSequence_getLIST( event, RP_TAGS_STRINGSW, &searchStrings ) &&
+            NULL != ( searchSet = _newSearchSet( searchStrings ) ) )
         {
             currentPid = processLib_getCurrentPid();
 
@@ -664,7 +801,7 @@ RVOID
                 if( 0 != pid )
                 {
                     if( NULL != ( process = _findStringsInProcess( pid, 
-                                                                   searchStrings, 
+                                                                   searchSet, 
                                                                    minLength, 
                                                                    maxLength ) ) )
                     {
@@ -683,7 +820,7 @@ RVOID
                             if( currentPid != pids[ nCurrent ].pid )
                             {
                                 if( NULL != ( process = _findStringsInProcess( pids[ nCurrent ].pid, 
-                                                                               searchStrings, 
+                                                                               searchSet, 
                                                                                minLength, 
                                                                                maxLength ) ) )
                                 {
@@ -708,6 +845,8 @@ RVOID
             }
         }
 
+        _freeSearchSet( searchSet );
+
         hbs_timestampEvent( event, 0 );
         hbs_publish( RP_TAGS_NOTIFICATION_MEM_FIND_STRING_REP, event );
     }
@@ -725,6 +864,8 @@ rpcm_tag collector_10_events[] = { RP_TAGS_NOTIFICATION_MEM_MAP_REP,
                                    RP_TAGS_NOTIFICATION_MEM_FIND_STRING_REP,
                                    0 };
 
+RU32 collector_10_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_10_init
     (
@@ -738,6 +879,9 @@ RBOOL
 
     if( NULL != hbsState )
     {
+        // Without a cache handles are still listed, just not incrementally.
+        g_handleCache = processLib_newHandleCache();
+
         if( notifications_subscribe( RP_TAGS_NOTIFICATION_MEM_MAP_REQ, NULL, 0, NULL, mem_map ) &&
             notifications_subscribe( RP_TAGS_NOTIFICATION_MEM_READ_REQ, NULL, 0, NULL, mem_read ) &&
             notifications_subscribe( RP_TAGS_NOTIFICATION_MEM_HANDLES_REQ, NULL, 0, NULL, mem_handles ) &&
@@ -754,6 +898,9 @@ RBOOL
             notifications_unsubscribe( RP_TAGS_NOTIFICATION_MEM_HANDLES_REQ, NULL, mem_handles );
             notifications_unsubscribe( RP_TAGS_NOTIFICATION_MEM_FIND_HANDLE_REQ, NULL, mem_find_handle );
             notifications_unsubscribe( RP_TAGS_NOTIFICATION_MEM_STRINGS_REQ, NULL, mem_strings );
+
+            processLib_freeHandleCache( g_handleCache );
+            g_handleCache = NULL;
         }
     }
 
@@ -780,6 +927,9 @@ RBOOL
         notifications_unsubscribe( RP_TAGS_NOTIFICATION_MEM_STRINGS_REQ, NULL, mem_strings );
         notifications_unsubscribe( RP_TAGS_NOTIFICATION_MEM_FIND_STRING_REQ, NULL, mem_find_string );
 
+        processLib_freeHandleCache( g_handleCache );
+        g_handleCache = NULL;
+
         isSuccess = TRUE;
     }
 
@@ -394,6 +394,8 @@ rpcm_tag collector_11_events[] = { RP_TAGS_NOTIFICATION_OS_SERVICES_REP,
                                    RP_TAGS_NOTIFICATION_OS_RESUME_REP,
                                    0 };
 
+RU32 collector_11_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_11_init
     (
@@ -280,6 +280,8 @@ RBOOL
 
 rpcm_tag collector_12_events[] = { 0 };
 
+RU32 collector_12_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_12_init
     (
@@ -491,6 +491,9 @@ RPVOID
 rpcm_tag collector_13_events[] = { RP_TAGS_NOTIFICATION_EXEC_OOB,
                                    0 };
 
+RU32 collector_13_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                 COLLECTOR_DEPENDENCY( 20 );
+
 RBOOL
     collector_13_init
     (
@@ -227,6 +227,9 @@ RVOID
 
 rpcm_tag collector_14_events[] = { 0 };
 
+RU32 collector_14_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                 COLLECTOR_DEPENDENCY( 1 );
+
 RBOOL
     collector_14_init
     (
@@ -747,6 +747,9 @@ RVOID
 rpcm_tag collector_15_events[] = { RP_TAGS_NOTIFICATION_MODULE_MEM_DISK_MISMATCH,
                                    0 };
 
+RU32 collector_15_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                 COLLECTOR_DEPENDENCY( 1 );
+
 RBOOL
     collector_15_init
     (
@@ -793,6 +793,10 @@ RVOID
 rpcm_tag collector_16_events[] = { RP_TAGS_NOTIFICATION_YARA_DETECTION,
                                    0 };
 
+RU32 collector_16_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                 COLLECTOR_DEPENDENCY( 1 ) |
+                                 COLLECTOR_DEPENDENCY( 6 );
+
 RBOOL
     collector_16_init
     (
@@ -214,6 +214,8 @@ rpcm_tag collector_17_events[] = { RP_TAGS_NOTIFICATION_SERVICE_CHANGE,
                                    RP_TAGS_NOTIFICATION_AUTORUN_CHANGE,
                                    0 };
 
+RU32 collector_17_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_17_init
     (
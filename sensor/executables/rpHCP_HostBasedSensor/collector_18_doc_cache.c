@@ -21,16 +21,48 @@ limitations under the License.
 #include <rpHostCommonPlatformLib/rTags.h>
 #include <obsLib/obsLib.h>
 #include <cryptoLib/cryptoLib.h>
+#include <zlib/zlib.h>
 
 #define  RPAL_FILE_ID           102
 
 #define MAX_CACHE_SIZE                  (1024 * 1024 * 50)
 #define DOCUMENT_MAX_SIZE               (1024 * 1024 * 15)
+#define DOCUMENT_READ_CHUNK             (64 * 1024)
+#define DOCUMENT_COMPRESSION_LEVEL      6
 
 RPRIVATE rQueue g_createQueue = NULL;
 RPRIVATE HObs g_matcher = NULL;
 
-RPRIVATE HbsRingBuffer g_documentCache = NULL;
+// The cache is content addressed, every distinct document body is kept once
+// compressed and every path it was seen at refers to it. Paths are evicted
+// oldest first and a body goes away with the last path referring to it.
+// The cache size accounts for the compressed bodies and the path records.
+typedef struct _DocEntry
+{
+    RPNCHAR path;
+    rSequence info;
+    RU32 infoSize;
+    struct _DocBody* body;
+    struct _DocEntry* nextSameBody;
+    struct _DocEntry* older;
+    struct _DocEntry* newer;
+
+} _DocEntry;
+
+typedef struct _DocBody
+{
+    CryptoLib_Hash hash;
+    RU32 rawSize;
+    RU32 compressedSize;
+    RPU8 compressed;
+    _DocEntry* entries;
+
+} _DocBody;
+
+RPRIVATE rBTree g_docPaths = NULL;
+RPRIVATE rBTree g_docBodies = NULL;
+RPRIVATE _DocEntry* g_oldestDoc = NULL;
+RPRIVATE _DocEntry* g_newestDoc = NULL;
 RPRIVATE RU32 g_cacheMaxSize = MAX_CACHE_SIZE;
 RPRIVATE RU32 g_cacheSize = 0;
 RPRIVATE rMutex g_cacheMutex = NULL;
@@ -54,6 +86,388 @@ RVOID
     rSequence_free( evt );
 }
 
+RPRIVATE
+RS32
+    _cmpDocPath
+    (
+        _DocEntry** pEntry1,
+        _DocEntry** pEntry2
+    )
+{
+    return rpal_string_strcmp( (*pEntry1)->path, (*pEntry2)->path );
+}
+
+RPRIVATE
+RS32
+    _cmpDocBody
+    (
+        _DocBody** pBody1,
+        _DocBody** pBody2
+    )
+{
+    return rpal_memory_memcmp( &(*pBody1)->hash, &(*pBody2)->hash, sizeof( (*pBody1)->hash ) );
+}
+
+RPRIVATE
+RBOOL
+    _deflateChunk
+    (
+        z_stream* pStream,
+        RPU8 data,
+        RU32 dataSize,
+        int flush,
+        RPU8* pOut,
+        RU32* pOutSize,
+        RU32* pOutAlloc
+    )
+{
+    RBOOL isSuccess = TRUE;
+    RPU8 newOut = NULL;
+    RU32 newAlloc = 0;
+    int zErr = Z_OK;
+
+    pStream->next_in = data;
+    pStream->avail_in = dataSize;
+
+    do
+    {
+        if( *pOutSize == *pOutAlloc )
+        {
+            newAlloc = MAX_OF( *pOutAlloc * 2, DOCUMENT_READ_CHUNK );
+            if( NULL == ( newOut = rpal_memory_realloc( *pOut, newAlloc ) ) )
+            {
+                isSuccess = FALSE;
+                break;
+            }
+            *pOut = newOut;
+            *pOutAlloc = newAlloc;
+        }
+
+        pStream->next_out = *pOut + *pOutSize;
+        pStream->avail_out = *pOutAlloc - *pOutSize;
+
+        zErr = deflate( pStream, flush );
+        *pOutSize = *pOutAlloc - pStream->avail_out;
+
+        if( Z_STREAM_ERROR == zErr )
+        {
+            isSuccess = FALSE;
+            break;
+        }
+    } while( 0 == pStream->avail_out ||
+             ( Z_FINISH == flush && Z_STREAM_END != zErr ) );
+
+    return isSuccess;
+}
+
+// Hash the document and, if it is small enough to be cached, compress it
+// in the same pass so the raw content is never held in memory whole.
+RPRIVATE
+RBOOL
+    _acquireDocument
+    (
+        RPNCHAR filePath,
+        CryptoLib_Hash* pHash,
+        RPU8* pCompressed,
+        RU32* pCompressedSize,
+        RU32* pRawSize
+    )
+{
+    RBOOL isSuccess = FALSE;
+    rFile hFile = NULL;
+    CryptoLib_HashContext hashCtx = NULL;
+    z_stream stream = { 0 };
+    RBOOL isCompressing = FALSE;
+    RPU8 chunk = NULL;
+    RU32 nRead = 0;
+    RU32 rawSize = 0;
+    RPU8 out = NULL;
+    RU32 outSize = 0;
+    RU32 outAlloc = 0;
+    RPU8 tmp = NULL;
+
+    *pCompressed = NULL;
+    *pCompressedSize = 0;
+    *pRawSize = 0;
+
+    if( rFile_open( filePath, &hFile, RPAL_FILE_OPEN_READ |
+                                      RPAL_FILE_OPEN_EXISTING |
+                                      RPAL_FILE_OPEN_AVOID_TIMESTAMPS ) )
+    {
+        if( NULL != ( chunk = rpal_memory_alloc( DOCUMENT_READ_CHUNK ) ) &&
+            NULL != ( hashCtx = CryptoLib_hashInit() ) )
+        {
+            isCompressing = ( Z_OK == deflateInit( &stream, DOCUMENT_COMPRESSION_LEVEL ) );
+
+            while( 0 != ( nRead = rFile_readUpTo( hFile, DOCUMENT_READ_CHUNK, chunk ) ) )
+            {
+                rawSize += nRead;
+                CryptoLib_hashUpdate( hashCtx, chunk, nRead );
+
+                if( isCompressing &&
+                    ( DOCUMENT_MAX_SIZE < rawSize ||
+                      !_deflateChunk( &stream, chunk, nRead, Z_NO_FLUSH, &out, &outSize, &outAlloc ) ) )
+                {
+                    // Too big to be cached, we still need the hash.
+                    deflateEnd( &stream );
+                    isCompressing = FALSE;
+                }
+            }
+
+            if( isCompressing )
+            {
+                if( _deflateChunk( &stream, NULL, 0, Z_FINISH, &out, &outSize, &outAlloc ) &&
+                    0 != rawSize )
+                {
+                    // Give back the growth slack since this stays in the cache.
+                    if( NULL != ( tmp = rpal_memory_realloc( out, outSize ) ) )
+                    {
+                        out = tmp;
+                    }
+
+                    *pCompressed = out;
+                    *pCompressedSize = outSize;
+                    *pRawSize = rawSize;
+                    out = NULL;
+                }
+
+                deflateEnd( &stream );
+            }
+
+            isSuccess = CryptoLib_hashFinish( hashCtx, pHash );
+        }
+
+        rpal_memory_free( chunk );
+        rpal_memory_free( out );
+        rFile_close( hFile );
+    }
+
+    if( !isSuccess )
+    {
+        rpal_memory_free( *pCompressed );
+        *pCompressed = NULL;
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RVOID
+    _removeDocEntry
+    (
+        _DocEntry* entry
+    )
+{
+    _DocBody* body = entry->body;
+    _DocEntry** pLink = NULL;
+    _DocEntry* tmpEntry = NULL;
+    _DocBody* tmpBody = NULL;
+
+    if( NULL == entry->older )
+    {
+        g_oldestDoc = entry->newer;
+    }
+    else
+    {
+        entry->older->newer = entry->newer;
+    }
+
+    if( NULL == entry->newer )
+    {
+        g_newestDoc = entry->older;
+    }
+    else
+    {
+        entry->newer->older = entry->older;
+    }
+
+    rpal_btree_remove( g_docPaths, &entry, &tmpEntry, TRUE );
+    g_cacheSize -= entry->infoSize;
+
+    for( pLink = &body->entries; NULL != *pLink; pLink = &(*pLink)->nextSameBody )
+    {
+        if( entry == *pLink )
+        {
+            *pLink = entry->nextSameBody;
+            break;
+        }
+    }
+
+    if( NULL == body->entries )
+    {
+        rpal_btree_remove( g_docBodies, &body, &tmpBody, TRUE );
+        g_cacheSize -= body->compressedSize;
+        rpal_memory_free( body->compressed );
+        rpal_memory_free( body );
+    }
+
+    rSequence_free( entry->info );
+    rpal_memory_free( entry->path );
+    rpal_memory_free( entry );
+}
+
+// Takes ownership of the compressed body in all cases and of the info
+// when successful.
+RPRIVATE
+RBOOL
+    _cacheDocument
+    (
+        RPNCHAR filePath,
+        rSequence info,
+        CryptoLib_Hash* pHash,
+        RPU8 compressed,
+        RU32 compressedSize,
+        RU32 rawSize
+    )
+{
+    RBOOL isCached = FALSE;
+    _DocEntry keyEntry = { 0 };
+    _DocEntry* pKeyEntry = &keyEntry;
+    _DocEntry* entry = NULL;
+    _DocBody keyBody = { 0 };
+    _DocBody* pKeyBody = &keyBody;
+    _DocBody* body = NULL;
+    RBOOL isNewBody = FALSE;
+
+    // The path now refers to this content, whatever it was before.
+    keyEntry.path = filePath;
+    if( rpal_btree_search( g_docPaths, &pKeyEntry, &entry, TRUE ) )
+    {
+        _removeDocEntry( entry );
+        entry = NULL;
+    }
+
+    keyBody.hash = *pHash;
+    if( !rpal_btree_search( g_docBodies, &pKeyBody, &body, TRUE ) )
+    {
+        if( NULL != ( body = rpal_memory_alloc( sizeof( *body ) ) ) )
+        {
+            rpal_memory_zero( body, sizeof( *body ) );
+            body->hash = *pHash;
+            body->rawSize = rawSize;
+            body->compressedSize = compressedSize;
+            body->compressed = compressed;
+
+            if( rpal_btree_add( g_docBodies, &body, TRUE ) )
+            {
+                compressed = NULL;
+                isNewBody = TRUE;
+                g_cacheSize += compressedSize;
+            }
+            else
+            {
+                rpal_memory_free( body );
+                body = NULL;
+            }
+        }
+    }
+
+    rpal_memory_free( compressed );
+
+    if( NULL != body &&
+        NULL != ( entry = rpal_memory_alloc( sizeof( *entry ) ) ) )
+    {
+        rpal_memory_zero( entry, sizeof( *entry ) );
+        entry->info = info;
+        entry->infoSize = rSequence_getEstimateSize( info );
+        entry->body = body;
+
+        if( NULL != ( entry->path = rpal_string_strdup( filePath ) ) &&
+            rpal_btree_add( g_docPaths, &entry, TRUE ) )
+        {
+            entry->nextSameBody = body->entries;
+            body->entries = entry;
+            entry->older = g_newestDoc;
+            if( NULL != g_newestDoc )
+            {
+                g_newestDoc->newer = entry;
+            }
+            else
+            {
+                g_oldestDoc = entry;
+            }
+            g_newestDoc = entry;
+            g_cacheSize += entry->infoSize;
+            isCached = TRUE;
+        }
+        else
+        {
+            rpal_memory_free( entry->path );
+            rpal_memory_free( entry );
+        }
+    }
+
+    if( !isCached &&
+        isNewBody )
+    {
+        rpal_btree_remove( g_docBodies, &body, &pKeyBody, TRUE );
+        g_cacheSize -= body->compressedSize;
+        rpal_memory_free( body->compressed );
+        rpal_memory_free( body );
+    }
+
+    while( g_cacheSize > g_cacheMaxSize &&
+           NULL != g_oldestDoc )
+    {
+        _removeDocEntry( g_oldestDoc );
+    }
+
+    return isCached;
+}
+
+RPRIVATE
+RBOOL
+    _docCacheInit
+    (
+
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    g_cacheSize = 0;
+    g_oldestDoc = NULL;
+    g_newestDoc = NULL;
+
+    if( NULL != ( g_docPaths = rpal_btree_create( sizeof( _DocEntry* ),
+                                                  (rpal_btree_comp_f)_cmpDocPath,
+                                                  NULL ) ) &&
+        NULL != ( g_docBodies = rpal_btree_create( sizeof( _DocBody* ),
+                                                   (rpal_btree_comp_f)_cmpDocBody,
+                                                   NULL ) ) )
+    {
+        isSuccess = TRUE;
+    }
+    else
+    {
+        rpal_btree_destroy( g_docPaths, TRUE );
+        g_docPaths = NULL;
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RVOID
+    _docCacheDeinit
+    (
+
+    )
+{
+    if( NULL != g_docPaths &&
+        NULL != g_docBodies )
+    {
+        while( NULL != g_oldestDoc )
+        {
+            _removeDocEntry( g_oldestDoc );
+        }
+    }
+
+    rpal_btree_destroy( g_docPaths, TRUE );
+    rpal_btree_destroy( g_docBodies, TRUE );
+    g_docPaths = NULL;
+    g_docBodies = NULL;
+}
+
 RPRIVATE
 RVOID
     processFile
@@ -62,9 +476,10 @@ RVOID
     )
 {
     RPNCHAR fileN = NULL;
-    RPU8 fileContent = NULL;
-    RU32 fileSize = 0;
     CryptoLib_Hash hash = { 0 };
+    RPU8 compressed = NULL;
+    RU32 compressedSize = 0;
+    RU32 rawSize = 0;
 
     if( NULL != notif )
     {
@@ -72,15 +487,12 @@ RVOID
 
         if( rSequence_getSTRINGN( notif, RP_TAGS_FILE_PATH, &fileN ) &&
             obsLib_setTargetBuffer( g_matcher,
-                                    fileN, 
+                                    fileN,
                                     rpal_string_strsize( fileN ) ) &&
             obsLib_nextHit( g_matcher, NULL, NULL ) )
         {
             // This means it's a file of interest.
-            if( ( DOCUMENT_MAX_SIZE >= rpal_file_getSize( fileN, TRUE ) &&
-                  rpal_file_read( fileN, (RPVOID*)&fileContent, &fileSize, TRUE ) &&
-                  CryptoLib_hash( fileContent, fileSize, &hash ) ) ||
-                CryptoLib_hashFile( fileN, &hash, TRUE ) )
+            if( _acquireDocument( fileN, &hash, &compressed, &compressedSize, &rawSize ) )
             {
                 rpal_debug_info( "new document acquired" );
                 rSequence_unTaintRead( notif );
@@ -93,17 +505,15 @@ RVOID
                 rSequence_addRU32( notif, RP_TAGS_ERROR, rpal_error_getLast() );
             }
 
-            // We acquired the hash, either by reading the entire file in memory
-            // which we will use for caching, or if it was too big by hashing it
-            // sequentially on disk.
+            // We always get the hash, but we only get a compressed body for
+            // documents small enough to be cached.
             rSequence_removeElement( notif, RP_TAGS_HBS_THIS_ATOM, RPCM_BUFFER );
             hbs_publish( RP_TAGS_NOTIFICATION_NEW_DOCUMENT, notif );
 
-            if( rMutex_lock( g_cacheMutex ) )
+            if( NULL != compressed &&
+                rMutex_lock( g_cacheMutex ) )
             {
-                if( NULL == fileContent ||
-                    !rSequence_addBUFFER( notif, RP_TAGS_FILE_CONTENT, fileContent, fileSize ) ||
-                    !HbsRingBuffer_add( g_documentCache, notif ) )
+                if( !_cacheDocument( fileN, notif, &hash, compressed, compressedSize, rawSize ) )
                 {
                     rSequence_free( notif );
                 }
@@ -112,13 +522,9 @@ RVOID
             }
             else
             {
+                rpal_memory_free( compressed );
                 rSequence_free( notif );
             }
-
-            if( NULL != fileContent )
-            {
-                rpal_memory_free( fileContent );
-            }
         }
         else
         {
@@ -136,7 +542,7 @@ RPVOID
     )
 {
     rSequence createEvt = NULL;
-    
+
     UNREFERENCED_PARAMETER( ctx );
 
     while( rpal_memory_isValid( isTimeToStop ) &&
@@ -152,48 +558,74 @@ RPVOID
 }
 
 RPRIVATE
-RBOOL
-    findDoc
+RVOID
+    _addCachedDoc
     (
-        rSequence doc,
+        rList docs,
+        _DocEntry* entry,
         DocSearchContext* ctx
     )
 {
-    RBOOL isMatch = FALSE;
-    RPNCHAR filePathN = NULL;
-    RPCHAR tmpA = NULL;
-    RPWCHAR tmpW = NULL;
-    CryptoLib_Hash* pHash = NULL;
-    RU32 hashSize = 0;
+    rSequence doc = NULL;
+    RPU8 content = NULL;
+    uLongf contentSize = 0;
 
-    if( rpal_memory_isValid( doc ) &&
-        NULL != ctx )
+    if( NULL != ctx->expr &&
+        !rpal_string_match( ctx->expr, entry->path, FALSE ) )
     {
-        if( NULL == ctx->expr &&
-            NULL == ctx->pHash )
-        {
-            return TRUE;
-        }
+        return;
+    }
+
+    contentSize = entry->body->rawSize;
 
-        if( rSequence_getSTRINGA( doc, RP_TAGS_FILE_PATH, &tmpA ) )
+    if( NULL != ( content = rpal_memory_alloc( entry->body->rawSize ) ) &&
+        Z_OK == uncompress( content, &contentSize, entry->body->compressed, entry->body->compressedSize ) &&
+        contentSize == entry->body->rawSize &&
+        NULL != ( doc = rSequence_duplicate( entry->info ) ) )
+    {
+        if( !rSequence_addBUFFER( doc, RP_TAGS_FILE_CONTENT, content, (RU32)contentSize ) ||
+            !rList_addSEQUENCE( docs, doc ) )
         {
-            filePathN = rpal_string_aton( tmpA );
+            rSequence_free( doc );
         }
-        else if( rSequence_getSTRINGW( doc, RP_TAGS_FILE_PATH, &tmpW ) )
+    }
+
+    rpal_memory_free( content );
+}
+
+RPRIVATE
+RVOID
+    _getCachedDocs
+    (
+        rList docs,
+        DocSearchContext* ctx
+    )
+{
+    _DocBody keyBody = { 0 };
+    _DocBody* pKeyBody = &keyBody;
+    _DocBody* body = NULL;
+    _DocEntry* entry = NULL;
+
+    if( NULL != ctx->pHash )
+    {
+        // Requests for a specific hash go straight to the body, the path
+        // pattern if any only needs checking on the paths it was seen at.
+        keyBody.hash = *ctx->pHash;
+        if( rpal_btree_search( g_docBodies, &pKeyBody, &body, TRUE ) )
         {
-            filePathN = rpal_string_wton( tmpW );
+            for( entry = body->entries; NULL != entry; entry = entry->nextSameBody )
+            {
+                _addCachedDoc( docs, entry, ctx );
+            }
         }
-        
-        rSequence_getBUFFER( doc, RP_TAGS_HASH, (RPU8*)&pHash, &hashSize );
-
-        if( ( NULL == filePathN || NULL == ctx->expr || rpal_string_match( ctx->expr, filePathN, FALSE ) ) &&
-            ( NULL == ctx->pHash || ( NULL == pHash && 0 == rpal_memory_memcmp( pHash, ctx->pHash, hashSize ) ) ) )
+    }
+    else
+    {
+        for( entry = g_oldestDoc; NULL != entry; entry = entry->newer )
         {
-            isMatch = TRUE;
+            _addCachedDoc( docs, entry, ctx );
         }
     }
-
-    return isMatch;
 }
 
 RPRIVATE
@@ -204,7 +636,6 @@ RVOID
         rSequence notif
     )
 {
-    rSequence tmp = NULL;
     DocSearchContext ctx = { 0 };
     RPWCHAR tmpW = NULL;
     RPCHAR tmpA = NULL;
@@ -226,7 +657,7 @@ RVOID
         if( !rSequence_getBUFFER( notif, RP_TAGS_HASH, (RPU8*)&ctx.pHash, &hashSize ) ||
             sizeof( *ctx.pHash ) != hashSize )
         {
-            // Unexpected hash size, let's not gamble 
+            // Unexpected hash size, let's not gamble
             ctx.pHash = NULL;
         }
     }
@@ -235,20 +666,7 @@ RVOID
     {
         if( NULL != ( foundDocs = rList_new( RP_TAGS_FILE_INFO, RPCM_SEQUENCE ) ) )
         {
-            while( HbsRingBuffer_find( g_documentCache, (HbsRingBufferCompareFunc)findDoc, &ctx, &tmp ) )
-            {
-                // TODO: optimize this since if we're dealing with large files
-                // we will be temporarily using large amounts of duplicate memory.
-                // We just need to do some shallow free of the datastructures
-                // somehow.
-                if( NULL != ( tmp = rSequence_duplicate( tmp ) ) )
-                {
-                    if( !rList_addSEQUENCE( foundDocs, tmp ) )
-                    {
-                        rSequence_free( tmp );
-                    }
-                }
-            }
+            _getCachedDocs( foundDocs, &ctx );
 
             if( !rSequence_addLIST( notif, RP_TAGS_FILES, foundDocs ) )
             {
@@ -296,6 +714,9 @@ rpcm_tag collector_18_events[] = { RP_TAGS_NOTIFICATION_NEW_DOCUMENT,
                                    RP_TAGS_NOTIFICATION_GET_DOCUMENT_REP,
                                    0 };
 
+RU32 collector_18_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                 COLLECTOR_DEPENDENCY( 7 );
+
 RBOOL
     collector_18_init
     (
@@ -322,7 +743,6 @@ RBOOL
             if( NULL != ( g_cacheMutex = rMutex_create() ) &&
                 NULL != ( g_matcher = obsLib_new( 0, 0 ) ) )
             {
-                g_cacheSize = 0;
                 if( NULL != config &&
                     rSequence_getRU32( config, RP_TAGS_MAX_SIZE, &maxSize ) )
                 {
@@ -333,7 +753,7 @@ RBOOL
                     g_cacheMaxSize = MAX_CACHE_SIZE;
                 }
                 
-                if( NULL != ( g_documentCache = HbsRingBuffer_new( 0, g_cacheMaxSize ) ) )
+                if( _docCacheInit() )
                 {
                     if( NULL == config )
                     {
@@ -411,9 +831,8 @@ RBOOL
                 g_createQueue = NULL;
 
                 obsLib_free( g_matcher );
-                HbsRingBuffer_free( g_documentCache );
+                _docCacheDeinit();
                 g_matcher = NULL;
-                g_documentCache = NULL;
 
                 rMutex_free( g_cacheMutex );
                 g_cacheMutex = NULL;
@@ -448,9 +867,8 @@ RBOOL
         g_createQueue = NULL;
 
         obsLib_free( g_matcher );
-        HbsRingBuffer_free( g_documentCache );
+        _docCacheDeinit();
         g_matcher = NULL;
-        g_documentCache = NULL;
 
         rMutex_free( g_cacheMutex );
         g_cacheMutex = NULL;
@@ -464,6 +882,144 @@ RBOOL
 //=============================================================================
 //  Collector Testing
 //=============================================================================
+RPRIVATE
+RU32
+    _countCachedDocs
+    (
+        DocSearchContext* ctx,
+        RPU8 expectedContent,
+        RU32 expectedSize
+    )
+{
+    RU32 nDocs = 0;
+    rList docs = NULL;
+    rSequence doc = NULL;
+    RPU8 content = NULL;
+    RU32 contentSize = 0;
+
+    if( NULL != ( docs = rList_new( RP_TAGS_FILE_INFO, RPCM_SEQUENCE ) ) )
+    {
+        _getCachedDocs( docs, ctx );
+
+        while( rList_getSEQUENCE( docs, RP_TAGS_FILE_INFO, &doc ) )
+        {
+            if( rSequence_getBUFFER( doc, RP_TAGS_FILE_CONTENT, &content, &contentSize ) &&
+                expectedSize == contentSize &&
+                0 == rpal_memory_memcmp( content, expectedContent, contentSize ) )
+            {
+                nDocs++;
+            }
+        }
+
+        rList_free( docs );
+    }
+
+    return nDocs;
+}
+
+HBS_DECLARE_TEST( doc_cache )
+{
+    RPNCHAR paths[] = { _NC( "./tmp_doc_cache_1" ),
+                        _NC( "./tmp_doc_cache_2" ),
+                        _NC( "./tmp_doc_cache_3" ) };
+    RU32 docSize = 256 * 1024;
+    RPU8 docA = NULL;
+    RPU8 docB = NULL;
+    CryptoLib_Hash hashes[ ARRAY_N_ELEM( paths ) ] = { 0 };
+    RPU8 compressed = NULL;
+    RU32 compressedSize = 0;
+    RU32 rawSize = 0;
+    rSequence info = NULL;
+    DocSearchContext ctx = { 0 };
+    RU32 i = 0;
+
+    docA = rpal_memory_alloc( docSize );
+    docB = rpal_memory_alloc( docSize );
+    HBS_ASSERT_TRUE( NULL != docA && NULL != docB );
+    for( i = 0; i < docSize; i++ )
+    {
+        docA[ i ] = (RU8)( i % 251 );
+        docB[ i ] = (RU8)( i % 13 );
+    }
+
+    // Same content at two paths and different content at a third.
+    HBS_ASSERT_TRUE( rpal_file_write( paths[ 0 ], docA, docSize, TRUE ) );
+    HBS_ASSERT_TRUE( rpal_file_write( paths[ 1 ], docA, docSize, TRUE ) );
+    HBS_ASSERT_TRUE( rpal_file_write( paths[ 2 ], docB, docSize, TRUE ) );
+
+    g_cacheMaxSize = MAX_CACHE_SIZE;
+    HBS_ASSERT_TRUE( _docCacheInit() );
+
+    for( i = 0; i < ARRAY_N_ELEM( paths ); i++ )
+    {
+        HBS_ASSERT_TRUE( _acquireDocument( paths[ i ], &hashes[ i ], &compressed, &compressedSize, &rawSize ) );
+        HBS_ASSERT_TRUE( NULL != compressed );
+        HBS_ASSERT_TRUE( docSize == rawSize );
+        HBS_ASSERT_TRUE( compressedSize < docSize / 10 );
+
+        info = rSequence_new();
+        HBS_ASSERT_TRUE( rSequence_addSTRINGN( info, RP_TAGS_FILE_PATH, paths[ i ] ) );
+        HBS_ASSERT_TRUE( rSequence_addBUFFER( info, RP_TAGS_HASH, (RPU8)&hashes[ i ], sizeof( hashes[ i ] ) ) );
+        HBS_ASSERT_TRUE( _cacheDocument( paths[ i ], info, &hashes[ i ], compressed, compressedSize, rawSize ) );
+    }
+
+    HBS_ASSERT_TRUE( 0 == rpal_memory_memcmp( &hashes[ 0 ], &hashes[ 1 ], sizeof( hashes[ 0 ] ) ) );
+    HBS_ASSERT_TRUE( 0 != rpal_memory_memcmp( &hashes[ 0 ], &hashes[ 2 ], sizeof( hashes[ 0 ] ) ) );
+    HBS_ASSERT_TRUE( 3 == rpal_btree_getSize( g_docPaths, TRUE ) );
+    HBS_ASSERT_TRUE( 2 == rpal_btree_getSize( g_docBodies, TRUE ) );
+    HBS_ASSERT_TRUE( g_cacheSize < docSize );
+
+    // Lookups by hash get every path with the content, lookups by pattern
+    // get the matching paths.
+    ctx.pHash = &hashes[ 0 ];
+    HBS_ASSERT_TRUE( 2 == _countCachedDocs( &ctx, docA, docSize ) );
+    ctx.pHash = NULL;
+    ctx.expr = _NC( "*3" );
+    HBS_ASSERT_TRUE( 1 == _countCachedDocs( &ctx, docB, docSize ) );
+    ctx.expr = NULL;
+    HBS_ASSERT_TRUE( 2 == _countCachedDocs( &ctx, docA, docSize ) );
+
+    // A path seen again with new content moves to the new body.
+    HBS_ASSERT_TRUE( rpal_file_write( paths[ 0 ], docB, docSize, TRUE ) );
+    HBS_ASSERT_TRUE( _acquireDocument( paths[ 0 ], &hashes[ 0 ], &compressed, &compressedSize, &rawSize ) );
+    info = rSequence_new();
+    HBS_ASSERT_TRUE( rSequence_addSTRINGN( info, RP_TAGS_FILE_PATH, paths[ 0 ] ) );
+    HBS_ASSERT_TRUE( _cacheDocument( paths[ 0 ], info, &hashes[ 0 ], compressed, compressedSize, rawSize ) );
+    HBS_ASSERT_TRUE( 3 == rpal_btree_getSize( g_docPaths, TRUE ) );
+    HBS_ASSERT_TRUE( 2 == rpal_btree_getSize( g_docBodies, TRUE ) );
+    ctx.pHash = &hashes[ 2 ];
+    HBS_ASSERT_TRUE( 2 == _countCachedDocs( &ctx, docB, docSize ) );
+    ctx.pHash = NULL;
+
+    // Dropping the budget evicts oldest first, bodies go with their last path.
+    g_cacheMaxSize = g_cacheSize - 1;
+    HBS_ASSERT_TRUE( rpal_file_write( paths[ 1 ], docB, docSize, TRUE ) );
+    HBS_ASSERT_TRUE( _acquireDocument( paths[ 1 ], &hashes[ 1 ], &compressed, &compressedSize, &rawSize ) );
+    info = rSequence_new();
+    HBS_ASSERT_TRUE( rSequence_addSTRINGN( info, RP_TAGS_FILE_PATH, paths[ 1 ] ) );
+    HBS_ASSERT_TRUE( _cacheDocument( paths[ 1 ], info, &hashes[ 1 ], compressed, compressedSize, rawSize ) );
+    HBS_ASSERT_TRUE( 1 == rpal_btree_getSize( g_docBodies, TRUE ) );
+    HBS_ASSERT_TRUE( g_cacheSize <= g_cacheMaxSize );
+
+    g_cacheMaxSize = 0;
+    HBS_ASSERT_TRUE( _acquireDocument( paths[ 2 ], &hashes[ 2 ], &compressed, &compressedSize, &rawSize ) );
+    info = rSequence_new();
+    HBS_ASSERT_TRUE( _cacheDocument( paths[ 2 ], info, &hashes[ 2 ], compressed, compressedSize, rawSize ) );
+    HBS_ASSERT_TRUE( 0 == rpal_btree_getSize( g_docPaths, TRUE ) );
+    HBS_ASSERT_TRUE( 0 == rpal_btree_getSize( g_docBodies, TRUE ) );
+    HBS_ASSERT_TRUE( 0 == g_cacheSize );
+
+    _docCacheDeinit();
+    g_cacheMaxSize = MAX_CACHE_SIZE;
+
+    for( i = 0; i < ARRAY_N_ELEM( paths ); i++ )
+    {
+        rpal_file_delete( paths[ i ], FALSE );
+    }
+    rpal_memory_free( docA );
+    rpal_memory_free( docB );
+}
+
 HBS_TEST_SUITE( 18 )
 {
     RBOOL isSuccess = FALSE;
@@ -472,6 +1028,7 @@ HBS_TEST_SUITE( 18 )
         NULL != testContext )
     {
         isSuccess = TRUE;
+        HBS_RUN_TEST( doc_cache );
     }
 
     return isSuccess;
@@ -23,6 +23,11 @@ limitations under the License.
 #include <libOs/libOs.h>
 #include <cryptoLib/cryptoLib.h>
 
+#ifdef RPAL_PLATFORM_LINUX
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <unistd.h>
+#endif
 
 #define RPAL_FILE_ID       104
 
@@ -55,6 +60,388 @@ RS32
     return ret;
 }
 
+#ifdef RPAL_PLATFORM_LINUX
+//=============================================================================
+// Linux mount watcher
+//=============================================================================
+// The kernel flags /proc/self/mountinfo with POLLPRI whenever the mount
+// table changes, so it only needs to be parsed when something happened.
+// Every mount has a unique id which gives exact deltas between two reads.
+#define _MOUNTINFO_PATH             "/proc/self/mountinfo"
+#define _MOUNTINFO_INITIAL_SIZE     (16 * 1024)
+#define _MOUNTINFO_MAX_SIZE         (16 * 1024 * 1024)
+#define _MOUNTINFO_STOP_CHECK       1000
+
+typedef struct
+{
+    RU32 mountId;
+    RPCHAR mountPoint;
+    RPCHAR source;
+    RPCHAR fsType;
+} _MountEntry;
+
+typedef struct
+{
+    RPCHAR buffer;
+    _MountEntry* entries;
+    RU32 nEntries;
+} _MountTable;
+
+RPRIVATE
+RVOID
+    _freeMountTable
+    (
+        _MountTable* table
+    )
+{
+    rpal_memory_free( table->buffer );
+    rpal_memory_free( table->entries );
+    rpal_memory_zero( table, sizeof( *table ) );
+}
+
+// Splits the next space separated field in place and decodes the octal
+// escapes the kernel uses for spaces, tabs, newlines and backslashes.
+RPRIVATE
+RPCHAR
+    _nextMountField
+    (
+        RPCHAR* pCursor
+    )
+{
+    RPCHAR field = *pCursor;
+    RPCHAR in = field;
+    RPCHAR out = field;
+
+    if( NULL == field ||
+        0 == *field )
+    {
+        return NULL;
+    }
+
+    while( 0 != *in &&
+           ' ' != *in )
+    {
+        if( '\\' == in[ 0 ] &&
+            '0' <= in[ 1 ] && '3' >= in[ 1 ] &&
+            '0' <= in[ 2 ] && '7' >= in[ 2 ] &&
+            '0' <= in[ 3 ] && '7' >= in[ 3 ] )
+        {
+            *out = (RCHAR)( ( ( in[ 1 ] - '0' ) << 6 ) | ( ( in[ 2 ] - '0' ) << 3 ) | ( in[ 3 ] - '0' ) );
+            in += 4;
+        }
+        else
+        {
+            *out = *in;
+            in++;
+        }
+        out++;
+    }
+
+    *pCursor = ( ' ' == *in ) ? in + 1 : in;
+    *out = 0;
+
+    return field;
+}
+
+// Parses the content of mountinfo, takes ownership of the buffer which
+// must be NULL terminated.
+RPRIVATE
+RBOOL
+    _parseMountInfo
+    (
+        RPCHAR buffer,
+        _MountTable* table
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RPCHAR line = NULL;
+    RPCHAR nextLine = NULL;
+    RPCHAR cursor = NULL;
+    RPCHAR field = NULL;
+    RU32 nLines = 1;
+    RU32 i = 0;
+    _MountEntry entry = { 0 };
+
+    rpal_memory_zero( table, sizeof( *table ) );
+    table->buffer = buffer;
+
+    for( i = 0; 0 != buffer[ i ]; i++ )
+    {
+        if( '\n' == buffer[ i ] )
+        {
+            nLines++;
+        }
+    }
+
+    if( NULL != ( table->entries = rpal_memory_alloc( sizeof( *table->entries ) * nLines ) ) )
+    {
+        isSuccess = TRUE;
+
+        for( line = buffer; NULL != line && 0 != *line; line = nextLine )
+        {
+            if( NULL != ( nextLine = strchr( line, '\n' ) ) )
+            {
+                *nextLine = 0;
+                nextLine++;
+            }
+
+            // id parent major:minor root mountPoint options [optional...] - fsType source superOptions
+            rpal_memory_zero( &entry, sizeof( entry ) );
+            cursor = line;
+
+            if( NULL == ( field = _nextMountField( &cursor ) ) ||
+                !rpal_string_stoi( field, &entry.mountId ) ||
+                NULL == _nextMountField( &cursor ) ||
+                NULL == _nextMountField( &cursor ) ||
+                NULL == _nextMountField( &cursor ) ||
+                NULL == ( entry.mountPoint = _nextMountField( &cursor ) ) )
+            {
+                continue;
+            }
+
+            while( NULL != ( field = _nextMountField( &cursor ) ) &&
+                   !( '-' == field[ 0 ] && 0 == field[ 1 ] ) )
+            {
+                // Mount options and the variable number of optional fields.
+            }
+
+            if( NULL == field ||
+                NULL == ( entry.fsType = _nextMountField( &cursor ) ) ||
+                NULL == ( entry.source = _nextMountField( &cursor ) ) )
+            {
+                continue;
+            }
+
+            table->entries[ table->nEntries ] = entry;
+            table->nEntries++;
+        }
+
+        rpal_sort_array( table->entries,
+                         table->nEntries,
+                         sizeof( *table->entries ),
+                         (rpal_ordering_func)rpal_order_RU32 );
+    }
+
+    if( !isSuccess )
+    {
+        _freeMountTable( table );
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RBOOL
+    _readMountInfo
+    (
+        RS32 fd,
+        _MountTable* table
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RPCHAR buffer = NULL;
+    RPCHAR tmpBuffer = NULL;
+    RU32 bufferSize = _MOUNTINFO_INITIAL_SIZE;
+    RU32 size = 0;
+    ssize_t nRead = 0;
+
+    if( 0 != lseek( fd, 0, SEEK_SET ) ||
+        NULL == ( buffer = rpal_memory_alloc( bufferSize ) ) )
+    {
+        return FALSE;
+    }
+
+    // Reading to the end is also what acknowledges the change notification.
+    while( 0 < ( nRead = read( fd, buffer + size, bufferSize - size - 1 ) ) )
+    {
+        size += (RU32)nRead;
+
+        if( size + 1 == bufferSize )
+        {
+            if( _MOUNTINFO_MAX_SIZE <= bufferSize ||
+                NULL == ( tmpBuffer = rpal_memory_realloc( buffer, bufferSize * 2 ) ) )
+            {
+                nRead = -1;
+                break;
+            }
+            buffer = tmpBuffer;
+            bufferSize *= 2;
+        }
+    }
+
+    if( 0 == nRead )
+    {
+        buffer[ size ] = 0;
+        isSuccess = _parseMountInfo( buffer, table );
+    }
+    else
+    {
+        rpal_memory_free( buffer );
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RVOID
+    _publishMount
+    (
+        _MountEntry* entry,
+        RBOOL isMounted
+    )
+{
+    rSequence volume = NULL;
+
+    if( NULL != ( volume = rSequence_new() ) )
+    {
+        // Same fields as the volumes reported by libOs.
+        rSequence_addSTRINGA( volume, RP_TAGS_VOLUME_PATH, entry->mountPoint );
+        rSequence_addSTRINGA( volume, RP_TAGS_VOLUME_NAME, entry->source );
+
+        if( isMounted )
+        {
+            hbs_publish( RP_TAGS_NOTIFICATION_VOLUME_MOUNT, volume );
+            rpal_debug_info( "new volume mounted: %s", entry->mountPoint );
+        }
+        else
+        {
+            hbs_publish( RP_TAGS_NOTIFICATION_VOLUME_UNMOUNT, volume );
+            rpal_debug_info( "volume unmounted: %s", entry->mountPoint );
+        }
+
+        rSequence_free( volume );
+    }
+}
+
+RPRIVATE
+RBOOL
+    _isSameMount
+    (
+        _MountEntry* entry1,
+        _MountEntry* entry2
+    )
+{
+    // Mount ids are recycled, so a reused id must also point to the same thing.
+    return entry1->mountId == entry2->mountId &&
+           0 == rpal_string_strcmp( entry1->mountPoint, entry2->mountPoint ) &&
+           0 == rpal_string_strcmp( entry1->source, entry2->source ) &&
+           0 == rpal_string_strcmp( entry1->fsType, entry2->fsType );
+}
+
+RPRIVATE
+RVOID
+    _diffMountTables
+    (
+        _MountTable* previous,
+        _MountTable* current
+    )
+{
+    RU32 iPrev = 0;
+    RU32 iCur = 0;
+    _MountEntry* prevEntry = NULL;
+    _MountEntry* curEntry = NULL;
+
+    // Both tables are sorted by mount id so a single merge pass is enough.
+    while( iPrev < previous->nEntries ||
+           iCur < current->nEntries )
+    {
+        prevEntry = iPrev < previous->nEntries ? &previous->entries[ iPrev ] : NULL;
+        curEntry = iCur < current->nEntries ? &current->entries[ iCur ] : NULL;
+
+        if( NULL != prevEntry &&
+            NULL != curEntry &&
+            prevEntry->mountId == curEntry->mountId )
+        {
+            if( !_isSameMount( prevEntry, curEntry ) )
+            {
+                _publishMount( prevEntry, FALSE );
+                _publishMount( curEntry, TRUE );
+            }
+            iPrev++;
+            iCur++;
+        }
+        else if( NULL == curEntry ||
+                 ( NULL != prevEntry &&
+                   prevEntry->mountId < curEntry->mountId ) )
+        {
+            _publishMount( prevEntry, FALSE );
+            iPrev++;
+        }
+        else
+        {
+            _publishMount( curEntry, TRUE );
+            iCur++;
+        }
+    }
+}
+
+// Returns FALSE if mountinfo cannot be watched, in which case the caller
+// falls back to polling the volumes.
+RPRIVATE
+RBOOL
+    _watchMountInfo
+    (
+        rEvent isTimeToStop
+    )
+{
+    RS32 fd = (-1);
+    struct pollfd pfd = { 0 };
+    _MountTable previous = { 0 };
+    _MountTable current = { 0 };
+    RS32 ret = 0;
+
+    if( 0 > ( fd = open( _MOUNTINFO_PATH, O_RDONLY | O_CLOEXEC ) ) )
+    {
+        return FALSE;
+    }
+
+    if( !_readMountInfo( fd, &previous ) )
+    {
+        close( fd );
+        return FALSE;
+    }
+
+    rpal_debug_info( "watching mountinfo, %d mounts", previous.nEntries );
+
+    pfd.fd = fd;
+    pfd.events = POLLPRI;
+
+    while( !rEvent_wait( isTimeToStop, 0 ) )
+    {
+        // The timeout is only there to notice we need to stop.
+        pfd.revents = 0;
+        if( 0 > ( ret = poll( &pfd, 1, _MOUNTINFO_STOP_CHECK ) ) )
+        {
+            if( EINTR == errno )
+            {
+                continue;
+            }
+            rpal_debug_warning( "failed to poll mountinfo: %d", errno );
+            break;
+        }
+
+        if( 0 == ret ||
+            0 == ( pfd.revents & ( POLLPRI | POLLERR ) ) )
+        {
+            continue;
+        }
+
+        if( _readMountInfo( fd, &current ) )
+        {
+            _diffMountTables( &previous, &current );
+            _freeMountTable( &previous );
+            previous = current;
+            rpal_memory_zero( &current, sizeof( current ) );
+        }
+    }
+
+    _freeMountTable( &previous );
+    close( fd );
+
+    return TRUE;
+}
+#endif
+
 RPRIVATE
 RPVOID
     volumeTrackerDiffThread
@@ -82,6 +469,14 @@ RPVOID
     perfProfile.targetCpuPerformance = 0;
     perfProfile.globalTargetCpuPerformance = GLOBAL_CPU_USAGE_TARGET;
     perfProfile.timeoutIncrementPerSec = 1;
+
+#ifdef RPAL_PLATFORM_LINUX
+    if( _watchMountInfo( isTimeToStop ) )
+    {
+        return NULL;
+    }
+    rpal_debug_warning( "cannot watch mountinfo, polling volumes instead" );
+#endif
     
     while( !rEvent_wait( isTimeToStop, 0 ) )
     {
@@ -185,6 +580,8 @@ rpcm_tag collector_19_events[] = { RP_TAGS_NOTIFICATION_VOLUME_MOUNT,
                                    RP_TAGS_NOTIFICATION_VOLUME_UNMOUNT,
                                    0 };
 
+RU32 collector_19_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_19_init
     (
@@ -235,6 +632,174 @@ RBOOL
 //=============================================================================
 //  Collector Testing
 //=============================================================================
+#ifdef RPAL_PLATFORM_LINUX
+RPRIVATE
+RBOOL
+    _parseTestMountInfo
+    (
+        RPCHAR fixture,
+        _MountTable* table
+    )
+{
+    RPCHAR buffer = NULL;
+    RU32 size = rpal_string_strlen( fixture ) + 1;
+
+    if( NULL == ( buffer = rpal_memory_alloc( size ) ) )
+    {
+        return FALSE;
+    }
+
+    rpal_memory_memcpy( buffer, fixture, size );
+
+    return _parseMountInfo( buffer, table );
+}
+
+HBS_DECLARE_TEST( parse_mountinfo )
+{
+    _MountTable table = { 0 };
+    RCHAR fixture[] = "40 22 8:2 / /mnt/my\\040disk rw,relatime master:3 shared:9 - vfat /dev/sdb1 rw\n"
+                      "22 1 8:1 / / rw,relatime shared:1 - ext4 /dev/sda1 rw,errors=remount-ro\n"
+                      "not a mount line\n"
+                      "25 22 0:5 / /dev rw,nosuid - devtmpfs udev rw,size=1024k\n"
+                      "\n"
+                      "41 22 0:40 / /run/user rw - tmpfs tmpfs rw";
+
+    if( HBS_ASSERT_TRUE( _parseTestMountInfo( fixture, &table ) ) )
+    {
+        if( HBS_ASSERT_TRUE( 4 == table.nEntries ) )
+        {
+            // Sorted by mount id.
+            HBS_ASSERT_TRUE( 22 == table.entries[ 0 ].mountId );
+            HBS_ASSERT_TRUE( 25 == table.entries[ 1 ].mountId );
+            HBS_ASSERT_TRUE( 40 == table.entries[ 2 ].mountId );
+            HBS_ASSERT_TRUE( 41 == table.entries[ 3 ].mountId );
+
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( table.entries[ 0 ].mountPoint, "/" ) );
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( table.entries[ 0 ].source, "/dev/sda1" ) );
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( table.entries[ 0 ].fsType, "ext4" ) );
+
+            // No optional fields.
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( table.entries[ 1 ].source, "udev" ) );
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( table.entries[ 1 ].fsType, "devtmpfs" ) );
+
+            // Escaped space and several optional fields.
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( table.entries[ 2 ].mountPoint, "/mnt/my disk" ) );
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( table.entries[ 2 ].source, "/dev/sdb1" ) );
+
+            // Last line without a newline.
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( table.entries[ 3 ].mountPoint, "/run/user" ) );
+        }
+
+        _freeMountTable( &table );
+    }
+}
+
+HBS_DECLARE_TEST( diff_mounts )
+{
+    _MountTable previous = { 0 };
+    _MountTable current = { 0 };
+    rQueue mountQueue = NULL;
+    rQueue unmountQueue = NULL;
+    rSequence notif = NULL;
+    RPCHAR path = NULL;
+    RU32 size = 0;
+    RBOOL isRemovedFound = FALSE;
+    RBOOL isOldReusedFound = FALSE;
+    RBOOL isNewReusedFound = FALSE;
+    RBOOL isAddedFound = FALSE;
+    RCHAR before[] = "22 1 8:1 / / rw - ext4 /dev/sda1 rw\n"
+                     "25 22 0:5 / /dev rw - devtmpfs udev rw\n"
+                     "40 22 8:2 / /mnt/usb rw - vfat /dev/sdb1 rw\n";
+    // 25 is gone, 40 was unmounted and its id reused, 50 is new.
+    RCHAR after[] = "50 22 0:41 / /mnt/share rw - cifs //server/share rw\n"
+                    "22 1 8:1 / / rw - ext4 /dev/sda1 rw\n"
+                    "40 22 8:3 / /mnt/other rw - ext4 /dev/sdc1 rw\n";
+
+    HBS_ASSERT_TRUE( rQueue_create( &mountQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( rQueue_create( &unmountQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_VOLUME_MOUNT, NULL, 0, mountQueue, NULL ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_VOLUME_UNMOUNT, NULL, 0, unmountQueue, NULL ) );
+
+    HBS_ASSERT_TRUE( _parseTestMountInfo( before, &previous ) );
+    HBS_ASSERT_TRUE( _parseTestMountInfo( after, &current ) );
+
+    // Nothing changed, nothing reported.
+    _diffMountTables( &previous, &previous );
+    HBS_ASSERT_TRUE( rQueue_getSize( mountQueue, &size ) && 0 == size );
+    HBS_ASSERT_TRUE( rQueue_getSize( unmountQueue, &size ) && 0 == size );
+
+    _diffMountTables( &previous, &current );
+
+    HBS_ASSERT_TRUE( rQueue_getSize( mountQueue, &size ) && 2 == size );
+    while( rQueue_remove( mountQueue, &notif, NULL, 0 ) )
+    {
+        if( HBS_ASSERT_TRUE( rSequence_getSTRINGA( notif, RP_TAGS_VOLUME_PATH, &path ) ) )
+        {
+            if( 0 == rpal_string_strcmp( path, "/mnt/other" ) ) isNewReusedFound = TRUE;
+            if( 0 == rpal_string_strcmp( path, "/mnt/share" ) ) isAddedFound = TRUE;
+        }
+        rSequence_free( notif );
+    }
+
+    HBS_ASSERT_TRUE( rQueue_getSize( unmountQueue, &size ) && 2 == size );
+    while( rQueue_remove( unmountQueue, &notif, NULL, 0 ) )
+    {
+        if( HBS_ASSERT_TRUE( rSequence_getSTRINGA( notif, RP_TAGS_VOLUME_PATH, &path ) ) )
+        {
+            if( 0 == rpal_string_strcmp( path, "/dev" ) ) isRemovedFound = TRUE;
+            if( 0 == rpal_string_strcmp( path, "/mnt/usb" ) ) isOldReusedFound = TRUE;
+        }
+        rSequence_free( notif );
+    }
+
+    HBS_ASSERT_TRUE( isRemovedFound );
+    HBS_ASSERT_TRUE( isOldReusedFound );
+    HBS_ASSERT_TRUE( isNewReusedFound );
+    HBS_ASSERT_TRUE( isAddedFound );
+
+    _freeMountTable( &previous );
+    _freeMountTable( &current );
+
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_VOLUME_MOUNT, mountQueue, NULL );
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_VOLUME_UNMOUNT, unmountQueue, NULL );
+    rQueue_free( mountQueue );
+    rQueue_free( unmountQueue );
+}
+
+HBS_DECLARE_TEST( read_mountinfo )
+{
+    RS32 fd = (-1);
+    _MountTable table = { 0 };
+    RU32 i = 0;
+    RBOOL isRootFound = FALSE;
+
+    if( HBS_ASSERT_TRUE( 0 <= ( fd = open( _MOUNTINFO_PATH, O_RDONLY | O_CLOEXEC ) ) ) )
+    {
+        // Read twice to make sure the file is read again from the start.
+        HBS_ASSERT_TRUE( _readMountInfo( fd, &table ) );
+        _freeMountTable( &table );
+
+        if( HBS_ASSERT_TRUE( _readMountInfo( fd, &table ) ) )
+        {
+            HBS_ASSERT_TRUE( 0 != table.nEntries );
+
+            for( i = 0; i < table.nEntries; i++ )
+            {
+                if( 0 == rpal_string_strcmp( table.entries[ i ].mountPoint, "/" ) )
+                {
+                    isRootFound = TRUE;
+                }
+            }
+
+            HBS_ASSERT_TRUE( isRootFound );
+            _freeMountTable( &table );
+        }
+
+        close( fd );
+    }
+}
+#endif
+
 HBS_TEST_SUITE( 19 )
 {
     RBOOL isSuccess = FALSE;
@@ -242,6 +807,12 @@ HBS_TEST_SUITE( 19 )
     if( NULL != hbsState &&
         NULL != testContext )
     {
+#ifdef RPAL_PLATFORM_LINUX
+        HBS_RUN_TEST( parse_mountinfo );
+        HBS_RUN_TEST( diff_mounts );
+        HBS_RUN_TEST( read_mountinfo );
+#endif
+
         isSuccess = TRUE;
     }
 
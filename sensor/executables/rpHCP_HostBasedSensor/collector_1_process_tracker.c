@@ -21,6 +21,7 @@ limitations under the License.
 #include <rpHostCommonPlatformLib/rTags.h>
 #include <processLib/processLib.h>
 #include <libOs/libOs.h>
+#include <cryptoLib/cryptoLib.h>
 #include <kernelAcquisitionLib/kernelAcquisitionLib.h>
 #include <kernelAcquisitionLib/common.h>
 
@@ -34,33 +35,737 @@ limitations under the License.
 
 #define RPAL_FILE_ID       63
 
-#define MAX_SNAPSHOT_SIZE   1536
 #define NO_PARENT_PID       ((RU32)(-1))
 
+// Container attribution of new processes, resolved once per container.
+RPRIVATE processLibContainerCache g_containerCache = NULL;
+
+// A process is identified by its pid and start time since pids get reused.
 typedef struct
 {
     RU32 pid;
     RU32 ppid;
+    RU64 startTime;
 } processEntry;
 
+// Open addressing hash set of processes, a pid of 0 marks an empty slot.
+// Entries are hashed on the pid alone so that all the processes that
+// used the same pid are found on the same probe sequence.
+#define _SNAPSHOT_INITIAL_CAPACITY  1024
+
+typedef struct
+{
+    processEntry* entries;
+    RU32 nEntries;
+    RU32 capacity;
+} processSnapshot;
+
+//=============================================================================
+// Environment capture
+//=============================================================================
+// Environment variables are highly redundant across processes so every
+// unique "NAME=VALUE" string is kept once in a store keyed by its hash
+// and refcounted by the live processes using it. Events only carry the
+// variables that differ from the parent's captured environment.
+#define _ENV_MAX_CAPTURE_SIZE       (32 * 1024)
+#define _ENV_MAX_STORE_SIZE         (4 * 1024 * 1024)
+
+typedef struct
+{
+    CryptoLib_Hash hash;
+    RU32 refCount;
+    RU32 size;
+    RPNCHAR var;
+} _EnvValue;
+
+typedef struct
+{
+    RU32 pid;
+    CryptoLib_Hash envHash;
+    RU32 nValues;
+    _EnvValue** values;
+} _ProcessEnv;
+
+RPRIVATE rMutex g_envLock = NULL;
+RPRIVATE rBTree g_envValues = NULL;
+RPRIVATE rBTree g_envProcesses = NULL;
+RPRIVATE RU32 g_envStoreSize = 0;
+
+RPRIVATE
+RS32
+    _cmpEnvValue
+    (
+        _EnvValue** val1,
+        _EnvValue** val2
+    )
+{
+    return rpal_memory_memcmp( &( (*val2)->hash ), &( (*val1)->hash ), sizeof( CryptoLib_Hash ) );
+}
+
+RPRIVATE
+RS32
+    _cmpProcessEnv
+    (
+        _ProcessEnv* env1,
+        _ProcessEnv* env2
+    )
+{
+    return rpal_order_RU32( &env1->pid, &env2->pid );
+}
+
+RPRIVATE
+RU32
+    _envNameLength
+    (
+        RPNCHAR var
+    )
+{
+    RU32 len = 0;
+
+    while( 0 != var[ len ] && _NC( '=' ) != var[ len ] )
+    {
+        len++;
+    }
+
+    return len;
+}
+
+// Must be called with g_envLock held.
+RPRIVATE
+RVOID
+    _envReleaseValue
+    (
+        _EnvValue* value
+    )
+{
+    if( 0 != --value->refCount )
+    {
+        return;
+    }
+
+    rpal_btree_remove( g_envValues, &value, NULL, TRUE );
+    g_envStoreSize -= value->size;
+    rpal_memory_free( value );
+}
+
+// Must be called with g_envLock held.
+RPRIVATE
+_EnvValue*
+    _envAcquireValue
+    (
+        RPNCHAR var
+    )
+{
+    _EnvValue* value = NULL;
+    _EnvValue tmpValue = { 0 };
+    _EnvValue* pTmpValue = &tmpValue;
+    RU32 size = 0;
+
+    size = ( rpal_string_strlen( var ) + 1 ) * sizeof( RNCHAR );
+
+    if( !CryptoLib_hash( var, size, &tmpValue.hash ) )
+    {
+        return NULL;
+    }
+
+    if( rpal_btree_search( g_envValues, &pTmpValue, &value, TRUE ) )
+    {
+        value->refCount++;
+    }
+    else if( _ENV_MAX_STORE_SIZE >= g_envStoreSize + size &&
+             NULL != ( value = rpal_memory_alloc( sizeof( *value ) + size ) ) )
+    {
+        rpal_memory_memcpy( &value->hash, &tmpValue.hash, sizeof( value->hash ) );
+        value->refCount = 1;
+        value->size = size;
+        value->var = (RPNCHAR)( value + 1 );
+        rpal_memory_memcpy( value->var, var, size );
+
+        if( rpal_btree_add( g_envValues, &value, TRUE ) )
+        {
+            g_envStoreSize += size;
+        }
+        else
+        {
+            rpal_memory_free( value );
+            value = NULL;
+        }
+    }
+    else
+    {
+        value = NULL;
+    }
+
+    return value;
+}
+
+// Must be called with g_envLock held.
+RPRIVATE
+RVOID
+    _envReleaseProcess
+    (
+        RU32 pid
+    )
+{
+    _ProcessEnv key = { 0 };
+    _ProcessEnv env = { 0 };
+    RU32 i = 0;
+
+    key.pid = pid;
+
+    if( rpal_btree_remove( g_envProcesses, &key, &env, TRUE ) )
+    {
+        for( i = 0; i < env.nValues; i++ )
+        {
+            _envReleaseValue( env.values[ i ] );
+        }
+
+        rpal_memory_free( env.values );
+    }
+}
+
+RPRIVATE
+RBOOL
+    _envStoreInit
+    (
+
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    g_envStoreSize = 0;
+
+    if( NULL != ( g_envLock = rMutex_create() ) )
+    {
+        if( NULL != ( g_envValues = rpal_btree_create( sizeof( _EnvValue* ),
+                                                       (rpal_btree_comp_f)_cmpEnvValue,
+                                                       NULL ) ) )
+        {
+            if( NULL != ( g_envProcesses = rpal_btree_create( sizeof( _ProcessEnv ),
+                                                              (rpal_btree_comp_f)_cmpProcessEnv,
+                                                              NULL ) ) )
+            {
+                isSuccess = TRUE;
+            }
+            else
+            {
+                rpal_btree_destroy( g_envValues, FALSE );
+                g_envValues = NULL;
+            }
+        }
+
+        if( !isSuccess )
+        {
+            rMutex_free( g_envLock );
+            g_envLock = NULL;
+        }
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RVOID
+    _envStoreDeinit
+    (
+
+    )
+{
+    _ProcessEnv env = { 0 };
+
+    if( NULL != g_envLock &&
+        rMutex_lock( g_envLock ) )
+    {
+        while( rpal_btree_minimum( g_envProcesses, &env, TRUE ) )
+        {
+            _envReleaseProcess( env.pid );
+        }
+
+        rpal_btree_destroy( g_envProcesses, TRUE );
+        rpal_btree_destroy( g_envValues, TRUE );
+        g_envProcesses = NULL;
+        g_envValues = NULL;
+        g_envStoreSize = 0;
+
+        rMutex_unlock( g_envLock );
+        rMutex_free( g_envLock );
+        g_envLock = NULL;
+    }
+}
+
+// Records the environment of a new process in the store and adds to the
+// event the hash of the environment and the delta from the parent's:
+//   env( ENVIRONMENT_HASH ) = env( PARENT_ENVIRONMENT_HASH )
+//                             - ENVIRONMENT_REMOVED + ENVIRONMENT_VARIABLES
+// Without a known parent, ENVIRONMENT_VARIABLES holds the whole environment.
+RPRIVATE
+RBOOL
+    _envCapture
+    (
+        RU32 pid,
+        RU32 ppid,
+        rList envVars,
+        rSequence info
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RBOOL isTruncated = FALSE;
+    _ProcessEnv env = { 0 };
+    _ProcessEnv parentKey = { 0 };
+    _ProcessEnv parentEnv = { 0 };
+    _EnvValue* value = NULL;
+    RPNCHAR var = NULL;
+    RU32 nMaxValues = 0;
+    RU32 captured = 0;
+    RU32 size = 0;
+    RU32 i = 0;
+    RU32 j = 0;
+    RU32 k = 0;
+    RS32 cmp = 0;
+    RU32 nameLen = 0;
+    RBOOL isOverridden = FALSE;
+    RPU8 hashes = NULL;
+    rList delta = NULL;
+    rList removed = NULL;
+
+    if( NULL == g_envLock ||
+        !rpal_memory_isValid( envVars ) ||
+        !rpal_memory_isValid( info ) )
+    {
+        return FALSE;
+    }
+
+    env.pid = pid;
+    nMaxValues = rList_getNumElements( envVars );
+
+    if( NULL == ( delta = rList_new( RP_TAGS_ENVIRONMENT_VARIABLE, RPCM_STRINGN ) ) ||
+        NULL == ( removed = rList_new( RP_TAGS_ENVIRONMENT_VARIABLE, RPCM_STRINGN ) ) ||
+        ( 0 != nMaxValues &&
+          NULL == ( env.values = rpal_memory_alloc( nMaxValues * sizeof( *env.values ) ) ) ) )
+    {
+        rList_free( delta );
+        rList_free( removed );
+        return FALSE;
+    }
+
+    if( rMutex_lock( g_envLock ) )
+    {
+        // A stale record means we missed the termination of a previous
+        // process with the same pid.
+        _envReleaseProcess( pid );
+
+        rList_resetIterator( envVars );
+        while( env.nValues < nMaxValues &&
+               rList_getSTRINGN( envVars, RP_TAGS_ENVIRONMENT_VARIABLE, &var ) )
+        {
+            size = ( rpal_string_strlen( var ) + 1 ) * sizeof( RNCHAR );
+            if( _ENV_MAX_CAPTURE_SIZE < captured + size ||
+                NULL == ( value = _envAcquireValue( var ) ) )
+            {
+                isTruncated = TRUE;
+                continue;
+            }
+
+            captured += size;
+            env.values[ env.nValues ] = value;
+            env.nValues++;
+        }
+
+        rpal_sort_array( env.values,
+                         env.nValues,
+                         sizeof( *env.values ),
+                         (rpal_ordering_func)_cmpEnvValue );
+
+        // Duplicate entries in a single environment only count once.
+        for( i = 1, j = 0; i < env.nValues; i++ )
+        {
+            if( env.values[ i ] == env.values[ j ] )
+            {
+                _envReleaseValue( env.values[ i ] );
+            }
+            else
+            {
+                env.values[ ++j ] = env.values[ i ];
+            }
+        }
+        if( 0 != env.nValues )
+        {
+            env.nValues = j + 1;
+        }
+
+        // The environment hash is the hash of its sorted value hashes, an
+        // empty environment is represented by a zeroed hash.
+        if( 0 == env.nValues )
+        {
+            isSuccess = TRUE;
+        }
+        else if( NULL != ( hashes = rpal_memory_alloc( env.nValues * sizeof( CryptoLib_Hash ) ) ) )
+        {
+            for( i = 0; i < env.nValues; i++ )
+            {
+                rpal_memory_memcpy( hashes + ( i * sizeof( CryptoLib_Hash ) ),
+                                    &env.values[ i ]->hash,
+                                    sizeof( CryptoLib_Hash ) );
+            }
+
+            isSuccess = CryptoLib_hash( hashes, env.nValues * sizeof( CryptoLib_Hash ), &env.envHash );
+            rpal_memory_free( hashes );
+        }
+
+        parentKey.pid = ppid;
+        if( NO_PARENT_PID == ppid ||
+            pid == ppid ||
+            !rpal_btree_search( g_envProcesses, &parentKey, &parentEnv, TRUE ) )
+        {
+            rpal_memory_zero( &parentEnv, sizeof( parentEnv ) );
+            ppid = NO_PARENT_PID;
+        }
+
+        // Both environments are sorted so a single merge walk gives the delta.
+        for( i = 0, j = 0; isSuccess && ( i < env.nValues || j < parentEnv.nValues ); )
+        {
+            if( i == env.nValues )
+            {
+                cmp = -1;
+            }
+            else if( j == parentEnv.nValues )
+            {
+                cmp = 1;
+            }
+            else
+            {
+                cmp = _cmpEnvValue( &env.values[ i ], &parentEnv.values[ j ] );
+            }
+
+            if( 0 < cmp )
+            {
+                rList_addSTRINGN( delta, env.values[ i ]->var );
+                i++;
+            }
+            else if( 0 > cmp )
+            {
+                // Only report the variable as removed if the child
+                // did not simply give it a new value.
+                var = parentEnv.values[ j ]->var;
+                nameLen = _envNameLength( var );
+                isOverridden = FALSE;
+                for( k = 0; k < env.nValues; k++ )
+                {
+                    if( nameLen == _envNameLength( env.values[ k ]->var ) &&
+                        0 == rpal_memory_memcmp( var, env.values[ k ]->var, nameLen * sizeof( RNCHAR ) ) )
+                    {
+                        isOverridden = TRUE;
+                        break;
+                    }
+                }
+
+                if( !isOverridden &&
+                    NULL != ( var = rpal_memory_duplicate( var, ( nameLen + 1 ) * sizeof( RNCHAR ) ) ) )
+                {
+                    var[ nameLen ] = 0;
+                    rList_addSTRINGN( removed, var );
+                    rpal_memory_free( var );
+                }
+                j++;
+            }
+            else
+            {
+                i++;
+                j++;
+            }
+        }
+
+        if( isSuccess &&
+            rpal_btree_add( g_envProcesses, &env, TRUE ) )
+        {
+            rSequence_addBUFFER( info, RP_TAGS_ENVIRONMENT_HASH, (RPU8)&env.envHash, sizeof( env.envHash ) );
+            if( NO_PARENT_PID != ppid )
+            {
+                rSequence_addBUFFER( info,
+                                     RP_TAGS_PARENT_ENVIRONMENT_HASH,
+                                     (RPU8)&parentEnv.envHash,
+                                     sizeof( parentEnv.envHash ) );
+            }
+
+            if( !rSequence_addLIST( info, RP_TAGS_ENVIRONMENT_VARIABLES, delta ) )
+            {
+                rList_free( delta );
+            }
+            delta = NULL;
+
+            if( 0 != rList_getNumElements( removed ) &&
+                rSequence_addLIST( info, RP_TAGS_ENVIRONMENT_REMOVED, removed ) )
+            {
+                removed = NULL;
+            }
+
+            if( isTruncated )
+            {
+                rSequence_addRU8( info, RP_TAGS_IS_TRUNCATED, TRUE );
+            }
+        }
+        else
+        {
+            isSuccess = FALSE;
+
+            for( i = 0; i < env.nValues; i++ )
+            {
+                _envReleaseValue( env.values[ i ] );
+            }
+            rpal_memory_free( env.values );
+        }
+
+        rMutex_unlock( g_envLock );
+    }
+    else
+    {
+        rpal_memory_free( env.values );
+    }
+
+    rList_free( delta );
+    rList_free( removed );
+
+    return isSuccess;
+}
+
+RPRIVATE
+RVOID
+    _envRelease
+    (
+        RU32 pid
+    )
+{
+    if( NULL != g_envLock &&
+        rMutex_lock( g_envLock ) )
+    {
+        _envReleaseProcess( pid );
+        rMutex_unlock( g_envLock );
+    }
+}
+
+RPRIVATE
+RVOID
+    _envCaptureProcess
+    (
+        RU32 pid,
+        RU32 ppid,
+        rSequence info
+    )
+{
+    rList envVars = NULL;
+
+    if( NULL == g_envLock )
+    {
+        return;
+    }
+
+    if( NULL != ( envVars = processLib_getProcessEnvironment( pid ) ) )
+    {
+        if( !_envCapture( pid, ppid, envVars, info ) )
+        {
+            rpal_debug_warning( "failed to capture environment of process %d", pid );
+        }
+
+        rList_free( envVars );
+    }
+}
+
+//=============================================================================
+// Process snapshots
+//=============================================================================
+RPRIVATE
+RU32
+    _snapshotSlot
+    (
+        processSnapshot* snapshot,
+        RU32 pid
+    )
+{
+    return (RU32)( ( pid * 0x9E3779B1 ) & ( snapshot->capacity - 1 ) );
+}
+
+RPRIVATE
+RVOID
+    _snapshotFree
+    (
+        processSnapshot* snapshot
+    )
+{
+    rpal_memory_free( snapshot->entries );
+    snapshot->entries = NULL;
+    snapshot->nEntries = 0;
+    snapshot->capacity = 0;
+}
+
+RPRIVATE
+RBOOL
+    _snapshotReset
+    (
+        processSnapshot* snapshot
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    if( NULL == snapshot->entries )
+    {
+        snapshot->capacity = _SNAPSHOT_INITIAL_CAPACITY;
+        snapshot->entries = rpal_memory_alloc( sizeof( processEntry ) * snapshot->capacity );
+    }
+
+    if( NULL != snapshot->entries )
+    {
+        rpal_memory_zero( snapshot->entries, sizeof( processEntry ) * snapshot->capacity );
+        snapshot->nEntries = 0;
+        isSuccess = TRUE;
+    }
+    else
+    {
+        snapshot->capacity = 0;
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+processEntry*
+    _snapshotFind
+    (
+        processSnapshot* snapshot,
+        RU32 pid,
+        RU64 startTime
+    )
+{
+    processEntry* entry = NULL;
+    RU32 i = 0;
+
+    if( 0 == pid ||
+        0 == snapshot->capacity )
+    {
+        return NULL;
+    }
+
+    i = _snapshotSlot( snapshot, pid );
+
+    while( 0 != snapshot->entries[ i ].pid )
+    {
+        if( pid == snapshot->entries[ i ].pid &&
+            startTime == snapshot->entries[ i ].startTime )
+        {
+            entry = &snapshot->entries[ i ];
+            break;
+        }
+
+        i = ( i + 1 ) & ( snapshot->capacity - 1 );
+    }
+
+    return entry;
+}
+
+RPRIVATE
+RBOOL
+    _snapshotAdd
+    (
+        processSnapshot* snapshot,
+        processEntry* entry
+    );
+
+RPRIVATE
+RBOOL
+    _snapshotGrow
+    (
+        processSnapshot* snapshot
+    )
+{
+    RBOOL isSuccess = FALSE;
+    processSnapshot grown = { 0 };
+    RU32 i = 0;
+
+    grown.capacity = snapshot->capacity * 2;
+
+    if( NULL != ( grown.entries = rpal_memory_alloc( sizeof( processEntry ) * grown.capacity ) ) )
+    {
+        rpal_memory_zero( grown.entries, sizeof( processEntry ) * grown.capacity );
+        isSuccess = TRUE;
+
+        for( i = 0; i < snapshot->capacity; i++ )
+        {
+            if( 0 != snapshot->entries[ i ].pid &&
+                !_snapshotAdd( &grown, &snapshot->entries[ i ] ) )
+            {
+                isSuccess = FALSE;
+                break;
+            }
+        }
+
+        if( isSuccess )
+        {
+            _snapshotFree( snapshot );
+            *snapshot = grown;
+        }
+        else
+        {
+            _snapshotFree( &grown );
+        }
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RBOOL
+    _snapshotAdd
+    (
+        processSnapshot* snapshot,
+        processEntry* entry
+    )
+{
+    RU32 i = 0;
+
+    if( 0 == entry->pid ||
+        ( 0 == snapshot->capacity && !_snapshotReset( snapshot ) ) )
+    {
+        return FALSE;
+    }
+
+    // Keep the load under 75% so probe sequences stay short.
+    if( ( snapshot->nEntries + 1 ) * 4 > snapshot->capacity * 3 &&
+        !_snapshotGrow( snapshot ) )
+    {
+        return FALSE;
+    }
+
+    i = _snapshotSlot( snapshot, entry->pid );
+
+    while( 0 != snapshot->entries[ i ].pid )
+    {
+        if( entry->pid == snapshot->entries[ i ].pid &&
+            entry->startTime == snapshot->entries[ i ].startTime )
+        {
+            // Already there, nothing to do.
+            return TRUE;
+        }
+
+        i = ( i + 1 ) & ( snapshot->capacity - 1 );
+    }
+
+    snapshot->entries[ i ] = *entry;
+    snapshot->nEntries++;
+
+    return TRUE;
+}
+
 RPRIVATE
 RBOOL
     getSnapshot
     (
-        processEntry* toSnapshot,
-        RU32* nElem
+        processSnapshot* toSnapshot
     )
 {
     RBOOL isSuccess = FALSE;
-    RU32 i = 0;
-
-    if( NULL != toSnapshot )
-    {
-        rpal_memory_zero( toSnapshot, sizeof( processEntry ) * MAX_SNAPSHOT_SIZE );
-    }
+    processEntry entry = { 0 };
 
     if( NULL != toSnapshot &&
-        NULL != nElem )
+        _snapshotReset( toSnapshot ) )
     {
 #ifdef RPAL_PLATFORM_WINDOWS
         HANDLE hSnapshot = NULL;
@@ -80,11 +785,22 @@ RBOOL
                         continue;
                     }
 
-                    toSnapshot[ i ].pid = procEntry.th32ProcessID;
-                    toSnapshot[ i ].ppid = procEntry.th32ParentProcessID;
-                    i++;
-                } while( Process32NextW( hSnapshot, &procEntry ) &&
-                         MAX_SNAPSHOT_SIZE > i );
+                    entry.pid = procEntry.th32ProcessID;
+                    entry.ppid = procEntry.th32ParentProcessID;
+
+                    // Protected processes may not give us their start time,
+                    // they are then tracked by pid alone.
+                    if( !processLib_getProcessStartTime( entry.pid, &entry.startTime ) )
+                    {
+                        entry.startTime = 0;
+                    }
+
+                    if( !_snapshotAdd( toSnapshot, &entry ) )
+                    {
+                        isSuccess = FALSE;
+                        break;
+                    }
+                } while( Process32NextW( hSnapshot, &procEntry ) );
             }
 
             CloseHandle( hSnapshot );
@@ -98,14 +814,20 @@ RBOOL
         {
             isSuccess = TRUE;
 
-            while( rDir_next( hProcDir, &finfo ) &&
-                   MAX_SNAPSHOT_SIZE > i )
+            while( rDir_next( hProcDir, &finfo ) )
             {
-                if( rpal_string_stoi( (RPCHAR)finfo.fileName, &( toSnapshot[ i ].pid ) )
-                    && 0 != toSnapshot[ i ].pid )
+                if( rpal_string_stoi( (RPCHAR)finfo.fileName, &entry.pid ) &&
+                    0 != entry.pid &&
+                    // If the stat is gone the process exited while we were looking.
+                    processLib_getProcessStartTime( entry.pid, &entry.startTime ) )
                 {
-                    toSnapshot[ i ].ppid = NO_PARENT_PID;
-                    i++;
+                    entry.ppid = NO_PARENT_PID;
+
+                    if( !_snapshotAdd( toSnapshot, &entry ) )
+                    {
+                        isSuccess = FALSE;
+                        break;
+                    }
                 }
             }
 
@@ -115,6 +837,7 @@ RBOOL
         int mib[] = { CTL_KERN, KERN_PROC, KERN_PROC_ALL };
         struct kinfo_proc* infos = NULL;
         size_t size = 0;
+        size_t i = 0;
         int ret = 0;
 
         if( 0 == ( ret = sysctl( mib, ARRAY_N_ELEM( mib ), infos, &size, NULL, 0 ) ) )
@@ -135,25 +858,33 @@ RBOOL
         {
             isSuccess = TRUE;
             size = size / sizeof( struct kinfo_proc );
-            for( i = 0; i < size && MAX_SNAPSHOT_SIZE > i; i++ )
+            for( i = 0; i < size; i++ )
             {
-                toSnapshot[ i ].pid = infos[ i ].kp_proc.p_pid;
-                toSnapshot[ i ].ppid = infos[ i ].kp_eproc.e_ppid;
-            }
+                // The kernel_task is pid 0, it is tracked separately.
+                if( 0 == infos[ i ].kp_proc.p_pid )
+                {
+                    continue;
+                }
 
-            if( NULL != infos )
-            {
-                rpal_memory_free( infos );
-                infos = NULL;
+                entry.pid = infos[ i ].kp_proc.p_pid;
+                entry.ppid = infos[ i ].kp_eproc.e_ppid;
+                entry.startTime = ( (RU64)infos[ i ].kp_proc.p_starttime.tv_sec * 1000000 ) +
+                                  infos[ i ].kp_proc.p_starttime.tv_usec;
+
+                if( !_snapshotAdd( toSnapshot, &entry ) )
+                {
+                    isSuccess = FALSE;
+                    break;
+                }
             }
         }
-#endif
 
-        rpal_sort_array( toSnapshot, 
-                         i, 
-                         sizeof( processEntry ), 
-                         (rpal_ordering_func)rpal_order_RU32 );
-        *nElem = i;
+        if( NULL != infos )
+        {
+            rpal_memory_free( infos );
+            infos = NULL;
+        }
+#endif
     }
 
     return isSuccess;
@@ -175,6 +906,7 @@ RBOOL
     RBOOL isSuccess = FALSE;
     rSequence info = NULL;
     rSequence parentInfo = NULL;
+    rSequence container = NULL;
     RPNCHAR cleanPath = NULL;
     Atom atom = { 0 };
     Atom parentAtom = { 0 };
@@ -196,6 +928,10 @@ RBOOL
         atoms_getOneTime( &atom );
     }
 
+    // The event and everything gathered into it only live until published,
+    // subscribers keeping it get their own copy.
+    rpcm_transient_begin();
+
     if( NULL != ( info = rSequence_new() ) )
     {
         // If we got a real parent pid we'll include it right away since we don't want to
@@ -280,6 +1016,19 @@ RBOOL
             {
                 rSequence_free( parentInfo );
             }
+
+            _envCaptureProcess( pid, ppid, info );
+
+            if( NULL != ( container = processLib_getContainerInfo( pid, g_containerCache ) ) &&
+                !rSequence_addSEQUENCE( info, RP_TAGS_CONTAINER, container ) )
+            {
+                rSequence_free( container );
+            }
+        }
+        else
+        {
+            _envRelease( pid );
+            processLib_forgetContainerInfo( g_containerCache, pid );
         }
 
         if( isStarting )
@@ -306,9 +1055,67 @@ RBOOL
         rpal_debug_error( "could not allocate info on new process" );
     }
 
+    rpcm_transient_end();
+
     return isSuccess;
 }
 
+RPRIVATE
+RVOID
+    diffSnapshots
+    (
+        processSnapshot* previousSnapshot,
+        processSnapshot* currentSnapshot
+    )
+{
+    RU32 i = 0;
+    processEntry* entry = NULL;
+
+    // Terminations are reported first so that when a pid got reused the
+    // atom of the old process is gone before the new one is registered.
+    for( i = 0; i < previousSnapshot->capacity; i++ )
+    {
+        entry = &previousSnapshot->entries[ i ];
+
+        if( 0 != entry->pid &&
+            NULL == _snapshotFind( currentSnapshot, entry->pid, entry->startTime ) )
+        {
+            if( !notifyOfProcess( entry->pid,
+                                  entry->ppid,
+                                  FALSE,
+                                  NULL,
+                                  NULL,
+                                  KERNEL_ACQ_NO_USER_ID,
+                                  0 ) )
+            {
+                rpal_debug_warning( "error reporting terminated process: %d",
+                                    entry->pid );
+            }
+        }
+    }
+
+    for( i = 0; i < currentSnapshot->capacity; i++ )
+    {
+        entry = &currentSnapshot->entries[ i ];
+
+        if( 0 != entry->pid &&
+            NULL == _snapshotFind( previousSnapshot, entry->pid, entry->startTime ) )
+        {
+            if( !notifyOfProcess( entry->pid,
+                                  entry->ppid,
+                                  TRUE,
+                                  NULL,
+                                  NULL,
+                                  KERNEL_ACQ_NO_USER_ID,
+                                  0 ) )
+            {
+                rpal_debug_warning( "error reporting new process: %d",
+                                    entry->pid );
+            }
+        }
+    }
+}
+
 RPRIVATE
 RVOID
     procUserModeDiff
@@ -316,17 +1123,12 @@ RVOID
         rEvent isTimeToStop
     )
 {
-    processEntry snapshot_1[ MAX_SNAPSHOT_SIZE ] = { 0 };
-    processEntry snapshot_2[ MAX_SNAPSHOT_SIZE ] = { 0 };
-    processEntry* currentSnapshot = snapshot_1;
-    processEntry* previousSnapshot = snapshot_2;
-    processEntry* tmpSnapshot = NULL;
+    processSnapshot snapshot_1 = { 0 };
+    processSnapshot snapshot_2 = { 0 };
+    processSnapshot* currentSnapshot = &snapshot_1;
+    processSnapshot* previousSnapshot = &snapshot_2;
+    processSnapshot* tmpSnapshot = NULL;
     RBOOL isFirstSnapshots = TRUE;
-    RU32 i = 0;
-    RBOOL isFound = FALSE;
-    RU32 nTmpElem = 0;
-    RU32 nCurElem = 0;
-    RU32 nPrevElem = 0;
     LibOsPerformanceProfile perfProfile = { 0 };
 
     perfProfile.enforceOnceIn = 1;
@@ -349,11 +1151,7 @@ RVOID
         currentSnapshot = previousSnapshot;
         previousSnapshot = tmpSnapshot;
 
-        nTmpElem = nCurElem;
-        nCurElem = nPrevElem;
-        nPrevElem = nTmpElem;
-
-        if( getSnapshot( currentSnapshot, &nCurElem ) )
+        if( getSnapshot( currentSnapshot ) )
         {
             if( isFirstSnapshots )
             {
@@ -361,69 +1159,43 @@ RVOID
                 continue;
             }
 
-            // Diff to find new processes
-            for( i = 0; i < nCurElem; i++ )
-            {
-                isFound = FALSE;
-
-                if( (RU32)( -1 ) != rpal_binsearch_array( previousSnapshot,
-                                                          nPrevElem,
-                                                          sizeof( processEntry ),
-                                                          &(currentSnapshot[ i ].pid),
-                                                          (rpal_ordering_func)rpal_order_RU32 ) )
-                {
-                    isFound = TRUE;
-                }
-
-                if( !isFound )
-                {
-                    if( !notifyOfProcess( currentSnapshot[ i ].pid,
-                                          currentSnapshot[ i ].ppid,
-                                          TRUE,
-                                          NULL,
-                                          NULL,
-                                          KERNEL_ACQ_NO_USER_ID,
-                                          0 ) )
-                    {
-                        rpal_debug_warning( "error reporting new process: %d",
-                                            currentSnapshot[ i ].pid );
-                    }
-                }
-            }
+            diffSnapshots( previousSnapshot, currentSnapshot );
+        }
+        else
+        {
+            // A partial snapshot would look like mass terminations, so
+            // start over from a clean baseline on the next pass.
+            isFirstSnapshots = TRUE;
+        }
 
-            // Diff to find terminated processes
-            for( i = 0; i < nPrevElem; i++ )
-            {
-                isFound = FALSE;
+        libOs_timeoutWithProfile( &perfProfile, TRUE, isTimeToStop );
+    }
 
-                if( (RU32)( -1 ) != rpal_binsearch_array( currentSnapshot,
-                                                          nCurElem,
-                                                          sizeof( processEntry ),
-                                                          &(previousSnapshot[ i ].pid),
-                                                          (rpal_ordering_func)rpal_order_RU32 ) )
-                {
-                    isFound = TRUE;
-                }
+    _snapshotFree( &snapshot_1 );
+    _snapshotFree( &snapshot_2 );
+}
 
-                if( !isFound )
-                {
-                    if( !notifyOfProcess( previousSnapshot[ i ].pid,
-                                          previousSnapshot[ i ].ppid,
-                                          FALSE,
-                                          NULL,
-                                          NULL,
-                                          KERNEL_ACQ_NO_USER_ID,
-                                          0 ) )
-                    {
-                        rpal_debug_warning( "error reporting terminated process: %d",
-                                            previousSnapshot[ i ].pid );
-                    }
-                }
-            }
-        }
+RPRIVATE
+RBOOL
+    isTrackedProcessAlive
+    (
+        processEntry* entry
+    )
+{
+    RBOOL isAlive = FALSE;
+    RU64 startTime = 0;
 
-        libOs_timeoutWithProfile( &perfProfile, TRUE, isTimeToStop );
+    if( processLib_getProcessStartTime( entry->pid, &startTime ) )
+    {
+        // A different start time means the pid was reused.
+        isAlive = ( 0 == entry->startTime || startTime == entry->startTime );
+    }
+    else
+    {
+        isAlive = processLib_isPidInUse( entry->pid );
     }
+
+    return isAlive;
 }
 
 RPRIVATE
@@ -435,19 +1207,32 @@ RVOID
 {
     RU32 i = 0;
     RU32 nScratch = 0;
-    RU32 nProcessEntries = 0;
     KernelAcqProcess new_from_kernel[ 200 ] = { 0 };
-    processEntry tracking_user[ MAX_SNAPSHOT_SIZE ] = { 0 };
+    processSnapshot tracking_1 = { 0 };
+    processSnapshot tracking_2 = { 0 };
+    processSnapshot* tracking = &tracking_1;
+    processSnapshot* survivors = &tracking_2;
+    processSnapshot* tmpTracking = NULL;
+    processEntry entry = { 0 };
     processLibProcEntry* tmpProcesses = NULL;
 
+    if( !_snapshotReset( tracking ) )
+    {
+        return;
+    }
+
     // Prime the list of tracked processes so we see them terminate.
     if( NULL != ( tmpProcesses = processLib_getProcessEntries( FALSE ) ) )
     {
-        for( i = 0; i < MAX_SNAPSHOT_SIZE; i++ )
+        for( i = 0; 0 != tmpProcesses[ i ].pid; i++ )
         {
-            if( 0 == tmpProcesses[ i ].pid ) break;
-            tracking_user[ i ].pid = tmpProcesses[ i ].pid;
-            tracking_user[ i ].ppid = NO_PARENT_PID;
+            entry.pid = tmpProcesses[ i ].pid;
+            entry.ppid = NO_PARENT_PID;
+            if( !processLib_getProcessStartTime( entry.pid, &entry.startTime ) )
+            {
+                entry.startTime = 0;
+            }
+            _snapshotAdd( tracking, &entry );
         }
 
         rpal_memory_free( tmpProcesses );
@@ -464,6 +1249,38 @@ RVOID
             break;
         }
 
+        // Look for terminations before reporting the new processes, a new
+        // process may be reusing the pid of one that just went away.
+        if( _snapshotReset( survivors ) )
+        {
+            for( i = 0; i < tracking->capacity; i++ )
+            {
+                if( 0 == tracking->entries[ i ].pid )
+                {
+                    continue;
+                }
+
+                if( isTrackedProcessAlive( &tracking->entries[ i ] ) )
+                {
+                    _snapshotAdd( survivors, &tracking->entries[ i ] );
+                }
+                else
+                {
+                    notifyOfProcess( tracking->entries[ i ].pid,
+                                     tracking->entries[ i ].ppid,
+                                     FALSE,
+                                     NULL,
+                                     NULL,
+                                     KERNEL_ACQ_NO_USER_ID,
+                                     0 );
+                }
+            }
+
+            tmpTracking = tracking;
+            tracking = survivors;
+            survivors = tmpTracking;
+        }
+
         for( i = 0; i < nScratch; i++ )
         {
             new_from_kernel[ i ].ts += MSEC_FROM_SEC( rpal_time_getGlobalFromLocal( 0 ) );
@@ -475,38 +1292,19 @@ RVOID
                              new_from_kernel[ i ].uid,
                              new_from_kernel[ i ].ts );
 
-            if( nProcessEntries >= ARRAY_N_ELEM( tracking_user ) )
-            {
-                continue;
-            }
-
-            tracking_user[ nProcessEntries ].pid = new_from_kernel[ i ].pid;
-            tracking_user[ nProcessEntries ].ppid = new_from_kernel[ i ].ppid;
-            nProcessEntries++;
-        }
-
-        for( i = 0; i < nProcessEntries; i++ )
-        {
-            if( !processLib_isPidInUse( tracking_user[ i ].pid ) )
+            entry.pid = new_from_kernel[ i ].pid;
+            entry.ppid = new_from_kernel[ i ].ppid;
+            if( !processLib_getProcessStartTime( entry.pid, &entry.startTime ) )
             {
-                notifyOfProcess( tracking_user[ i ].pid, 
-                                 tracking_user[ i ].ppid, 
-                                 FALSE, 
-                                 NULL, 
-                                 NULL,
-                                 KERNEL_ACQ_NO_USER_ID,
-                                 0 );
-                if( nProcessEntries != i + 1 )
-                {
-                    rpal_memory_memmove( &(tracking_user[ i ]), 
-                                         &(tracking_user[ i + 1 ]), 
-                                         ( nProcessEntries - ( i + 1 ) ) * sizeof( *tracking_user ) );
-                }
-                nProcessEntries--;
-                i--;
+                // Already gone, it will be reported on the next pass.
+                entry.startTime = 0;
             }
+            _snapshotAdd( tracking, &entry );
         }
     }
+
+    _snapshotFree( &tracking_1 );
+    _snapshotFree( &tracking_2 );
 }
 
 RPRIVATE
@@ -521,6 +1319,7 @@ RPVOID
     processLibProcEntry* tmpProcesses = NULL;
     Atom tmpAtom = { 0 };
     rSequence processInfo = NULL;
+    RU32 ppid = 0;
 
     UNREFERENCED_PARAMETER( ctx );
 
@@ -536,9 +1335,8 @@ RPVOID
         tmpAtom.key.process.pid = 0;
         atoms_register( &tmpAtom );
 
-        for( i = 0; i < MAX_SNAPSHOT_SIZE; i++ )
+        for( i = 0; 0 != tmpProcesses[ i ].pid; i++ )
         {
-            if( 0 == tmpProcesses[ i ].pid ) break;
             tmpAtom.key.category = RP_TAGS_NOTIFICATION_NEW_PROCESS;
             tmpAtom.key.process.pid = tmpProcesses[ i ].pid;
             atoms_register( &tmpAtom );
@@ -547,6 +1345,11 @@ RPVOID
                 hbs_timestampEvent( processInfo, 0 ) &&
                 HbsSetThisAtom( processInfo, tmpAtom.id ) )
             {
+                // Existing processes also get their environment recorded so
+                // that children started later can be reported as deltas.
+                _envCaptureProcess( tmpProcesses[ i ].pid,
+                                    rSequence_getRU32( processInfo, RP_TAGS_PARENT_PROCESS_ID, &ppid ) ? ppid : NO_PARENT_PID,
+                                    processInfo );
                 hbs_publish( RP_TAGS_NOTIFICATION_EXISTING_PROCESS, processInfo );
                 rSequence_free( processInfo );
             }
@@ -586,6 +1389,8 @@ rpcm_tag collector_1_events[] = { RP_TAGS_NOTIFICATION_NEW_PROCESS,
                                   RP_TAGS_NOTIFICATION_EXISTING_PROCESS,
                                   0 };
 
+RU32 collector_1_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_1_init
     (
@@ -598,10 +1403,23 @@ RBOOL
 
     if( NULL != hbsState )
     {
+        if( !_envStoreInit() )
+        {
+            rpal_debug_warning( "failed to create environment store, environments not captured" );
+        }
+
+        g_containerCache = processLib_newContainerCache();
+
         if( rThreadPool_task( hbsState->hThreadPool, processDiffThread, NULL ) )
         {
             isSuccess = TRUE;
         }
+        else
+        {
+            _envStoreDeinit();
+            processLib_freeContainerCache( g_containerCache );
+            g_containerCache = NULL;
+        }
     }
 
     return isSuccess;
@@ -616,6 +1434,10 @@ RBOOL
 {
     RBOOL isSuccess = FALSE;
 
+    _envStoreDeinit();
+    processLib_freeContainerCache( g_containerCache );
+    g_containerCache = NULL;
+
     if( NULL != hbsState &&
         rpal_memory_isValid( config ) )
     {
@@ -630,28 +1452,155 @@ RBOOL
 //=============================================================================
 HBS_DECLARE_TEST( um_snapshot )
 {
-    RU32 nElem = 0;
-    RBOOL isThisPidFound = FALSE;
-    RU32 i = 0;
     RU32 thisPid = 0;
-
-    processEntry snapshot[ MAX_SNAPSHOT_SIZE ] = { 0 };
-    HBS_ASSERT_TRUE( getSnapshot( (processEntry*)&snapshot, &nElem ) );
-    HBS_ASSERT_TRUE( 0 != nElem );
-    HBS_ASSERT_TRUE( ARRAY_N_ELEM( snapshot ) > nElem );
+    RU64 thisStartTime = 0;
+    processSnapshot snapshot = { 0 };
 
     thisPid = processLib_getCurrentPid();
+    HBS_ASSERT_TRUE( processLib_getProcessStartTime( thisPid, &thisStartTime ) );
+
+    HBS_ASSERT_TRUE( getSnapshot( &snapshot ) );
+    HBS_ASSERT_TRUE( 0 != snapshot.nEntries );
+    HBS_ASSERT_TRUE( snapshot.capacity > snapshot.nEntries );
+    HBS_ASSERT_TRUE( NULL != _snapshotFind( &snapshot, thisPid, thisStartTime ) );
+    HBS_ASSERT_TRUE( NULL == _snapshotFind( &snapshot, thisPid, thisStartTime + 1 ) );
+
+    _snapshotFree( &snapshot );
+}
+
+HBS_DECLARE_TEST( snapshot_set )
+{
+    processSnapshot snapshot = { 0 };
+    processEntry entry = { 0 };
+    RU32 nProcesses = 5000;
+    RU32 i = 0;
+    RU32 nErrors = 0;
+
+    HBS_ASSERT_TRUE( _snapshotReset( &snapshot ) );
+
+    // Well past the old fixed snapshot size, every pid is there twice
+    // to simulate a reuse with a different start time.
+    for( i = 1; i <= nProcesses; i++ )
+    {
+        entry.pid = i;
+        entry.ppid = NO_PARENT_PID;
+        entry.startTime = 1000;
+        if( !_snapshotAdd( &snapshot, &entry ) ) nErrors++;
+        entry.startTime = 2000 + i;
+        if( !_snapshotAdd( &snapshot, &entry ) ) nErrors++;
+        // Adding the same process twice is a no-op.
+        if( !_snapshotAdd( &snapshot, &entry ) ) nErrors++;
+    }
+    HBS_ASSERT_TRUE( 0 == nErrors );
+    HBS_ASSERT_TRUE( nProcesses * 2 == snapshot.nEntries );
+    HBS_ASSERT_TRUE( snapshot.capacity * 3 >= snapshot.nEntries * 4 );
 
-    for( i = 0; i < nElem; i++ )
+    for( i = 1; i <= nProcesses; i++ )
     {
-        if( thisPid == snapshot[ i ].pid )
+        if( NULL == _snapshotFind( &snapshot, i, 1000 ) ||
+            NULL == _snapshotFind( &snapshot, i, 2000 + i ) ||
+            NULL != _snapshotFind( &snapshot, i, 1 ) )
         {
-            isThisPidFound = TRUE;
-            break;
+            nErrors++;
         }
     }
+    HBS_ASSERT_TRUE( 0 == nErrors );
+    HBS_ASSERT_TRUE( NULL == _snapshotFind( &snapshot, nProcesses + 1, 1000 ) );
+    HBS_ASSERT_TRUE( NULL == _snapshotFind( &snapshot, 0, 0 ) );
+
+    HBS_ASSERT_TRUE( _snapshotReset( &snapshot ) );
+    HBS_ASSERT_TRUE( 0 == snapshot.nEntries );
+    HBS_ASSERT_TRUE( NULL == _snapshotFind( &snapshot, 1, 1000 ) );
+
+    _snapshotFree( &snapshot );
+}
+
+HBS_DECLARE_TEST( pid_reuse )
+{
+    processSnapshot previous = { 0 };
+    processSnapshot current = { 0 };
+    processEntry entry = { 0 };
+    rQueue notifQueue = NULL;
+    rSequence notif = NULL;
+    RU32 size = 0;
+    RU32 thisPid = 0;
+    RU64 thisStartTime = 0;
+    RU32 outPid = 0;
+    RPNCHAR outPath = NULL;
+    rSequence container = NULL;
+    Atom atom = { 0 };
+    RU8 oldAtomId[ HBS_ATOM_ID_SIZE ] = { 0 };
+
+    // We pretend our own process replaced an older one with the same pid.
+    thisPid = processLib_getCurrentPid();
+    HBS_ASSERT_TRUE( processLib_getProcessStartTime( thisPid, &thisStartTime ) );
+
+    atom.key.category = RP_TAGS_NOTIFICATION_NEW_PROCESS;
+    atom.key.process.pid = thisPid;
+    atoms_register( &atom );
+    rpal_memory_memcpy( oldAtomId, atom.id, HBS_ATOM_ID_SIZE );
+
+    HBS_ASSERT_TRUE( rQueue_create( &notifQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_NEW_PROCESS, NULL, 0, notifQueue, NULL ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_TERMINATE_PROCESS, NULL, 0, notifQueue, NULL ) );
+
+    HBS_ASSERT_TRUE( _snapshotReset( &previous ) );
+    HBS_ASSERT_TRUE( _snapshotReset( &current ) );
+
+    entry.ppid = NO_PARENT_PID;
+
+    // Same pid, different start time.
+    entry.pid = thisPid;
+    entry.startTime = thisStartTime - 1;
+    HBS_ASSERT_TRUE( _snapshotAdd( &previous, &entry ) );
+    entry.startTime = thisStartTime;
+    HBS_ASSERT_TRUE( _snapshotAdd( &current, &entry ) );
+
+    // An unchanged process generates nothing.
+    entry.pid = thisPid + 1;
+    entry.startTime = 42;
+    HBS_ASSERT_TRUE( _snapshotAdd( &previous, &entry ) );
+    HBS_ASSERT_TRUE( _snapshotAdd( &current, &entry ) );
+
+    diffSnapshots( &previous, &current );
+
+    HBS_ASSERT_TRUE( rQueue_getSize( notifQueue, &size ) );
+    HBS_ASSERT_TRUE( 2 == size );
+
+    // The old process terminates first, termination has no path.
+    if( HBS_ASSERT_TRUE( rQueue_remove( notifQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( rSequence_getRU32( notif, RP_TAGS_PROCESS_ID, &outPid ) );
+        HBS_ASSERT_TRUE( thisPid == outPid );
+        HBS_ASSERT_TRUE( !rSequence_getSTRINGN( notif, RP_TAGS_FILE_PATH, &outPath ) );
+        rSequence_free( notif );
+    }
+
+    if( HBS_ASSERT_TRUE( rQueue_remove( notifQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( rSequence_getRU32( notif, RP_TAGS_PROCESS_ID, &outPid ) );
+        HBS_ASSERT_TRUE( thisPid == outPid );
+        HBS_ASSERT_TRUE( rSequence_getSTRINGN( notif, RP_TAGS_FILE_PATH, &outPath ) );
+#ifdef RPAL_PLATFORM_LINUX
+        HBS_ASSERT_TRUE( rSequence_getSEQUENCE( notif, RP_TAGS_CONTAINER, &container ) );
+#endif
+        rSequence_free( notif );
+    }
+
+    // The pid now maps to a new atom.
+    atom.key.category = RP_TAGS_NOTIFICATION_NEW_PROCESS;
+    atom.key.process.pid = thisPid;
+    if( HBS_ASSERT_TRUE( atoms_query( &atom, rpal_time_getGlobalPreciseTime() ) ) )
+    {
+        HBS_ASSERT_TRUE( 0 != rpal_memory_memcmp( oldAtomId, atom.id, HBS_ATOM_ID_SIZE ) );
+    }
 
-    HBS_ASSERT_TRUE( isThisPidFound );
+    _snapshotFree( &previous );
+    _snapshotFree( &current );
+
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_PROCESS, notifQueue, NULL );
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_TERMINATE_PROCESS, notifQueue, NULL );
+    rQueue_free( notifQueue );
 }
 
 HBS_DECLARE_TEST( notify_process )
@@ -948,6 +1897,232 @@ HBS_DECLARE_TEST( um_diff_thread )
     rQueue_free( notifQueue );
 }
 
+HBS_DECLARE_TEST( env_capture )
+{
+    rList parentVars = NULL;
+    rList childVars = NULL;
+    rList bigVars = NULL;
+    rList tmpList = NULL;
+    rSequence parentInfo = NULL;
+    rSequence childInfo = NULL;
+    rSequence bigInfo = NULL;
+    rSequence selfInfo = NULL;
+    RPU8 parentHash = NULL;
+    RPU8 refHash = NULL;
+    RPU8 childHash = NULL;
+    RU32 hashSize = 0;
+    RPNCHAR var = NULL;
+    RU32 nFound = 0;
+    RU8 isTruncated = FALSE;
+    RPNCHAR bigVar = NULL;
+    RU32 bigSize = ( _ENV_MAX_CAPTURE_SIZE / sizeof( RNCHAR ) ) + 1;
+    RU32 i = 0;
+
+    HBS_ASSERT_TRUE( _envStoreInit() );
+
+    parentVars = rList_new( RP_TAGS_ENVIRONMENT_VARIABLE, RPCM_STRINGN );
+    childVars = rList_new( RP_TAGS_ENVIRONMENT_VARIABLE, RPCM_STRINGN );
+    bigVars = rList_new( RP_TAGS_ENVIRONMENT_VARIABLE, RPCM_STRINGN );
+    parentInfo = rSequence_new();
+    childInfo = rSequence_new();
+    bigInfo = rSequence_new();
+    selfInfo = rSequence_new();
+    bigVar = rpal_memory_alloc( bigSize * sizeof( RNCHAR ) );
+    HBS_ASSERT_TRUE( NULL != parentVars && NULL != childVars && NULL != bigVars );
+    HBS_ASSERT_TRUE( NULL != parentInfo && NULL != childInfo && NULL != bigInfo && NULL != selfInfo );
+    HBS_ASSERT_TRUE( NULL != bigVar );
+
+    rList_addSTRINGN( parentVars, _NC( "PATH=/usr/bin" ) );
+    rList_addSTRINGN( parentVars, _NC( "LANG=C" ) );
+    rList_addSTRINGN( parentVars, _NC( "TERM=xterm" ) );
+    rList_addSTRINGN( childVars, _NC( "LANG=C" ) );
+    rList_addSTRINGN( childVars, _NC( "PATH=/opt/bin" ) );
+    rList_addSTRINGN( childVars, _NC( "HOME=/root" ) );
+    rList_addSTRINGN( childVars, _NC( "HOME=/root" ) );
+
+    // A process without a known parent reports its full environment.
+    HBS_ASSERT_TRUE( _envCapture( 100, NO_PARENT_PID, parentVars, parentInfo ) );
+    HBS_ASSERT_TRUE( rSequence_getBUFFER( parentInfo, RP_TAGS_ENVIRONMENT_HASH, &parentHash, &hashSize ) );
+    HBS_ASSERT_TRUE( sizeof( CryptoLib_Hash ) == hashSize );
+    HBS_ASSERT_TRUE( !rSequence_getBUFFER( parentInfo, RP_TAGS_PARENT_ENVIRONMENT_HASH, &refHash, &hashSize ) );
+    HBS_ASSERT_TRUE( rSequence_getLIST( parentInfo, RP_TAGS_ENVIRONMENT_VARIABLES, &tmpList ) );
+    HBS_ASSERT_TRUE( 3 == rList_getNumElements( tmpList ) );
+    HBS_ASSERT_TRUE( 3 == rpal_btree_getSize( g_envValues, FALSE ) );
+
+    // A child only reports what changed from its parent.
+    HBS_ASSERT_TRUE( _envCapture( 101, 100, childVars, childInfo ) );
+    HBS_ASSERT_TRUE( rSequence_getBUFFER( childInfo, RP_TAGS_ENVIRONMENT_HASH, &childHash, &hashSize ) );
+    HBS_ASSERT_TRUE( 0 != rpal_memory_memcmp( childHash, parentHash, sizeof( CryptoLib_Hash ) ) );
+    if( HBS_ASSERT_TRUE( rSequence_getBUFFER( childInfo, RP_TAGS_PARENT_ENVIRONMENT_HASH, &refHash, &hashSize ) ) )
+    {
+        HBS_ASSERT_TRUE( 0 == rpal_memory_memcmp( refHash, parentHash, sizeof( CryptoLib_Hash ) ) );
+    }
+    if( HBS_ASSERT_TRUE( rSequence_getLIST( childInfo, RP_TAGS_ENVIRONMENT_VARIABLES, &tmpList ) ) )
+    {
+        HBS_ASSERT_TRUE( 2 == rList_getNumElements( tmpList ) );
+        nFound = 0;
+        while( rList_getSTRINGN( tmpList, RP_TAGS_ENVIRONMENT_VARIABLE, &var ) )
+        {
+            if( 0 == rpal_string_strcmp( var, _NC( "PATH=/opt/bin" ) ) ||
+                0 == rpal_string_strcmp( var, _NC( "HOME=/root" ) ) )
+            {
+                nFound++;
+            }
+        }
+        HBS_ASSERT_TRUE( 2 == nFound );
+    }
+    if( HBS_ASSERT_TRUE( rSequence_getLIST( childInfo, RP_TAGS_ENVIRONMENT_REMOVED, &tmpList ) ) )
+    {
+        HBS_ASSERT_TRUE( 1 == rList_getNumElements( tmpList ) );
+        if( HBS_ASSERT_TRUE( rList_getSTRINGN( tmpList, RP_TAGS_ENVIRONMENT_VARIABLE, &var ) ) )
+        {
+            HBS_ASSERT_TRUE( 0 == rpal_string_strcmp( var, _NC( "TERM" ) ) );
+        }
+    }
+    HBS_ASSERT_TRUE( !rSequence_getRU8( childInfo, RP_TAGS_IS_TRUNCATED, &isTruncated ) );
+
+    // Shared values are only stored once.
+    HBS_ASSERT_TRUE( 5 == rpal_btree_getSize( g_envValues, FALSE ) );
+
+    // Values over the capture limit are dropped and flagged.
+    for( i = 0; i < bigSize - 1; i++ )
+    {
+        bigVar[ i ] = _NC( 'A' );
+    }
+    bigVar[ 0 ] = _NC( 'B' );
+    bigVar[ 1 ] = _NC( '=' );
+    bigVar[ bigSize - 1 ] = 0;
+    rList_addSTRINGN( bigVars, _NC( "LANG=C" ) );
+    rList_addSTRINGN( bigVars, bigVar );
+    HBS_ASSERT_TRUE( _envCapture( 102, 100, bigVars, bigInfo ) );
+    HBS_ASSERT_TRUE( rSequence_getRU8( bigInfo, RP_TAGS_IS_TRUNCATED, &isTruncated ) );
+    HBS_ASSERT_TRUE( 5 == rpal_btree_getSize( g_envValues, FALSE ) );
+
+    // Values are released with the last process referencing them.
+    _envRelease( 100 );
+    HBS_ASSERT_TRUE( 3 == rpal_btree_getSize( g_envValues, FALSE ) );
+    _envRelease( 102 );
+    HBS_ASSERT_TRUE( 3 == rpal_btree_getSize( g_envValues, FALSE ) );
+    _envRelease( 101 );
+    HBS_ASSERT_TRUE( 0 == rpal_btree_getSize( g_envValues, FALSE ) );
+    HBS_ASSERT_TRUE( 0 == g_envStoreSize );
+
+    // Capture from a real process.
+    _envCaptureProcess( processLib_getCurrentPid(), NO_PARENT_PID, selfInfo );
+    HBS_ASSERT_TRUE( rSequence_getBUFFER( selfInfo, RP_TAGS_ENVIRONMENT_HASH, &refHash, &hashSize ) );
+    HBS_ASSERT_TRUE( rSequence_getLIST( selfInfo, RP_TAGS_ENVIRONMENT_VARIABLES, &tmpList ) );
+
+    _envStoreDeinit();
+
+    rList_free( parentVars );
+    rList_free( childVars );
+    rList_free( bigVars );
+    rSequence_free( parentInfo );
+    rSequence_free( childInfo );
+    rSequence_free( bigInfo );
+    rSequence_free( selfInfo );
+    rpal_memory_free( bigVar );
+}
+
+#define _ATOMS_STRESS_COUNT     1000000
+
+HBS_DECLARE_TEST( atoms_stress )
+{
+    Atom atom = { 0 };
+    RPU8 ids = NULL;
+    RU32 i = 0;
+    RU32 nErrors = 0;
+    RU64 startTime = 0;
+    RU64 expiredOn = 0;
+
+    ids = rpal_memory_alloc( _ATOMS_STRESS_COUNT * HBS_ATOM_ID_SIZE );
+    if( !HBS_ASSERT_TRUE( NULL != ids ) )
+    {
+        return;
+    }
+
+    // Use module atoms with pids no real process has to stay clear of live atoms.
+    startTime = rpal_time_getGlobalPreciseTime();
+    for( i = 0; i < _ATOMS_STRESS_COUNT; i++ )
+    {
+        rpal_memory_zero( &atom, sizeof( atom ) );
+        atom.key.category = RP_TAGS_NOTIFICATION_MODULE_LOAD;
+        atom.key.module.pid = 0x80000000 | i;
+        atom.key.module.baseAddress = i;
+        if( !atoms_register( &atom ) )
+        {
+            nErrors++;
+        }
+        rpal_memory_memcpy( ids + ( i * HBS_ATOM_ID_SIZE ), atom.id, HBS_ATOM_ID_SIZE );
+    }
+    HBS_ASSERT_TRUE( 0 == nErrors );
+    rpal_debug_info( "registered %d atoms in %d ms",
+                     _ATOMS_STRESS_COUNT,
+                     (RU32)( rpal_time_getGlobalPreciseTime() - startTime ) );
+
+    // Lookups by key and by id.
+    nErrors = 0;
+    startTime = rpal_time_getGlobalPreciseTime();
+    for( i = 0; i < _ATOMS_STRESS_COUNT; i++ )
+    {
+        rpal_memory_zero( &atom, sizeof( atom ) );
+        atom.key.category = RP_TAGS_NOTIFICATION_MODULE_LOAD;
+        atom.key.module.pid = 0x80000000 | i;
+        atom.key.module.baseAddress = i;
+        if( !atoms_query( &atom, 0 ) ||
+            0 != rpal_memory_memcmp( atom.id, ids + ( i * HBS_ATOM_ID_SIZE ), HBS_ATOM_ID_SIZE ) ||
+            ( 0x80000000 | i ) != atoms_getPid( ids + ( i * HBS_ATOM_ID_SIZE ) ) )
+        {
+            nErrors++;
+        }
+    }
+    HBS_ASSERT_TRUE( 0 == nErrors );
+    rpal_debug_info( "queried %d atoms in %d ms",
+                     _ATOMS_STRESS_COUNT,
+                     (RU32)( rpal_time_getGlobalPreciseTime() - startTime ) );
+
+    // Registering a key again replaces its id in the index.
+    rpal_memory_zero( &atom, sizeof( atom ) );
+    atom.key.category = RP_TAGS_NOTIFICATION_MODULE_LOAD;
+    atom.key.module.pid = 0x80000000;
+    HBS_ASSERT_TRUE( atoms_register( &atom ) );
+    HBS_ASSERT_TRUE( 0 == atoms_getPid( ids ) );
+    HBS_ASSERT_TRUE( 0x80000000 == atoms_getPid( atom.id ) );
+    rpal_memory_memcpy( ids, atom.id, HBS_ATOM_ID_SIZE );
+
+    // Expire everything past the grace period, cleanup runs as we go.
+    nErrors = 0;
+    startTime = rpal_time_getGlobalPreciseTime();
+    expiredOn = startTime - MSEC_FROM_SEC( 60 );
+    for( i = 0; i < _ATOMS_STRESS_COUNT; i++ )
+    {
+        rpal_memory_zero( &atom, sizeof( atom ) );
+        atom.key.category = RP_TAGS_NOTIFICATION_MODULE_LOAD;
+        atom.key.module.pid = 0x80000000 | i;
+        atom.key.module.baseAddress = i;
+        if( !atoms_remove( &atom, expiredOn ) )
+        {
+            nErrors++;
+        }
+    }
+    HBS_ASSERT_TRUE( 0 == nErrors );
+    rpal_debug_info( "expired %d atoms in %d ms",
+                     _ATOMS_STRESS_COUNT,
+                     (RU32)( rpal_time_getGlobalPreciseTime() - startTime ) );
+
+    nErrors = 0;
+    for( i = 0; i < _ATOMS_STRESS_COUNT; i++ )
+    {
+        if( 0 != atoms_getPid( ids + ( i * HBS_ATOM_ID_SIZE ) ) )
+        {
+            nErrors++;
+        }
+    }
+    HBS_ASSERT_TRUE( 0 == nErrors );
+
+    rpal_memory_free( ids );
+}
+
 HBS_TEST_SUITE( 1 )
 {
     RBOOL isSuccess = FALSE;
@@ -956,7 +2131,11 @@ HBS_TEST_SUITE( 1 )
         NULL != testContext )
     {
         HBS_RUN_TEST( um_snapshot );
+        HBS_RUN_TEST( snapshot_set );
+        HBS_RUN_TEST( pid_reuse );
         HBS_RUN_TEST( notify_process );
+        HBS_RUN_TEST( env_capture );
+        HBS_RUN_TEST( atoms_stress );
         HBS_RUN_TEST( um_diff_thread );
 
         isSuccess = TRUE;
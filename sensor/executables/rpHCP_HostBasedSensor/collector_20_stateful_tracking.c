@@ -24,6 +24,8 @@ limitations under the License.
 
 #define RPAL_FILE_ID       106
 
+#define _UPDATE_BATCH_SIZE  64
+
 RPRIVATE rQueue g_events = NULL;
 RPRIVATE rVector g_liveMachines = NULL;
 
@@ -58,68 +60,89 @@ RVOID
 }
 
 RPRIVATE
-RPVOID
-    updateThread
+RVOID
+    processEvent
     (
-        rEvent isTimeToStop,
-        RPVOID ctx
+        rpcm_tag eventType,
+        rSequence event
     )
 {
     StatefulEvent* statefulEvent = NULL;
     StatefulMachine* tmpMachine = NULL;
-    StatefulEvent* event = NULL;
-    rpcm_tag eventType = 0;
     RU32 i = 0;
 
-    UNREFERENCED_PARAMETER( ctx );
-
-    while( !rEvent_wait( isTimeToStop, 0 ) )
+    if( NULL != ( statefulEvent = SMEvent_new( eventType, event ) ) )
     {
-        if( HbsDelayBuffer_remove( g_events, (RPVOID*)&event, &eventType, MSEC_FROM_SEC( 1 ) ) )
+        // First we update currently running machines
+        for( i = 0; i < g_liveMachines->nElements; i++ )
         {
-            RTIME tmp = 0;
-            rSequence_getTIMESTAMP( event, RP_TAGS_TIMESTAMP, &tmp );
+            //rpal_debug_info( "SM begin update ( %p / %p )", g_liveMachines->elements[ i ], ((StatefulMachine*)g_liveMachines->elements[ i ])->desc );
 
-            if( NULL != ( statefulEvent = SMEvent_new( eventType, event ) ) )
+            if( !SMUpdate( g_liveMachines->elements[ i ], statefulEvent ) )
             {
-                // First we update currently running machines
-                for( i = 0; i < g_liveMachines->nElements; i++ )
-                {
-                    //rpal_debug_info( "SM begin update ( %p / %p )", g_liveMachines->elements[ i ], ((StatefulMachine*)g_liveMachines->elements[ i ])->desc );
+                //rpal_debug_info( "SM no longer required ( %p / %p )", g_liveMachines->elements[ i ], ((StatefulMachine*)g_liveMachines->elements[ i ])->desc );
 
-                    if( !SMUpdate( g_liveMachines->elements[ i ], statefulEvent ) )
-                    {
-                        //rpal_debug_info( "SM no longer required ( %p / %p )", g_liveMachines->elements[ i ], ((StatefulMachine*)g_liveMachines->elements[ i ])->desc );
-
-                        // Machine indicated it is no longer live
-                        SMFreeMachine( g_liveMachines->elements[ i ] );
-                        if( rpal_vector_remove( g_liveMachines, i ) )
-                        {
-                            i--;
-                        }
-                    }
+                // Machine indicated it is no longer live
+                SMFreeMachine( g_liveMachines->elements[ i ] );
+                if( rpal_vector_remove( g_liveMachines, i ) )
+                {
+                    i--;
                 }
+            }
+        }
 
-                // Then we prime any new machines
-                for( i = 0; i < ARRAY_N_ELEM( g_statefulMachines ); i++ )
-                {
-                    if( NULL != ( tmpMachine = SMPrime( g_statefulMachines[ i ], statefulEvent ) ) )
-                    {
-                        //rpal_debug_info( "SM created ( %p / %p )", tmpMachine, g_statefulMachines[ i ] );
+        // Then we prime any new machines
+        for( i = 0; i < ARRAY_N_ELEM( g_statefulMachines ); i++ )
+        {
+            if( NULL != ( tmpMachine = SMPrime( g_statefulMachines[ i ], statefulEvent ) ) )
+            {
+                //rpal_debug_info( "SM created ( %p / %p )", tmpMachine, g_statefulMachines[ i ] );
 
-                        // New machines get added to the pool of live machines
-                        if( !rpal_vector_add( g_liveMachines, tmpMachine ) )
-                        {
-                            SMFreeMachine( tmpMachine );
-                        }
-                    }
+                // New machines get added to the pool of live machines
+                if( !rpal_vector_add( g_liveMachines, tmpMachine ) )
+                {
+                    SMFreeMachine( tmpMachine );
                 }
-
-                _freeSmEvent( statefulEvent, 0 );
             }
-            else
+        }
+
+        _freeSmEvent( statefulEvent, 0 );
+    }
+    else
+    {
+        rSequence_free( event );
+    }
+}
+
+RPRIVATE
+RPVOID
+    updateThread
+    (
+        rEvent isTimeToStop,
+        RPVOID ctx
+    )
+{
+    rSequence events[ _UPDATE_BATCH_SIZE ] = { 0 };
+    rpcm_tag eventTypes[ _UPDATE_BATCH_SIZE ] = { 0 };
+    RU32 nEvents = 0;
+    RU32 i = 0;
+
+    UNREFERENCED_PARAMETER( ctx );
+
+    while( !rEvent_wait( isTimeToStop, 0 ) )
+    {
+        // Matured events come out in timestamp order, draining them in
+        // batches means we only take the buffer lock once per batch.
+        if( HbsDelayBuffer_removeBatch( g_events, 
+                                        events, 
+                                        eventTypes, 
+                                        ARRAY_N_ELEM( events ), 
+                                        &nEvents, 
+                                        MSEC_FROM_SEC( 1 ) ) )
+        {
+            for( i = 0; i < nEvents; i++ )
             {
-                rSequence_free( event );
+                processEvent( eventTypes[ i ], events[ i ] );
             }
         }
     }
@@ -170,6 +193,10 @@ rpcm_tag collector_20_events[] = { STATEFUL_MACHINE_0_EVENT,
                                    STATEFUL_MACHINE_1_EVENT,
                                    0 };
 
+RU32 collector_20_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                 COLLECTOR_DEPENDENCY( 1 ) |
+                                 COLLECTOR_DEPENDENCY( 6 );
+
 RBOOL
     collector_20_init
     (
@@ -295,6 +322,99 @@ RBOOL
 //=============================================================================
 //  Collector Testing
 //=============================================================================
+RPRIVATE
+rSequence
+    _newTestEvent
+    (
+        RTIME ts
+    )
+{
+    rSequence event = NULL;
+
+    if( NULL != ( event = rSequence_new() ) &&
+        !rSequence_addTIMESTAMP( event, RP_TAGS_TIMESTAMP, ts ) )
+    {
+        rSequence_free( event );
+        event = NULL;
+    }
+
+    return event;
+}
+
+HBS_DECLARE_TEST( delay_buffer )
+{
+    HbsDelayBuffer hdb = NULL;
+    rSequence events[ _UPDATE_BATCH_SIZE ] = { 0 };
+    rpcm_tag eventTypes[ _UPDATE_BATCH_SIZE ] = { 0 };
+    RU32 nEvents = 0;
+    RU32 nTotal = 0;
+    RTIME now = 0;
+    RTIME ts = 0;
+    RTIME lastTs = 0;
+    RBOOL isOrdered = TRUE;
+    RU32 i = 0;
+    RTIME offsets[] = { 50, 150, 0, 100 };
+
+    HBS_ASSERT_TRUE( NULL != ( hdb = HbsDelayBuffer_new( 200 ) ) );
+
+    // Events arriving out of order are released in timestamp order.
+    now = rpal_time_getGlobalPreciseTime();
+    for( i = 0; i < ARRAY_N_ELEM( offsets ); i++ )
+    {
+        HBS_ASSERT_TRUE( HbsDelayBuffer_add( hdb, i, _newTestEvent( now - offsets[ i ] ) ) );
+    }
+    HBS_ASSERT_FALSE( HbsDelayBuffer_removeBatch( hdb, events, eventTypes, ARRAY_N_ELEM( events ), &nEvents, 0 ) );
+    HBS_ASSERT_TRUE( 0 == nEvents );
+
+    rpal_thread_sleep( 300 );
+
+    HBS_ASSERT_TRUE( HbsDelayBuffer_removeBatch( hdb, events, eventTypes, 3, &nEvents, 0 ) );
+    HBS_ASSERT_TRUE( 3 == nEvents );
+    HBS_ASSERT_TRUE( 1 == eventTypes[ 0 ] && 3 == eventTypes[ 1 ] && 0 == eventTypes[ 2 ] );
+    for( i = 0; i < nEvents; i++ )
+    {
+        rSequence_free( events[ i ] );
+    }
+
+    // What did not fit in the batch is returned right away by the next call.
+    HBS_ASSERT_TRUE( HbsDelayBuffer_remove( hdb, events, eventTypes, 0 ) );
+    HBS_ASSERT_TRUE( 2 == eventTypes[ 0 ] );
+    rSequence_free( events[ 0 ] );
+    HBS_ASSERT_FALSE( HbsDelayBuffer_remove( hdb, events, eventTypes, 0 ) );
+
+    // Volume with shuffled timestamps, every event comes out once and each
+    // batch is in order.
+    now = rpal_time_getGlobalPreciseTime();
+    for( i = 0; i < 10000; i++ )
+    {
+        ts = now - ( ( i * 7919 ) % 200 );
+        HBS_ASSERT_TRUE( HbsDelayBuffer_add( hdb, i, _newTestEvent( ts ) ) );
+    }
+
+    while( nTotal < 10000 &&
+           HbsDelayBuffer_removeBatch( hdb, events, eventTypes, ARRAY_N_ELEM( events ), &nEvents, 1000 ) )
+    {
+        lastTs = 0;
+        for( i = 0; i < nEvents; i++ )
+        {
+            rSequence_getTIMESTAMP( events[ i ], RP_TAGS_TIMESTAMP, &ts );
+            if( ts < lastTs )
+            {
+                isOrdered = FALSE;
+            }
+            lastTs = ts;
+            rSequence_free( events[ i ] );
+        }
+        nTotal += nEvents;
+    }
+    HBS_ASSERT_TRUE( 10000 == nTotal );
+    HBS_ASSERT_TRUE( isOrdered );
+
+    // Pending events are released with the buffer.
+    HBS_ASSERT_TRUE( HbsDelayBuffer_add( hdb, 0, _newTestEvent( rpal_time_getGlobalPreciseTime() ) ) );
+    HbsDelayBuffer_free( hdb );
+}
+
 HBS_TEST_SUITE( 20 )
 {
     RBOOL isSuccess = FALSE;
@@ -303,6 +423,7 @@ HBS_TEST_SUITE( 20 )
         NULL != testContext )
     {
         isSuccess = TRUE;
+        HBS_RUN_TEST( delay_buffer );
     }
 
     return isSuccess;
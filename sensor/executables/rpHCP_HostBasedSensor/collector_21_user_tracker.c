@@ -22,6 +22,15 @@ limitations under the License.
 #include <cryptoLib/cryptoLib.h>
 #include <libOs/libOs.h>
 
+#ifdef RPAL_PLATFORM_LINUX
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <unistd.h>
+    #include <utmp.h>
+    #include <sys/inotify.h>
+    #include <sys/stat.h>
+#endif
+
 #define RPAL_FILE_ID 109
 
 RPRIVATE rMutex g_mutex = NULL;
@@ -109,15 +118,670 @@ RVOID
     }
 }
 
+#ifdef RPAL_PLATFORM_LINUX
+//=============================================================================
+// Linux login sessions
+//=============================================================================
+// utmp has one slot per terminal rewritten in place, wtmp gets a record
+// appended for every login and logout. The sessions open when we start come
+// from utmp, wtmp is then read from its end on, each time from where the last
+// read stopped. utmp is small and read whole, which also covers hosts that do
+// not keep a wtmp. Sessions are keyed by terminal so a login or logout seen in
+// both files is only reported once.
+#define _UTMP_PATH                  "/var/run/utmp"
+#define _WTMP_PATH                  "/var/log/wtmp"
+#define _SESSIONS_STOP_CHECK        1000
+#define _SESSIONS_READ_RECORDS      32
+#define _SESSIONS_MAX_UTMP_SIZE     ( 4096 * sizeof( struct utmp ) )
+
+typedef struct
+{
+    RCHAR terminal[ UT_LINESIZE + 1 ];
+    RCHAR user[ UT_NAMESIZE + 1 ];
+    RCHAR host[ UT_HOSTSIZE + 1 ];
+    RU32 pid;
+    RU32 sessionId;
+    RU32 ip4;
+    RTIME loginTime;
+} _UserSession;
+
+typedef struct
+{
+    RPCHAR path;
+    RS32 fd;
+    RS32 watch;
+    RU64 offset;
+    RBOOL isAppendOnly;
+} _SessionFile;
+
+RPRIVATE
+RS32
+    _cmpSession
+    (
+        _UserSession* session1,
+        _UserSession* session2
+    )
+{
+    return rpal_string_strcmp( session1->terminal, session2->terminal );
+}
+
+// utmp strings are only NULL terminated when shorter than their field.
+RPRIVATE
+RVOID
+    _copyUtField
+    (
+        RPCHAR dest,
+        RPCHAR src,
+        RU32 srcSize
+    )
+{
+    RU32 i = 0;
+
+    for( i = 0; i < srcSize && 0 != src[ i ]; i++ )
+    {
+        dest[ i ] = src[ i ];
+    }
+    dest[ i ] = 0;
+}
+
+RPRIVATE
+RTIME
+    _recordTime
+    (
+        struct utmp* record
+    )
+{
+    return MSEC_FROM_SEC( (RU64)record->ut_tv.tv_sec ) + MSEC_FROM_USEC( (RU64)record->ut_tv.tv_usec );
+}
+
+RPRIVATE
+RVOID
+    _publishSession
+    (
+        _UserSession* session,
+        RBOOL isLogin,
+        RTIME ts
+    )
+{
+    rSequence event = NULL;
+
+    if( NULL != ( event = rSequence_new() ) )
+    {
+        rSequence_addSTRINGA( event, RP_TAGS_USER_NAME, session->user );
+        rSequence_addSTRINGA( event, RP_TAGS_TERMINAL, session->terminal );
+        if( 0 != session->host[ 0 ] )
+        {
+            rSequence_addSTRINGA( event, RP_TAGS_REMOTE_HOST, session->host );
+        }
+        if( 0 != session->ip4 )
+        {
+            rSequence_addIPV4( event, RP_TAGS_IP_ADDRESS, session->ip4 );
+        }
+        rSequence_addRU32( event, RP_TAGS_SESSION_ID, session->sessionId );
+        rSequence_addRU32( event, RP_TAGS_PROCESS_ID, session->pid );
+
+        if( !isLogin &&
+            0 != session->loginTime &&
+            ts > session->loginTime )
+        {
+            rSequence_addTIMEDELTA( event, RP_TAGS_TIMEDELTA, ts - session->loginTime );
+        }
+
+        hbs_timestampEvent( event, ts );
+
+        if( isLogin )
+        {
+            hbs_publish( RP_TAGS_NOTIFICATION_USER_LOGIN, event );
+            rpal_debug_info( "user login: %s on %s", session->user, session->terminal );
+        }
+        else
+        {
+            hbs_publish( RP_TAGS_NOTIFICATION_USER_LOGOUT, event );
+            rpal_debug_info( "user logout: %s on %s", session->user, session->terminal );
+        }
+
+        rSequence_free( event );
+    }
+}
+
+RPRIVATE
+RVOID
+    _onLogin
+    (
+        rBTree sessions,
+        struct utmp* record,
+        RBOOL isNotify
+    )
+{
+    _UserSession session = { 0 };
+    _UserSession existing = { 0 };
+
+    _copyUtField( session.terminal, record->ut_line, sizeof( record->ut_line ) );
+    if( 0 == session.terminal[ 0 ] )
+    {
+        return;
+    }
+    _copyUtField( session.user, record->ut_user, sizeof( record->ut_user ) );
+    _copyUtField( session.host, record->ut_host, sizeof( record->ut_host ) );
+    session.pid = (RU32)record->ut_pid;
+    session.sessionId = (RU32)record->ut_session;
+    if( 0 == record->ut_addr_v6[ 1 ] &&
+        0 == record->ut_addr_v6[ 2 ] &&
+        0 == record->ut_addr_v6[ 3 ] )
+    {
+        session.ip4 = (RU32)record->ut_addr_v6[ 0 ];
+    }
+    session.loginTime = _recordTime( record );
+
+    if( rpal_btree_search( sessions, &session, &existing, FALSE ) )
+    {
+        // Already seen through the other file.
+        if( existing.pid == session.pid &&
+            0 == rpal_string_strcmp( existing.user, session.user ) )
+        {
+            return;
+        }
+
+        // The terminal was reused without the logout being seen.
+        if( isNotify )
+        {
+            _publishSession( &existing, FALSE, session.loginTime );
+        }
+
+        rpal_btree_update( sessions, &session, &session, FALSE );
+    }
+    else if( !rpal_btree_add( sessions, &session, FALSE ) )
+    {
+        return;
+    }
+
+    if( isNotify )
+    {
+        _publishSession( &session, TRUE, session.loginTime );
+    }
+}
+
+RPRIVATE
+RVOID
+    _onLogout
+    (
+        rBTree sessions,
+        struct utmp* record,
+        RBOOL isPidMatched,
+        RBOOL isNotify
+    )
+{
+    _UserSession session = { 0 };
+    _UserSession existing = { 0 };
+
+    _copyUtField( session.terminal, record->ut_line, sizeof( record->ut_line ) );
+    if( 0 == session.terminal[ 0 ] ||
+        !rpal_btree_search( sessions, &session, &existing, FALSE ) )
+    {
+        return;
+    }
+
+    // A dead utmp slot may be a stale one for a terminal now used by
+    // another slot, it only ends the session it belonged to.
+    if( isPidMatched &&
+        existing.pid != (RU32)record->ut_pid )
+    {
+        return;
+    }
+
+    rpal_btree_remove( sessions, &session, NULL, FALSE );
+
+    if( isNotify )
+    {
+        _publishSession( &existing, FALSE, _recordTime( record ) );
+    }
+}
+
+RPRIVATE
+RVOID
+    _onBoot
+    (
+        rBTree sessions,
+        struct utmp* record,
+        RBOOL isNotify
+    )
+{
+    _UserSession existing = { 0 };
+
+    while( rpal_btree_minimum( sessions, &existing, FALSE ) )
+    {
+        rpal_btree_remove( sessions, &existing, NULL, FALSE );
+
+        if( isNotify )
+        {
+            _publishSession( &existing, FALSE, _recordTime( record ) );
+        }
+    }
+}
+
+RPRIVATE
+RVOID
+    _processSessionRecord
+    (
+        rBTree sessions,
+        struct utmp* record,
+        RBOOL isAppendOnly,
+        RBOOL isNotify
+    )
+{
+    switch( record->ut_type )
+    {
+        case USER_PROCESS:
+            _onLogin( sessions, record, isNotify );
+            break;
+        case DEAD_PROCESS:
+            _onLogout( sessions, record, !isAppendOnly, isNotify );
+            break;
+        case BOOT_TIME:
+            // Only wtmp keeps boot records in order with the sessions.
+            if( isAppendOnly )
+            {
+                _onBoot( sessions, record, isNotify );
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// Processes the whole records appended since the last read. A partial record
+// at the end is left for the next read.
+RPRIVATE
+RBOOL
+    _readWtmp
+    (
+        rBTree sessions,
+        _SessionFile* file,
+        RBOOL isNotify
+    )
+{
+    struct utmp records[ _SESSIONS_READ_RECORDS ];
+    struct stat info = { 0 };
+    RS32 nRead = 0;
+    RU32 nRecords = 0;
+    RU32 i = 0;
+
+    if( 0 != fstat( file->fd, &info ) )
+    {
+        return FALSE;
+    }
+
+    // Truncated or replaced by a smaller file.
+    if( (RU64)info.st_size < file->offset )
+    {
+        file->offset = 0;
+    }
+
+    while( TRUE )
+    {
+        if( 0 > ( nRead = (RS32)pread( file->fd, records, sizeof( records ), (off_t)file->offset ) ) )
+        {
+            if( EINTR == errno )
+            {
+                continue;
+            }
+            return FALSE;
+        }
+
+        if( 0 == ( nRecords = (RU32)nRead / sizeof( struct utmp ) ) )
+        {
+            break;
+        }
+
+        for( i = 0; i < nRecords; i++ )
+        {
+            _processSessionRecord( sessions, &records[ i ], TRUE, isNotify );
+        }
+
+        file->offset += nRecords * sizeof( struct utmp );
+    }
+
+    return TRUE;
+}
+
+// Records already in wtmp are history, the sessions still open are in utmp.
+// A record only partly written is left to be read once it is complete.
+RPRIVATE
+RBOOL
+    _skipWtmp
+    (
+        _SessionFile* file
+    )
+{
+    struct stat info = { 0 };
+
+    if( 0 != fstat( file->fd, &info ) )
+    {
+        return FALSE;
+    }
+
+    file->offset = ( (RU64)info.st_size / sizeof( struct utmp ) ) * sizeof( struct utmp );
+
+    return TRUE;
+}
+
+// Slots are rewritten in place, so the whole file is read every time.
+RPRIVATE
+RBOOL
+    _readUtmp
+    (
+        rBTree sessions,
+        _SessionFile* file,
+        RBOOL isNotify
+    )
+{
+    RBOOL isSuccess = FALSE;
+    struct stat info = { 0 };
+    struct utmp* records = NULL;
+    RU32 size = 0;
+    RS32 nRead = 0;
+    RU32 i = 0;
+
+    if( 0 != fstat( file->fd, &info ) )
+    {
+        return FALSE;
+    }
+
+    size = (RU32)MIN_OF( (RU64)info.st_size, (RU64)_SESSIONS_MAX_UTMP_SIZE );
+    if( 0 == size )
+    {
+        return TRUE;
+    }
+
+    if( NULL != ( records = rpal_memory_alloc( size ) ) )
+    {
+        while( 0 > ( nRead = (RS32)pread( file->fd, records, size, 0 ) ) &&
+               EINTR == errno )
+        {
+        }
+
+        if( 0 <= nRead )
+        {
+            isSuccess = TRUE;
+
+            for( i = 0; i < (RU32)nRead / sizeof( struct utmp ); i++ )
+            {
+                _processSessionRecord( sessions, &records[ i ], FALSE, isNotify );
+            }
+        }
+
+        rpal_memory_free( records );
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RBOOL
+    _readSessionFile
+    (
+        rBTree sessions,
+        _SessionFile* file,
+        RBOOL isNotify
+    )
+{
+    if( file->isAppendOnly )
+    {
+        return _readWtmp( sessions, file, isNotify );
+    }
+
+    return _readUtmp( sessions, file, isNotify );
+}
+
+RPRIVATE
+RBOOL
+    _openSessionFile
+    (
+        RS32 inotifyFd,
+        _SessionFile* file
+    )
+{
+    if( 0 > ( file->fd = open( file->path, O_RDONLY | O_CLOEXEC ) ) )
+    {
+        return FALSE;
+    }
+
+    if( 0 <= inotifyFd )
+    {
+        file->watch = inotify_add_watch( inotifyFd, file->path, IN_MODIFY | IN_MOVE_SELF | IN_DELETE_SELF );
+    }
+    file->offset = 0;
 
+    return TRUE;
+}
+
+RPRIVATE
+RVOID
+    _closeSessionFile
+    (
+        RS32 inotifyFd,
+        _SessionFile* file
+    )
+{
+    if( 0 <= file->watch )
+    {
+        inotify_rm_watch( inotifyFd, file->watch );
+        file->watch = (-1);
+    }
+
+    if( 0 <= file->fd )
+    {
+        close( file->fd );
+        file->fd = (-1);
+    }
+}
+
+// A file we hold no watch on is polled, this notices it was rotated or
+// removed by its path no longer leading to the file we have open.
+RPRIVATE
+RBOOL
+    _isSessionFileReplaced
+    (
+        _SessionFile* file
+    )
+{
+    struct stat pathInfo = { 0 };
+    struct stat fileInfo = { 0 };
+
+    if( 0 != fstat( file->fd, &fileInfo ) ||
+        0 != stat( file->path, &pathInfo ) )
+    {
+        return TRUE;
+    }
+
+    return pathInfo.st_dev != fileInfo.st_dev ||
+           pathInfo.st_ino != fileInfo.st_ino;
+}
+
+// Returns FALSE if neither file can be opened. Without an inotifyFd, or
+// when a watch can't be added, the files are polled instead.
+RPRIVATE
+RBOOL
+    _watchSessions
+    (
+        rEvent isTimeToStop,
+        RS32 inotifyFd,
+        RPCHAR utmpPath,
+        RPCHAR wtmpPath
+    )
+{
+    RBOOL isSuccess = FALSE;
+    rBTree sessions = NULL;
+    _SessionFile files[ 2 ] = { { utmpPath, (-1), (-1), 0, FALSE },
+                                { wtmpPath, (-1), (-1), 0, TRUE } };
+    RBOOL isChanged[ ARRAY_N_ELEM( files ) ] = { 0 };
+    RBOOL isGone[ ARRAY_N_ELEM( files ) ] = { 0 };
+    RU8 events[ 4096 ] = { 0 };
+    struct inotify_event* event = NULL;
+    struct pollfd pfd = { 0 };
+    RS32 nRead = 0;
+    RS32 offset = 0;
+    RS32 ret = 0;
+    RU32 i = 0;
+
+    if( NULL == ( sessions = rpal_btree_create( sizeof( _UserSession ),
+                                                (rpal_btree_comp_f)_cmpSession,
+                                                NULL ) ) )
+    {
+        return FALSE;
+    }
+
+    for( i = 0; i < ARRAY_N_ELEM( files ); i++ )
+    {
+        if( _openSessionFile( inotifyFd, &files[ i ] ) )
+        {
+            isSuccess = TRUE;
+        }
+    }
+
+    if( !isSuccess )
+    {
+        rpal_btree_destroy( sessions, FALSE );
+        return FALSE;
+    }
+
+    // Sessions open before we started are tracked but not reported, and
+    // only the wtmp records appended from now on are of interest.
+    if( 0 <= files[ 0 ].fd )
+    {
+        _readUtmp( sessions, &files[ 0 ], FALSE );
+    }
+    if( 0 <= files[ 1 ].fd )
+    {
+        _skipWtmp( &files[ 1 ] );
+    }
+
+    rpal_debug_info( "watching login sessions, %d active", rpal_btree_getSize( sessions, FALSE ) );
+
+    pfd.fd = inotifyFd;
+    pfd.events = POLLIN;
+
+    while( !rEvent_wait( isTimeToStop, 0 ) )
+    {
+        // The timeout is only there to notice we need to stop, to pick
+        // up files that were rotated or did not exist yet and to poll the
+        // files without a watch. A negative fd is ignored by poll.
+        pfd.revents = 0;
+        if( 0 > ( ret = poll( &pfd, 1, _SESSIONS_STOP_CHECK ) ) &&
+            EINTR != errno )
+        {
+            rpal_debug_warning( "failed to poll login sessions: %d", errno );
+            break;
+        }
+
+        while( 0 < ret &&
+               0 < ( nRead = (RS32)read( inotifyFd, events, sizeof( events ) ) ) )
+        {
+            for( offset = 0; offset + (RS32)sizeof( struct inotify_event ) <= nRead; offset += sizeof( struct inotify_event ) + event->len )
+            {
+                event = (struct inotify_event*)( events + offset );
+
+                for( i = 0; i < ARRAY_N_ELEM( files ); i++ )
+                {
+                    if( event->wd == files[ i ].watch )
+                    {
+                        isChanged[ i ] = TRUE;
+                        if( IS_FLAG_ENABLED( event->mask, IN_MOVE_SELF ) ||
+                            IS_FLAG_ENABLED( event->mask, IN_DELETE_SELF ) ||
+                            IS_FLAG_ENABLED( event->mask, IN_IGNORED ) )
+                        {
+                            isGone[ i ] = TRUE;
+                        }
+                    }
+                }
+            }
+        }
+
+        for( i = 0; i < ARRAY_N_ELEM( files ); i++ )
+        {
+            // Without a watch the file is polled.
+            if( 0 > files[ i ].watch &&
+                0 <= files[ i ].fd )
+            {
+                isChanged[ i ] = TRUE;
+                isGone[ i ] = _isSessionFileReplaced( &files[ i ] );
+            }
+
+            if( isChanged[ i ] &&
+                0 <= files[ i ].fd )
+            {
+                _readSessionFile( sessions, &files[ i ], TRUE );
+            }
+
+            // Rotated or removed: finish the old file and everything in
+            // its replacement is new.
+            if( isGone[ i ] )
+            {
+                _closeSessionFile( inotifyFd, &files[ i ] );
+            }
+
+            if( 0 > files[ i ].fd &&
+                _openSessionFile( inotifyFd, &files[ i ] ) )
+            {
+                _readSessionFile( sessions, &files[ i ], TRUE );
+            }
+
+            isChanged[ i ] = FALSE;
+            isGone[ i ] = FALSE;
+        }
+    }
+
+    for( i = 0; i < ARRAY_N_ELEM( files ); i++ )
+    {
+        _closeSessionFile( inotifyFd, &files[ i ] );
+    }
+    rpal_btree_destroy( sessions, FALSE );
+
+    return TRUE;
+}
+
+RPRIVATE
+RPVOID
+    sessionTrackerThread
+    (
+        rEvent isTimeToStop,
+        RPVOID ctx
+    )
+{
+    RS32 inotifyFd = (-1);
+    UNREFERENCED_PARAMETER( ctx );
+
+    if( 0 > ( inotifyFd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC ) ) )
+    {
+        rpal_debug_warning( "inotify unavailable (%d), polling utmp and wtmp", errno );
+    }
+
+    if( !_watchSessions( isTimeToStop, inotifyFd, _UTMP_PATH, _WTMP_PATH ) )
+    {
+        rpal_debug_warning( "cannot watch utmp or wtmp, login sessions not tracked" );
+    }
+
+    if( 0 <= inotifyFd )
+    {
+        close( inotifyFd );
+    }
+
+    return NULL;
+}
+#endif
 
 //=============================================================================
 // COLLECTOR INTERFACE
 //=============================================================================
 
 rpcm_tag collector_21_events[] = { RP_TAGS_NOTIFICATION_USER_OBSERVED,
+                                   RP_TAGS_NOTIFICATION_USER_LOGIN,
+                                   RP_TAGS_NOTIFICATION_USER_LOGOUT,
                                    0 };
 
+RU32 collector_21_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                 COLLECTOR_DEPENDENCY( 1 );
+
 RBOOL
     collector_21_init
     (
@@ -139,6 +803,12 @@ RBOOL
                 if( notifications_subscribe( RP_TAGS_NOTIFICATION_NEW_PROCESS, NULL, 0, NULL, processNewProcesses ) )
                 {
                     isSuccess = TRUE;
+#ifdef RPAL_PLATFORM_LINUX
+                    if( !rThreadPool_task( hbsState->hThreadPool, sessionTrackerThread, NULL ) )
+                    {
+                        rpal_debug_warning( "failed to start the login session tracker" );
+                    }
+#endif
                 }
                 else
                 {
@@ -198,6 +868,439 @@ RBOOL
 //=============================================================================
 //  Collector Testing
 //=============================================================================
+#ifdef RPAL_PLATFORM_LINUX
+#define _TEST_UTMP_PATH     "./tmp_test_utmp"
+#define _TEST_WTMP_PATH     "./tmp_test_wtmp"
+
+RPRIVATE
+RVOID
+    _makeTestRecord
+    (
+        struct utmp* record,
+        RU16 type,
+        RPCHAR terminal,
+        RPCHAR user,
+        RPCHAR host,
+        RU32 pid,
+        RU32 seconds
+    )
+{
+    rpal_memory_zero( record, sizeof( *record ) );
+    record->ut_type = type;
+    record->ut_pid = (pid_t)pid;
+    record->ut_session = pid;
+    record->ut_tv.tv_sec = seconds;
+
+    if( NULL != terminal )
+    {
+        rpal_memory_memcpy( record->ut_line, terminal, MIN_OF( rpal_string_strlen( terminal ), sizeof( record->ut_line ) ) );
+    }
+    if( NULL != user )
+    {
+        rpal_memory_memcpy( record->ut_user, user, MIN_OF( rpal_string_strlen( user ), sizeof( record->ut_user ) ) );
+    }
+    if( NULL != host )
+    {
+        rpal_memory_memcpy( record->ut_host, host, MIN_OF( rpal_string_strlen( host ), sizeof( record->ut_host ) ) );
+    }
+}
+
+RPRIVATE
+RBOOL
+    _writeTestRecords
+    (
+        RPCHAR path,
+        RPVOID records,
+        RU32 size,
+        RBOOL isTruncate
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RS32 fd = (-1);
+
+    if( 0 <= ( fd = open( path, O_WRONLY | O_CREAT | O_CLOEXEC | ( isTruncate ? O_TRUNC : O_APPEND ), 0600 ) ) )
+    {
+        isSuccess = ( (ssize_t)size == write( fd, records, size ) );
+        close( fd );
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RBOOL
+    _isTestEventFor
+    (
+        rSequence event,
+        RPCHAR user,
+        RPCHAR terminal
+    )
+{
+    RPCHAR tmpUser = NULL;
+    RPCHAR tmpTerminal = NULL;
+
+    return rSequence_getSTRINGA( event, RP_TAGS_USER_NAME, &tmpUser ) &&
+           rSequence_getSTRINGA( event, RP_TAGS_TERMINAL, &tmpTerminal ) &&
+           0 == rpal_string_strcmp( tmpUser, user ) &&
+           0 == rpal_string_strcmp( tmpTerminal, terminal );
+}
+
+HBS_DECLARE_TEST( wtmp_append )
+{
+    rBTree sessions = NULL;
+    _SessionFile file = { _TEST_WTMP_PATH, (-1), (-1), 0, TRUE };
+    struct utmp records[ 3 ];
+    rQueue loginQueue = NULL;
+    rQueue logoutQueue = NULL;
+    rSequence notif = NULL;
+    RPCHAR host = NULL;
+    RU32 tmp32 = 0;
+    RU64 tmp64 = 0;
+    RU32 size = 0;
+    RU32 half = sizeof( struct utmp ) / 2;
+
+    HBS_ASSERT_TRUE( rQueue_create( &loginQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( rQueue_create( &logoutQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_USER_LOGIN, NULL, 0, loginQueue, NULL ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_USER_LOGOUT, NULL, 0, logoutQueue, NULL ) );
+    HBS_ASSERT_TRUE( NULL != ( sessions = rpal_btree_create( sizeof( _UserSession ),
+                                                             (rpal_btree_comp_f)_cmpSession,
+                                                             NULL ) ) );
+
+    _makeTestRecord( &records[ 0 ], BOOT_TIME, "~", "reboot", NULL, 0, 1000 );
+    _makeTestRecord( &records[ 1 ], USER_PROCESS, "pts/0", "alice", "10.0.0.1", 100, 1010 );
+    records[ 1 ].ut_addr_v6[ 0 ] = 0x0100000A;
+    _makeTestRecord( &records[ 2 ], USER_PROCESS, "tty1", "bob", NULL, 200, 1020 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, records, sizeof( records ), TRUE ) );
+    HBS_ASSERT_TRUE( 0 <= ( file.fd = open( _TEST_WTMP_PATH, O_RDONLY | O_CLOEXEC ) ) );
+
+    HBS_ASSERT_TRUE( _readWtmp( sessions, &file, TRUE ) );
+    HBS_ASSERT_TRUE( 3 * sizeof( struct utmp ) == file.offset );
+    HBS_ASSERT_TRUE( rQueue_getSize( loginQueue, &size ) && 2 == size );
+    if( HBS_ASSERT_TRUE( rQueue_remove( loginQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "alice", "pts/0" ) );
+        HBS_ASSERT_TRUE( rSequence_getSTRINGA( notif, RP_TAGS_REMOTE_HOST, &host ) &&
+                         0 == rpal_string_strcmp( host, "10.0.0.1" ) );
+        HBS_ASSERT_TRUE( rSequence_getIPV4( notif, RP_TAGS_IP_ADDRESS, &tmp32 ) && 0x0100000A == tmp32 );
+        HBS_ASSERT_TRUE( rSequence_getRU32( notif, RP_TAGS_SESSION_ID, &tmp32 ) && 100 == tmp32 );
+        HBS_ASSERT_TRUE( rSequence_getTIMESTAMP( notif, RP_TAGS_TIMESTAMP, &tmp64 ) && 1010000 == tmp64 );
+        rSequence_free( notif );
+    }
+    if( HBS_ASSERT_TRUE( rQueue_remove( loginQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "bob", "tty1" ) );
+        HBS_ASSERT_FALSE( rSequence_getSTRINGA( notif, RP_TAGS_REMOTE_HOST, &host ) );
+        rSequence_free( notif );
+    }
+
+    // Nothing appended, nothing reported.
+    HBS_ASSERT_TRUE( _readWtmp( sessions, &file, TRUE ) );
+    HBS_ASSERT_TRUE( rQueue_getSize( loginQueue, &size ) && 0 == size );
+    HBS_ASSERT_TRUE( rQueue_getSize( logoutQueue, &size ) && 0 == size );
+
+    // A logout and half of a login still being written.
+    _makeTestRecord( &records[ 0 ], DEAD_PROCESS, "pts/0", NULL, NULL, 100, 1070 );
+    _makeTestRecord( &records[ 1 ], USER_PROCESS, "pts/1", "carol", NULL, 300, 1080 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, records, sizeof( struct utmp ) + half, FALSE ) );
+    HBS_ASSERT_TRUE( _readWtmp( sessions, &file, TRUE ) );
+    HBS_ASSERT_TRUE( 4 * sizeof( struct utmp ) == file.offset );
+    HBS_ASSERT_TRUE( rQueue_getSize( loginQueue, &size ) && 0 == size );
+    if( HBS_ASSERT_TRUE( rQueue_remove( logoutQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "alice", "pts/0" ) );
+        HBS_ASSERT_TRUE( rSequence_getTIMEDELTA( notif, RP_TAGS_TIMEDELTA, &tmp64 ) && 60000 == tmp64 );
+        rSequence_free( notif );
+    }
+
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, (RPU8)&records[ 1 ] + half, sizeof( struct utmp ) - half, FALSE ) );
+    HBS_ASSERT_TRUE( _readWtmp( sessions, &file, TRUE ) );
+    if( HBS_ASSERT_TRUE( rQueue_remove( loginQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "carol", "pts/1" ) );
+        rSequence_free( notif );
+    }
+
+    // Truncated, it is read again from the start.
+    _makeTestRecord( &records[ 0 ], DEAD_PROCESS, "tty1", NULL, NULL, 200, 1100 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, records, sizeof( struct utmp ), TRUE ) );
+    HBS_ASSERT_TRUE( _readWtmp( sessions, &file, TRUE ) );
+    HBS_ASSERT_TRUE( sizeof( struct utmp ) == file.offset );
+    if( HBS_ASSERT_TRUE( rQueue_remove( logoutQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "bob", "tty1" ) );
+        rSequence_free( notif );
+    }
+
+    // A reboot ends whatever is left.
+    _makeTestRecord( &records[ 0 ], BOOT_TIME, "~", "reboot", NULL, 0, 2000 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, records, sizeof( struct utmp ), FALSE ) );
+    HBS_ASSERT_TRUE( _readWtmp( sessions, &file, TRUE ) );
+    if( HBS_ASSERT_TRUE( rQueue_remove( logoutQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "carol", "pts/1" ) );
+        rSequence_free( notif );
+    }
+    HBS_ASSERT_TRUE( 0 == rpal_btree_getSize( sessions, FALSE ) );
+
+    close( file.fd );
+    rpal_btree_destroy( sessions, FALSE );
+    rpal_file_delete( _TEST_WTMP_PATH, FALSE );
+
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_USER_LOGIN, loginQueue, NULL );
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_USER_LOGOUT, logoutQueue, NULL );
+    rQueue_free( loginQueue );
+    rQueue_free( logoutQueue );
+}
+
+HBS_DECLARE_TEST( utmp_slots )
+{
+    rBTree sessions = NULL;
+    _SessionFile file = { _TEST_UTMP_PATH, (-1), (-1), 0, FALSE };
+    struct utmp records[ 4 ];
+    rQueue loginQueue = NULL;
+    rQueue logoutQueue = NULL;
+    rSequence notif = NULL;
+    RU32 size = 0;
+
+    HBS_ASSERT_TRUE( rQueue_create( &loginQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( rQueue_create( &logoutQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_USER_LOGIN, NULL, 0, loginQueue, NULL ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_USER_LOGOUT, NULL, 0, logoutQueue, NULL ) );
+    HBS_ASSERT_TRUE( NULL != ( sessions = rpal_btree_create( sizeof( _UserSession ),
+                                                             (rpal_btree_comp_f)_cmpSession,
+                                                             NULL ) ) );
+
+    // Sessions already there are tracked silently.
+    _makeTestRecord( &records[ 0 ], USER_PROCESS, "pts/0", "alice", "10.0.0.1", 100, 1010 );
+    _makeTestRecord( &records[ 1 ], DEAD_PROCESS, "pts/1", NULL, NULL, 50, 900 );
+    _makeTestRecord( &records[ 2 ], USER_PROCESS, "pts/2", "carol", NULL, 300, 1020 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_UTMP_PATH, records, 3 * sizeof( struct utmp ), TRUE ) );
+    HBS_ASSERT_TRUE( 0 <= ( file.fd = open( _TEST_UTMP_PATH, O_RDONLY | O_CLOEXEC ) ) );
+
+    HBS_ASSERT_TRUE( _readUtmp( sessions, &file, FALSE ) );
+    HBS_ASSERT_TRUE( 2 == rpal_btree_getSize( sessions, FALSE ) );
+    HBS_ASSERT_TRUE( rQueue_getSize( loginQueue, &size ) && 0 == size );
+
+    // alice's slot is released, dave gets pts/1 in a new slot while the
+    // stale one is still around and carol's is untouched.
+    _makeTestRecord( &records[ 0 ], DEAD_PROCESS, "pts/0", NULL, NULL, 100, 1070 );
+    _makeTestRecord( &records[ 1 ], DEAD_PROCESS, "pts/1", NULL, NULL, 50, 900 );
+    _makeTestRecord( &records[ 2 ], USER_PROCESS, "pts/2", "carol", NULL, 300, 1020 );
+    _makeTestRecord( &records[ 3 ], USER_PROCESS, "pts/1", "dave", "server", 400, 1080 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_UTMP_PATH, records, sizeof( records ), TRUE ) );
+
+    HBS_ASSERT_TRUE( _readUtmp( sessions, &file, TRUE ) );
+    HBS_ASSERT_TRUE( 2 == rpal_btree_getSize( sessions, FALSE ) );
+    HBS_ASSERT_TRUE( rQueue_getSize( loginQueue, &size ) && 1 == size );
+    HBS_ASSERT_TRUE( rQueue_getSize( logoutQueue, &size ) && 1 == size );
+    if( HBS_ASSERT_TRUE( rQueue_remove( loginQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "dave", "pts/1" ) );
+        rSequence_free( notif );
+    }
+    if( HBS_ASSERT_TRUE( rQueue_remove( logoutQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "alice", "pts/0" ) );
+        rSequence_free( notif );
+    }
+
+    // Reading it again or seeing the same login in wtmp reports nothing.
+    HBS_ASSERT_TRUE( _readUtmp( sessions, &file, TRUE ) );
+    _processSessionRecord( sessions, &records[ 3 ], TRUE, TRUE );
+    HBS_ASSERT_TRUE( rQueue_getSize( loginQueue, &size ) && 0 == size );
+    HBS_ASSERT_TRUE( rQueue_getSize( logoutQueue, &size ) && 0 == size );
+
+    close( file.fd );
+    rpal_btree_destroy( sessions, FALSE );
+    rpal_file_delete( _TEST_UTMP_PATH, FALSE );
+
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_USER_LOGIN, loginQueue, NULL );
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_USER_LOGOUT, logoutQueue, NULL );
+    rQueue_free( loginQueue );
+    rQueue_free( logoutQueue );
+}
+
+HBS_DECLARE_TEST( wtmp_start )
+{
+    rBTree sessions = NULL;
+    _SessionFile utmpFile = { _TEST_UTMP_PATH, (-1), (-1), 0, FALSE };
+    _SessionFile wtmpFile = { _TEST_WTMP_PATH, (-1), (-1), 0, TRUE };
+    struct utmp records[ 3 ];
+    rQueue loginQueue = NULL;
+    rQueue logoutQueue = NULL;
+    rSequence notif = NULL;
+    RU32 size = 0;
+    RU32 half = sizeof( struct utmp ) / 2;
+
+    HBS_ASSERT_TRUE( rQueue_create( &loginQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( rQueue_create( &logoutQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_USER_LOGIN, NULL, 0, loginQueue, NULL ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_USER_LOGOUT, NULL, 0, logoutQueue, NULL ) );
+    HBS_ASSERT_TRUE( NULL != ( sessions = rpal_btree_create( sizeof( _UserSession ),
+                                                             (rpal_btree_comp_f)_cmpSession,
+                                                             NULL ) ) );
+
+    // Only alice is still logged in, eve's login is history whose logout
+    // was lost, and bob's login is being written as we start.
+    _makeTestRecord( &records[ 0 ], USER_PROCESS, "pts/0", "alice", NULL, 100, 1010 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_UTMP_PATH, records, sizeof( struct utmp ), TRUE ) );
+    _makeTestRecord( &records[ 1 ], USER_PROCESS, "pts/3", "eve", NULL, 50, 900 );
+    _makeTestRecord( &records[ 2 ], USER_PROCESS, "pts/1", "bob", NULL, 200, 1020 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, records, 2 * sizeof( struct utmp ) + half, TRUE ) );
+    HBS_ASSERT_TRUE( 0 <= ( utmpFile.fd = open( _TEST_UTMP_PATH, O_RDONLY | O_CLOEXEC ) ) );
+    HBS_ASSERT_TRUE( 0 <= ( wtmpFile.fd = open( _TEST_WTMP_PATH, O_RDONLY | O_CLOEXEC ) ) );
+
+    HBS_ASSERT_TRUE( _readUtmp( sessions, &utmpFile, FALSE ) );
+    HBS_ASSERT_TRUE( _skipWtmp( &wtmpFile ) );
+    HBS_ASSERT_TRUE( 2 * sizeof( struct utmp ) == wtmpFile.offset );
+    HBS_ASSERT_TRUE( 1 == rpal_btree_getSize( sessions, FALSE ) );
+
+    // The rest of bob's login is reported, the history is not.
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, (RPU8)records + 2 * sizeof( struct utmp ) + half, sizeof( struct utmp ) - half, FALSE ) );
+    HBS_ASSERT_TRUE( _readWtmp( sessions, &wtmpFile, TRUE ) );
+    HBS_ASSERT_TRUE( rQueue_getSize( loginQueue, &size ) && 1 == size );
+    if( HBS_ASSERT_TRUE( rQueue_remove( loginQueue, &notif, NULL, 0 ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "bob", "pts/1" ) );
+        rSequence_free( notif );
+    }
+
+    // A logout on eve's old terminal was never a session of ours.
+    _makeTestRecord( &records[ 0 ], DEAD_PROCESS, "pts/3", NULL, NULL, 50, 1030 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, records, sizeof( struct utmp ), FALSE ) );
+    HBS_ASSERT_TRUE( _readWtmp( sessions, &wtmpFile, TRUE ) );
+    HBS_ASSERT_TRUE( rQueue_getSize( logoutQueue, &size ) && 0 == size );
+    HBS_ASSERT_TRUE( 2 == rpal_btree_getSize( sessions, FALSE ) );
+
+    close( utmpFile.fd );
+    close( wtmpFile.fd );
+    rpal_btree_destroy( sessions, FALSE );
+    rpal_file_delete( _TEST_UTMP_PATH, FALSE );
+    rpal_file_delete( _TEST_WTMP_PATH, FALSE );
+
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_USER_LOGIN, loginQueue, NULL );
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_USER_LOGOUT, logoutQueue, NULL );
+    rQueue_free( loginQueue );
+    rQueue_free( logoutQueue );
+}
+
+RPRIVATE
+RU32
+RPAL_THREAD_FUNC
+    _testWatchSessions
+    (
+        rEvent isTimeToStop
+    )
+{
+    RS32 inotifyFd = (-1);
+
+    if( 0 <= ( inotifyFd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC ) ) )
+    {
+        _watchSessions( isTimeToStop, inotifyFd, _TEST_UTMP_PATH, _TEST_WTMP_PATH );
+        close( inotifyFd );
+    }
+
+    return 0;
+}
+
+RPRIVATE
+RU32
+RPAL_THREAD_FUNC
+    _testPollSessions
+    (
+        rEvent isTimeToStop
+    )
+{
+    _watchSessions( isTimeToStop, (-1), _TEST_UTMP_PATH, _TEST_WTMP_PATH );
+    return 0;
+}
+
+RPRIVATE
+RVOID
+    _testSessionTracking
+    (
+        SelfTestContext* testContext,
+        rpal_thread_func watcher
+    )
+{
+    rThread hThread = NULL;
+    rEvent stopEvent = NULL;
+    struct utmp record;
+    rQueue loginQueue = NULL;
+    rQueue logoutQueue = NULL;
+    rSequence notif = NULL;
+    RU32 size = 0;
+
+    HBS_ASSERT_TRUE( rQueue_create( &loginQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( rQueue_create( &logoutQueue, rSequence_freeWithSize, 10 ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_USER_LOGIN, NULL, 0, loginQueue, NULL ) );
+    HBS_ASSERT_TRUE( notifications_subscribe( RP_TAGS_NOTIFICATION_USER_LOGOUT, NULL, 0, logoutQueue, NULL ) );
+
+    _makeTestRecord( &record, USER_PROCESS, "pts/0", "alice", NULL, 100, 1010 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_UTMP_PATH, &record, sizeof( record ), TRUE ) );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, &record, sizeof( record ), TRUE ) );
+
+    HBS_ASSERT_TRUE( NULL != ( stopEvent = rEvent_create( TRUE ) ) );
+    HBS_ASSERT_TRUE( NULL != ( hThread = rpal_thread_new( watcher, stopEvent ) ) );
+    rpal_thread_sleep( MSEC_FROM_SEC( 1 ) );
+
+    // Only what is appended once watching is reported.
+    HBS_ASSERT_TRUE( rQueue_getSize( loginQueue, &size ) && 0 == size );
+    _makeTestRecord( &record, USER_PROCESS, "pts/1", "bob", NULL, 200, 1020 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, &record, sizeof( record ), FALSE ) );
+    if( HBS_ASSERT_TRUE( rQueue_remove( loginQueue, &notif, NULL, MSEC_FROM_SEC( 5 ) ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "bob", "pts/1" ) );
+        rSequence_free( notif );
+    }
+
+    // Rotated, the new file is read from the start.
+    HBS_ASSERT_TRUE( 0 == rename( _TEST_WTMP_PATH, _TEST_WTMP_PATH ".1" ) );
+    _makeTestRecord( &record, DEAD_PROCESS, "pts/1", NULL, NULL, 200, 1030 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_WTMP_PATH, &record, sizeof( record ), TRUE ) );
+    if( HBS_ASSERT_TRUE( rQueue_remove( logoutQueue, &notif, NULL, MSEC_FROM_SEC( 5 ) ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "bob", "pts/1" ) );
+        rSequence_free( notif );
+    }
+
+    // A logout only seen in utmp.
+    _makeTestRecord( &record, DEAD_PROCESS, "pts/0", NULL, NULL, 100, 1040 );
+    HBS_ASSERT_TRUE( _writeTestRecords( _TEST_UTMP_PATH, &record, sizeof( record ), TRUE ) );
+    if( HBS_ASSERT_TRUE( rQueue_remove( logoutQueue, &notif, NULL, MSEC_FROM_SEC( 5 ) ) ) )
+    {
+        HBS_ASSERT_TRUE( _isTestEventFor( notif, "alice", "pts/0" ) );
+        rSequence_free( notif );
+    }
+
+    rEvent_set( stopEvent );
+    rpal_thread_wait( hThread, RINFINITE );
+    rpal_thread_free( hThread );
+    rEvent_free( stopEvent );
+
+    rpal_file_delete( _TEST_UTMP_PATH, FALSE );
+    rpal_file_delete( _TEST_WTMP_PATH, FALSE );
+    rpal_file_delete( _TEST_WTMP_PATH ".1", FALSE );
+
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_USER_LOGIN, loginQueue, NULL );
+    notifications_unsubscribe( RP_TAGS_NOTIFICATION_USER_LOGOUT, logoutQueue, NULL );
+    rQueue_free( loginQueue );
+    rQueue_free( logoutQueue );
+}
+
+HBS_DECLARE_TEST( watch_sessions )
+{
+    _testSessionTracking( testContext, _testWatchSessions );
+}
+
+// Without inotify both files are polled, rotation included.
+HBS_DECLARE_TEST( poll_sessions )
+{
+    _testSessionTracking( testContext, _testPollSessions );
+}
+#endif
+
 HBS_TEST_SUITE( 21 )
 {
     RBOOL isSuccess = FALSE;
@@ -205,6 +1308,14 @@ HBS_TEST_SUITE( 21 )
     if( NULL != hbsState &&
         NULL != testContext )
     {
+#ifdef RPAL_PLATFORM_LINUX
+        HBS_RUN_TEST( wtmp_append );
+        HBS_RUN_TEST( utmp_slots );
+        HBS_RUN_TEST( wtmp_start );
+        HBS_RUN_TEST( watch_sessions );
+        HBS_RUN_TEST( poll_sessions );
+#endif
+
         isSuccess = TRUE;
     }
 
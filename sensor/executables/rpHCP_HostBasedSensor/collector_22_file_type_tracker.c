@@ -263,6 +263,10 @@ RVOID
 rpcm_tag collector_22_events[] = { RP_TAGS_NOTIFICATION_FILE_TYPE_ACCESSED,
                                    0 };
 
+RU32 collector_22_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                 COLLECTOR_DEPENDENCY( 1 ) |
+                                 COLLECTOR_DEPENDENCY( 7 );
+
 RBOOL
     collector_22_init
     (
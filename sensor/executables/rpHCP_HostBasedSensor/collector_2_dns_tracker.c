@@ -580,6 +580,8 @@ RPVOID
 rpcm_tag collector_2_events[] = { RP_TAGS_NOTIFICATION_DNS_REQUEST,
                                   0 };
 
+RU32 collector_2_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_2_init
     (
@@ -21,6 +21,7 @@ limitations under the License.
 #include <rpHostCommonPlatformLib/rTags.h>
 #include <cryptoLib/cryptoLib.h>
 #include <libOs/libOs.h>
+#include "code_meta.h"
 
 #define RPAL_FILE_ID 72
 
@@ -38,6 +39,7 @@ typedef struct
     {
         RNCHAR fileName[ RPAL_MAX_PATH ];
         CryptoLib_Hash fileHash;
+        HbsCodeMeta meta;
     } info;
     struct
     {
@@ -162,6 +164,12 @@ RBOOL
             }
         }
 
+        // Header parsing is bounded so it applies even to files too large to hash.
+        if( !HbsCodeMeta_parseFile( tmpInfo->info.fileName, &tmpInfo->info.meta ) )
+        {
+            rpal_memory_zero( &tmpInfo->info.meta, sizeof( tmpInfo->info.meta ) );
+        }
+
         if( !rpal_btree_add( g_reportedCode, tmpInfo, TRUE ) &&
             !rpal_btree_update( g_reportedCode, tmpInfo, tmpInfo, TRUE ) )
         {
@@ -207,10 +215,8 @@ RBOOL
                     0 != rpal_memory_memcmp( &emptyHash, &tmpInfo->info.fileHash, sizeof( emptyHash ) ) )
                 {
                     // Never seen this hash, report it.
-                    isNeedsReporting = populateCodeInfo( tmpInfo, pHash, originalEvent );
-
                     // We only keep the last hash at a specific file.
-                    *tmpInfo = infoFound;
+                    isNeedsReporting = populateCodeInfo( tmpInfo, pHash, originalEvent );
                 }
                 else
                 {
@@ -270,6 +276,7 @@ RVOID
 {
     rSequence notif = NULL;
     rSequence sig = NULL;
+    rSequence binaryInfo = NULL;
     RBOOL isSigned = FALSE;
     RBOOL isVerifiedLocal = FALSE;
     RBOOL isVerifiedGlobal = FALSE;
@@ -318,6 +325,16 @@ RVOID
                 }
                 rSequence_addRU32( notif, RP_TAGS_ERROR, tmpInfo.mtd.lastError );
 
+                if( HBS_CODE_META_FORMAT_UNKNOWN != tmpInfo.info.meta.format &&
+                    NULL != ( binaryInfo = rSequence_new() ) )
+                {
+                    if( !HbsCodeMeta_toSequence( &tmpInfo.info.meta, binaryInfo ) ||
+                        !rSequence_addSEQUENCE( notif, RP_TAGS_BINARY_INFO, binaryInfo ) )
+                    {
+                        rSequence_free( binaryInfo );
+                    }
+                }
+
 #ifdef RPAL_PLATFORM_WINDOWS
                 if( libOs_getSignature( name,
                                         &sig,
@@ -503,6 +520,13 @@ RVOID
 rpcm_tag collector_3_events[] = { RP_TAGS_NOTIFICATION_CODE_IDENTITY,
                                   0 };
 
+RU32 collector_3_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                COLLECTOR_DEPENDENCY( 1 ) |
+                                COLLECTOR_DEPENDENCY( 6 ) |
+                                COLLECTOR_DEPENDENCY( 7 ) |
+                                COLLECTOR_DEPENDENCY( 11 ) |
+                                COLLECTOR_DEPENDENCY( 17 );
+
 RBOOL
     collector_3_init
     (
@@ -732,6 +756,261 @@ HBS_DECLARE_TEST( code_population )
     }
 }
 
+RPRIVATE
+RVOID
+    _testSet16
+    (
+        RPU8 p,
+        RU16 val
+    )
+{
+    p[ 0 ] = (RU8)val;
+    p[ 1 ] = (RU8)( val >> 8 );
+}
+
+RPRIVATE
+RVOID
+    _testSet32
+    (
+        RPU8 p,
+        RU32 val
+    )
+{
+    _testSet16( p, (RU16)val );
+    _testSet16( p + 2, (RU16)( val >> 16 ) );
+}
+
+RPRIVATE
+RVOID
+    _testSet64
+    (
+        RPU8 p,
+        RU64 val
+    )
+{
+    _testSet32( p, (RU32)val );
+    _testSet32( p + 4, (RU32)( val >> 32 ) );
+}
+
+// Minimal PE32+ with a .text and a .rdata holding 2 imports and a CodeView entry.
+RPRIVATE
+RVOID
+    _testBuildPe
+    (
+        RPU8 pe
+    )
+{
+    rpal_memory_zero( pe, 0x1800 );
+    pe[ 0 ] = 'M';
+    pe[ 1 ] = 'Z';
+    _testSet32( pe + 0x3C, 0x80 );
+    rpal_memory_memcpy( pe + 0x80, "PE\0\0", 4 );
+    _testSet16( pe + 0x84, 0x8664 );
+    _testSet16( pe + 0x86, 2 );
+    _testSet16( pe + 0x94, 240 );
+    _testSet16( pe + 0x98, 0x20B );
+    _testSet32( pe + 0x98 + 108, 16 );
+    _testSet32( pe + 0x108 + 8, 0x3000 );
+    _testSet32( pe + 0x108 + 12, 60 );
+    _testSet32( pe + 0x108 + 48, 0x3100 );
+    _testSet32( pe + 0x108 + 52, 28 );
+
+    rpal_memory_memcpy( pe + 0x188, ".text", 5 );
+    _testSet32( pe + 0x188 + 8, 0x1000 );
+    _testSet32( pe + 0x188 + 12, 0x1000 );
+    _testSet32( pe + 0x188 + 16, 0x1000 );
+    _testSet32( pe + 0x188 + 20, 0x400 );
+    _testSet32( pe + 0x188 + 36, 0x60000020 );
+    rpal_memory_memcpy( pe + 0x1B0, ".rdata", 6 );
+    _testSet32( pe + 0x1B0 + 8, 0x400 );
+    _testSet32( pe + 0x1B0 + 12, 0x3000 );
+    _testSet32( pe + 0x1B0 + 16, 0x400 );
+    _testSet32( pe + 0x1B0 + 20, 0x1400 );
+    _testSet32( pe + 0x1B0 + 36, 0x40000040 );
+
+    _testSet32( pe + 0x1400 + 12, 0x3200 );
+    _testSet32( pe + 0x1400 + 20 + 12, 0x3210 );
+    rpal_memory_memcpy( pe + 0x1600, "KERNEL32.dll", 12 );
+    rpal_memory_memcpy( pe + 0x1610, "USER32.dll", 10 );
+
+    _testSet32( pe + 0x1500 + 12, 2 );
+    _testSet32( pe + 0x1500 + 16, 24 );
+    _testSet32( pe + 0x1500 + 24, 0x1700 );
+    rpal_memory_memcpy( pe + 0x1700, "RSDS0123456789abcdef\x01\0\0\0", 24 );
+}
+
+HBS_DECLARE_TEST( code_meta_pe )
+{
+    RU8 pe[ 0x1800 ] = { 0 };
+    HbsCodeMeta meta = { 0 };
+    rSequence seq = NULL;
+
+    _testBuildPe( pe );
+
+    if( HBS_ASSERT_TRUE( HbsCodeMeta_parseBuffer( pe, sizeof( pe ), &meta ) ) )
+    {
+        HBS_ASSERT_TRUE( HBS_CODE_META_FORMAT_PE == meta.format );
+        HBS_ASSERT_TRUE( HBS_CODE_META_ARCH_X64 == meta.arch );
+        HBS_ASSERT_TRUE( 2 == meta.nSections );
+        HBS_ASSERT_TRUE( 2 == meta.nImports );
+        HBS_ASSERT_TRUE( 0 == rpal_memory_memcmp( meta.imports, "KERNEL32.dll\0USER32.dll\0", 24 ) );
+        HBS_ASSERT_TRUE( 20 == meta.buildIdSize );
+        HBS_ASSERT_TRUE( 0 == rpal_memory_memcmp( meta.buildId, "0123456789abcdef\x01\0\0\0", 20 ) );
+        HBS_ASSERT_TRUE( 0 == meta.nHighEntropySections );
+        HBS_ASSERT_TRUE( !meta.isPacked );
+    }
+
+    if( HBS_ASSERT_TRUE( NULL != ( seq = rSequence_new() ) ) )
+    {
+        HBS_ASSERT_TRUE( HbsCodeMeta_toSequence( &meta, seq ) );
+        rSequence_free( seq );
+    }
+
+    // Truncated and garbage inputs are rejected without reading out of bounds.
+    HBS_ASSERT_TRUE( !HbsCodeMeta_parseBuffer( pe, 0x90, &meta ) );
+    rpal_memory_memcpy( pe, "garbage!", 8 );
+    HBS_ASSERT_TRUE( !HbsCodeMeta_parseBuffer( pe, sizeof( pe ), &meta ) );
+}
+
+HBS_DECLARE_TEST( code_meta_packer )
+{
+    RU8 pe[ 0x1800 ] = { 0 };
+    HbsCodeMeta meta = { 0 };
+
+    // Known packer section name.
+    _testBuildPe( pe );
+    rpal_memory_memcpy( pe + 0x188, "UPX1\0", 5 );
+    if( HBS_ASSERT_TRUE( HbsCodeMeta_parseBuffer( pe, sizeof( pe ), &meta ) ) )
+    {
+        HBS_ASSERT_TRUE( IS_FLAG_ENABLED( meta.packerFlags, HBS_CODE_META_PACKER_SECTION_NAME ) );
+        HBS_ASSERT_TRUE( meta.isPacked );
+    }
+
+    // High entropy alone is not enough, compressed resources are common.
+    _testBuildPe( pe );
+    CryptoLib_genRandomBytes( pe + 0x400, 0x1000 );
+    if( HBS_ASSERT_TRUE( HbsCodeMeta_parseBuffer( pe, sizeof( pe ), &meta ) ) )
+    {
+        HBS_ASSERT_TRUE( 1 == meta.nHighEntropySections );
+        HBS_ASSERT_TRUE( 750 < meta.maxEntropy );
+        HBS_ASSERT_TRUE( !meta.isPacked );
+    }
+
+    // But high entropy in writable code is.
+    _testSet32( pe + 0x188 + 36, 0xE0000020 );
+    if( HBS_ASSERT_TRUE( HbsCodeMeta_parseBuffer( pe, sizeof( pe ), &meta ) ) )
+    {
+        HBS_ASSERT_TRUE( IS_FLAG_ENABLED( meta.packerFlags, HBS_CODE_META_PACKER_WRITABLE_CODE ) );
+        HBS_ASSERT_TRUE( meta.isPacked );
+    }
+}
+
+HBS_DECLARE_TEST( code_meta_elf )
+{
+    RU8 elf[ 0x1000 ] = { 0 };
+    HbsCodeMeta meta = { 0 };
+
+    // ELF64 without section headers: a LOAD, a DYNAMIC and a NOTE segment.
+    rpal_memory_memcpy( elf, "\x7F" "ELF\x02\x01\x01", 7 );
+    _testSet16( elf + 18, 183 );
+    _testSet64( elf + 32, 64 );
+    _testSet16( elf + 54, 56 );
+    _testSet16( elf + 56, 3 );
+
+    _testSet32( elf + 64, 1 );
+    _testSet32( elf + 64 + 4, 5 );
+    _testSet64( elf + 64 + 16, 0x400000 );
+    _testSet64( elf + 64 + 32, 0x1000 );
+    _testSet32( elf + 120, 2 );
+    _testSet64( elf + 120 + 8, 0x200 );
+    _testSet64( elf + 120 + 32, 64 );
+    _testSet32( elf + 176, 4 );
+    _testSet64( elf + 176 + 8, 0x300 );
+    _testSet64( elf + 176 + 32, 36 );
+
+    _testSet64( elf + 0x200, 1 );
+    _testSet64( elf + 0x208, 1 );
+    _testSet64( elf + 0x210, 1 );
+    _testSet64( elf + 0x218, 11 );
+    _testSet64( elf + 0x220, 5 );
+    _testSet64( elf + 0x228, 0x400400 );
+    rpal_memory_memcpy( elf + 0x400, "\0libm.so.6\0libc.so.6", 21 );
+
+    _testSet32( elf + 0x300, 4 );
+    _testSet32( elf + 0x304, 20 );
+    _testSet32( elf + 0x308, 3 );
+    rpal_memory_memcpy( elf + 0x30C, "GNU\0" "abcdefghijklmnopqrst", 24 );
+
+    if( HBS_ASSERT_TRUE( HbsCodeMeta_parseBuffer( elf, sizeof( elf ), &meta ) ) )
+    {
+        HBS_ASSERT_TRUE( HBS_CODE_META_FORMAT_ELF == meta.format );
+        HBS_ASSERT_TRUE( HBS_CODE_META_ARCH_ARM64 == meta.arch );
+        HBS_ASSERT_TRUE( 20 == meta.buildIdSize );
+        HBS_ASSERT_TRUE( 0 == rpal_memory_memcmp( meta.buildId, "abcdefghijklmnopqrst", 20 ) );
+        HBS_ASSERT_TRUE( 2 == meta.nImports );
+        HBS_ASSERT_TRUE( 0 == rpal_memory_memcmp( meta.imports, "libm.so.6\0libc.so.6\0", 20 ) );
+        HBS_ASSERT_TRUE( IS_FLAG_ENABLED( meta.packerFlags, HBS_CODE_META_PACKER_NO_SECTIONS ) );
+        HBS_ASSERT_TRUE( !meta.isPacked );
+    }
+
+#ifdef RPAL_PLATFORM_LINUX
+    // A real binary, ourselves.
+    if( HBS_ASSERT_TRUE( HbsCodeMeta_parseFile( _NC( "/proc/self/exe" ), &meta ) ) )
+    {
+        HBS_ASSERT_TRUE( HBS_CODE_META_FORMAT_ELF == meta.format );
+        HBS_ASSERT_TRUE( HBS_CODE_META_ARCH_UNKNOWN != meta.arch );
+        HBS_ASSERT_TRUE( 0 != meta.nSections );
+        HBS_ASSERT_TRUE( !meta.isPacked );
+    }
+#endif
+}
+
+HBS_DECLARE_TEST( code_meta_macho )
+{
+    RU8 macho[ 0x1000 ] = { 0 };
+    HbsCodeMeta meta = { 0 };
+    RPU8 cmd = macho + 32;
+
+    _testSet32( macho, 0xFEEDFACF );
+    _testSet32( macho + 4, 0x01000007 );
+    _testSet32( macho + 16, 3 );
+    _testSet32( macho + 20, 24 + 56 + 152 );
+
+    _testSet32( cmd, 0x1B );
+    _testSet32( cmd + 4, 24 );
+    rpal_memory_memcpy( cmd + 8, "0123456789ABCDEF", 16 );
+    cmd += 24;
+
+    _testSet32( cmd, 0x0C );
+    _testSet32( cmd + 4, 56 );
+    _testSet32( cmd + 8, 24 );
+    rpal_memory_memcpy( cmd + 24, "/usr/lib/libSystem.B.dylib", 27 );
+    cmd += 56;
+
+    _testSet32( cmd, 0x19 );
+    _testSet32( cmd + 4, 152 );
+    rpal_memory_memcpy( cmd + 8, "__TEXT", 6 );
+    _testSet32( cmd + 60, 5 );
+    _testSet32( cmd + 64, 1 );
+    rpal_memory_memcpy( cmd + 72, "__text", 6 );
+    rpal_memory_memcpy( cmd + 72 + 16, "__TEXT", 6 );
+    _testSet64( cmd + 72 + 40, 0x800 );
+    _testSet32( cmd + 72 + 48, 0x800 );
+    _testSet32( cmd + 72 + 64, 0x80000400 );
+
+    if( HBS_ASSERT_TRUE( HbsCodeMeta_parseBuffer( macho, sizeof( macho ), &meta ) ) )
+    {
+        HBS_ASSERT_TRUE( HBS_CODE_META_FORMAT_MACHO == meta.format );
+        HBS_ASSERT_TRUE( HBS_CODE_META_ARCH_X64 == meta.arch );
+        HBS_ASSERT_TRUE( 16 == meta.buildIdSize );
+        HBS_ASSERT_TRUE( 0 == rpal_memory_memcmp( meta.buildId, "0123456789ABCDEF", 16 ) );
+        HBS_ASSERT_TRUE( 1 == meta.nImports );
+        HBS_ASSERT_TRUE( 0 == rpal_string_strcmpA( meta.imports, "/usr/lib/libSystem.B.dylib" ) );
+        HBS_ASSERT_TRUE( 1 == meta.nSections );
+        HBS_ASSERT_TRUE( !meta.isPacked );
+    }
+}
+
 HBS_TEST_SUITE( 3 )
 {
     RBOOL isSuccess = FALSE;
@@ -741,6 +1020,10 @@ HBS_TEST_SUITE( 3 )
     {
         HBS_RUN_TEST( cleanup );
         HBS_RUN_TEST( code_population );
+        HBS_RUN_TEST( code_meta_pe );
+        HBS_RUN_TEST( code_meta_packer );
+        HBS_RUN_TEST( code_meta_elf );
+        HBS_RUN_TEST( code_meta_macho );
         isSuccess = TRUE;
     }
 
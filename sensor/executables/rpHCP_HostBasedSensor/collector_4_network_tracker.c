@@ -488,6 +488,8 @@ rpcm_tag collector_4_events[] = { RP_TAGS_NOTIFICATION_NEW_TCP4_CONNECTION,
                                   RP_TAGS_NOTIFICATION_NEW_UDP6_CONNECTION,
                                   0 };
 
+RU32 collector_4_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_4_init
     (
@@ -443,6 +443,8 @@ RPVOID
 rpcm_tag collector_5_events[] = { RP_TAGS_NOTIFICATION_HIDDEN_MODULE_DETECTED,
                                   0 };
 
+RU32 collector_5_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_5_init
     (
@@ -317,6 +317,8 @@ RPVOID
 rpcm_tag collector_6_events[] = { RP_TAGS_NOTIFICATION_MODULE_LOAD,
                                   0 };
 
+RU32 collector_6_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_6_init
     (
@@ -275,6 +275,8 @@ rpcm_tag collector_7_events[] = { RP_TAGS_NOTIFICATION_FILE_CREATE,
                                   RP_TAGS_NOTIFICATION_FILE_READ,
                                   0};
 
+RU32 collector_7_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_7_init
     (
@@ -19,24 +19,65 @@ limitations under the License.
 #include "collectors.h"
 #include <notificationsLib/notificationsLib.h>
 #include <rpHostCommonPlatformLib/rTags.h>
+#include <math.h>
 
 #define  RPAL_FILE_ID           68
 
-#define SUMMARY_N_NET_CONNECTIONS   (10)
+// Each process gets a fixed size sketch of its network activity so that
+// memory is constant per process no matter how many connections it makes.
+// Destinations and ports are ranked with a space-saving top-K, distinct
+// remote endpoints are estimated with a HyperLogLog.
+#define _SUMMARY_TOP_K              10
+#define _SUMMARY_TOP_KEY_SIZE       17
+#define _SUMMARY_HLL_PRECISION      8
+#define _SUMMARY_HLL_REGISTERS      ( 1 << _SUMMARY_HLL_PRECISION )
+#define _SUMMARY_INTERIM_PERIOD     MSEC_FROM_SEC( 60 * 10 )
+#define _SUMMARY_INTERIM_CHECK      MSEC_FROM_SEC( 60 )
 
+typedef struct
+{
+    RU8 isV6;
+    RU8 ip[ 16 ];
+    RU16 port;
+} _NetEndpoint;
+
+typedef struct
+{
+    RU8 key[ _SUMMARY_TOP_KEY_SIZE ];
+    RU32 count;
+    RU32 error;
+} _TopKEntry;
+
+typedef struct
+{
+    RU32 nEntries;
+    _TopKEntry entries[ _SUMMARY_TOP_K ];
+} _TopK;
+
+typedef struct
+{
+    _TopK destinations;
+    _TopK ports;
+    RU8 endpoints[ _SUMMARY_HLL_REGISTERS ];
+    RU64 nTcp;
+    RU64 nUdp;
+    RU64 firstSeen;
+    RU64 lastSeen;
+    RU64 lastSummary;
+} _NetSketch;
 
 typedef struct
 {
     RU32 pid;
-    RBOOL hasBeenSummarized;
     rSequence proc;
-    rList net;
+    _NetSketch* sketch;
 
 } _NetActivity;
 
 RPRIVATE rBTree netState = NULL;
 
 RPRIVATE rQueue netQueue = NULL;
+RPRIVATE rQueue udpQueue = NULL;
 RPRIVATE rQueue execQueue = NULL;
 RPRIVATE rQueue termQueue = NULL;
 
@@ -50,9 +91,9 @@ RVOID
     if( NULL != p )
     {
         rSequence_free( p->proc );
-        rList_free( p->net );
+        rpal_memory_free( p->sketch );
         p->proc = NULL;
-        p->net = NULL;
+        p->sketch = NULL;
     }
 }
 
@@ -87,68 +128,454 @@ RVOID
     rSequence_free( evt );
 }
 
+//=============================================================================
+// Sketches
+//=============================================================================
+RPRIVATE
+RU64
+    _hashEndpoint
+    (
+        _NetEndpoint* endpoint
+    )
+{
+    RU64 hash = 0xcbf29ce484222325ULL;
+    RPU8 p = (RPU8)endpoint;
+    RU32 i = 0;
+
+    for( i = 0; i < sizeof( *endpoint ); i++ )
+    {
+        hash ^= p[ i ];
+        hash *= 0x100000001b3ULL;
+    }
+
+    // FNV leaves the high bits poorly mixed and they pick the register.
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+RPRIVATE
+RVOID
+    _topKAdd
+    (
+        _TopK* topK,
+        RPVOID key,
+        RU32 keySize
+    )
+{
+    RU8 fullKey[ _SUMMARY_TOP_KEY_SIZE ] = { 0 };
+    _TopKEntry* minEntry = NULL;
+    RU32 i = 0;
+
+    rpal_memory_memcpy( fullKey, key, MIN_OF( keySize, sizeof( fullKey ) ) );
+
+    for( i = 0; i < topK->nEntries; i++ )
+    {
+        if( 0 == rpal_memory_memcmp( topK->entries[ i ].key, fullKey, sizeof( fullKey ) ) )
+        {
+            topK->entries[ i ].count++;
+            return;
+        }
+
+        if( NULL == minEntry ||
+            topK->entries[ i ].count < minEntry->count )
+        {
+            minEntry = &topK->entries[ i ];
+        }
+    }
+
+    if( _SUMMARY_TOP_K > topK->nEntries )
+    {
+        minEntry = &topK->entries[ topK->nEntries ];
+        topK->nEntries++;
+        rpal_memory_zero( minEntry, sizeof( *minEntry ) );
+    }
+    else
+    {
+        // Space-saving: the new key takes over the smallest counter and
+        // inherits its count as the possible overestimation.
+        minEntry->error = minEntry->count;
+    }
+
+    rpal_memory_memcpy( minEntry->key, fullKey, sizeof( fullKey ) );
+    minEntry->count++;
+}
+
+RPRIVATE
+RVOID
+    _hllAdd
+    (
+        RU8* registers,
+        RU64 hash
+    )
+{
+    RU32 index = (RU32)( hash >> ( 64 - _SUMMARY_HLL_PRECISION ) );
+    RU8 rank = 1;
+
+    hash <<= _SUMMARY_HLL_PRECISION;
+
+    while( 0 == ( hash & 0x8000000000000000ULL ) &&
+           ( 64 - _SUMMARY_HLL_PRECISION ) >= rank )
+    {
+        rank++;
+        hash <<= 1;
+    }
+
+    if( rank > registers[ index ] )
+    {
+        registers[ index ] = rank;
+    }
+}
+
+RPRIVATE
+RU32
+    _hllEstimate
+    (
+        RU8* registers
+    )
+{
+    RDOUBLE m = _SUMMARY_HLL_REGISTERS;
+    RDOUBLE sum = 0;
+    RDOUBLE estimate = 0;
+    RU32 nZeros = 0;
+    RU32 i = 0;
+
+    for( i = 0; i < _SUMMARY_HLL_REGISTERS; i++ )
+    {
+        sum += ldexp( 1.0, -(int)registers[ i ] );
+        if( 0 == registers[ i ] )
+        {
+            nZeros++;
+        }
+    }
+
+    estimate = ( 0.7213 / ( 1.0 + 1.079 / m ) ) * m * m / sum;
+
+    // Linear counting is much more accurate for small cardinalities.
+    if( estimate <= 2.5 * m &&
+        0 != nZeros )
+    {
+        estimate = m * log( m / nZeros );
+    }
+
+    return (RU32)( estimate + 0.5 );
+}
+
+RPRIVATE
+RBOOL
+    _getRemoteEndpoint
+    (
+        rSequence evt,
+        _NetEndpoint* pEndpoint
+    )
+{
+    RBOOL isSuccess = FALSE;
+    rSequence endpoint = NULL;
+    RU32 ip4 = 0;
+
+    rpal_memory_zero( pEndpoint, sizeof( *pEndpoint ) );
+
+    // UDP events from user mode only have the local endpoint at the top.
+    if( !rSequence_getSEQUENCE( evt, RP_TAGS_DESTINATION, &endpoint ) )
+    {
+        endpoint = evt;
+    }
+
+    if( rSequence_getIPV4( endpoint, RP_TAGS_IP_ADDRESS, &ip4 ) )
+    {
+        rpal_memory_memcpy( pEndpoint->ip, &ip4, sizeof( ip4 ) );
+        isSuccess = TRUE;
+    }
+    else if( rSequence_getIPV6( endpoint, RP_TAGS_IP_ADDRESS, pEndpoint->ip ) )
+    {
+        pEndpoint->isV6 = TRUE;
+        isSuccess = TRUE;
+    }
+
+    rSequence_getRU16( endpoint, RP_TAGS_PORT, &pEndpoint->port );
+
+    return isSuccess;
+}
+
+RPRIVATE
+RVOID
+    _sketchAddConnection
+    (
+        _NetSketch* sketch,
+        rSequence evt,
+        RBOOL isTcp
+    )
+{
+    _NetEndpoint endpoint = { 0 };
+    RU64 ts = 0;
+
+    if( !rSequence_getTIMESTAMP( evt, RP_TAGS_TIMESTAMP, &ts ) )
+    {
+        ts = rpal_time_getGlobalPreciseTime();
+    }
+
+    if( 0 == sketch->firstSeen ||
+        ts < sketch->firstSeen )
+    {
+        sketch->firstSeen = ts;
+    }
+    if( ts > sketch->lastSeen )
+    {
+        sketch->lastSeen = ts;
+    }
+
+    if( isTcp )
+    {
+        sketch->nTcp++;
+    }
+    else
+    {
+        sketch->nUdp++;
+    }
+
+    if( _getRemoteEndpoint( evt, &endpoint ) )
+    {
+        // The address alone (isV6 and ip) is the destination key.
+        _topKAdd( &sketch->destinations, &endpoint, _SUMMARY_TOP_KEY_SIZE );
+        _topKAdd( &sketch->ports, &endpoint.port, sizeof( endpoint.port ) );
+        _hllAdd( sketch->endpoints, _hashEndpoint( &endpoint ) );
+    }
+}
+
+RPRIVATE
+rList
+    _topKToList
+    (
+        _TopK* topK,
+        RBOOL isPorts
+    )
+{
+    rList list = NULL;
+    rSequence entry = NULL;
+    _NetEndpoint endpoint = { 0 };
+    RU16 port = 0;
+    RU32 ip4 = 0;
+    RU32 i = 0;
+
+    if( NULL != ( list = rList_new( isPorts ? RP_TAGS_PORT_ACTIVITY : RP_TAGS_DESTINATION, RPCM_SEQUENCE ) ) )
+    {
+        for( i = 0; i < topK->nEntries; i++ )
+        {
+            if( NULL == ( entry = rSequence_new() ) )
+            {
+                continue;
+            }
+
+            if( isPorts )
+            {
+                rpal_memory_memcpy( &port, topK->entries[ i ].key, sizeof( port ) );
+                rSequence_addRU16( entry, RP_TAGS_PORT, port );
+            }
+            else
+            {
+                rpal_memory_memcpy( &endpoint, topK->entries[ i ].key, _SUMMARY_TOP_KEY_SIZE );
+                if( endpoint.isV6 )
+                {
+                    rSequence_addIPV6( entry, RP_TAGS_IP_ADDRESS, endpoint.ip );
+                }
+                else
+                {
+                    rpal_memory_memcpy( &ip4, endpoint.ip, sizeof( ip4 ) );
+                    rSequence_addIPV4( entry, RP_TAGS_IP_ADDRESS, ip4 );
+                }
+            }
+
+            rSequence_addRU32( entry, RP_TAGS_CONNECTION_COUNT, topK->entries[ i ].count );
+            rSequence_addRU32( entry, RP_TAGS_COUNT_ERROR, topK->entries[ i ].error );
+
+            if( !rList_addSEQUENCE( list, entry ) )
+            {
+                rSequence_free( entry );
+            }
+        }
+    }
+
+    return list;
+}
+
+RPRIVATE
+rSequence
+    _sketchToSequence
+    (
+        _NetSketch* sketch,
+        RBOOL isInterim
+    )
+{
+    rSequence activity = NULL;
+    rList tmpList = NULL;
+
+    if( NULL != ( activity = rSequence_new() ) )
+    {
+        rSequence_addTIMESTAMP( activity, RP_TAGS_START_TIME, sketch->firstSeen );
+        rSequence_addTIMESTAMP( activity, RP_TAGS_END_TIME, sketch->lastSeen );
+        rSequence_addRU64( activity, RP_TAGS_TCP_CONNECTIONS, sketch->nTcp );
+        rSequence_addRU64( activity, RP_TAGS_UDP_CONNECTIONS, sketch->nUdp );
+        rSequence_addRU32( activity, RP_TAGS_DISTINCT_ENDPOINTS, _hllEstimate( sketch->endpoints ) );
+
+        if( NULL != ( tmpList = _topKToList( &sketch->destinations, FALSE ) ) &&
+            !rSequence_addLIST( activity, RP_TAGS_TOP_DESTINATIONS, tmpList ) )
+        {
+            rList_free( tmpList );
+        }
+
+        if( NULL != ( tmpList = _topKToList( &sketch->ports, TRUE ) ) &&
+            !rSequence_addLIST( activity, RP_TAGS_TOP_PORTS, tmpList ) )
+        {
+            rList_free( tmpList );
+        }
+
+        if( isInterim )
+        {
+            rSequence_addRU8( activity, RP_TAGS_IS_INTERIM, 1 );
+        }
+    }
+
+    return activity;
+}
 
 RPRIVATE
 RBOOL
     _summarize
     (
-        _NetActivity* pActivity
+        _NetActivity* pActivity,
+        RBOOL isInterim
     )
 {
     RBOOL isSuccess = FALSE;
     Atom parentAtom = { 0 };
     rSequence wrapper = NULL;
+    rSequence proc = NULL;
+    rSequence activity = NULL;
 
-    if( NULL != pActivity )
+    if( NULL != pActivity &&
+        NULL != pActivity->sketch &&
+        0 != pActivity->sketch->nTcp + pActivity->sketch->nUdp )
     {
-        if( NULL != pActivity->net &&
-            0 != rList_getNumElements( pActivity->net ) )
+        if( NULL != pActivity->proc )
+        {
+            proc = rSequence_duplicate( pActivity->proc );
+        }
+        else if( NULL != ( proc = rSequence_new() ) )
+        {
+            rSequence_addRU32( proc, RP_TAGS_PROCESS_ID, pActivity->pid );
+        }
+
+        if( NULL != proc &&
+            NULL != ( wrapper = rSequence_new() ) )
         {
-            if( NULL == pActivity->proc )
+            if( rSequence_addSEQUENCE( wrapper, RP_TAGS_PROCESS, proc ) )
             {
-                if( NULL != ( pActivity->proc = rSequence_new() ) )
+                if( NULL != ( activity = _sketchToSequence( pActivity->sketch, isInterim ) ) &&
+                    !rSequence_addSEQUENCE( proc, RP_TAGS_NETWORK_ACTIVITY, activity ) )
                 {
-                    rSequence_addRU32( pActivity->proc, RP_TAGS_PROCESS_ID, pActivity->pid );
+                    rSequence_free( activity );
                 }
-            }
 
-            if( NULL != pActivity->proc )
-            {
-                if( rSequence_addLIST( pActivity->proc, RP_TAGS_NETWORK_ACTIVITY, pActivity->net ) )
+                parentAtom.key.category = RP_TAGS_NOTIFICATION_NEW_PROCESS;
+                parentAtom.key.process.pid = pActivity->pid;
+                // Query the last value since final summaries are on process death.
+                if( atoms_query( &parentAtom, 0 ) )
                 {
-                    if( NULL != ( wrapper = rSequence_new() ) )
-                    {
-                        if( rSequence_addSEQUENCE( wrapper, RP_TAGS_PROCESS, pActivity->proc ) )
-                        {
-                            parentAtom.key.category = RP_TAGS_NOTIFICATION_NEW_PROCESS;
-                            parentAtom.key.process.pid = pActivity->pid;
-                            // Query the last value since summaries are on process death.
-                            if( atoms_query( &parentAtom, 0 ) )
-                            {
-                                HbsSetParentAtom( wrapper, parentAtom.id );
-                            }
-
-                            hbs_timestampEvent( wrapper, 0 );
-                            hbs_publish( RP_TAGS_NOTIFICATION_NETWORK_SUMMARY, wrapper );
-                        }
-
-                        rSequence_shallowFree( wrapper );
-                    }
-
-                    pActivity->net = NULL;
+                    HbsSetParentAtom( wrapper, parentAtom.id );
                 }
+
+                hbs_timestampEvent( wrapper, 0 );
+                isSuccess = hbs_publish( RP_TAGS_NOTIFICATION_NETWORK_SUMMARY, wrapper );
+            }
+            else
+            {
+                rSequence_free( proc );
             }
-        }
 
-        rSequence_free( pActivity->proc );
-        rList_free( pActivity->net );
+            rSequence_free( wrapper );
+        }
+        else
+        {
+            rSequence_free( proc );
+        }
 
-        rpal_memory_zero( pActivity, sizeof( *pActivity ) );
+        // Each summary covers the activity since the previous one.
+        rpal_memory_zero( pActivity->sketch, sizeof( *pActivity->sketch ) );
+        pActivity->sketch->lastSummary = rpal_time_getGlobalPreciseTime();
     }
 
     return isSuccess;
 }
 
+RPRIVATE
+RVOID
+    _summarizeLongLived
+    (
+
+    )
+{
+    _NetActivity activity = { 0 };
+    RU32 lastPid = 0;
+    RU64 now = rpal_time_getGlobalPreciseTime();
+    RBOOL isFound = FALSE;
+
+    // Only the sketches are touched, and they live outside the tree,
+    // so the tree can be walked in place.
+    for( isFound = rpal_btree_minimum( netState, &activity, TRUE );
+         isFound;
+         isFound = rpal_btree_after( netState, &lastPid, &activity, TRUE ) )
+    {
+        lastPid = activity.pid;
+
+        if( NULL != activity.sketch &&
+            0 != activity.sketch->nTcp + activity.sketch->nUdp &&
+            now > activity.sketch->lastSummary + _SUMMARY_INTERIM_PERIOD )
+        {
+            rpal_debug_info( "process is long lived, publish interim summary" );
+            _summarize( &activity, TRUE );
+        }
+    }
+}
+
+RPRIVATE
+RBOOL
+    _processConnections
+    (
+        rEvent isTimeToStop,
+        rQueue queue,
+        RBOOL isTcp
+    )
+{
+    RBOOL isNewEventProcessed = FALSE;
+    rSequence netEvt = NULL;
+    RU32 netPid = 0;
+    _NetActivity activity = { 0 };
+
+    while( rpal_memory_isValid( isTimeToStop ) &&
+           !rEvent_wait( isTimeToStop, 0 ) &&
+           rQueue_remove( queue, &netEvt, NULL, 0 ) )
+    {
+        // We don't have a record of the process starting.
+        // There is a potential race condition and ignoring
+        // the net event opens a blind spot but for now it greatly
+        // simplifies the code.
+        if( rSequence_getRU32( netEvt, RP_TAGS_PROCESS_ID, &netPid ) &&
+            rpal_btree_search( netState, &netPid, &activity, TRUE ) &&
+            NULL != activity.sketch )
+        {
+            _sketchAddConnection( activity.sketch, netEvt, isTcp );
+            isNewEventProcessed = TRUE;
+        }
+
+        rSequence_free( netEvt );
+    }
+
+    return isNewEventProcessed;
+}
 
 RPRIVATE
 RPVOID
@@ -158,13 +585,12 @@ RPVOID
         RPVOID ctx
     )
 {
-    rSequence netEvt = NULL;
     rSequence execEvt = NULL;
     rSequence termEvt = NULL;
 
-    RU32 netPid = 0;
     RU32 execPid = 0;
     RU32 termPid = 0;
+    RU64 lastInterimCheck = rpal_time_getGlobalPreciseTime();
 
     _NetActivity activity = { 0 };
 
@@ -193,24 +619,25 @@ RPVOID
             {
                 // If we already had an entry for it in the state
                 // we assume we somehow missed the termination event (although unlikely)
-                // so we reset it
-                if( !rpal_btree_remove( netState, &execPid, &activity, TRUE ) )
+                // so we report what we had and reset it.
+                if( rpal_btree_remove( netState, &execPid, &activity, TRUE ) )
                 {
-                    rpal_memory_zero( &activity, sizeof( activity ) );
-                    activity.pid = execPid;
-                }
-
-                if( NULL != activity.proc ||
-                    NULL != activity.net )
-                {
-                    // If it had previous data, free it
+                    _summarize( &activity, FALSE );
                     _freePid( &activity );
                 }
 
-                activity.hasBeenSummarized = FALSE;
+                rpal_memory_zero( &activity, sizeof( activity ) );
+                activity.pid = execPid;
                 activity.proc = execEvt;
 
-                if( rpal_btree_add( netState, &activity, TRUE ) )
+                if( NULL != ( activity.sketch = rpal_memory_alloc( sizeof( *activity.sketch ) ) ) )
+                {
+                    rpal_memory_zero( activity.sketch, sizeof( *activity.sketch ) );
+                    activity.sketch->lastSummary = rpal_time_getGlobalPreciseTime();
+                }
+
+                if( NULL != activity.sketch &&
+                    rpal_btree_add( netState, &activity, TRUE ) )
                 {
                     isNewEventProcessed = TRUE;
                 }
@@ -225,62 +652,15 @@ RPVOID
             }
         }
 
-        while( rpal_memory_isValid( isTimeToStop ) &&
-              !rEvent_wait( isTimeToStop, 0 ) &&
-              rQueue_remove( netQueue, &netEvt, NULL, 0 ) )
+        if( _processConnections( isTimeToStop, netQueue, TRUE ) )
         {
-            if( rSequence_getRU32( netEvt, RP_TAGS_PROCESS_ID, &netPid ) )
-            {
-                if( !rpal_btree_remove( netState, &netPid, &activity, TRUE ) )
-                {
-                    // We don't have a record of the process starting.
-                    // There is a potential race condition and ignoring
-                    // the net event opens a blind spot but for now it greatly
-                    // simplifies the code. Just trying to avoid managed memory leaks.
-                    rSequence_free( netEvt );
-                }
-                else
-                {
-                    if( !activity.hasBeenSummarized )
-                    {
-                        if( NULL == activity.net )
-                        {
-                            activity.net = rList_new( RP_TAGS_NOTIFICATION_NEW_TCP4_CONNECTION, RPCM_SEQUENCE );
-                        }
-
-                        if( !rList_addSEQUENCE( activity.net, netEvt ) )
-                        {
-                            rSequence_free( netEvt );
-                        }
-
-                        if( SUMMARY_N_NET_CONNECTIONS <= rList_getNumElements( activity.net ) )
-                        {
-                            rpal_debug_info( "process reached max summary size, publish" );
-                            _summarize( &activity );
-                            activity.pid = netPid;
-                            activity.hasBeenSummarized = TRUE;
-                        }
-                    }
-                    else
-                    {
-                        rSequence_free( netEvt );
-                    }
-
-                    if( rpal_btree_add( netState, &activity, TRUE ) )
-                    {
-                        isNewEventProcessed = TRUE;
-                    }
-                    else
-                    {
-                        _freePid( &activity );
-                    }
-                }
-            }
-            else
-            {
-                rSequence_free( netEvt );
-            }
+            isNewEventProcessed = TRUE;
+        }
+        if( _processConnections( isTimeToStop, udpQueue, FALSE ) )
+        {
+            isNewEventProcessed = TRUE;
         }
+
         while( rpal_memory_isValid( isTimeToStop ) &&
                !rEvent_wait( isTimeToStop, 0 ) &&
                rQueue_remove( termQueue, &termEvt, NULL, 0 ) )
@@ -290,12 +670,19 @@ RPVOID
                 if( rpal_btree_remove( netState, &termPid, &activity, TRUE ) )
                 {
                     rpal_debug_info( "process terminating, cleanup" );
-                    _summarize( &activity );
+                    _summarize( &activity, FALSE );
+                    _freePid( &activity );
                 }
             }
 
             rSequence_free( termEvt );
         }
+
+        if( rpal_time_getGlobalPreciseTime() > lastInterimCheck + _SUMMARY_INTERIM_CHECK )
+        {
+            _summarizeLongLived();
+            lastInterimCheck = rpal_time_getGlobalPreciseTime();
+        }
     }
 
     return NULL;
@@ -308,6 +695,10 @@ RPVOID
 rpcm_tag collector_8_events[] = { RP_TAGS_NOTIFICATION_NETWORK_SUMMARY,
                                   0 };
 
+RU32 collector_8_dependencies = COLLECTOR_DEPENDENCY( 0 ) |
+                                COLLECTOR_DEPENDENCY( 1 ) |
+                                COLLECTOR_DEPENDENCY( 4 );
+
 RBOOL
     collector_8_init
     (
@@ -323,10 +714,13 @@ RBOOL
     {
         if( NULL != ( netState = rpal_btree_create( sizeof( _NetActivity ), (rpal_btree_comp_f)_isPid, (rpal_btree_free_f)_freePid ) ) &&
             rQueue_create( &netQueue, _freeEvt, 100 ) &&
+            rQueue_create( &udpQueue, _freeEvt, 100 ) &&
             rQueue_create( &execQueue, _freeEvt, 100 ) &&
             rQueue_create( &termQueue, _freeEvt, 100 ) &&
             notifications_subscribe( RP_TAGS_NOTIFICATION_NEW_TCP4_CONNECTION, NULL, 0, netQueue, NULL ) &&
-            notifications_subscribe( RP_TAGS_NOTIFICATION_NEW_UDP4_CONNECTION, NULL, 0, netQueue, NULL ) &&
+            notifications_subscribe( RP_TAGS_NOTIFICATION_NEW_TCP6_CONNECTION, NULL, 0, netQueue, NULL ) &&
+            notifications_subscribe( RP_TAGS_NOTIFICATION_NEW_UDP4_CONNECTION, NULL, 0, udpQueue, NULL ) &&
+            notifications_subscribe( RP_TAGS_NOTIFICATION_NEW_UDP6_CONNECTION, NULL, 0, udpQueue, NULL ) &&
             notifications_subscribe( RP_TAGS_NOTIFICATION_NEW_PROCESS, NULL, 0, execQueue, NULL ) &&
             notifications_subscribe( RP_TAGS_NOTIFICATION_TERMINATE_PROCESS, NULL, 0, termQueue, NULL ) &&
             rThreadPool_task( hbsState->hThreadPool, summarizeNetwork, NULL ) )
@@ -336,10 +730,13 @@ RBOOL
         else
         {
             notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_TCP4_CONNECTION, netQueue, NULL );
-            notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_UDP4_CONNECTION, netQueue, NULL );
+            notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_TCP6_CONNECTION, netQueue, NULL );
+            notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_UDP4_CONNECTION, udpQueue, NULL );
+            notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_UDP6_CONNECTION, udpQueue, NULL );
             notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_PROCESS, execQueue, NULL );
             notifications_unsubscribe( RP_TAGS_NOTIFICATION_TERMINATE_PROCESS, termQueue, NULL );
             rQueue_free( netQueue );
+            rQueue_free( udpQueue );
             rQueue_free( execQueue );
             rQueue_free( termQueue );
             rpal_btree_destroy( netState, TRUE );
@@ -363,10 +760,13 @@ RBOOL
     if( NULL != hbsState )
     {
         notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_TCP4_CONNECTION, netQueue, NULL );
-        notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_UDP4_CONNECTION, netQueue, NULL );
+        notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_TCP6_CONNECTION, netQueue, NULL );
+        notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_UDP4_CONNECTION, udpQueue, NULL );
+        notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_UDP6_CONNECTION, udpQueue, NULL );
         notifications_unsubscribe( RP_TAGS_NOTIFICATION_NEW_PROCESS, execQueue, NULL );
         notifications_unsubscribe( RP_TAGS_NOTIFICATION_TERMINATE_PROCESS, termQueue, NULL );
         rQueue_free( netQueue );
+        rQueue_free( udpQueue );
         rQueue_free( execQueue );
         rQueue_free( termQueue );
         rpal_btree_destroy( netState, TRUE );
@@ -380,6 +780,165 @@ RBOOL
 //=============================================================================
 //  Collector Testing
 //=============================================================================
+RPRIVATE
+rSequence
+    _testConnection
+    (
+        RU32 ip,
+        RU16 port,
+        RU64 ts
+    )
+{
+    rSequence evt = NULL;
+    rSequence dest = NULL;
+
+    if( NULL != ( evt = rSequence_new() ) )
+    {
+        if( NULL != ( dest = rSequence_new() ) )
+        {
+            rSequence_addIPV4( dest, RP_TAGS_IP_ADDRESS, ip );
+            rSequence_addRU16( dest, RP_TAGS_PORT, port );
+            if( !rSequence_addSEQUENCE( evt, RP_TAGS_DESTINATION, dest ) )
+            {
+                rSequence_free( dest );
+            }
+        }
+        rSequence_addTIMESTAMP( evt, RP_TAGS_TIMESTAMP, ts );
+    }
+
+    return evt;
+}
+
+HBS_DECLARE_TEST( top_k )
+{
+    _TopK topK = { 0 };
+    RU32 key = 0;
+    RU32 i = 0;
+    RBOOL isHeavyFound = FALSE;
+    RBOOL isMediumFound = FALSE;
+
+    // Two heavy hitters hidden in a long tail of unique keys, space-saving
+    // guarantees to keep anything seen more than N/K times.
+    for( i = 0; i < 5000; i++ )
+    {
+        key = 1;
+        if( 0 == i % 3 ) _topKAdd( &topK, &key, sizeof( key ) );
+        key = 2;
+        if( 0 == i % 5 ) _topKAdd( &topK, &key, sizeof( key ) );
+        key = 1000 + i;
+        _topKAdd( &topK, &key, sizeof( key ) );
+    }
+
+    HBS_ASSERT_TRUE( _SUMMARY_TOP_K == topK.nEntries );
+
+    for( i = 0; i < topK.nEntries; i++ )
+    {
+        rpal_memory_memcpy( &key, topK.entries[ i ].key, sizeof( key ) );
+
+        // Counts are never underestimated and the error bounds them.
+        if( 1 == key )
+        {
+            isHeavyFound = TRUE;
+            HBS_ASSERT_TRUE( 1667 <= topK.entries[ i ].count );
+            HBS_ASSERT_TRUE( 1667 >= topK.entries[ i ].count - topK.entries[ i ].error );
+        }
+        else if( 2 == key )
+        {
+            isMediumFound = TRUE;
+            HBS_ASSERT_TRUE( 1000 <= topK.entries[ i ].count );
+            HBS_ASSERT_TRUE( 1000 >= topK.entries[ i ].count - topK.entries[ i ].error );
+        }
+    }
+
+    HBS_ASSERT_TRUE( isHeavyFound );
+    HBS_ASSERT_TRUE( isMediumFound );
+}
+
+HBS_DECLARE_TEST( distinct_endpoints )
+{
+    RU8 registers[ _SUMMARY_HLL_REGISTERS ] = { 0 };
+    _NetEndpoint endpoint = { 0 };
+    RU32 nDistinct[] = { 0, 1, 50, 1000, 50000 };
+    RU32 estimate = 0;
+    RU32 value = 0;
+    RU32 i = 0;
+    RU32 j = 0;
+
+    for( i = 0; i < ARRAY_N_ELEM( nDistinct ); i++ )
+    {
+        rpal_memory_zero( registers, sizeof( registers ) );
+
+        // Every endpoint is seen twice, duplicates must not count.
+        for( j = 0; j < nDistinct[ i ] * 2; j++ )
+        {
+            value = j % nDistinct[ i ];
+            rpal_memory_zero( &endpoint, sizeof( endpoint ) );
+            rpal_memory_memcpy( endpoint.ip, &value, sizeof( value ) );
+            endpoint.port = 443;
+            _hllAdd( registers, _hashEndpoint( &endpoint ) );
+        }
+
+        estimate = _hllEstimate( registers );
+
+        // The standard error with 256 registers is 6.5%, allow for 3 sigmas.
+        HBS_ASSERT_TRUE( estimate <= nDistinct[ i ] + ( nDistinct[ i ] / 5 ) + 1 );
+        HBS_ASSERT_TRUE( estimate + ( nDistinct[ i ] / 5 ) + 1 >= nDistinct[ i ] );
+    }
+}
+
+HBS_DECLARE_TEST( sketch_summary )
+{
+    _NetSketch sketch = { 0 };
+    rSequence evt = NULL;
+    rSequence activity = NULL;
+    rList tmpList = NULL;
+    rSequence entry = NULL;
+    RU64 tmp64 = 0;
+    RU32 tmp32 = 0;
+    RU8 tmp8 = 0;
+    RU32 i = 0;
+
+    // Many more connections than the old 10 event cap.
+    for( i = 0; i < 20000; i++ )
+    {
+        if( NULL != ( evt = _testConnection( 0x0A000001 + ( i % 100 ), (RU16)( 0 == i % 2 ? 443 : 80 ), 1000 + i ) ) )
+        {
+            _sketchAddConnection( &sketch, evt, 0 != i % 4 );
+            rSequence_free( evt );
+        }
+    }
+
+    HBS_ASSERT_TRUE( 15000 == sketch.nTcp );
+    HBS_ASSERT_TRUE( 5000 == sketch.nUdp );
+
+    if( HBS_ASSERT_TRUE( NULL != ( activity = _sketchToSequence( &sketch, TRUE ) ) ) )
+    {
+        HBS_ASSERT_TRUE( rSequence_getTIMESTAMP( activity, RP_TAGS_START_TIME, &tmp64 ) && 1000 == tmp64 );
+        HBS_ASSERT_TRUE( rSequence_getTIMESTAMP( activity, RP_TAGS_END_TIME, &tmp64 ) && 1000 + 19999 == tmp64 );
+        HBS_ASSERT_TRUE( rSequence_getRU64( activity, RP_TAGS_TCP_CONNECTIONS, &tmp64 ) && 15000 == tmp64 );
+        HBS_ASSERT_TRUE( rSequence_getRU64( activity, RP_TAGS_UDP_CONNECTIONS, &tmp64 ) && 5000 == tmp64 );
+        HBS_ASSERT_TRUE( rSequence_getRU32( activity, RP_TAGS_DISTINCT_ENDPOINTS, &tmp32 ) && 80 <= tmp32 && 120 >= tmp32 );
+        HBS_ASSERT_TRUE( rSequence_getRU8( activity, RP_TAGS_IS_INTERIM, &tmp8 ) && 1 == tmp8 );
+
+        if( HBS_ASSERT_TRUE( rSequence_getLIST( activity, RP_TAGS_TOP_DESTINATIONS, &tmpList ) ) )
+        {
+            HBS_ASSERT_TRUE( _SUMMARY_TOP_K == rList_getNumElements( tmpList ) );
+        }
+
+        if( HBS_ASSERT_TRUE( rSequence_getLIST( activity, RP_TAGS_TOP_PORTS, &tmpList ) ) )
+        {
+            HBS_ASSERT_TRUE( 2 == rList_getNumElements( tmpList ) );
+            while( rList_getSEQUENCE( tmpList, RP_TAGS_PORT_ACTIVITY, &entry ) )
+            {
+                HBS_ASSERT_TRUE( rSequence_getRU32( entry, RP_TAGS_CONNECTION_COUNT, &tmp32 ) && 10000 == tmp32 );
+                HBS_ASSERT_TRUE( rSequence_getRU32( entry, RP_TAGS_COUNT_ERROR, &tmp32 ) && 0 == tmp32 );
+            }
+        }
+
+        rSequence_free( activity );
+    }
+}
+
 HBS_TEST_SUITE( 8 )
 {
     RBOOL isSuccess = FALSE;
@@ -387,8 +946,12 @@ HBS_TEST_SUITE( 8 )
     if( NULL != hbsState &&
         NULL != testContext )
     {
+        HBS_RUN_TEST( top_k );
+        HBS_RUN_TEST( distinct_endpoints );
+        HBS_RUN_TEST( sketch_summary );
+
         isSuccess = TRUE;
     }
 
     return isSuccess;
-}
\ No newline at end of file
+}
@@ -23,6 +23,61 @@ limitations under the License.
 
 #define RPAL_FILE_ID                  64
 
+#define _DIR_LIST_CRAWL_THREADS       4
+
+#ifdef RPAL_PLATFORM_LINUX
+// Pseudo file systems are huge and never what a listing from above them is
+// after, so they are pruned then. Listing them, or anything in them, as the
+// root is unaffected.
+#define _DIR_LIST_N_PSEUDO_FS         2
+RPRIVATE RPNCHAR g_pseudoFs[ _DIR_LIST_N_PSEUDO_FS ] = { _NC( "/proc" ), _NC( "/sys" ) };
+
+RPRIVATE
+RBOOL
+    _isDirBelow
+    (
+        RPNCHAR root,
+        RPNCHAR path
+    )
+{
+    RU32 rootLen = rpal_string_strlen( root );
+
+    while( 0 != rootLen &&
+           _NC( '/' ) == root[ rootLen - 1 ] )
+    {
+        rootLen--;
+    }
+
+    return rootLen < rpal_string_strlen( path ) &&
+           0 == rpal_memory_memcmp( root, path, rootLen * sizeof( RNCHAR ) ) &&
+           _NC( '/' ) == path[ rootLen ];
+}
+
+// Fills pruned with the pseudo file systems below root, NULL-terminated.
+RPRIVATE
+RVOID
+    _getDirListPruning
+    (
+        RPNCHAR root,
+        RPNCHAR pruned[ _DIR_LIST_N_PSEUDO_FS + 1 ]
+    )
+{
+    RU32 i = 0;
+    RU32 nPruned = 0;
+
+    for( i = 0; i < _DIR_LIST_N_PSEUDO_FS; i++ )
+    {
+        if( _isDirBelow( root, g_pseudoFs[ i ] ) )
+        {
+            pruned[ nPruned ] = g_pseudoFs[ i ];
+            nPruned++;
+        }
+    }
+
+    pruned[ nPruned ] = NULL;
+}
+#endif
+
 RPRIVATE
 RBOOL
     _getAsNativeString
@@ -311,6 +366,10 @@ RVOID
     rList entries = NULL;
     rSequence dirEntry = NULL;
     RU32 depth = 0;
+    rDirCrawlOptions crawlOptions = { 0 };
+#ifdef RPAL_PLATFORM_LINUX
+    RPNCHAR pruned[ _DIR_LIST_N_PSEUDO_FS + 1 ] = { 0 };
+#endif
     UNREFERENCED_PARAMETER( eventType );
 
     if( rpal_memory_isValid( event ) )
@@ -323,7 +382,18 @@ RVOID
             // dir depth is optional, but if provided, use it
             rSequence_getRU32( event, RP_TAGS_DIRECTORY_LIST_DEPTH, &depth );
 
-            if( NULL != ( hDir = rpal_file_crawlStart( filePath, fileSpec, depth ) ) )
+            // Only deep listings have enough directories to keep workers busy.
+            if( 0 != depth )
+            {
+                crawlOptions.nThreads = _DIR_LIST_CRAWL_THREADS;
+            }
+
+#ifdef RPAL_PLATFORM_LINUX
+            _getDirListPruning( filePath, pruned );
+            crawlOptions.pruneExpr = pruned;
+#endif
+
+            if( NULL != ( hDir = rpal_file_crawlStartEx( filePath, fileSpec, depth, &crawlOptions ) ) )
             {
                 if( NULL != ( entries = rList_new( RP_TAGS_DIRECTORY_LIST, RPCM_SEQUENCE ) ) )
                 {
@@ -384,6 +454,8 @@ rpcm_tag collector_9_events[] = { RP_TAGS_NOTIFICATION_FILE_GET_REP,
                                   RP_TAGS_NOTIFICATION_DIR_LIST_REP,
                                   0 };
 
+RU32 collector_9_dependencies = COLLECTOR_DEPENDENCY( 0 );
+
 RBOOL
     collector_9_init
     (
@@ -448,6 +520,33 @@ RBOOL
 //=============================================================================
 //  Collector Testing
 //=============================================================================
+#ifdef RPAL_PLATFORM_LINUX
+HBS_DECLARE_TEST( dir_list_pruning )
+{
+    RPNCHAR pruned[ _DIR_LIST_N_PSEUDO_FS + 1 ] = { 0 };
+
+    // Crawling from above prunes both.
+    _getDirListPruning( _NC( "/" ), pruned );
+    HBS_ASSERT_TRUE( NULL != pruned[ 0 ] && 0 == rpal_string_strcmp( pruned[ 0 ], _NC( "/proc" ) ) );
+    HBS_ASSERT_TRUE( NULL != pruned[ 1 ] && 0 == rpal_string_strcmp( pruned[ 1 ], _NC( "/sys" ) ) );
+    HBS_ASSERT_TRUE( NULL == pruned[ 2 ] );
+
+    // Starting in or below one of them prunes nothing.
+    _getDirListPruning( _NC( "/proc" ), pruned );
+    HBS_ASSERT_TRUE( NULL == pruned[ 0 ] );
+    _getDirListPruning( _NC( "/proc/" ), pruned );
+    HBS_ASSERT_TRUE( NULL == pruned[ 0 ] );
+    _getDirListPruning( _NC( "/sys/class" ), pruned );
+    HBS_ASSERT_TRUE( NULL == pruned[ 0 ] );
+
+    // Nor does a root elsewhere, even one sharing a prefix.
+    _getDirListPruning( _NC( "/usr" ), pruned );
+    HBS_ASSERT_TRUE( NULL == pruned[ 0 ] );
+    _getDirListPruning( _NC( "/pro" ), pruned );
+    HBS_ASSERT_TRUE( NULL == pruned[ 0 ] );
+}
+#endif
+
 HBS_TEST_SUITE( 9 )
 {
     RBOOL isSuccess = FALSE;
@@ -455,6 +554,10 @@ HBS_TEST_SUITE( 9 )
     if( NULL != hbsState &&
         NULL != testContext )
     {
+#ifdef RPAL_PLATFORM_LINUX
+        HBS_RUN_TEST( dir_list_pruning );
+#endif
+
         isSuccess = TRUE;
     }
 
@@ -32,11 +32,37 @@ typedef struct
 
 typedef struct
 {
-    rBTree events;
+    rpcm_tag type;
+    RTIME ts;
+    RU64 releaseAt;
+    rSequence event;
+} _EventStub;
+
+typedef struct
+{
+    _EventStub* stubs;
+    RU32 nStubs;
+    RU32 nAlloc;
+} _WheelSlot;
+
+// The delay buffer is a hashed timing wheel with one slot per millisecond
+// of monotonic time. No event is delayed by more than nMilliSeconds and the
+// wheel is larger than that, so an insert is O(1) whatever the order in
+// which events arrive. Events that are due are moved to the matured list
+// which is kept in timestamp order.
+typedef struct
+{
+    _WheelSlot* slots;
+    RU32 nSlots;
     RU32 nMilliSeconds;
+    RU64 cursor;
+    RU32 nEvents;
+    _EventStub* matured;
+    RU32 nMatured;
+    RU32 nMaturedAlloc;
     rEvent newElemEvent;
     rMutex mutex;
-    RTIME oldestItem;
+    RU64 nextRelease;
 } _HbsDelayBuffer;
 
 RBOOL
@@ -104,7 +130,7 @@ RBOOL
 {
     RBOOL isCpuIdle = FALSE;
 
-    RTIME end = rpal_time_getLocal() + timeoutSeconds;
+    RU64 end = rpal_time_getMonotonicCoarseNs() + NSEC_FROM_SEC( timeoutSeconds );
 
     do
     {
@@ -126,7 +152,7 @@ RBOOL
             }
         }
     } 
-    while( end > rpal_time_getLocal() );
+    while( end > rpal_time_getMonotonicCoarseNs() );
 
     return isCpuIdle;
 }
@@ -177,7 +203,7 @@ RVOID
     )
 {
     _HbsRingBuffer* pHrb = (_HbsRingBuffer*)hrb;
-    
+
     if( rpal_memory_isValid( pHrb ) )
     {
         if( NULL != pHrb->col )
@@ -216,6 +242,7 @@ RBOOL
         {
             if( rpal_collection_remove( pHrb->col, &toDelete, NULL, NULL, NULL ) )
             {
+                pHrb->sizeInBuffer -= MIN_OF( pHrb->sizeInBuffer, rSequence_getEstimateSize( toDelete ) );
                 rSequence_free( toDelete );
             }
             else
@@ -229,7 +256,7 @@ RBOOL
             rpal_collection_add( pHrb->col, elem, sizeof( elem ) ) )
         {
             isAdded = TRUE;
-            pHrb->sizeInBuffer += rSequence_getEstimateSize( elem );
+            pHrb->sizeInBuffer += elemSize;
         }
     }
 
@@ -348,6 +375,231 @@ RBOOL
     return isSuccess;
 }
 
+typedef struct
+{
+    HbsState* hbsState;
+    rMutex mutex;
+    rEvent isChanged;
+    RU32 toStart;
+    RU32 inProgress;
+
+} _CollectorStartup;
+
+RPRIVATE
+RPVOID
+    _initCollectorsWorker
+    (
+        rEvent isTimeToStop,
+        _CollectorStartup* startup
+    )
+{
+    RU32 i = 0;
+    RU32 nCollectors = 0;
+    RU32 toInit = 0;
+    RU32 pending = 0;
+    RBOOL isDone = FALSE;
+    RBOOL isSuccess = FALSE;
+    RU64 startTime = 0;
+    HbsState* hbsState = NULL;
+
+    UNREFERENCED_PARAMETER( isTimeToStop );
+
+    if( NULL == startup )
+    {
+        return NULL;
+    }
+
+    hbsState = startup->hbsState;
+    nCollectors = ARRAY_N_ELEM( hbsState->collectors );
+
+    while( !isDone )
+    {
+        toInit = (RU32)( -1 );
+
+        if( !rMutex_lock( startup->mutex ) )
+        {
+            break;
+        }
+
+        // Any change after this point will set the event again.
+        rEvent_unset( startup->isChanged );
+
+        pending = startup->toStart | startup->inProgress;
+
+        for( i = 0; i < nCollectors; i++ )
+        {
+            if( IS_FLAG_ENABLED( startup->toStart, COLLECTOR_DEPENDENCY( i ) ) &&
+                0 == ( *hbsState->collectors[ i ].dependencies & pending ) )
+            {
+                toInit = i;
+                break;
+            }
+        }
+
+        if( (RU32)( -1 ) == toInit &&
+            0 != startup->toStart &&
+            0 == startup->inProgress )
+        {
+            // Nothing is running and nothing is ready, the dependencies
+            // are circular so we break the cycle at the lowest collector.
+            for( i = 0; i < nCollectors; i++ )
+            {
+                if( IS_FLAG_ENABLED( startup->toStart, COLLECTOR_DEPENDENCY( i ) ) )
+                {
+                    rpal_debug_error( "circular dependency on collector %d, starting anyway.", i );
+                    toInit = i;
+                    break;
+                }
+            }
+        }
+
+        if( (RU32)( -1 ) != toInit )
+        {
+            DISABLE_FLAG( startup->toStart, COLLECTOR_DEPENDENCY( toInit ) );
+            ENABLE_FLAG( startup->inProgress, COLLECTOR_DEPENDENCY( toInit ) );
+        }
+        else if( 0 == startup->toStart )
+        {
+            isDone = TRUE;
+        }
+
+        rMutex_unlock( startup->mutex );
+
+        if( isDone )
+        {
+            break;
+        }
+
+        if( (RU32)( -1 ) == toInit )
+        {
+            // Wait for a running collector to finish.
+            rEvent_wait( startup->isChanged, 100 );
+            continue;
+        }
+
+        startTime = rpal_time_getMonotonicNs();
+        isSuccess = hbsState->collectors[ toInit ].init( hbsState, hbsState->collectors[ toInit ].conf );
+        hbsState->collectors[ toInit ].initTime = (RU32)MSEC_FROM_NSEC( rpal_time_getMonotonicNs() - startTime );
+        hbsState->collectors[ toInit ].isInitFailed = !isSuccess;
+
+        if( isSuccess )
+        {
+            rpal_debug_info( "collector %d started in %d ms.", toInit, hbsState->collectors[ toInit ].initTime );
+        }
+        else
+        {
+            rpal_debug_warning( "collector %d failed to init.", toInit );
+        }
+
+        if( rMutex_lock( startup->mutex ) )
+        {
+            DISABLE_FLAG( startup->inProgress, COLLECTOR_DEPENDENCY( toInit ) );
+            rMutex_unlock( startup->mutex );
+        }
+
+        rEvent_set( startup->isChanged );
+    }
+
+    rEvent_set( startup->isChanged );
+
+    return NULL;
+}
+
+RBOOL
+    hbs_initCollectors
+    (
+        HbsState* hbsState,
+        RU32 nThreads
+    )
+{
+    RBOOL isSuccess = FALSE;
+    _CollectorStartup startup = { 0 };
+    rThreadPool workers = NULL;
+    RU32 i = 0;
+    RBOOL isDone = FALSE;
+
+    if( NULL == hbsState )
+    {
+        return FALSE;
+    }
+
+    startup.hbsState = hbsState;
+
+    for( i = 0; i < ARRAY_N_ELEM( hbsState->collectors ); i++ )
+    {
+        hbsState->collectors[ i ].initTime = 0;
+        hbsState->collectors[ i ].isInitFailed = FALSE;
+
+        if( hbsState->collectors[ i ].isEnabled )
+        {
+            ENABLE_FLAG( startup.toStart, COLLECTOR_DEPENDENCY( i ) );
+        }
+        else
+        {
+            rpal_debug_info( "collector %d disabled.", i );
+        }
+    }
+
+    if( NULL == ( startup.mutex = rMutex_create() ) ||
+        NULL == ( startup.isChanged = rEvent_create( TRUE ) ) )
+    {
+        rMutex_free( startup.mutex );
+        return FALSE;
+    }
+
+    // The calling thread is always one of the workers, so if the pool cannot
+    // be created we degrade to a serial startup in dependency order.
+    if( 1 < nThreads &&
+        NULL != ( workers = rThreadPool_create( nThreads - 1, nThreads - 1, MSEC_FROM_SEC( 10 ) ) ) )
+    {
+        for( i = 0; i < nThreads - 1; i++ )
+        {
+            if( !rThreadPool_task( workers, (rpal_thread_pool_func)_initCollectorsWorker, &startup ) )
+            {
+                rpal_debug_warning( "failed to schedule collector startup worker." );
+            }
+        }
+    }
+
+    _initCollectorsWorker( NULL, &startup );
+
+    // Our worker only returns once there is nothing left to start, but
+    // some collectors may still be initializing on other workers.
+    while( !isDone )
+    {
+        if( rMutex_lock( startup.mutex ) )
+        {
+            isDone = ( 0 == startup.inProgress );
+            rMutex_unlock( startup.mutex );
+        }
+
+        if( !isDone )
+        {
+            rEvent_wait( startup.isChanged, 100 );
+        }
+    }
+
+    if( NULL != workers )
+    {
+        rThreadPool_destroy( workers, TRUE );
+    }
+
+    rEvent_free( startup.isChanged );
+    rMutex_free( startup.mutex );
+
+    isSuccess = TRUE;
+    for( i = 0; i < ARRAY_N_ELEM( hbsState->collectors ); i++ )
+    {
+        if( hbsState->collectors[ i ].isEnabled &&
+            hbsState->collectors[ i ].isInitFailed )
+        {
+            isSuccess = FALSE;
+        }
+    }
+
+    return isSuccess;
+}
+
 RBOOL
     hbs_publish
     (
@@ -385,67 +637,215 @@ RBOOL
     return isSuccess;
 }
 
-typedef struct
-{
-    rpcm_tag type;
-    RTIME ts;
-    rSequence event;
-} _EventStub;
+#define _HDB_MIN_SLOTS          64
+#define _HDB_MIN_SLOT_ALLOC     8
+#define _HDB_MAX_IDLE_SLOT      64
 
 RPRIVATE
-RS32
-    _cmpEventTimes
+RBOOL
+    _isEventBefore
     (
         _EventStub* evt1,
         _EventStub* evt2
     )
 {
-    RS32 ret = 0;
-    RTIME t1 = 0;
-    RTIME t2 = 0;
+    // First key is the time and the pointer value is the tie breaker.
+    return evt1->ts < evt2->ts ||
+           ( evt1->ts == evt2->ts && evt1->event < evt2->event );
+}
+
+RPRIVATE
+_WheelSlot*
+    _getSlot
+    (
+        _HbsDelayBuffer* pHdb,
+        RU64 msTime
+    )
+{
+    return &pHdb->slots[ msTime & ( pHdb->nSlots - 1 ) ];
+}
+
+RPRIVATE
+RBOOL
+    _slotAdd
+    (
+        _WheelSlot* slot,
+        _EventStub* stub
+    )
+{
+    RBOOL isAdded = FALSE;
+    RU32 newAlloc = 0;
+    _EventStub* newStubs = NULL;
+
+    if( slot->nStubs == slot->nAlloc )
+    {
+        newAlloc = MAX_OF( slot->nAlloc * 2, _HDB_MIN_SLOT_ALLOC );
+        if( NULL != ( newStubs = rpal_memory_realloc( slot->stubs, newAlloc * sizeof( *newStubs ) ) ) )
+        {
+            slot->stubs = newStubs;
+            slot->nAlloc = newAlloc;
+        }
+    }
 
-    if( NULL != evt1 &&
-        NULL != evt2 )
+    if( slot->nStubs < slot->nAlloc )
     {
-        t1 = evt1->ts;
-        t2 = evt2->ts;
+        slot->stubs[ slot->nStubs ] = *stub;
+        slot->nStubs++;
+        isAdded = TRUE;
+    }
+
+    return isAdded;
+}
+
+// Matured events are kept sorted by timestamp. They are mostly matured in the
+// order they were generated so the insertion point is almost always the tail.
+RPRIVATE
+RBOOL
+    _maturedAdd
+    (
+        _HbsDelayBuffer* pHdb,
+        _EventStub* stub
+    )
+{
+    RBOOL isAdded = FALSE;
+    RU32 newAlloc = 0;
+    _EventStub* newStubs = NULL;
+    RU32 i = 0;
 
-        // First key is the time and the pointer value is the tie breaker.
-        if( t1 > t2 )
+    if( pHdb->nMatured == pHdb->nMaturedAlloc )
+    {
+        newAlloc = MAX_OF( pHdb->nMaturedAlloc * 2, _HDB_MIN_SLOT_ALLOC );
+        if( NULL != ( newStubs = rpal_memory_realloc( pHdb->matured, newAlloc * sizeof( *newStubs ) ) ) )
         {
-            ret = 1;
+            pHdb->matured = newStubs;
+            pHdb->nMaturedAlloc = newAlloc;
         }
-        else if( t2 > t1 )
+    }
+
+    if( pHdb->nMatured < pHdb->nMaturedAlloc )
+    {
+        i = pHdb->nMatured;
+        while( 0 != i &&
+               _isEventBefore( stub, &pHdb->matured[ i - 1 ] ) )
         {
-            ret = -1;
+            pHdb->matured[ i ] = pHdb->matured[ i - 1 ];
+            i--;
         }
-        else if( evt1->event > evt2->event )
+        pHdb->matured[ i ] = *stub;
+        pHdb->nMatured++;
+        isAdded = TRUE;
+    }
+
+    return isAdded;
+}
+
+// Move every event that is due by curTime from the wheel to the matured list.
+RPRIVATE
+RVOID
+    _advanceWheel
+    (
+        _HbsDelayBuffer* pHdb,
+        RU64 curTime
+    )
+{
+    RU64 curMs = MSEC_FROM_NSEC( curTime );
+    RU64 nToScan = 0;
+    RU64 i = 0;
+    RU32 j = 0;
+    RU32 nKept = 0;
+    RBOOL isFull = FALSE;
+    _WheelSlot* slot = NULL;
+
+    if( curMs < pHdb->cursor )
+    {
+        return;
+    }
+
+    // If we fell behind by more than a full turn every slot has to be visited once.
+    nToScan = MIN_OF( curMs - pHdb->cursor + 1, pHdb->nSlots );
+
+    for( i = 0; i < nToScan && 0 != pHdb->nEvents; i++ )
+    {
+        slot = _getSlot( pHdb, pHdb->cursor + i );
+        nKept = 0;
+
+        for( j = 0; j < slot->nStubs; j++ )
         {
-            ret = 1;
+            if( !isFull &&
+                slot->stubs[ j ].releaseAt <= curTime )
+            {
+                if( _maturedAdd( pHdb, &slot->stubs[ j ] ) )
+                {
+                    pHdb->nEvents--;
+                    continue;
+                }
+
+                isFull = TRUE;
+            }
+
+            slot->stubs[ nKept ] = slot->stubs[ j ];
+            nKept++;
         }
-        else if( evt2->event > evt1->event )
+
+        slot->nStubs = nKept;
+
+        if( 0 == slot->nStubs &&
+            _HDB_MAX_IDLE_SLOT < slot->nAlloc )
         {
-            ret = -1;
+            rpal_memory_free( slot->stubs );
+            slot->stubs = NULL;
+            slot->nAlloc = 0;
         }
-        else
+
+        if( isFull )
         {
-            ret = 0;
+            // Out of memory, we'll resume from this slot on the next call.
+            curMs = pHdb->cursor + i;
+            break;
         }
     }
 
-    return ret;
+    pHdb->cursor = curMs;
 }
 
 RPRIVATE
 RVOID
-    _freeStub
+    _updateNextRelease
     (
-        _EventStub* evt
+        _HbsDelayBuffer* pHdb
     )
 {
-    if( NULL != evt )
+    RU32 i = 0;
+    RU32 j = 0;
+    RU32 nSeen = 0;
+    RBOOL isExact = FALSE;
+    _WheelSlot* slot = NULL;
+
+    pHdb->nextRelease = (RU64)(-1);
+
+    if( 0 != pHdb->nMatured )
+    {
+        pHdb->nextRelease = pHdb->matured[ 0 ].releaseAt;
+        return;
+    }
+
+    // Every event in the wheel is due at or after the cursor so the first slot
+    // holding an event from the current turn bounds the earliest release.
+    for( i = 0; i < pHdb->nSlots && nSeen < pHdb->nEvents && !isExact; i++ )
     {
-        rSequence_free( evt->event );
+        slot = _getSlot( pHdb, pHdb->cursor + i );
+
+        for( j = 0; j < slot->nStubs; j++ )
+        {
+            pHdb->nextRelease = MIN_OF( pHdb->nextRelease, slot->stubs[ j ].releaseAt );
+
+            if( MSEC_FROM_NSEC( slot->stubs[ j ].releaseAt ) < pHdb->cursor + pHdb->nSlots )
+            {
+                isExact = TRUE;
+            }
+        }
+
+        nSeen += slot->nStubs;
     }
 }
 
@@ -456,23 +856,36 @@ HbsDelayBuffer
     )
 {
     _HbsDelayBuffer* hdb = NULL;
+    RU32 nSlots = _HDB_MIN_SLOTS;
+
+    // Power of two larger than the delay so no event ever wraps past the cursor.
+    while( nSlots <= nMilliSeconds )
+    {
+        nSlots *= 2;
+    }
 
     if( NULL != ( hdb = rpal_memory_alloc( sizeof( *hdb ) ) ) )
     {
+        rpal_memory_zero( hdb, sizeof( *hdb ) );
         hdb->nMilliSeconds = nMilliSeconds;
-        hdb->oldestItem = (RTIME)(-1);
-        if( NULL == ( hdb->events = rpal_btree_create( sizeof( _EventStub ),
-                                                       (rpal_btree_comp_f)_cmpEventTimes,
-                                                       (rpal_btree_free_f)_freeStub ) ) ||
+        hdb->nSlots = nSlots;
+        hdb->nextRelease = (RU64)(-1);
+        hdb->cursor = MSEC_FROM_NSEC( rpal_time_getMonotonicNs() );
+
+        if( NULL == ( hdb->slots = rpal_memory_alloc( sizeof( *hdb->slots ) * nSlots ) ) ||
             NULL == ( hdb->newElemEvent = rEvent_create( FALSE ) ) ||
             NULL == ( hdb->mutex = rMutex_create() ) )
         {
             rEvent_free( hdb->newElemEvent );
             rMutex_free( hdb->mutex );
-            rpal_btree_destroy( hdb->events, FALSE );
+            rpal_memory_free( hdb->slots );
             rpal_memory_free( hdb );
             hdb = NULL;
         }
+        else
+        {
+            rpal_memory_zero( hdb->slots, sizeof( *hdb->slots ) * nSlots );
+        }
     }
 
     return hdb;
@@ -489,6 +902,8 @@ RBOOL
     RBOOL isAdded = FALSE;
     _HbsDelayBuffer* pHdb = (_HbsDelayBuffer*)hdb;
     RTIME newTime = 0;
+    RTIME curTime = 0;
+    RU64 age = 0;
     _EventStub stub = { 0 };
 
     if( NULL != pHdb )
@@ -502,11 +917,23 @@ RBOOL
             {
                 stub.ts = newTime;
 
-                if( rpal_btree_add( pHdb->events, &stub, FALSE ) )
+                // The event timestamp is wall clock, so we only use it once to know
+                // how old the event already is, after that the delay is tracked on
+                // the monotonic clock so it is not affected by clock changes.
+                curTime = rpal_time_getGlobalPreciseTime();
+                if( curTime > newTime )
+                {
+                    age = MIN_OF( curTime - newTime, pHdb->nMilliSeconds );
+                }
+                stub.releaseAt = rpal_time_getMonotonicNs() + NSEC_FROM_MSEC( pHdb->nMilliSeconds - age );
+
+                if( _slotAdd( _getSlot( pHdb, MSEC_FROM_NSEC( stub.releaseAt ) ), &stub ) )
                 {
-                    if( newTime < pHdb->oldestItem )
+                    pHdb->nEvents++;
+
+                    if( stub.releaseAt < pHdb->nextRelease )
                     {
-                        pHdb->oldestItem = newTime;
+                        pHdb->nextRelease = stub.releaseAt;
                         rEvent_set( pHdb->newElemEvent );
                     }
 
@@ -527,48 +954,70 @@ RVOID
     )
 {
     _HbsDelayBuffer* pHdb = (_HbsDelayBuffer*)hdb;
+    RU32 i = 0;
+    RU32 j = 0;
 
     if( NULL != pHdb )
     {
         rMutex_lock( pHdb->mutex );
         rEvent_free( pHdb->newElemEvent );
         rMutex_free( pHdb->mutex );
-        rpal_btree_destroy( pHdb->events, TRUE );
+        for( i = 0; i < pHdb->nSlots; i++ )
+        {
+            for( j = 0; j < pHdb->slots[ i ].nStubs; j++ )
+            {
+                rSequence_free( pHdb->slots[ i ].stubs[ j ].event );
+            }
+            rpal_memory_free( pHdb->slots[ i ].stubs );
+        }
+        for( i = 0; i < pHdb->nMatured; i++ )
+        {
+            rSequence_free( pHdb->matured[ i ].event );
+        }
+        rpal_memory_free( pHdb->matured );
+        rpal_memory_free( pHdb->slots );
         rpal_memory_free( pHdb );
     }
 }
 
 RBOOL
-    HbsDelayBuffer_remove
+    HbsDelayBuffer_removeBatch
     (
         HbsDelayBuffer hdb,
-        rSequence* pEvent,
-        rpcm_tag* pEventType,
+        rSequence* pEvents,
+        rpcm_tag* pEventTypes,
+        RU32 nMaxEvents,
+        RU32* pnEvents,
         RU32 milliSecTimeout
     )
 {
     RBOOL isSuccess = FALSE;
     _HbsDelayBuffer* pHdb = (_HbsDelayBuffer*)hdb;
-    RTIME curTime = 0;
-    RTIME endWait = 0;
-    RTIME toWait = 0;
+    RU64 curTime = 0;
+    RU64 endWait = 0;
+    RU64 toWait = 0;
     RBOOL isItemReady = FALSE;
-    _EventStub stub = { 0 };
+    RU32 nOut = 0;
+    RU32 i = 0;
 
     if( NULL != pHdb &&
-        NULL != pEvent &&
-        NULL != pEventType )
+        NULL != pEvents &&
+        NULL != pEventTypes &&
+        NULL != pnEvents &&
+        0 != nMaxEvents )
     {
+        *pnEvents = 0;
+
         if( rMutex_lock( pHdb->mutex ) )
         {
-            curTime = rpal_time_getGlobalPreciseTime();
-            endWait = curTime + milliSecTimeout;
+            curTime = rpal_time_getMonotonicNs();
+            endWait = curTime + NSEC_FROM_MSEC( milliSecTimeout );
 
             do
             {
-                if( (RTIME)( -1 ) != pHdb->oldestItem )
+                if( (RU64)( -1 ) != pHdb->nextRelease )
                 {
-                    if( pHdb->oldestItem + pHdb->nMilliSeconds <= curTime )
+                    if( pHdb->nextRelease <= curTime )
                     {
                         isItemReady = TRUE;
                         break;
@@ -579,7 +1028,7 @@ RBOOL
                         break;
                     }
 
-                    toWait = MIN_OF( ( pHdb->oldestItem + pHdb->nMilliSeconds ) - curTime, endWait - curTime );
+                    toWait = MIN_OF( pHdb->nextRelease - curTime, endWait - curTime );
                 }
                 else if( endWait <= curTime )
                 {
@@ -587,45 +1036,47 @@ RBOOL
                 }
                 else
                 {
-                    toWait = milliSecTimeout;
+                    toWait = endWait - curTime;
                 }
 
                 rMutex_unlock( pHdb->mutex );
 
-                // We add a sanity check for max timeout here since in some rare cases
-                // (mainly related to running both a Cloud and a sensor in VMs on a laptop
-                // going in hibernation) we could end up with wild values.
-                if( !rEvent_wait( pHdb->newElemEvent, (RU32)MIN_OF( toWait, milliSecTimeout ) ) )
+                // Round up so we don't spin on sub-millisecond waits.
+                if( !rEvent_wait( pHdb->newElemEvent,
+                                  (RU32)MIN_OF( MSEC_FROM_NSEC( toWait + NSEC_PER_MSEC - 1 ),
+                                                milliSecTimeout ) ) )
                 {
                     isItemReady = TRUE;
                 }
 
                 rMutex_lock( pHdb->mutex );
 
-                curTime = rpal_time_getGlobalPreciseTime();
+                curTime = rpal_time_getMonotonicNs();
 
             } while( !isItemReady );
 
             if( isItemReady )
             {
-                if( rpal_btree_minimum( pHdb->events, &stub, TRUE ) &&
-                    curTime >= stub.ts + pHdb->nMilliSeconds &&
-                    rpal_btree_remove( pHdb->events, &stub, &stub, TRUE ) )
-                {
-                    *pEvent = stub.event;
-                    *pEventType = stub.type;
+                _advanceWheel( pHdb, curTime );
 
-                    if( rpal_btree_minimum( pHdb->events, &stub, TRUE ) )
-                    {
-                        pHdb->oldestItem = stub.ts;
-                    }
-                    else
-                    {
-                        pHdb->oldestItem = (RTIME)(-1);
-                    }
+                nOut = MIN_OF( nMaxEvents, pHdb->nMatured );
+                for( i = 0; i < nOut; i++ )
+                {
+                    pEvents[ i ] = pHdb->matured[ i ].event;
+                    pEventTypes[ i ] = pHdb->matured[ i ].type;
+                }
 
-                    isSuccess = TRUE;
+                // Whatever did not fit is returned first on the next call.
+                for( i = nOut; i < pHdb->nMatured; i++ )
+                {
+                    pHdb->matured[ i - nOut ] = pHdb->matured[ i ];
                 }
+                pHdb->nMatured -= nOut;
+
+                _updateNextRelease( pHdb );
+
+                *pnEvents = nOut;
+                isSuccess = ( 0 != nOut );
             }
 
             rMutex_unlock( pHdb->mutex );
@@ -635,6 +1086,20 @@ RBOOL
     return isSuccess;
 }
 
+RBOOL
+    HbsDelayBuffer_remove
+    (
+        HbsDelayBuffer hdb,
+        rSequence* pEvent,
+        rpcm_tag* pEventType,
+        RU32 milliSecTimeout
+    )
+{
+    RU32 nEvents = 0;
+
+    return HbsDelayBuffer_removeBatch( hdb, pEvent, pEventType, 1, &nEvents, milliSecTimeout );
+}
+
 
 RBOOL
     HbsSetThisAtom
@@ -47,6 +47,9 @@ typedef struct _HbsState
         RBOOL( *test )( struct _HbsState* hbsState, SelfTestContext* testContext );
         rSequence conf;
         rpcm_tag* externalEvents;
+        RU32* dependencies;
+        RU32 initTime;
+        RBOOL isInitFailed;
     } collectors[ 23 ];
 } HbsState;
 
@@ -57,6 +60,7 @@ typedef struct _HbsState
 // Collector Naming Convention
 //=============================================================================
 #define DECLARE_COLLECTOR(num) extern rpcm_tag collector_ ##num## _events[]; \
+                               extern RU32 collector_ ##num## _dependencies; \
                                RBOOL collector_ ##num## _init( HbsState* hbsState, \
                                                                rSequence config ); \
                                RBOOL collector_ ##num## _cleanup( HbsState* hbsState, \
@@ -64,8 +68,14 @@ typedef struct _HbsState
                                RBOOL collector_ ##num## _test( HbsState* hbsState, \
                                                                SelfTestContext* testContext );
 
-#define ENABLED_COLLECTOR(num) { TRUE, collector_ ##num## _init, collector_ ##num## _cleanup, collector_ ##num## _test, NULL, collector_ ##num## _events }
-#define DISABLED_COLLECTOR(num) { FALSE, collector_ ##num## _init, collector_ ##num## _cleanup, collector_ ##num## _test, NULL, collector_ ##num## _events }
+#define ENABLED_COLLECTOR(num) { TRUE, collector_ ##num## _init, collector_ ##num## _cleanup, collector_ ##num## _test, NULL, collector_ ##num## _events, &collector_ ##num## _dependencies }
+#define DISABLED_COLLECTOR(num) { FALSE, collector_ ##num## _init, collector_ ##num## _cleanup, collector_ ##num## _test, NULL, collector_ ##num## _events, &collector_ ##num## _dependencies }
+
+// Each collector declares a mask of the collectors that must be initialized
+// before it is. Everything depends on exfil so that no event is produced
+// before it can be sent home, and consumers of notifications start after the
+// collectors producing them. Disabled or failed dependencies are ignored.
+#define COLLECTOR_DEPENDENCY(num) ( (RU32)1 << (num) )
 
 #ifdef RPAL_PLATFORM_WINDOWS
     #define ENABLED_WINDOWS_COLLECTOR(num) ENABLED_COLLECTOR(num)
@@ -187,6 +197,13 @@ RBOOL
         RPCHAR errorMessage
     );
 
+RBOOL
+    hbs_initCollectors
+    (
+        HbsState* hbsState,
+        RU32 nThreads
+    );
+
 RBOOL
     hbs_publish
     (
@@ -216,6 +233,17 @@ RBOOL
         rSequence event
     );
 
+RBOOL
+    HbsDelayBuffer_removeBatch
+    (
+        HbsDelayBuffer hdb,
+        rSequence* pEvents,
+        rpcm_tag* pEventTypes,
+        RU32 nMaxEvents,
+        RU32* pnEvents,
+        RU32 milliSecTimeout
+    );
+
 RBOOL
     HbsDelayBuffer_remove
     (
@@ -25,7 +25,9 @@ limitations under the License.
 #include <librpcm/librpcm.h>
 #include <kernelAcquisitionLib/kernelAcquisitionLib.h>
 #include "collectors.h"
+#include "spool.h"
 #include "keys.h"
+#include "obfuscated.h"
 #include "git_info.h"
 #include <libOs/libOs.h>
 
@@ -47,6 +49,9 @@ RpHcp_ModuleId g_current_Module_id = 2;
 #define HBS_MAX_OUBOUND_FRAME_SIZE              (100)
 #define HBS_SYNC_INTERVAL                       (60*5)
 #define HBS_KACQ_RETRY_N_FRAMES                 (10)
+#define HBS_SPOOL_MAX_SIZE                      (1024*1024*100)
+#define HBS_SPOOL_REPLAY_FRAMES_PER_SEC         (5)
+#define HBS_COLLECTOR_INIT_THREADS              (4)
 
 // Large blank buffer to be used to patch configurations post-build
 #define _HCP_DEFAULT_STATIC_STORE_SIZE                          (1024 * 50)
@@ -461,6 +466,8 @@ RPVOID
     rList taskList = NULL;
     rSequence task = NULL;
     RTIME threadTime = 0;
+    rList collectorList = NULL;
+    rSequence collector = NULL;
 
     UNREFERENCED_PARAMETER( ctx );
 
@@ -524,6 +531,38 @@ RPVOID
                         rpal_memory_free( tasks );
                     }
 
+                    // How long each collector took to start and whether it failed.
+                    if( NULL != ( collectorList = rList_new( RP_TAGS_COLLECTOR, RPCM_SEQUENCE ) ) )
+                    {
+                        for( i = 0; i < ARRAY_N_ELEM( g_hbs_state.collectors ); i++ )
+                        {
+                            if( !g_hbs_state.collectors[ i ].isEnabled )
+                            {
+                                continue;
+                            }
+
+                            if( NULL != ( collector = rSequence_new() ) )
+                            {
+                                rSequence_addRU32( collector, RP_TAGS_COLLECTOR_ID, i );
+                                rSequence_addTIMEDELTA( collector, RP_TAGS_TIMEDELTA, g_hbs_state.collectors[ i ].initTime );
+                                if( g_hbs_state.collectors[ i ].isInitFailed )
+                                {
+                                    rSequence_addRU32( collector, RP_TAGS_ERROR, RPAL_ERROR_NOT_SUPPORTED );
+                                }
+
+                                if( !rList_addSEQUENCE( collectorList, collector ) )
+                                {
+                                    rSequence_free( collector );
+                                }
+                            }
+                        }
+
+                        if( !rSequence_addLIST( message, RP_TAGS_COLLECTORS, collectorList ) )
+                        {
+                            rList_free( collectorList );
+                        }
+                    }
+
                     if( !sendSingleMessageHome( wrapper ) )
                     {
                         rpal_debug_warning( "failed to send sync" );
@@ -555,7 +594,6 @@ RBOOL
     )
 {
     RBOOL isSuccess = FALSE;
-    RU32 i = 0;
 
     rEvent_unset( g_hbs_state.isTimeToStop );
     if( NULL != ( g_hbs_state.hThreadPool = rThreadPool_create( 1, 
@@ -571,24 +609,9 @@ RBOOL
                                        NULL, 
                                        FALSE );
 
-        for( i = 0; i < ARRAY_N_ELEM( g_hbs_state.collectors ); i++ )
+        if( !hbs_initCollectors( &g_hbs_state, HBS_COLLECTOR_INIT_THREADS ) )
         {
-            if( g_hbs_state.collectors[ i ].isEnabled )
-            {
-                if( !g_hbs_state.collectors[ i ].init( &g_hbs_state, g_hbs_state.collectors[ i ].conf ) )
-                {
-                    isSuccess = FALSE;
-                    rpal_debug_warning( "collector %d failed to init.", i );
-                }
-                else
-                {
-                    rpal_debug_info( "collector %d started.", i );
-                }
-            }
-            else
-            {
-                rpal_debug_info( "collector %d disabled.", i );
-            }
+            isSuccess = FALSE;
         }
     }
 
@@ -982,6 +1005,172 @@ RVOID
     }
 }
 
+//=============================================================================
+//  Exfil Framing and Spooling
+//=============================================================================
+RPRIVATE
+rList
+    getExfilFrame
+    (
+
+    )
+{
+    rList exfilList = NULL;
+    rSequence exfilMessage = NULL;
+
+    if( NULL != ( exfilList = rList_new( RP_TAGS_MESSAGE, RPCM_SEQUENCE ) ) )
+    {
+        while( rQueue_remove( g_hbs_state.outQueue, &exfilMessage, NULL, 0 ) )
+        {
+            if( !rList_addSEQUENCE( exfilList, exfilMessage ) )
+            {
+                rpal_debug_error( "dropping exfil message" );
+                rSequence_free( exfilMessage );
+            }
+
+            if( HBS_MAX_OUBOUND_FRAME_SIZE <= rList_getNumElements( exfilList ) )
+            {
+                break;
+            }
+        }
+
+        if( 0 == rList_getNumElements( exfilList ) )
+        {
+            rList_free( exfilList );
+            exfilList = NULL;
+        }
+    }
+
+    return exfilList;
+}
+
+RPRIVATE
+RVOID
+    requeueExfilFrame
+    (
+        rList exfilList
+    )
+{
+    rSequence exfilMessage = NULL;
+
+    if( g_hbs_state.maxQueueNum < rList_getNumElements( exfilList ) ||
+        g_hbs_state.maxQueueSize < rList_getEstimateSize( exfilList ) )
+    {
+        // We have an overflow of the queues, dropping will occur.
+        rpal_debug_warning( "queue thresholds reached, dropping %d messages", 
+                            rList_getNumElements( exfilList ) );
+        rList_free( exfilList );
+    }
+    else
+    {
+        rpal_debug_info( "transmition failed, re-adding %d messages.", rList_getNumElements( exfilList ) );
+
+        // We will attempt to re-add the existing messages back in the queue since this failed
+        rList_resetIterator( exfilList );
+        while( rList_getSEQUENCE( exfilList, RP_TAGS_MESSAGE, &exfilMessage ) )
+        {
+            if( !rQueue_add( g_hbs_state.outQueue, exfilMessage, 0 ) )
+            {
+                rSequence_free( exfilMessage );
+            }
+        }
+        rList_shallowFree( exfilList );
+    }
+}
+
+// Frames that could not be sent go to the on-disk spool, if the spool is not
+// available we fall back to keeping them in memory.
+RPRIVATE
+RVOID
+    holdExfilFrame
+    (
+        HbsSpool spool,
+        rList exfilList
+    )
+{
+    if( NULL != spool &&
+        HbsSpool_write( spool, exfilList ) )
+    {
+        rpal_debug_info( "spooled %d messages to disk", rList_getNumElements( exfilList ) );
+        rList_free( exfilList );
+    }
+    else
+    {
+        requeueExfilFrame( exfilList );
+    }
+}
+
+// While offline we move full frames from the memory queue to the spool so
+// that a long disconnection does not overflow the queue.
+RPRIVATE
+RVOID
+    spoolExfilQueue
+    (
+        HbsSpool spool,
+        RU32 minMessages
+    )
+{
+    rList exfilList = NULL;
+    RU32 nQueued = 0;
+
+    while( rQueue_getSize( g_hbs_state.outQueue, &nQueued ) &&
+           0 != nQueued &&
+           minMessages <= nQueued &&
+           NULL != ( exfilList = getExfilFrame() ) )
+    {
+        if( !HbsSpool_write( spool, exfilList ) )
+        {
+            requeueExfilFrame( exfilList );
+            break;
+        }
+
+        rList_free( exfilList );
+    }
+}
+
+// Replay the spool oldest frame first, limited to a few frames per second
+// so that reconnecting after a long outage does not flood the link.
+RPRIVATE
+RVOID
+    replaySpool
+    (
+        HbsSpool spool,
+        RU64* pLastReplay
+    )
+{
+    rList exfilList = NULL;
+    RU64 now = rpal_time_getGlobal();
+    RU32 nFrames = 0;
+
+    if( NULL == spool ||
+        now <= *pLastReplay )
+    {
+        return;
+    }
+
+    *pLastReplay = now;
+
+    while( HBS_SPOOL_REPLAY_FRAMES_PER_SEC > nFrames &&
+           HbsSpool_read( spool, &exfilList ) )
+    {
+        if( !rpHcpI_sendHome( exfilList ) )
+        {
+            // The frame stays in the spool, it will be read again next time.
+            rList_free( exfilList );
+            break;
+        }
+
+        rList_free( exfilList );
+        HbsSpool_commit( spool );
+        nFrames++;
+    }
+
+    if( 0 != nFrames )
+    {
+        rpal_debug_info( "replayed %d frames from spool", nFrames );
+    }
+}
+
 RU32
 RPAL_THREAD_FUNC
     RpHcpI_mainThread
@@ -996,15 +1185,26 @@ RPAL_THREAD_FUNC
     RU8* tmpBuffer = NULL;
     RU32 tmpSize = 0;
     rList exfilList = NULL;
-    rSequence exfilMessage = NULL;
     rEvent newExfilEvents = NULL;
     RU32 nFrames = 0;
+    HbsSpool spool = NULL;
+    RU64 maxSpoolSize = HBS_SPOOL_MAX_SIZE;
+    RU32 tmpSpoolSize = 0;
+    RU64 lastReplay = 0;
+    rpHCPId curId = { 0 };
+
+    OBFUSCATIONLIB_DECLARE( spoolDir, RP_HBS_CONFIG_SPOOL_DIRECTORY );
 
     FORCE_LINK_THAT( HCP_IFACE );
 
     CryptoLib_init();
     atoms_init();
 
+    if( !rpcm_transient_init() )
+    {
+        rpal_debug_warning( "transient events unavailable, building them on the heap" );
+    }
+
     if( !getPrivileges() )
     {
         rpal_debug_info( "special privileges not acquired" );
@@ -1070,6 +1270,12 @@ RPAL_THREAD_FUNC
             g_hbs_state.maxQueueSize = HBS_EXFIL_QUEUE_MAX_SIZE;
         }
 
+        if( rSequence_getRU32( staticConfig, RP_TAGS_MAX_SPOOL_SIZE, &tmpSpoolSize ) )
+        {
+            rpal_debug_info( "loading max spool size from static config" );
+            maxSpoolSize = tmpSpoolSize;
+        }
+
         rSequence_free( staticConfig );
     }
     else
@@ -1087,6 +1293,21 @@ RPAL_THREAD_FUNC
 
     newExfilEvents = rQueue_getNewElemEvent( g_hbs_state.outQueue );
 
+    // Frames we can't deliver are kept on disk until we're back online,
+    // a spool size of 0 disables it. The spool is keyed on our identity.
+    if( 0 != maxSpoolSize )
+    {
+        OBFUSCATIONLIB_TOGGLE( spoolDir );
+
+        if( !rpHcpI_getId( &curId ) ||
+            NULL == ( spool = HbsSpool_open( (RPNCHAR)spoolDir, maxSpoolSize, &curId, sizeof( curId ) ) ) )
+        {
+            rpal_debug_warning( "could not open spool, offline data will only be kept in memory" );
+        }
+
+        OBFUSCATIONLIB_TOGGLE( spoolDir );
+    }
+
     g_hbs_state.isOnlineEvent = rpHcpI_getOnlineEvent();
 
     // We simply enqueue a message to let the cloud know we're starting
@@ -1155,62 +1376,37 @@ RPAL_THREAD_FUNC
             issueSync( g_hbs_state.isTimeToStop, NULL );
             break;
         }
+        else if( NULL != spool )
+        {
+            spoolExfilQueue( spool, HBS_MAX_OUBOUND_FRAME_SIZE );
+        }
     }
 
     // We've connected to the cloud at least once, did a sync once, let's start normal exfil.
     while( !rEvent_wait( isTimeToStop, 0 ) )
     {
-        if( rEvent_wait(g_hbs_state.isOnlineEvent, MSEC_FROM_SEC( 1 ) ) &&
-            rEvent_wait( newExfilEvents, MSEC_FROM_SEC( 1 ) ) )
+        if( rEvent_wait( g_hbs_state.isOnlineEvent, MSEC_FROM_SEC( 1 ) ) )
         {
-            if( NULL != ( exfilList = rList_new( RP_TAGS_MESSAGE, RPCM_SEQUENCE ) ) )
+            if( rEvent_wait( newExfilEvents, MSEC_FROM_SEC( 1 ) ) &&
+                NULL != ( exfilList = getExfilFrame() ) )
             {
-                while( rQueue_remove( g_hbs_state.outQueue, &exfilMessage, NULL, 0 ) )
-                {
-                    if( !rList_addSEQUENCE( exfilList, exfilMessage ) )
-                    {
-                        rpal_debug_error( "dropping exfil message" );
-                        rSequence_free( exfilMessage );
-                    }
-
-                    if( HBS_MAX_OUBOUND_FRAME_SIZE <= rList_getNumElements( exfilList ) )
-                    {
-                        break;
-                    }
-                }
-
                 if( rpHcpI_sendHome( exfilList ) )
                 {
                     rList_free( exfilList );
                 }
                 else
                 {
-                    // Failed to send the data home, so we'll re-queue it.
-                    if( g_hbs_state.maxQueueNum < rList_getNumElements( exfilList ) ||
-                        g_hbs_state.maxQueueSize < rList_getEstimateSize( exfilList ) )
-                    {
-                        // We have an overflow of the queues, dropping will occur.
-                        rpal_debug_warning( "queue thresholds reached, dropping %d messages", 
-                                            rList_getNumElements( exfilList ) );
-                        rList_free( exfilList );
-                    }
-                    else
-                    {
-                        rpal_debug_info( "transmition failed, re-adding %d messages.", rList_getNumElements( exfilList ) );
-
-                        // We will attempt to re-add the existing messages back in the queue since this failed
-                        rList_resetIterator( exfilList );
-                        while( rList_getSEQUENCE( exfilList, RP_TAGS_MESSAGE, &exfilMessage ) )
-                        {
-                            if( !rQueue_add( g_hbs_state.outQueue, exfilMessage, 0 ) )
-                            {
-                                rSequence_free( exfilMessage );
-                            }
-                        }
-                        rList_shallowFree( exfilList );
-                    }
+                    // Failed to send the data home, so we'll hold on to it.
+                    holdExfilFrame( spool, exfilList );
                 }
             }
+
+            // Live data goes first, then we catch up on what was spooled.
+            replaySpool( spool, &lastReplay );
+        }
+        else if( NULL != spool )
+        {
+            spoolExfilQueue( spool, HBS_MAX_OUBOUND_FRAME_SIZE );
         }
 
         if( !kAcq_isAvailable() &&
@@ -1228,6 +1424,13 @@ RPAL_THREAD_FUNC
     notifications_unsubscribe( RP_TAGS_NOTIFICATION_SELF_TEST, NULL, runSelfTests );
     shutdownCollectors();
 
+    // Whatever was not sent is persisted for the next run.
+    if( NULL != spool )
+    {
+        spoolExfilQueue( spool, 0 );
+        HbsSpool_close( spool );
+    }
+
     // Cleanup the last few resources
     rEvent_free( g_hbs_state.isTimeToStop );
     rQueue_free( g_hbs_state.outQueue );
@@ -1235,6 +1438,7 @@ RPAL_THREAD_FUNC
     rMutex_free( g_hbs_state.mutex );
 
     CryptoLib_deinit();
+    rpcm_transient_deinit();
 
     if( hbs_cloud_default_pub_key != hbs_cloud_pub_key &&
         NULL != hbs_cloud_pub_key )
@@ -0,0 +1,937 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <rpal/rpal.h>
+#include <librpcm/librpcm.h>
+#include <cryptoLib/cryptoLib.h>
+#include <zlib/zlib.h>
+#include "spool.h"
+
+#if defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+#include <sys/stat.h>
+#endif
+
+#define RPAL_FILE_ID        112
+
+// The spool is a directory of numbered segment files. Each segment starts
+// with a header holding a random salt followed by records appended one after
+// the other. The segment key is the hash of the store key and that salt, the
+// store key being the hash of the key material given to HbsSpool_open, so no
+// key is ever written to the spool. The header also holds a hash of the
+// segment key so a segment written under other key material is discarded as
+// a whole instead of failing record by record:
+//
+//   [ _SpoolRecordHeader ][ AES( RU32 rawSize | zlib( serialized rList ) ) ]
+//
+// The CRC in the record header covers the size, iv and encrypted payload so
+// a torn or corrupted record can be detected without decrypting anything.
+#define _SPOOL_MAGIC                    0x4C505348
+#define _SPOOL_VERSION                  2
+#define _SPOOL_SEGMENT_MAX_SIZE         (1024 * 1024)
+#define _SPOOL_RECORD_MAX_SIZE          (1024 * 1024 * 20)
+#define _SPOOL_RAW_MAX_SIZE             (1024 * 1024 * 50)
+#define _SPOOL_SEGMENT_EXT              _NC( ".spl" )
+#define _SPOOL_CURSOR_FILE              _NC( "cursor" )
+
+#pragma pack(push)
+#pragma pack(1)
+typedef struct
+{
+    RU32 magic;
+    RU32 version;
+    RU8 salt[ CRYPTOLIB_SYM_KEY_SIZE ];
+    CryptoLib_Hash keyCheck;
+} _SpoolSegmentHeader;
+
+typedef struct
+{
+    RU32 payloadSize;
+    RU32 crc;
+    RU8 iv[ CRYPTOLIB_SYM_IV_SIZE ];
+} _SpoolRecordHeader;
+
+// Replay position saved on a clean shutdown. Without it we replay from the
+// start of the oldest segment, so delivery is at-least-once across crashes.
+typedef struct
+{
+    RU32 magic;
+    RU32 segmentId;
+    RU64 offset;
+} _SpoolCursor;
+#pragma pack(pop)
+
+typedef struct
+{
+    RPNCHAR dirPath;
+    RU64 maxSize;
+    RU64 totalSize;
+    CryptoLib_Hash storeKey;
+    RBOOL isEmpty;
+    RU32 firstSegment;
+    RU32 lastSegment;
+    RU64 lastSegmentSize;
+    RU8 lastSegmentKey[ CRYPTOLIB_SYM_KEY_SIZE ];
+    RU64 readOffset;
+    RU64 nextReadOffset;
+} _HbsSpool;
+
+//=============================================================================
+//  Helpers
+//=============================================================================
+RPRIVATE
+RPNCHAR
+    _getSpoolFilePath
+    (
+        _HbsSpool* pSpool,
+        RPNCHAR fileName,
+        RPNCHAR extension
+    )
+{
+    RPNCHAR path = NULL;
+
+    if( NULL != ( path = rpal_string_strdup( pSpool->dirPath ) ) &&
+        NULL != ( path = rpal_string_strcatEx( path, _NC( "/" ) ) ) &&
+        NULL != ( path = rpal_string_strcatEx( path, fileName ) ) &&
+        NULL != ( path = rpal_string_strcatEx( path, extension ) ) )
+    {
+        rpal_file_pathToLocalSep( path );
+    }
+
+    return path;
+}
+
+RPRIVATE
+RPNCHAR
+    _getSegmentPath
+    (
+        _HbsSpool* pSpool,
+        RU32 segmentId
+    )
+{
+    RNCHAR idStr[ 16 ] = { 0 };
+
+    if( NULL == rpal_string_itos( segmentId, idStr, 10 ) )
+    {
+        return NULL;
+    }
+
+    return _getSpoolFilePath( pSpool, idStr, _SPOOL_SEGMENT_EXT );
+}
+
+RPRIVATE
+RVOID
+    _protectFile
+    (
+        RPNCHAR path
+    )
+{
+#if defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+    chmod( path, S_IRUSR | S_IWUSR );
+#else
+    UNREFERENCED_PARAMETER( path );
+#endif
+}
+
+RPRIVATE
+RU32
+    _getRecordCrc
+    (
+        _SpoolRecordHeader* pHeader,
+        RPU8 payload
+    )
+{
+    RU32 crc = 0;
+
+    crc = crc32( 0, (RPU8)&pHeader->payloadSize, sizeof( pHeader->payloadSize ) );
+    crc = crc32( crc, pHeader->iv, sizeof( pHeader->iv ) );
+    crc = crc32( crc, payload, pHeader->payloadSize );
+
+    return crc;
+}
+
+RPRIVATE
+RBOOL
+    _getSegmentKey
+    (
+        _HbsSpool* pSpool,
+        RU8 salt[ CRYPTOLIB_SYM_KEY_SIZE ],
+        RU8 key[ CRYPTOLIB_SYM_KEY_SIZE ],
+        CryptoLib_Hash* pKeyCheck
+    )
+{
+    RBOOL isDerived = FALSE;
+    RU8 material[ sizeof( pSpool->storeKey ) + CRYPTOLIB_SYM_KEY_SIZE ] = { 0 };
+    CryptoLib_Hash keyHash = { 0 };
+
+    rpal_memory_memcpy( material, &pSpool->storeKey, sizeof( pSpool->storeKey ) );
+    rpal_memory_memcpy( material + sizeof( pSpool->storeKey ), salt, CRYPTOLIB_SYM_KEY_SIZE );
+
+    if( CryptoLib_hash( material, sizeof( material ), &keyHash ) &&
+        CryptoLib_hash( &keyHash, sizeof( keyHash ), pKeyCheck ) )
+    {
+        rpal_memory_memcpy( key, &keyHash, CRYPTOLIB_SYM_KEY_SIZE );
+        isDerived = TRUE;
+    }
+
+    rpal_memory_zero( material, sizeof( material ) );
+    rpal_memory_zero( &keyHash, sizeof( keyHash ) );
+
+    return isDerived;
+}
+
+// Opens a segment for reading, validates its header and leaves the file
+// positioned on the first record.
+RPRIVATE
+RBOOL
+    _openSegment
+    (
+        _HbsSpool* pSpool,
+        RPNCHAR path,
+        rFile* phFile,
+        RU8 key[ CRYPTOLIB_SYM_KEY_SIZE ]
+    )
+{
+    RBOOL isOpen = FALSE;
+    _SpoolSegmentHeader header = { 0 };
+    CryptoLib_Hash keyCheck = { 0 };
+
+    if( rFile_open( path, phFile, RPAL_FILE_OPEN_EXISTING | RPAL_FILE_OPEN_READ ) )
+    {
+        if( rFile_read( *phFile, sizeof( header ), &header ) &&
+            _SPOOL_MAGIC == header.magic &&
+            _SPOOL_VERSION == header.version &&
+            _getSegmentKey( pSpool, header.salt, key, &keyCheck ) &&
+            0 == rpal_memory_memcmp( &keyCheck, &header.keyCheck, sizeof( keyCheck ) ) )
+        {
+            isOpen = TRUE;
+        }
+        else
+        {
+            rFile_close( *phFile );
+            *phFile = NULL;
+        }
+
+        rpal_memory_zero( &header, sizeof( header ) );
+    }
+
+    return isOpen;
+}
+
+// Reads the record at the current file position. When pMessages is NULL the
+// record is only validated against its CRC.
+RPRIVATE
+RBOOL
+    _readRecord
+    (
+        rFile hFile,
+        RU8 key[ CRYPTOLIB_SYM_KEY_SIZE ],
+        rList* pMessages,
+        RU32* pRecordSize
+    )
+{
+    RBOOL isValid = FALSE;
+    _SpoolRecordHeader header = { 0 };
+    RPU8 payload = NULL;
+    rBlob blob = NULL;
+    RPU8 decrypted = NULL;
+    RU32 decryptedSize = 0;
+    RPU8 raw = NULL;
+    uLongf rawSize = 0;
+    RU32 bytesConsumed = 0;
+
+    if( rFile_read( hFile, sizeof( header ), &header ) &&
+        0 != header.payloadSize &&
+        _SPOOL_RECORD_MAX_SIZE >= header.payloadSize &&
+        0 == header.payloadSize % CRYPTOLIB_SYM_MOD_SIZE &&
+        NULL != ( payload = rpal_memory_alloc( header.payloadSize ) ) )
+    {
+        if( rFile_read( hFile, header.payloadSize, payload ) &&
+            header.crc == _getRecordCrc( &header, payload ) )
+        {
+            *pRecordSize = sizeof( header ) + header.payloadSize;
+
+            if( NULL == pMessages )
+            {
+                isValid = TRUE;
+            }
+            else if( NULL != ( blob = rpal_blob_create( header.payloadSize, 0 ) ) )
+            {
+                if( rpal_blob_add( blob, payload, header.payloadSize ) &&
+                    CryptoLib_symDecrypt( blob, key, header.iv, NULL ) &&
+                    sizeof( RU32 ) < ( decryptedSize = rpal_blob_getSize( blob ) ) &&
+                    NULL != ( decrypted = rpal_blob_getBuffer( blob ) ) )
+                {
+                    rawSize = rpal_ntoh32( *(RU32*)decrypted );
+
+                    if( 0 != rawSize &&
+                        _SPOOL_RAW_MAX_SIZE >= rawSize &&
+                        NULL != ( raw = rpal_memory_alloc( rawSize ) ) )
+                    {
+                        if( Z_OK == uncompress( raw,
+                                                &rawSize,
+                                                decrypted + sizeof( RU32 ),
+                                                decryptedSize - sizeof( RU32 ) ) &&
+                            rList_deserialise( pMessages, raw, (RU32)rawSize, &bytesConsumed ) )
+                        {
+                            if( bytesConsumed == rawSize )
+                            {
+                                isValid = TRUE;
+                            }
+                            else
+                            {
+                                rList_free( *pMessages );
+                                *pMessages = NULL;
+                            }
+                        }
+
+                        rpal_memory_free( raw );
+                    }
+                }
+
+                rpal_blob_free( blob );
+            }
+        }
+
+        rpal_memory_free( payload );
+    }
+
+    return isValid;
+}
+
+RPRIVATE
+RVOID
+    _deleteSegment
+    (
+        _HbsSpool* pSpool,
+        RU32 segmentId
+    )
+{
+    RPNCHAR path = NULL;
+    RU64 size = 0;
+
+    if( NULL != ( path = _getSegmentPath( pSpool, segmentId ) ) )
+    {
+        size = rpal_file_getSize( path, FALSE );
+        if( (RU32)( -1 ) == size )
+        {
+            size = 0;
+        }
+
+        rpal_file_delete( path, FALSE );
+        pSpool->totalSize -= MIN_OF( pSpool->totalSize, size );
+
+        rpal_memory_free( path );
+    }
+}
+
+// Drops the oldest segment, whether it was fully replayed or is being evicted
+// to respect the disk budget.
+RPRIVATE
+RVOID
+    _dropOldestSegment
+    (
+        _HbsSpool* pSpool
+    )
+{
+    _deleteSegment( pSpool, pSpool->firstSegment );
+
+    if( pSpool->firstSegment == pSpool->lastSegment )
+    {
+        pSpool->isEmpty = TRUE;
+        pSpool->totalSize = 0;
+        pSpool->lastSegmentSize = 0;
+    }
+    else
+    {
+        pSpool->firstSegment++;
+    }
+
+    pSpool->readOffset = 0;
+    pSpool->nextReadOffset = 0;
+}
+
+RPRIVATE
+RBOOL
+    _newSegment
+    (
+        _HbsSpool* pSpool
+    )
+{
+    RBOOL isCreated = FALSE;
+    RPNCHAR path = NULL;
+    _SpoolSegmentHeader header = { 0 };
+    RU32 segmentId = pSpool->lastSegment + 1;
+
+    header.magic = _SPOOL_MAGIC;
+    header.version = _SPOOL_VERSION;
+
+    if( CryptoLib_genRandomBytes( header.salt, sizeof( header.salt ) ) &&
+        _getSegmentKey( pSpool, header.salt, pSpool->lastSegmentKey, &header.keyCheck ) &&
+        NULL != ( path = _getSegmentPath( pSpool, segmentId ) ) )
+    {
+        if( rpal_file_write( path, &header, sizeof( header ), TRUE ) )
+        {
+            _protectFile( path );
+
+            if( pSpool->isEmpty )
+            {
+                pSpool->firstSegment = segmentId;
+                pSpool->readOffset = 0;
+                pSpool->nextReadOffset = 0;
+                pSpool->isEmpty = FALSE;
+            }
+
+            pSpool->lastSegment = segmentId;
+            pSpool->lastSegmentSize = sizeof( header );
+            pSpool->totalSize += sizeof( header );
+            isCreated = TRUE;
+        }
+        else
+        {
+            rpal_debug_warning( "failed to create spool segment" );
+        }
+
+        rpal_memory_free( path );
+    }
+
+    rpal_memory_zero( &header, sizeof( header ) );
+
+    return isCreated;
+}
+
+// The newest segment is the only one that can have been interrupted in the
+// middle of a write, so on startup we validate it and cut any torn tail.
+RPRIVATE
+RVOID
+    _recoverLastSegment
+    (
+        _HbsSpool* pSpool
+    )
+{
+    RPNCHAR path = NULL;
+    rFile hFile = NULL;
+    RU64 validSize = 0;
+    RU64 fileSize = 0;
+    RU32 recordSize = 0;
+    RPU8 buffer = NULL;
+    RU32 bufferSize = 0;
+
+    if( NULL == ( path = _getSegmentPath( pSpool, pSpool->lastSegment ) ) )
+    {
+        return;
+    }
+
+    if( _openSegment( pSpool, path, &hFile, pSpool->lastSegmentKey ) )
+    {
+        validSize = sizeof( _SpoolSegmentHeader );
+
+        while( _readRecord( hFile, pSpool->lastSegmentKey, NULL, &recordSize ) )
+        {
+            validSize += recordSize;
+        }
+
+        fileSize = rFile_seek( hFile, 0, rFileSeek_END );
+        rFile_close( hFile );
+
+        if( validSize < fileSize )
+        {
+            rpal_debug_warning( "truncating spool segment from %d to %d bytes", (RU32)fileSize, (RU32)validSize );
+
+            if( rpal_file_read( path, (RPVOID*)&buffer, &bufferSize, FALSE ) )
+            {
+                if( validSize <= bufferSize &&
+                    rpal_file_write( path, buffer, (RU32)validSize, TRUE ) )
+                {
+                    _protectFile( path );
+                    pSpool->totalSize -= MIN_OF( pSpool->totalSize, fileSize - validSize );
+                }
+                else
+                {
+                    // We could not cut the tail, make sure nothing gets
+                    // appended after the garbage and let replay drop it.
+                    validSize = _SPOOL_SEGMENT_MAX_SIZE;
+                }
+
+                rpal_memory_free( buffer );
+            }
+            else
+            {
+                validSize = _SPOOL_SEGMENT_MAX_SIZE;
+            }
+        }
+
+        pSpool->lastSegmentSize = validSize;
+    }
+    else
+    {
+        rpal_debug_warning( "spool segment header invalid, discarding it" );
+
+        _deleteSegment( pSpool, pSpool->lastSegment );
+
+        if( pSpool->firstSegment == pSpool->lastSegment )
+        {
+            pSpool->isEmpty = TRUE;
+            pSpool->totalSize = 0;
+        }
+        else
+        {
+            // Missing segments are skipped on replay, we just make sure the
+            // next write goes to a fresh one.
+            pSpool->lastSegmentSize = _SPOOL_SEGMENT_MAX_SIZE;
+        }
+    }
+
+    rpal_memory_free( path );
+}
+
+// The cursor is only trusted once, it is removed as soon as it's loaded so
+// that a crash later on can't make us skip records.
+RPRIVATE
+RVOID
+    _loadCursor
+    (
+        _HbsSpool* pSpool
+    )
+{
+    RPNCHAR path = NULL;
+    RPNCHAR segmentPath = NULL;
+    _SpoolCursor* pCursor = NULL;
+    RU32 cursorSize = 0;
+
+    if( NULL == ( path = _getSpoolFilePath( pSpool, _SPOOL_CURSOR_FILE, _NC( "" ) ) ) )
+    {
+        return;
+    }
+
+    if( rpal_file_read( path, (RPVOID*)&pCursor, &cursorSize, FALSE ) )
+    {
+        if( sizeof( *pCursor ) == cursorSize &&
+            _SPOOL_MAGIC == pCursor->magic &&
+            !pSpool->isEmpty &&
+            pSpool->firstSegment == pCursor->segmentId &&
+            sizeof( _SpoolSegmentHeader ) <= pCursor->offset &&
+            NULL != ( segmentPath = _getSegmentPath( pSpool, pSpool->firstSegment ) ) )
+        {
+            if( pCursor->offset <= rpal_file_getSize( segmentPath, FALSE ) )
+            {
+                pSpool->readOffset = pCursor->offset;
+            }
+
+            rpal_memory_free( segmentPath );
+        }
+
+        rpal_memory_free( pCursor );
+        rpal_file_delete( path, FALSE );
+    }
+
+    rpal_memory_free( path );
+}
+
+RPRIVATE
+RVOID
+    _saveCursor
+    (
+        _HbsSpool* pSpool
+    )
+{
+    RPNCHAR path = NULL;
+    _SpoolCursor cursor = { 0 };
+
+    if( pSpool->isEmpty ||
+        0 == pSpool->readOffset )
+    {
+        return;
+    }
+
+    cursor.magic = _SPOOL_MAGIC;
+    cursor.segmentId = pSpool->firstSegment;
+    cursor.offset = pSpool->readOffset;
+
+    if( NULL != ( path = _getSpoolFilePath( pSpool, _SPOOL_CURSOR_FILE, _NC( "" ) ) ) )
+    {
+        if( rpal_file_write( path, &cursor, sizeof( cursor ), TRUE ) )
+        {
+            _protectFile( path );
+        }
+
+        rpal_memory_free( path );
+    }
+}
+
+//=============================================================================
+//  API
+//=============================================================================
+HbsSpool
+    HbsSpool_open
+    (
+        RPNCHAR dirPath,
+        RU64 maxSize,
+        RPVOID keyMaterial,
+        RU32 keyMaterialSize
+    )
+{
+    _HbsSpool* pSpool = NULL;
+    rDir hDir = NULL;
+    rFileInfo fileInfo = { 0 };
+    RNCHAR idStr[ 16 ] = { 0 };
+    RU32 nameLen = 0;
+    RU32 extLen = rpal_string_strlen( _SPOOL_SEGMENT_EXT );
+    RU32 segmentId = 0;
+    RBOOL isFound = FALSE;
+
+    if( NULL == dirPath ||
+        0 == maxSize ||
+        NULL == keyMaterial ||
+        0 == keyMaterialSize )
+    {
+        return NULL;
+    }
+
+    if( NULL != ( pSpool = rpal_memory_alloc( sizeof( *pSpool ) ) ) )
+    {
+        rpal_memory_zero( pSpool, sizeof( *pSpool ) );
+        pSpool->maxSize = maxSize;
+        pSpool->isEmpty = TRUE;
+
+        if( !CryptoLib_hash( keyMaterial, keyMaterialSize, &pSpool->storeKey ) ||
+            NULL == ( pSpool->dirPath = rpal_string_strdup( dirPath ) ) )
+        {
+            rpal_memory_free( pSpool );
+            return NULL;
+        }
+
+        // The directory is created 0700 on posix, it is fine if it already exists.
+        rDir_create( pSpool->dirPath );
+
+        if( rDir_open( pSpool->dirPath, &hDir ) )
+        {
+            while( rDir_next( hDir, &fileInfo ) )
+            {
+                if( IS_FLAG_ENABLED( RPAL_FILE_ATTRIBUTE_DIRECTORY, fileInfo.attributes ) ||
+                    !rpal_string_endswith( fileInfo.fileName, _SPOOL_SEGMENT_EXT ) )
+                {
+                    continue;
+                }
+
+                nameLen = rpal_string_strlen( fileInfo.fileName );
+                if( nameLen <= extLen ||
+                    ARRAY_N_ELEM( idStr ) <= nameLen - extLen )
+                {
+                    continue;
+                }
+
+                rpal_memory_memcpy( idStr, fileInfo.fileName, ( nameLen - extLen ) * sizeof( RNCHAR ) );
+                idStr[ nameLen - extLen ] = 0;
+
+                if( !rpal_string_stoi( idStr, &segmentId ) )
+                {
+                    continue;
+                }
+
+                if( !isFound )
+                {
+                    pSpool->firstSegment = segmentId;
+                    pSpool->lastSegment = segmentId;
+                    isFound = TRUE;
+                }
+                else
+                {
+                    pSpool->firstSegment = MIN_OF( pSpool->firstSegment, segmentId );
+                    pSpool->lastSegment = MAX_OF( pSpool->lastSegment, segmentId );
+                }
+
+                pSpool->totalSize += fileInfo.size;
+            }
+
+            rDir_close( hDir );
+        }
+
+        if( isFound )
+        {
+            pSpool->isEmpty = FALSE;
+            _recoverLastSegment( pSpool );
+
+            while( !pSpool->isEmpty &&
+                   pSpool->totalSize > pSpool->maxSize )
+            {
+                _dropOldestSegment( pSpool );
+            }
+
+            _loadCursor( pSpool );
+
+            rpal_debug_info( "spool recovered with %d bytes pending", (RU32)pSpool->totalSize );
+        }
+    }
+
+    return (HbsSpool)pSpool;
+}
+
+RVOID
+    HbsSpool_close
+    (
+        HbsSpool spool
+    )
+{
+    _HbsSpool* pSpool = (_HbsSpool*)spool;
+
+    if( rpal_memory_isValid( pSpool ) )
+    {
+        _saveCursor( pSpool );
+        rpal_memory_zero( pSpool->lastSegmentKey, sizeof( pSpool->lastSegmentKey ) );
+        rpal_memory_zero( &pSpool->storeKey, sizeof( pSpool->storeKey ) );
+        rpal_memory_free( pSpool->dirPath );
+        rpal_memory_free( pSpool );
+    }
+}
+
+RBOOL
+    HbsSpool_write
+    (
+        HbsSpool spool,
+        rList messages
+    )
+{
+    RBOOL isWritten = FALSE;
+    _HbsSpool* pSpool = (_HbsSpool*)spool;
+    rBlob serialized = NULL;
+    rBlob payload = NULL;
+    RPU8 compressed = NULL;
+    uLongf compressedSize = 0;
+    RU32 rawSize = 0;
+    RU32 recordSize = 0;
+    RU8 iv[ CRYPTOLIB_SYM_IV_SIZE ] = { 0 };
+    _SpoolRecordHeader header = { 0 };
+    RPNCHAR path = NULL;
+    rFile hFile = NULL;
+
+    if( !rpal_memory_isValid( pSpool ) ||
+        NULL == messages ||
+        NULL == ( serialized = rpal_blob_create( 0, 0 ) ) )
+    {
+        return FALSE;
+    }
+
+    if( rList_serialise( messages, serialized ) &&
+        0 != ( rawSize = rpal_blob_getSize( serialized ) ) )
+    {
+        compressedSize = compressBound( rawSize );
+
+        if( NULL != ( compressed = rpal_memory_alloc( sizeof( RU32 ) + compressedSize ) ) )
+        {
+            *(RU32*)compressed = rpal_hton32( rawSize );
+
+            if( Z_OK == compress( compressed + sizeof( RU32 ),
+                                  &compressedSize,
+                                  rpal_blob_getBuffer( serialized ),
+                                  rawSize ) &&
+                NULL != ( payload = rpal_blob_create( (RU32)( sizeof( RU32 ) + compressedSize + CRYPTOLIB_SYM_MOD_SIZE ), 0 ) ) &&
+                rpal_blob_add( payload, compressed, (RU32)( sizeof( RU32 ) + compressedSize ) ) )
+            {
+                // Padding always adds at least one byte, up to a full block.
+                recordSize = sizeof( header ) +
+                             rpal_blob_getSize( payload ) +
+                             CRYPTOLIB_SYM_BUFFER_PADDING( rpal_blob_getSize( payload ) );
+            }
+
+            rpal_memory_free( compressed );
+        }
+    }
+
+    rpal_blob_free( serialized );
+
+    if( 0 == recordSize ||
+        _SPOOL_RECORD_MAX_SIZE < recordSize - sizeof( header ) ||
+        pSpool->maxSize < recordSize + sizeof( _SpoolSegmentHeader ) )
+    {
+        rpal_blob_free( payload );
+        return FALSE;
+    }
+
+    // Oldest data goes first when we're over budget.
+    while( !pSpool->isEmpty &&
+           pSpool->totalSize + recordSize + sizeof( _SpoolSegmentHeader ) > pSpool->maxSize )
+    {
+        rpal_debug_warning( "spool over budget, evicting oldest segment" );
+        _dropOldestSegment( pSpool );
+    }
+
+    if( ( pSpool->isEmpty ||
+          ( sizeof( _SpoolSegmentHeader ) < pSpool->lastSegmentSize &&
+            _SPOOL_SEGMENT_MAX_SIZE < pSpool->lastSegmentSize + recordSize ) ) &&
+        !_newSegment( pSpool ) )
+    {
+        rpal_blob_free( payload );
+        return FALSE;
+    }
+
+    if( CryptoLib_genRandomBytes( header.iv, sizeof( header.iv ) ) )
+    {
+        rpal_memory_memcpy( iv, header.iv, sizeof( iv ) );
+
+        if( CryptoLib_symEncrypt( payload, pSpool->lastSegmentKey, iv, NULL ) &&
+            NULL != ( path = _getSegmentPath( pSpool, pSpool->lastSegment ) ) )
+        {
+            header.payloadSize = rpal_blob_getSize( payload );
+            header.crc = _getRecordCrc( &header, rpal_blob_getBuffer( payload ) );
+
+            // We seek to the known end instead of appending so that a previously
+            // failed partial write gets overwritten rather than left in the middle.
+            if( rFile_open( path, &hFile, RPAL_FILE_OPEN_ALWAYS | RPAL_FILE_OPEN_WRITE ) )
+            {
+                if( pSpool->lastSegmentSize == rFile_seek( hFile, pSpool->lastSegmentSize, rFileSeek_SET ) &&
+                    rFile_write( hFile, sizeof( header ), &header ) &&
+                    rFile_write( hFile, header.payloadSize, rpal_blob_getBuffer( payload ) ) )
+                {
+                    pSpool->lastSegmentSize += sizeof( header ) + header.payloadSize;
+                    pSpool->totalSize += sizeof( header ) + header.payloadSize;
+                    isWritten = TRUE;
+                }
+
+                rFile_close( hFile );
+            }
+
+            rpal_memory_free( path );
+        }
+    }
+
+    rpal_blob_free( payload );
+
+    return isWritten;
+}
+
+RBOOL
+    HbsSpool_read
+    (
+        HbsSpool spool,
+        rList* pMessages
+    )
+{
+    RBOOL isFound = FALSE;
+    _HbsSpool* pSpool = (_HbsSpool*)spool;
+    RPNCHAR path = NULL;
+    rFile hFile = NULL;
+    RU8 key[ CRYPTOLIB_SYM_KEY_SIZE ] = { 0 };
+    RU32 recordSize = 0;
+    RBOOL isSegmentDone = FALSE;
+
+    if( !rpal_memory_isValid( pSpool ) ||
+        NULL == pMessages )
+    {
+        return FALSE;
+    }
+
+    while( !isFound &&
+           !pSpool->isEmpty )
+    {
+        isSegmentDone = TRUE;
+
+        if( 0 == pSpool->readOffset )
+        {
+            pSpool->readOffset = sizeof( _SpoolSegmentHeader );
+        }
+
+        if( NULL != ( path = _getSegmentPath( pSpool, pSpool->firstSegment ) ) )
+        {
+            if( _openSegment( pSpool, path, &hFile, key ) )
+            {
+                if( pSpool->readOffset == rFile_seek( hFile, pSpool->readOffset, rFileSeek_SET ) &&
+                    _readRecord( hFile, key, pMessages, &recordSize ) )
+                {
+                    pSpool->nextReadOffset = pSpool->readOffset + recordSize;
+                    isFound = TRUE;
+                    isSegmentDone = FALSE;
+                }
+                else if( pSpool->readOffset < rFile_seek( hFile, 0, rFileSeek_END ) )
+                {
+                    rpal_debug_warning( "corrupt spool record, dropping rest of segment" );
+                }
+
+                rFile_close( hFile );
+            }
+
+            rpal_memory_free( path );
+        }
+        else
+        {
+            // Transient failure, try again on the next read.
+            break;
+        }
+
+        if( isSegmentDone )
+        {
+            _dropOldestSegment( pSpool );
+        }
+    }
+
+    rpal_memory_zero( key, sizeof( key ) );
+
+    return isFound;
+}
+
+RBOOL
+    HbsSpool_commit
+    (
+        HbsSpool spool
+    )
+{
+    RBOOL isCommitted = FALSE;
+    _HbsSpool* pSpool = (_HbsSpool*)spool;
+
+    if( rpal_memory_isValid( pSpool ) &&
+        0 != pSpool->nextReadOffset )
+    {
+        pSpool->readOffset = pSpool->nextReadOffset;
+        pSpool->nextReadOffset = 0;
+        isCommitted = TRUE;
+    }
+
+    return isCommitted;
+}
+
+RBOOL
+    HbsSpool_isEmpty
+    (
+        HbsSpool spool
+    )
+{
+    _HbsSpool* pSpool = (_HbsSpool*)spool;
+
+    if( !rpal_memory_isValid( pSpool ) )
+    {
+        return TRUE;
+    }
+
+    return pSpool->isEmpty ||
+           ( pSpool->firstSegment == pSpool->lastSegment &&
+             pSpool->lastSegmentSize <= MAX_OF( pSpool->readOffset, sizeof( _SpoolSegmentHeader ) ) );
+}
+
+RU64
+    HbsSpool_getSize
+    (
+        HbsSpool spool
+    )
+{
+    _HbsSpool* pSpool = (_HbsSpool*)spool;
+    RU64 size = 0;
+
+    if( rpal_memory_isValid( pSpool ) )
+    {
+        size = pSpool->totalSize;
+    }
+
+    return size;
+}
@@ -0,0 +1,82 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _HBS_SPOOL_H
+#define _HBS_SPOOL_H
+
+#include <rpal.h>
+#include <librpcm/librpcm.h>
+
+//=============================================================================
+//  On-disk spool of outbound frames used while the sensor is offline.
+//  Frames are appended to numbered segment files in the spool directory,
+//  each record is compressed, encrypted and checksummed individually. The
+//  keys are derived from the keyMaterial given to HbsSpool_open and never
+//  written to the spool, so it can only be read back with the same material.
+//  Replay is FIFO: HbsSpool_read returns the oldest frame and it is only
+//  removed from the spool once HbsSpool_commit is called. A spool is not
+//  thread safe, it is meant to be driven by a single thread.
+//=============================================================================
+typedef RPVOID HbsSpool;
+
+HbsSpool
+    HbsSpool_open
+    (
+        RPNCHAR dirPath,
+        RU64 maxSize,
+        RPVOID keyMaterial,
+        RU32 keyMaterialSize
+    );
+
+RVOID
+    HbsSpool_close
+    (
+        HbsSpool spool
+    );
+
+RBOOL
+    HbsSpool_write
+    (
+        HbsSpool spool,
+        rList messages
+    );
+
+RBOOL
+    HbsSpool_read
+    (
+        HbsSpool spool,
+        rList* pMessages
+    );
+
+RBOOL
+    HbsSpool_commit
+    (
+        HbsSpool spool
+    );
+
+RBOOL
+    HbsSpool_isEmpty
+    (
+        HbsSpool spool
+    );
+
+RU64
+    HbsSpool_getSize
+    (
+        HbsSpool spool
+    );
+
+#endif
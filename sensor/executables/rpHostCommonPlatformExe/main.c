@@ -32,6 +32,9 @@ limitations under the License.
 #endif
 #endif
 
+#define HCP_LOG_MAX_FILE_SIZE   (1024 * 1024 * 5)
+#define HCP_LOG_MAX_FILES       5
+
 RPRIVATE rEvent g_timeToQuit = NULL;
 RPRIVATE struct
 {
@@ -591,6 +594,7 @@ RPAL_NATIVE_MAIN
     RPNCHAR argVal = NULL;
     RPNCHAR primary = NULL;
     RPNCHAR secondary = NULL;
+    RPNCHAR logFile = NULL;
     RPNCHAR tmpMod = NULL;
     RU32 tmpModId = 0;
     RU32 i = 0;
@@ -602,7 +606,8 @@ RPAL_NATIVE_MAIN
                             { _NC( 'p' ), _NC( "primary" ), TRUE },
                             { _NC( 's' ), _NC( "secondary" ), TRUE },
                             { _NC( 'm' ), _NC( "manual" ), TRUE },
-                            { _NC( 'n' ), _NC( "moduleId" ), TRUE }
+                            { _NC( 'n' ), _NC( "moduleId" ), TRUE },
+                            { _NC( 'l' ), _NC( "log" ), TRUE }
 #ifdef RPAL_PLATFORM_WINDOWS
                             ,
                             { _NC( 'i' ), _NC( "install" ), FALSE },
@@ -671,6 +676,10 @@ RPAL_NATIVE_MAIN
                     }
                     isArgumentsSpecified = TRUE;
                     break;
+                case _NC( 'l' ):
+                    logFile = argVal;
+                    isArgumentsSpecified = TRUE;
+                    break;
 #ifdef RPAL_PLATFORM_WINDOWS
                 case _NC( 'i' ):
                     return installService();
@@ -693,11 +702,12 @@ RPAL_NATIVE_MAIN
                 case _NC( 'h' ):
                 default:
 #ifdef RPAL_PLATFORM_DEBUG
-                    printf( "Usage: " RF_STR_N " [ -p primaryHomeUrl ] [ -s secondaryHomeUrl ] [ -m moduleToLoad ] [ -h ].\n", argv[ 0 ] );
+                    printf( "Usage: " RF_STR_N " [ -p primaryHomeUrl ] [ -s secondaryHomeUrl ] [ -m moduleToLoad ] [ -l logFile ] [ -h ].\n", argv[ 0 ] );
                     printf( "-p: primary Url used to communicate home.\n" );
                     printf( "-s: secondary Url used to communicate home if the primary failed.\n" );
                     printf( "-m: module to be loaded manually, only available in debug builds.\n" );
                     printf( "-n: the module id of the module being manually loaded.\n" );
+                    printf( "-l: file to log to, rotated every %d bytes.\n", HCP_LOG_MAX_FILE_SIZE );
 #ifdef RPAL_PLATFORM_WINDOWS
                     printf( "-i: install executable as a service.\n" );
                     printf( "-r: uninstall executable as a service.\n" );
@@ -777,6 +787,13 @@ RPAL_NATIVE_MAIN
         }
 #endif
 
+        // Without a log file the records still go to stderr, but from a
+        // background writer instead of the logging threads.
+        if( !rpal_log_start( logFile, HCP_LOG_MAX_FILE_SIZE, HCP_LOG_MAX_FILES ) )
+        {
+            rpal_debug_warning( "failed to start logger, logging synchronously." );
+        }
+
         rpal_debug_info( "initialising rpHCP." );
         if( !rpHostCommonPlatformLib_launch( primary, secondary ) )
         {
@@ -829,6 +846,7 @@ RPAL_NATIVE_MAIN
         rEvent_free( g_timeToQuit );
         
         rpal_debug_info( "...exiting..." );
+        rpal_log_stop();
         rpal_Context_cleanup();
 
         memUsed = rpal_memory_totalUsed();
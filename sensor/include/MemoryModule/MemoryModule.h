@@ -38,6 +38,15 @@ HMEMORYMODULE
         RU32 libDataSize
     );
 
+// On platforms where a module cannot be loaded purely from memory it is
+// written to a file in this directory for the time of the load. The
+// directory is created private (0700) if it does not exist.
+RBOOL
+    MemorySetFallbackDirectory
+    (
+        RPNCHAR dirPath
+    );
+
 RPVOID
     MemoryGetLibraryBase
     (
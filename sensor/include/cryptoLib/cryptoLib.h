@@ -28,6 +28,7 @@ limitations under the License.
 #define CRYPTOLIB_ASYM_MAX_SIZE             0xF5
 #define CRYPTOLIB_HASH_SIZE                 0x20 // Sha-256
 #define CRYPTOLIB_SYM_MOD_SIZE              0x10
+#define CRYPTOLIB_UNIQUE_ID_SIZE            0x10
 
 typedef struct
 {
@@ -35,6 +36,7 @@ typedef struct
 } CryptoLib_Hash;
 
 typedef RPVOID CryptoLib_SymContext;
+typedef RPVOID CryptoLib_HashContext;
 
 #define CRYPTOLIB_SYM_BUFFER_PADDING(size) ( ( CRYPTOLIB_SYM_MOD_SIZE - ( (size) % CRYPTOLIB_SYM_MOD_SIZE ) ) ? \
                                              ( CRYPTOLIB_SYM_MOD_SIZE - ( (size) % CRYPTOLIB_SYM_MOD_SIZE ) ) :\
@@ -135,6 +137,14 @@ RBOOL
         RU32  bytesRequired
     );
 
+// Generates a 128 bit id unique to this process, much cheaper than
+// CryptoLib_genRandomBytes and safe to call from any thread.
+RBOOL
+    CryptoLib_genUniqueId
+    (
+        RU8 pId[ CRYPTOLIB_UNIQUE_ID_SIZE ]
+    );
+
 RBOOL
     CryptoLib_fastAsymEncrypt
     (
@@ -157,6 +167,18 @@ RBOOL
         CryptoLib_Hash* pHash
     );
 
+// Hashes several independent buffers at once, on CPUs with SHA instructions
+// pairs of buffers are interleaved which is much faster for small buffers
+// of similar sizes. Empty buffers are allowed.
+RBOOL
+    CryptoLib_hashMulti
+    (
+        RPVOID* buffers,
+        RU32* bufferSizes,
+        RU32 nBuffers,
+        CryptoLib_Hash* pHashes
+    );
+
 RBOOL
     CryptoLib_hashFile
     (
@@ -164,5 +186,27 @@ RBOOL
         CryptoLib_Hash* pHash,
         RBOOL isAvoidTimestamps
     );
+
+CryptoLib_HashContext
+    CryptoLib_hashInit
+    (
+
+    );
+
+RBOOL
+    CryptoLib_hashUpdate
+    (
+        CryptoLib_HashContext ctx,
+        RPVOID buffer,
+        RU32 bufferSize
+    );
+
+// Frees the context, pHash may be NULL to abandon the hash.
+RBOOL
+    CryptoLib_hashFinish
+    (
+        CryptoLib_HashContext ctx,
+        CryptoLib_Hash* pHash
+    );
     
 #endif
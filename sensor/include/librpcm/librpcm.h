@@ -146,6 +146,39 @@ RBOOL
         RU32* elemSize
     );
 
+// TRANSIENT CONSTRUCTION
+//-----------------------------------------------------------------------------
+// Sequences and lists created by a thread between rpcm_transient_begin and
+// rpcm_transient_end come from a per-thread arena and are all reclaimed at
+// once by the end call. Meant for events built, published and freed within
+// the same call. They behave like any other set: one outliving the scope
+// keeps its arena chunk alive until it is freed, one outgrowing its initial
+// buffer moves to the heap, and duplicates are always on the heap. Scopes
+// nest, and outside of one or before rpcm_transient_init nothing changes.
+RBOOL
+    rpcm_transient_init
+    (
+
+    );
+
+RVOID
+    rpcm_transient_deinit
+    (
+
+    );
+
+RVOID
+    rpcm_transient_begin
+    (
+
+    );
+
+RVOID
+    rpcm_transient_end
+    (
+
+    );
+
 // ADD
 //-----------------------------------------------------------------------------
 RBOOL
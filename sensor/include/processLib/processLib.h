@@ -52,6 +52,15 @@ RBOOL
         RU32 pid
     );
 
+// The start time only has meaning on the same host and boot, it is used
+// to tell apart two processes that were given the same pid.
+RBOOL
+    processLib_getProcessStartTime
+    (
+        RU32 pid,
+        RU64* pStartTime
+    );
+
 processLibProcEntry*
     processLib_getProcessEntries
     (
@@ -87,6 +96,7 @@ RBOOL
         RBOOL isBridgeGaps
     );
 
+// On Linux every handle is named, isOnlyReturnNamed makes no difference.
 rList
     processLib_getHandles
     (
@@ -95,6 +105,81 @@ rList
         RPNCHAR optSubstring
     );
 
+// Include the open flags and file position of each handle where supported.
+#define PROCESSLIB_HANDLES_WITH_FDINFO      0x00000001
+
+// Remembers the handles seen per process so that subsequent calls only need
+// to resolve the handles that were not there on the previous call. A handle
+// value closed and reused between two calls keeps its previous record.
+typedef RPVOID processLibHandleCache;
+
+processLibHandleCache
+    processLib_newHandleCache
+    (
+
+    );
+
+RVOID
+    processLib_freeHandleCache
+    (
+        processLibHandleCache cache
+    );
+
+rList
+    processLib_getHandlesEx
+    (
+        RU32 processId,
+        RBOOL isOnlyReturnNamed,
+        RPNCHAR optSubstring,
+        RU32 flags,
+        processLibHandleCache optCache
+    );
+
+// Container attribution: cgroup path, namespace inodes and the container id
+// and runtime when the cgroup path matches a known runtime. Only supported on
+// Linux, elsewhere NULL is returned.
+#define PROCESSLIB_CONTAINER_ID_SIZE        65
+
+// Remembers the container of each process by pid and start time, and the
+// container id parsed from each cgroup path, so a container is only resolved
+// once no matter how many processes it runs.
+typedef RPVOID processLibContainerCache;
+
+processLibContainerCache
+    processLib_newContainerCache
+    (
+
+    );
+
+RVOID
+    processLib_freeContainerCache
+    (
+        processLibContainerCache cache
+    );
+
+// Drops a terminated process from the cache.
+RVOID
+    processLib_forgetContainerInfo
+    (
+        processLibContainerCache cache,
+        RU32 processId
+    );
+
+rSequence
+    processLib_getContainerInfo
+    (
+        RU32 processId,
+        processLibContainerCache optCache
+    );
+
+RBOOL
+    processLib_getContainerIdFromCgroup
+    (
+        RPCHAR cgroupPath,
+        RCHAR containerId[ PROCESSLIB_CONTAINER_ID_SIZE ],
+        RPCHAR* pRuntime
+    );
+
 RBOOL 
     processLib_killProcess
     ( 
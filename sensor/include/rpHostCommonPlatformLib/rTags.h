@@ -183,6 +183,47 @@
 #define RP_TAGS_RESULT 176
 #define RP_TAGS_CNAME 177
 #define RP_TAGS_MESSAGE_ID 178
+#define RP_TAGS_HANDLE_INODE 179
+#define RP_TAGS_HANDLE_FLAGS 180
+#define RP_TAGS_HANDLE_POSITION 181
+#define RP_TAGS_ENVIRONMENT_HASH 182
+#define RP_TAGS_PARENT_ENVIRONMENT_HASH 183
+#define RP_TAGS_ENVIRONMENT_REMOVED 184
+#define RP_TAGS_IS_TRUNCATED 185
+#define RP_TAGS_MAX_SPOOL_SIZE 186
+#define RP_TAGS_COLLECTORS 187
+#define RP_TAGS_COLLECTOR 188
+#define RP_TAGS_COLLECTOR_ID 189
+#define RP_TAGS_TOP_DESTINATIONS 190
+#define RP_TAGS_TOP_PORTS 191
+#define RP_TAGS_CONNECTION_COUNT 192
+#define RP_TAGS_COUNT_ERROR 193
+#define RP_TAGS_DISTINCT_ENDPOINTS 194
+#define RP_TAGS_TCP_CONNECTIONS 195
+#define RP_TAGS_UDP_CONNECTIONS 196
+#define RP_TAGS_IS_INTERIM 197
+#define RP_TAGS_BINARY_INFO 198
+#define RP_TAGS_BINARY_FORMAT 199
+#define RP_TAGS_ARCHITECTURE 200
+#define RP_TAGS_BUILD_ID 201
+#define RP_TAGS_IMPORTS 202
+#define RP_TAGS_SECTION_COUNT 203
+#define RP_TAGS_HIGH_ENTROPY_SECTIONS 204
+#define RP_TAGS_MAX_SECTION_ENTROPY 205
+#define RP_TAGS_PACKER_FLAGS 206
+#define RP_TAGS_IS_PACKED 207
+#define RP_TAGS_CONTAINER 208
+#define RP_TAGS_CGROUP 209
+#define RP_TAGS_CONTAINER_ID 210
+#define RP_TAGS_CONTAINER_RUNTIME 211
+#define RP_TAGS_PID_NAMESPACE 212
+#define RP_TAGS_MOUNT_NAMESPACE 213
+#define RP_TAGS_NETWORK_NAMESPACE 214
+#define RP_TAGS_USER_NAMESPACE 215
+#define RP_TAGS_TERMINAL 216
+#define RP_TAGS_REMOTE_HOST 217
+#define RP_TAGS_SESSION_ID 218
+#define RP_TAGS_PORT_ACTIVITY 219
 #define RP_TAGS_HCP_MODULES 256
 #define RP_TAGS_HCP_MODULE 257
 #define RP_TAGS_HCP_MODULE_ID 258
@@ -202,6 +243,7 @@
 #define RP_TAGS_HCP_PRIMARY_PORT 272
 #define RP_TAGS_HCP_SECONDARY_PORT 273
 #define RP_TAGS_HCP_KERNEL_ACQ_AVAILABLE 274
+#define RP_TAGS_HCP_FRAME_DICTIONARY 275
 #define RP_TAGS_AAD_RELATION_TYPE 513
 #define RP_TAGS_AAD_PARENT_KEY 514
 #define RP_TAGS_AAD_CHILD_KEY 515
@@ -294,6 +336,8 @@
 #define RP_TAGS_NOTIFICATION_EXISTING_PROCESS 854
 #define RP_TAGS_NOTIFICATION_SELF_TEST 855
 #define RP_TAGS_NOTIFICATION_SELF_TEST_RESULT 856
+#define RP_TAGS_NOTIFICATION_USER_LOGIN 857
+#define RP_TAGS_NOTIFICATION_USER_LOGOUT 858
 #define RP_TAGS_HBS_CONFIGURATIONS 1024
 #define RP_TAGS_HBS_CLOUD_NOTIFICATIONS 1025
 #define RP_TAGS_HBS_CONFIGURATION 1026
@@ -71,6 +71,7 @@ extern rpal_PContext g_rpal_context; // Central reference
 
 // Utility Objects
 #include <rpal_string.h>
+#include <rpal_string_extract.h>
 #include <rpal_blob.h>
 #include <rpal_stringbuffer.h>
 #include <rpal_array.h>
@@ -30,6 +30,18 @@ rBlob
         RU32 from
 	);
 
+// The blob and its initial buffer come from the arena, growing past the
+// initial size moves the buffer to the heap.
+#define rpal_blob_createInArena( arena, initialSize, growBy )    rpal_blob_createInArena_from( arena, initialSize, growBy, RPAL_LINE_SUBTAG )
+rBlob
+	rpal_blob_createInArena_from
+	(
+		rMemoryArena arena,
+		RU32 initialSize,
+		RU32 growBy,
+		RU32 from
+	);
+
 RVOID
 	rpal_blob_free
 	(
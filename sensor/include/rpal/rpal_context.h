@@ -20,7 +20,11 @@ limitations under the License.
 #include <rpal.h>
 
 #define RPAL_VERSION_1          1
-#define RPAL_VERSION_CURRENT    RPAL_VERSION_1
+// The root frees and reallocates arena allocations.
+#define RPAL_VERSION_2          2
+#define RPAL_VERSION_CURRENT    RPAL_VERSION_2
+// Oldest root a module can bind to, the context layout has not changed since.
+#define RPAL_VERSION_MIN        RPAL_VERSION_1
 
 // Helpers to define API Calls into RPAL
 #define RPAL_API_REF(funcName)                  g_rpal_context->_##funcName
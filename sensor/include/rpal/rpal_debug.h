@@ -38,53 +38,134 @@ RVOID
         RU32 nWrap
     );
 
-#ifdef RPAL_PLATFORM_WINDOWS
+//=============================================================================
+//  Logging
+//  A log call records the call site, which holds the format, and a copy of
+//  its arguments in a ring owned by the calling thread. A background writer
+//  started by rpal_log_start formats the records to stderr or to a rotating
+//  log file. Before rpal_log_start and after rpal_log_stop records are
+//  formatted synchronously to stderr. Levels can be changed at runtime,
+//  globally or per source file, and each call site is rate limited.
+//=============================================================================
+#define RPAL_LOG_LEVEL_NONE             0
+#define RPAL_LOG_LEVEL_CRITICAL         1
+#define RPAL_LOG_LEVEL_ERROR            2
+#define RPAL_LOG_LEVEL_WARNING          3
+#define RPAL_LOG_LEVEL_INFO             4
+#define RPAL_LOG_LEVEL_DEFAULT          ((RU32)(-1))
 
-#if defined( RPAL_PLATFORM_DEBUG_LOG ) || defined( RPAL_PLATFORM_DEBUG_LOG_CRIT )
-#define rpal_debug_critical(format,...)   rpal_debug_print( "CRITICAL !!!!! %s: %d %s() " RF_U64 " - " ##format##"\n", __FILE__, __LINE__, __FUNCTION__, rpal_time_getLocal(), __VA_ARGS__ )
-#else
-#define rpal_debug_critical(format,...)
-#endif
-#if defined( RPAL_PLATFORM_DEBUG_LOG ) || defined( RPAL_PLATFORM_DEBUG_LOG_ERR )
-#define rpal_debug_error(format,...)      rpal_debug_print( "ERROR ++++++++ %s: %d %s() " RF_U64 " - " ##format##"\n", __FILE__, __LINE__, __FUNCTION__, rpal_time_getLocal(), __VA_ARGS__ )
-#else
-#define rpal_debug_error(format,...)
-#endif
-#if defined( RPAL_PLATFORM_DEBUG_LOG ) || defined( RPAL_PLATFORM_DEBUG_LOG_WARN )
-#define rpal_debug_warning(format,...)    rpal_debug_print( "WARNING ====== %s: %d %s() " RF_U64 " - " ##format##"\n", __FILE__, __LINE__, __FUNCTION__, rpal_time_getLocal(), __VA_ARGS__ )
-#else
-#define rpal_debug_warning(format,...)
-#endif
-#if defined( RPAL_PLATFORM_DEBUG_LOG ) || defined( RPAL_PLATFORM_DEBUG_LOG_INFO )
-#define rpal_debug_info(format,...)       rpal_debug_print( "INFO --------- %s: %d %s() " RF_U64 " - " ##format##"\n", __FILE__, __LINE__, __FUNCTION__, rpal_time_getLocal(), __VA_ARGS__ )
+#ifdef RPAL_PLATFORM_DEBUG
+#define RPAL_LOG_DEFAULT_LEVEL          RPAL_LOG_LEVEL_INFO
 #else
-#define rpal_debug_info(format,...)
+#define RPAL_LOG_DEFAULT_LEVEL          RPAL_LOG_LEVEL_WARNING
 #endif
+// Records per second per call site, 0 means no limit.
+#define RPAL_LOG_DEFAULT_RATE_LIMIT     50
+
+typedef struct
+{
+    RPCHAR file;
+    RU32 line;
+    RPCHAR function;
+    RPCHAR format;
+    RU32 level;
+
+    // Runtime state maintained by the logger.
+    volatile RU32 generation;
+    volatile RU32 threshold;
+    volatile RU32 window;
+    volatile RU32 nInWindow;
+    volatile RU32 nSuppressed;
+
+} rpal_log_site;
+
+extern volatile RU32 g_rpal_log_generation;
+
+RBOOL
+    rpal_log_start
+    (
+        RPNCHAR filePath,
+        RU32 maxFileSize,
+        RU32 maxFiles
+    );
+
+RVOID
+    rpal_log_stop
+    (
 
+    );
+
+RVOID
+    rpal_log_flush
+    (
+
+    );
+
+RVOID
+    rpal_log_setLevel
+    (
+        RU32 level
+    );
+
+RBOOL
+    rpal_log_setFileLevel
+    (
+        RPCHAR fileName,
+        RU32 level
+    );
+
+RVOID
+    rpal_log_setRateLimit
+    (
+        RU32 perSecond
+    );
+
+RBOOL
+    rpal_log_refreshSite
+    (
+        rpal_log_site* site
+    );
+
+RVOID
+    rpal_log_write
+    (
+        rpal_log_site* site,
+        ...
+    );
+
+#define rpal_log_isEnabled(site) ( (site)->generation == g_rpal_log_generation ? \
+                                   (site)->level <= (site)->threshold : \
+                                   rpal_log_refreshSite( (site) ) )
+
+#ifdef RPAL_PLATFORM_WINDOWS
+#define _RPAL_LOG(level,format,...) do{ static rpal_log_site _rpal_log_site = { __FILE__, __LINE__, __FUNCTION__, format, (level) };\
+                                        if( rpal_log_isEnabled( &_rpal_log_site ) ){ rpal_log_write( &_rpal_log_site, __VA_ARGS__ ); } }while(0)
 #elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
 #include <stdarg.h>
+#define _RPAL_LOG(level,format,...) do{ static rpal_log_site _rpal_log_site = { __FILE__, __LINE__, (RPCHAR)__FUNCTION__, format, (level) };\
+                                        if( rpal_log_isEnabled( &_rpal_log_site ) ){ rpal_log_write( &_rpal_log_site, ##__VA_ARGS__ ); } }while(0)
+#endif
+
 #if defined( RPAL_PLATFORM_DEBUG_LOG ) || defined( RPAL_PLATFORM_DEBUG_LOG_CRIT )
-#define rpal_debug_critical(format,...)   rpal_debug_print( "CRITICAL !!!!! %s: %d %s() " RF_U64 " - " format "\n", __FILE__, __LINE__, __FUNCTION__, rpal_time_getLocal(), ##__VA_ARGS__ )
+#define rpal_debug_critical(format,...)   _RPAL_LOG( RPAL_LOG_LEVEL_CRITICAL, format, ##__VA_ARGS__ )
 #else
 #define rpal_debug_critical(format,...)
 #endif
 #if defined( RPAL_PLATFORM_DEBUG_LOG ) || defined( RPAL_PLATFORM_DEBUG_LOG_ERR )
-#define rpal_debug_error(format,...)      rpal_debug_print( "ERROR ++++++++ %s: %d %s() " RF_U64 " - " format "\n", __FILE__, __LINE__, __FUNCTION__, rpal_time_getLocal(), ##__VA_ARGS__ )
+#define rpal_debug_error(format,...)      _RPAL_LOG( RPAL_LOG_LEVEL_ERROR, format, ##__VA_ARGS__ )
 #else
 #define rpal_debug_error(format,...)
 #endif
 #if defined( RPAL_PLATFORM_DEBUG_LOG ) || defined( RPAL_PLATFORM_DEBUG_LOG_WARN )
-#define rpal_debug_warning(format,...)    rpal_debug_print( "WARNING ====== %s: %d %s() " RF_U64 " - " format "\n", __FILE__, __LINE__, __FUNCTION__, rpal_time_getLocal(), ##__VA_ARGS__ )
+#define rpal_debug_warning(format,...)    _RPAL_LOG( RPAL_LOG_LEVEL_WARNING, format, ##__VA_ARGS__ )
 #else
 #define rpal_debug_warning(format,...)
 #endif
 #if defined( RPAL_PLATFORM_DEBUG_LOG ) || defined( RPAL_PLATFORM_DEBUG_LOG_INFO )
-#define rpal_debug_info(format,...)       rpal_debug_print( "INFO --------- %s: %d %s() " RF_U64 " - " format "\n", __FILE__, __LINE__, __FUNCTION__, rpal_time_getLocal(), ##__VA_ARGS__ )
+#define rpal_debug_info(format,...)       _RPAL_LOG( RPAL_LOG_LEVEL_INFO, format, ##__VA_ARGS__ )
 #else
 #define rpal_debug_info(format,...)
 #endif
-#endif
-
 
 RVOID
     rpal_debug_print
@@ -106,7 +187,7 @@ RVOID
     #define rpal_debug_break()
 #endif
 
-#define rpal_debug_not_implemented() ( rpal_debug_error( "API not implemented: %s", __FUNCTION__ ) )
+#define rpal_debug_not_implemented() rpal_debug_error( "API not implemented: %s", __FUNCTION__ )
 
 #endif
 
@@ -64,8 +64,25 @@ enum rFileSeek
 #define RPAL_FILE_OPEN_ALWAYS               0x00000010
 #define RPAL_FILE_OPEN_AVOID_TIMESTAMPS     0x00000020
 
+// Do not descend into directories living on another device than the root.
+#define RPAL_FILE_CRAWL_SAME_DEVICE         0x00000001
+// Only the path and the directory attribute are required, skip the stat.
+#define RPAL_FILE_CRAWL_NO_METADATA         0x00000002
+
 #pragma pack(pop)
 
+// Options for rpal_file_crawlStartEx, the arrays are NOT copied and must
+// remain valid until the crawl is stopped, like the file expressions.
+typedef struct
+{
+    RU32 flags;
+    // Number of worker threads listing directories, 0 crawls synchronously.
+    RU32 nThreads;
+    // NULL-terminated list of directory path expressions not to descend into.
+    RPNCHAR* pruneExpr;
+
+} rDirCrawlOptions;
+
 
 #ifdef RPAL_PLATFORM_WINDOWS
     #define RPAL_FILE_LOCAL_DIR_SEP_W    _WCH("\\")
@@ -173,6 +190,15 @@ rDirCrawl
         RU32 nMaxDepth
     );
 
+rDirCrawl
+    rpal_file_crawlStartEx
+    (
+        RPNCHAR rootExpr,
+        RPNCHAR fileExpr[],
+        RU32 nMaxDepth,
+        rDirCrawlOptions* pOptions
+    );
+
 RBOOL
     rpal_file_crawlNextFile
     (
@@ -119,4 +119,49 @@ RPVOID
         RU32 from
     );
 
+//=============================================================================
+//  Arenas: bump allocation out of preallocated chunks for short lived data.
+//  An arena is owned by a single thread, but what it allocates is a normal
+//  rpal allocation: it can be freed with rpal_memory_free from any thread and
+//  rpal_memory_realloc moves it to the heap. Resetting the arena rewinds the
+//  chunk if nothing allocated from it is still alive, otherwise the chunk is
+//  left to its survivors and is released with the last of them.
+//  No arena can be created when bound to a root rpal older than RPAL_VERSION_2.
+//=============================================================================
+typedef RPVOID rMemoryArena;
+
+rMemoryArena
+    rpal_memory_arena_create
+    (
+        RU32 chunkSize
+    );
+
+RVOID
+    rpal_memory_arena_free
+    (
+        rMemoryArena arena
+    );
+
+// Falls back to the heap when the size does not fit in a chunk.
+#define rpal_memory_arena_alloc( arena, size )   rpal_memory_arena_alloc_from( (arena), (size), RPAL_LINE_SUBTAG )
+RPVOID
+    rpal_memory_arena_alloc_from
+    (
+        rMemoryArena arena,
+        RSIZET size,
+        RU32 from
+    );
+
+RVOID
+    rpal_memory_arena_reset
+    (
+        rMemoryArena arena
+    );
+
+RBOOL
+    rpal_memory_isFromArena
+    (
+        RPVOID ptr
+    );
+
 #endif
@@ -134,7 +134,7 @@ RBOOL
 #endif
 	}
 #ifdef RPAL_MODE_SLAVE
-    else if( RPAL_VERSION_CURRENT <= context->version )
+    else if( RPAL_VERSION_MIN <= context->version )
 	{
 		// We bind this instance to the core.
 		g_rpal_context = context;
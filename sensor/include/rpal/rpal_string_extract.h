@@ -0,0 +1,61 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#ifndef _RPAL_STRING_EXTRACT_H
+#define _RPAL_STRING_EXTRACT_H
+
+#include <rpal/rpal.h>
+
+//=============================================================================
+//  PUBLIC STRUCTURES
+//=============================================================================
+#define RPAL_STRING_EXTRACT_ASCII       0x01
+#define RPAL_STRING_EXTRACT_UTF16LE     0x02
+
+// A run of printable characters found in a buffer. Printable means 0x20 to 0x7E,
+// for UTF-16LE this is the same range in 2-byte code units aligned on the buffer.
+// Runs are only reported when a non-printable character follows them within the
+// buffer, so buffer[ offset + length * charSize ] is always readable and is the
+// character that terminated the run.
+typedef struct
+{
+    RU64 offset;
+    RU32 length;
+    RU8 encoding;
+} rpal_string_span;
+
+// Return FALSE to stop the extraction.
+typedef RBOOL (*rpal_string_span_f)( RPVOID ctx, RPU8 pBuff, rpal_string_span* span );
+
+//=============================================================================
+//  PUBLIC API
+//=============================================================================
+// Finds ASCII and UTF-16LE printable runs in a single pass over the buffer, the
+// runs are reported in order of their end offset. Nothing is allocated.
+RBOOL
+    rpal_string_extractSpans
+    (
+        RPU8 pBuff,
+        RU64 size,
+        RU32 encodings,
+        RU32 minLength,
+        RU32 maxLength,
+        rpal_string_span_f callback,
+        RPVOID ctx
+    );
+
+#endif
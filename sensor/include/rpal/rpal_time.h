@@ -36,6 +36,17 @@ limitations under the License.
 #define USEC_PER_MSEC                               (1000)
 #define NSEC_100_PER_MSEC                           (10000)
 #define NSEC_100_PER_USEC                           (10)
+#define NSEC_PER_USEC                               (1000)
+#define NSEC_PER_MSEC                               (1000000)
+#define NSEC_PER_SEC                                (1000000000)
+#define NSEC_FROM_MSEC(msec)                        ((RU64)(msec)*NSEC_PER_MSEC)
+#define NSEC_FROM_SEC(sec)                          ((RU64)(sec)*NSEC_PER_SEC)
+#define MSEC_FROM_NSEC(nsec)                        ((nsec)/NSEC_PER_MSEC)
+#define SEC_FROM_NSEC(nsec)                         ((nsec)/NSEC_PER_SEC)
+
+// A time source returns a time value in nanoseconds. Time sources can be
+// overriden for testing purposes, NULL restores the system source.
+typedef RU64 (*rpal_time_source_f)( RBOOL isCoarse );
 
 typedef struct
 {
@@ -97,6 +108,30 @@ RU32
 
     );
 
+// Monotonic time in nanoseconds, unaffected by changes to the wall clock
+// (NTP steps, manual changes). It has no meaning as an absolute time and
+// should only be used to compute deadlines and durations.
+RU64
+    rpal_time_getMonotonicNs
+    (
+
+    );
+
+// Same as above but using a cheaper, lower resolution (a few ms) clock
+// where the platform provides one.
+RU64
+    rpal_time_getMonotonicCoarseNs
+    (
+
+    );
+
+RVOID
+    rpal_time_setSources
+    (
+        rpal_time_source_f wallSource,
+        rpal_time_source_f monotonicSource
+    );
+
 RU64
     rpal_time_elapsedMilliSeconds
     (
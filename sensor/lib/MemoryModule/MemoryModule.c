@@ -601,6 +601,18 @@ void MemoryFreeLibrary(HMEMORYMODULE mod)
     }
 }
 
+RBOOL
+    MemorySetFallbackDirectory
+    (
+        RPNCHAR dirPath
+    )
+{
+    // Modules never touch the disk on Windows.
+    UNREFERENCED_PARAMETER( dirPath );
+    return TRUE;
+}
+
+
 
 
 
@@ -610,58 +622,283 @@ void MemoryFreeLibrary(HMEMORYMODULE mod)
 #elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
 
 #include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 #include <rpal/rpal.h>
 
+#ifdef RPAL_PLATFORM_LINUX
+#include <sys/syscall.h>
+
+// Older libc headers do not know about memfd or file seals even when
+// the running kernel does, so we carry the values ourselves.
+#if !defined( SYS_memfd_create ) && defined( __NR_memfd_create )
+    #define SYS_memfd_create __NR_memfd_create
+#endif
+#ifndef MFD_CLOEXEC
+    #define MFD_CLOEXEC         0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+    #define MFD_ALLOW_SEALING   0x0002U
+#endif
+#ifndef F_ADD_SEALS
+    #define F_ADD_SEALS         1033
+#endif
+#ifndef F_SEAL_SHRINK
+    #define F_SEAL_SHRINK       0x0002
+#endif
+#ifndef F_SEAL_GROW
+    #define F_SEAL_GROW         0x0004
+#endif
+#ifndef F_SEAL_WRITE
+    #define F_SEAL_WRITE        0x0008
+#endif
+#endif
+
+#define _FALLBACK_DIR_MODE      0700
+#define _FALLBACK_FILE_NAME     "/rpXXXXXX"
+
 
 typedef struct {
     RPVOID hMod;
+    int fd;
 } MEMORYMODULE, *PMEMORYMODULE;
 
+RPRIVATE RPCHAR g_fallbackDir = NULL;
 
-HMEMORYMODULE
-    MemoryLoadLibrary
+// Only used by tests to exercise the on-disk path on hosts supporting memfd.
+RPRIVATE_TESTABLE RBOOL g_isMemfdDisabled = FALSE;
+
+RPRIVATE
+RBOOL
+    _writeAll
     (
-        RPVOID buffer,
-        unsigned int bufferSize
+        int fd,
+        RPU8 buffer,
+        RU32 bufferSize
     )
 {
-    PMEMORYMODULE h = NULL;
-    char modName[] = "/tmp/rpXXXXXX";
-    int fd = 0;
+    RBOOL isSuccess = FALSE;
+    ssize_t written = 0;
+
+    while( 0 != bufferSize )
+    {
+        written = write( fd, buffer, bufferSize );
+
+        if( -1 == written )
+        {
+            if( EINTR == errno )
+            {
+                continue;
+            }
+            break;
+        }
+
+        buffer += written;
+        bufferSize -= (RU32)written;
+    }
+
+    if( 0 == bufferSize )
+    {
+        isSuccess = TRUE;
+    }
+
+    return isSuccess;
+}
+
+#if defined( RPAL_PLATFORM_LINUX ) && defined( SYS_memfd_create )
+RPRIVATE
+RPVOID
+    _loadFromMemfd
+    (
+        RPU8 buffer,
+        RU32 bufferSize,
+        int* pFd
+    )
+{
+    RPVOID hMod = NULL;
+    int fd = -1;
+    RCHAR fdPath[ 32 ] = { 0 };
+
+    if( -1 != ( fd = (int)syscall( SYS_memfd_create, "rp", MFD_CLOEXEC | MFD_ALLOW_SEALING ) ) )
+    {
+        // Once sealed the image cannot be altered by anyone holding the fd,
+        // including through /proc/<pid>/fd.
+        if( _writeAll( fd, buffer, bufferSize ) &&
+            0 == fcntl( fd, F_ADD_SEALS, F_SEAL_WRITE | F_SEAL_SHRINK | F_SEAL_GROW ) &&
+            0 < rpal_string_snprintf( fdPath, sizeof( fdPath ), "/proc/self/fd/%d", fd ) )
+        {
+            if( NULL == ( hMod = dlopen( fdPath, RTLD_NOW | RTLD_LOCAL ) ) )
+            {
+                rpal_debug_warning( "failed to load module from memfd: %s", dlerror() );
+            }
+        }
+        else
+        {
+            rpal_debug_warning( "failed to prepare memfd: %d", errno );
+        }
+
+        // The loader recognizes modules by path, if the fd was closed the
+        // next memfd would reuse its number and path and dlopen would hand
+        // back this module instead of loading the new one. So the fd lives
+        // as long as the module does.
+        if( NULL != hMod )
+        {
+            *pFd = fd;
+        }
+        else
+        {
+            close( fd );
+        }
+    }
+    else
+    {
+        rpal_debug_warning( "memfd_create not available: %d", errno );
+    }
+
+    return hMod;
+}
+#endif
+
+RPRIVATE
+RBOOL
+    _preparePrivateDir
+    (
+        RPCHAR dirPath
+    )
+{
+    RBOOL isSuccess = FALSE;
+    struct stat info = { 0 };
+
+    if( 0 != mkdir( dirPath, _FALLBACK_DIR_MODE ) &&
+        EEXIST != errno )
+    {
+        rpal_debug_warning( "failed to create module directory: %d", errno );
+        return FALSE;
+    }
+
+    // A pre-existing directory must be ours and not reachable by anyone
+    // else, otherwise the module could be swapped between write and load.
+    if( 0 == lstat( dirPath, &info ) &&
+        S_ISDIR( info.st_mode ) &&
+        geteuid() == info.st_uid )
+    {
+        if( 0 == ( info.st_mode & ( S_IRWXG | S_IRWXO ) ) ||
+            0 == chmod( dirPath, _FALLBACK_DIR_MODE ) )
+        {
+            isSuccess = TRUE;
+        }
+    }
+    else
+    {
+        rpal_debug_warning( "module directory is not private" );
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE
+RPVOID
+    _loadFromPrivateDir
+    (
+        RPU8 buffer,
+        RU32 bufferSize
+    )
+{
+    RPVOID hMod = NULL;
+    RPCHAR modName = NULL;
+    int fd = -1;
     RBOOL isWritten = FALSE;
-    RBOOL isLoaded = FALSE;
-    
-    if( NULL != ( h = rpal_memory_alloc( sizeof( MEMORYMODULE ) ) ) )
+
+    if( NULL == g_fallbackDir )
     {
-        h->hMod = NULL;
-        
-        if( -1 != ( fd = mkstemp( (RPCHAR)&modName ) ) )
+        rpal_debug_warning( "no module directory configured" );
+        return NULL;
+    }
+
+    if( _preparePrivateDir( g_fallbackDir ) &&
+        NULL != ( modName = rpal_string_strdup( g_fallbackDir ) ) &&
+        NULL != ( modName = rpal_string_strcatEx( modName, _FALLBACK_FILE_NAME ) ) )
+    {
+        if( -1 != ( fd = mkstemp( modName ) ) )
         {
-            if( bufferSize == write( fd, buffer, bufferSize ) )
+            if( 0 == fchmod( fd, S_IRWXU ) &&
+                _writeAll( fd, buffer, bufferSize ) )
             {
                 isWritten = TRUE;
             }
-            
+
             close( fd );
-            
-            
+
             if( isWritten )
             {
-                if( NULL != ( h->hMod = dlopen( (RPCHAR)&modName, RTLD_NOW | RTLD_LOCAL ) ) )
+                if( NULL == ( hMod = dlopen( modName, RTLD_NOW | RTLD_LOCAL ) ) )
                 {
-                    isLoaded = TRUE;
+                    rpal_debug_warning( "failed to load module from disk: %s", dlerror() );
                 }
             }
-            
+
             unlink( modName );
         }
+
+        rpal_memory_free( modName );
     }
+
+    return hMod;
+}
+
+RBOOL
+    MemorySetFallbackDirectory
+    (
+        RPNCHAR dirPath
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RPCHAR tmpDir = NULL;
+
+    if( NULL == dirPath ||
+        NULL != ( tmpDir = rpal_string_strdup( dirPath ) ) )
+    {
+        rpal_memory_free( g_fallbackDir );
+        g_fallbackDir = tmpDir;
+        isSuccess = TRUE;
+    }
+
+    return isSuccess;
+}
+
+HMEMORYMODULE
+    MemoryLoadLibrary
+    (
+        RPVOID buffer,
+        unsigned int bufferSize
+    )
+{
+    PMEMORYMODULE h = NULL;
     
-    if( !isLoaded )
+    if( NULL != ( h = rpal_memory_alloc( sizeof( MEMORYMODULE ) ) ) )
     {
-        if( NULL != h )
+        h->hMod = NULL;
+        h->fd = -1;
+
+#if defined( RPAL_PLATFORM_LINUX ) && defined( SYS_memfd_create )
+        // Prefer an anonymous memory file, nothing hits the disk and it
+        // works on hosts where every writable mount is noexec.
+        if( !g_isMemfdDisabled )
+        {
+            h->hMod = _loadFromMemfd( buffer, bufferSize, &h->fd );
+        }
+#endif
+
+        if( NULL == h->hMod )
+        {
+            h->hMod = _loadFromPrivateDir( buffer, bufferSize );
+        }
+
+        if( NULL == h->hMod )
         {
             rpal_memory_free( h );
             h = NULL;
@@ -717,6 +954,11 @@ RVOID
     if( rpal_memory_isValid( pMod ) )
     {
         dlclose( pMod->hMod );
+
+        if( -1 != pMod->fd )
+        {
+            close( pMod->fd );
+        }
         
         rpal_memory_free( hModule );
     }
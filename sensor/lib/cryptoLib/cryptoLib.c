@@ -16,13 +16,18 @@ limitations under the License.
 
 #define RPAL_FILE_ID   33
 
-#include <mbedtls/sha256.h>
 #include <mbedtls/aes.h>
 #include <mbedtls/pk.h>
 #include <mbedtls/entropy.h>
 #include <mbedtls/ctr_drbg.h>
 
 #include <cryptoLib/cryptoLib.h>
+#include "sha256.h"
+
+#ifdef RPAL_PLATFORM_WINDOWS
+#else
+    #include <pthread.h>
+#endif
 
 
 #pragma pack(push)
@@ -42,10 +47,98 @@ typedef struct
 } _CryptoLib_SymContext;
 
 
+// Unique ids are generated from per-thread state: each thread encrypts a
+// nonce and counter with its own AES key drawn from the DRBG, so ids are
+// unique per key by construction and the DRBG is only hit on (re)seed.
+#define _UNIQUE_ID_RESEED_EVERY     ( 1 << 20 )
+
+typedef struct _CryptoLib_IdState
+{
+    mbedtls_aes_context aes;
+    RU8 block[ CRYPTOLIB_UNIQUE_ID_SIZE ];
+    RU32 nLeft;
+    RU32 generation;
+    struct _CryptoLib_IdState* prev;
+    struct _CryptoLib_IdState* next;
+} _CryptoLib_IdState;
+
 static rMutex g_mutex = NULL;
 static mbedtls_entropy_context g_entropy = { 0 };
 static mbedtls_ctr_drbg_context g_rng = { 0 };
+static _CryptoLib_IdState* g_idStates = NULL;
+#ifdef RPAL_PLATFORM_WINDOWS
+static DWORD g_idTls = TLS_OUT_OF_INDEXES;
+#else
+static pthread_key_t g_idTls = 0;
+static RBOOL g_isIdTlsCreated = FALSE;
+static RBOOL g_isForkHandled = FALSE;
+#endif
+static volatile RU32 g_idGeneration = 0;
+
+static RVOID
+    _freeIdState
+    (
+        RPVOID state
+    )
+{
+    _CryptoLib_IdState* pState = (_CryptoLib_IdState*)state;
+
+    if( NULL == pState ||
+        !rMutex_lock( g_mutex ) )
+    {
+        return;
+    }
+
+    if( NULL != pState->prev )
+    {
+        pState->prev->next = pState->next;
+    }
+    else
+    {
+        g_idStates = pState->next;
+    }
+    if( NULL != pState->next )
+    {
+        pState->next->prev = pState->prev;
+    }
+
+    rMutex_unlock( g_mutex );
+
+    mbedtls_aes_free( &pState->aes );
+    rpal_memory_free( pState );
+}
+
 
+#ifndef RPAL_PLATFORM_WINDOWS
+static RVOID
+    _onFork
+    (
+
+    )
+{
+    g_idGeneration++;
+}
+#endif
+
+// The DRBG is shared by every thread using the library.
+static int
+    _lockedRandom
+    (
+        void* ctx,
+        unsigned char* output,
+        size_t outputSize
+    )
+{
+    int ret = MBEDTLS_ERR_CTR_DRBG_REQUEST_TOO_BIG;
+
+    if( rMutex_lock( g_mutex ) )
+    {
+        ret = mbedtls_ctr_drbg_random( ctx, output, outputSize );
+        rMutex_unlock( g_mutex );
+    }
+
+    return ret;
+}
 
 RBOOL
     CryptoLib_init
@@ -64,6 +157,18 @@ RBOOL
                                &g_entropy,
                                (const unsigned char*)perso,
                                sizeof( perso ) - sizeof( RCHAR ) );
+#ifdef RPAL_PLATFORM_WINDOWS
+        g_idTls = TlsAlloc();
+#else
+        // Threads exiting give their state back, the rest is freed on deinit.
+        g_isIdTlsCreated = ( 0 == pthread_key_create( &g_idTls, _freeIdState ) );
+
+        // A forked child inherits the thread states, it must not reuse their keys.
+        if( !g_isForkHandled )
+        {
+            g_isForkHandled = ( 0 == pthread_atfork( NULL, NULL, _onFork ) );
+        }
+#endif
         isSuccess = TRUE;
     }
 
@@ -76,9 +181,32 @@ RVOID
 
     )
 {
+    _CryptoLib_IdState* pState = NULL;
+
     if( rMutex_lock( g_mutex ) )
     {
+#ifdef RPAL_PLATFORM_WINDOWS
+        if( TLS_OUT_OF_INDEXES != g_idTls )
+        {
+            TlsFree( g_idTls );
+            g_idTls = TLS_OUT_OF_INDEXES;
+        }
+#else
+        if( g_isIdTlsCreated )
+        {
+            pthread_key_delete( g_idTls );
+            g_isIdTlsCreated = FALSE;
+        }
+#endif
+        while( NULL != ( pState = g_idStates ) )
+        {
+            g_idStates = pState->next;
+            mbedtls_aes_free( &pState->aes );
+            rpal_memory_free( pState );
+        }
+
         rMutex_free( g_mutex );
+        g_mutex = NULL;
     }
 }
 
@@ -102,7 +230,7 @@ RBOOL
         NULL != privKey &&
         NULL != pSignature )
     {
-        mbedtls_sha256( bufferToSign, bufferSize, (RPU8)&hash, 0 );
+        CryptoLib_hash( bufferToSign, bufferSize, &hash );
         
         mbedtls_pk_init( &key );
 
@@ -111,7 +239,7 @@ RBOOL
             if( NULL != ( rsa = mbedtls_pk_rsa( key ) ) )
             {
                 if( 0 == mbedtls_rsa_pkcs1_encrypt( rsa,
-                                                    mbedtls_ctr_drbg_random,
+                                                    _lockedRandom,
                                                     &g_rng,
                                                     MBEDTLS_RSA_PRIVATE,
                                                     sizeof( hash ),
@@ -151,7 +279,7 @@ RBOOL
         NULL != pubKey &&
         NULL != signature )
     {
-        mbedtls_sha256( bufferToVerify, bufferSize, (RPU8)&actualHash, 0 );
+        CryptoLib_hash( bufferToVerify, bufferSize, &actualHash );
         
         mbedtls_pk_init( &key );
 
@@ -160,7 +288,7 @@ RBOOL
             if( NULL != ( rsa = mbedtls_pk_rsa( key ) ) )
             {
                 if( 0 == mbedtls_rsa_pkcs1_decrypt( rsa, 
-                                                    mbedtls_ctr_drbg_random, 
+                                                    _lockedRandom, 
                                                     &g_rng,
                                                     MBEDTLS_RSA_PUBLIC, 
                                                     &outLength, 
@@ -452,7 +580,7 @@ RBOOL
                                                  outBuff, 
                                                  &outSize, 
                                                  outSize, 
-                                                 mbedtls_ctr_drbg_random, 
+                                                 _lockedRandom, 
                                                  &g_rng ) )
                     {
                         *pEncryptedBuffer = outBuff;
@@ -513,7 +641,7 @@ RBOOL
                                              outBuff,
                                              &outSize,
                                              outSize,
-                                             mbedtls_ctr_drbg_random,
+                                             _lockedRandom,
                                              &g_rng ) )
                 {
                     *pDecryptedBuffer = (RU8*)outBuff;
@@ -547,7 +675,8 @@ RBOOL
     RU32 offset = 0;
 
     if( NULL != pRandBytes &&
-        0 != bytesRequired )
+        0 != bytesRequired &&
+        rMutex_lock( g_mutex ) )
     {
         isSuccess = TRUE;
 
@@ -563,6 +692,137 @@ RBOOL
             bytesLeft -= bytesRequesting;
             offset += bytesRequesting;
         }
+
+        rMutex_unlock( g_mutex );
+    }
+
+    return isSuccess;
+}
+
+// Draws a new key and nonce for the thread state from the DRBG.
+static RBOOL
+    _reseedIdState
+    (
+        _CryptoLib_IdState* pState
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RU8 key[ CRYPTOLIB_SYM_KEY_SIZE ] = { 0 };
+
+    if( CryptoLib_genRandomBytes( key, sizeof( key ) ) &&
+        CryptoLib_genRandomBytes( pState->block, sizeof( pState->block ) ) &&
+        0 == mbedtls_aes_setkey_enc( &pState->aes, key, sizeof( key ) * 8 ) )
+    {
+        pState->nLeft = _UNIQUE_ID_RESEED_EVERY;
+        pState->generation = g_idGeneration;
+        isSuccess = TRUE;
+    }
+
+    rpal_memory_zero( key, sizeof( key ) );
+
+    return isSuccess;
+}
+
+static _CryptoLib_IdState*
+    _getIdState
+    (
+
+    )
+{
+    _CryptoLib_IdState* pState = NULL;
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    if( TLS_OUT_OF_INDEXES == g_idTls )
+    {
+        return NULL;
+    }
+    pState = TlsGetValue( g_idTls );
+#else
+    if( !g_isIdTlsCreated )
+    {
+        return NULL;
+    }
+    pState = pthread_getspecific( g_idTls );
+#endif
+
+    if( NULL != pState )
+    {
+        return pState;
+    }
+
+    if( NULL != ( pState = rpal_memory_alloc( sizeof( *pState ) ) ) )
+    {
+        rpal_memory_zero( pState, sizeof( *pState ) );
+        mbedtls_aes_init( &pState->aes );
+
+        if( !rMutex_lock( g_mutex ) )
+        {
+            mbedtls_aes_free( &pState->aes );
+            rpal_memory_free( pState );
+            return NULL;
+        }
+
+        pState->next = g_idStates;
+        if( NULL != g_idStates )
+        {
+            g_idStates->prev = pState;
+        }
+        g_idStates = pState;
+
+        rMutex_unlock( g_mutex );
+
+#ifdef RPAL_PLATFORM_WINDOWS
+        if( !TlsSetValue( g_idTls, pState ) )
+#else
+        if( 0 != pthread_setspecific( g_idTls, pState ) )
+#endif
+        {
+            _freeIdState( pState );
+            pState = NULL;
+        }
+    }
+
+    return pState;
+}
+
+RBOOL
+    CryptoLib_genUniqueId
+    (
+        RU8 pId[ CRYPTOLIB_UNIQUE_ID_SIZE ]
+    )
+{
+    RBOOL isSuccess = FALSE;
+    _CryptoLib_IdState* pState = NULL;
+    RU32 i = 0;
+
+    if( NULL != pId &&
+        NULL != ( pState = _getIdState() ) )
+    {
+        if( 0 == pState->nLeft ||
+            g_idGeneration != pState->generation )
+        {
+            if( !_reseedIdState( pState ) )
+            {
+                pState->nLeft = 0;
+                return FALSE;
+            }
+        }
+
+        // The block is a random nonce followed by a counter, the counter
+        // can't wrap before the next reseed.
+        for( i = CRYPTOLIB_UNIQUE_ID_SIZE - 1; i >= CRYPTOLIB_UNIQUE_ID_SIZE / 2; i-- )
+        {
+            if( 0 != ++pState->block[ i ] )
+            {
+                break;
+            }
+        }
+
+        if( 0 == mbedtls_aes_crypt_ecb( &pState->aes, MBEDTLS_AES_ENCRYPT, pState->block, pId ) )
+        {
+            pState->nLeft--;
+            isSuccess = TRUE;
+        }
     }
 
     return isSuccess;
@@ -668,18 +928,111 @@ RBOOL
     )
 {
     RBOOL isSuccess = FALSE;
+    CryptoLib_Sha256Context ctx;
 
     if( NULL != buffer &&
         0 != bufferSize &&
         NULL != pHash )
     {
-        mbedtls_sha256( buffer, bufferSize, (RPU8)pHash, 0 );
+        CryptoLib_sha256Init( &ctx );
+        CryptoLib_sha256Update( &ctx, buffer, bufferSize );
+        CryptoLib_sha256Finish( &ctx, pHash );
         isSuccess = TRUE;
     }
 
     return isSuccess;
 }
 
+RBOOL
+    CryptoLib_hashMulti
+    (
+        RPVOID* buffers,
+        RU32* bufferSizes,
+        RU32 nBuffers,
+        CryptoLib_Hash* pHashes
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RU32 i = 0;
+
+    if( NULL != buffers &&
+        NULL != bufferSizes &&
+        NULL != pHashes )
+    {
+        for( i = 0; i < nBuffers; i++ )
+        {
+            if( NULL == buffers[ i ] &&
+                0 != bufferSizes[ i ] )
+            {
+                return FALSE;
+            }
+        }
+
+        CryptoLib_sha256Multi( (RPU8*)buffers, bufferSizes, nBuffers, pHashes );
+        isSuccess = TRUE;
+    }
+
+    return isSuccess;
+}
+
+CryptoLib_HashContext
+    CryptoLib_hashInit
+    (
+
+    )
+{
+    CryptoLib_Sha256Context* ctx = NULL;
+
+    if( NULL != ( ctx = rpal_memory_alloc( sizeof( *ctx ) ) ) )
+    {
+        CryptoLib_sha256Init( ctx );
+    }
+
+    return (CryptoLib_HashContext)ctx;
+}
+
+RBOOL
+    CryptoLib_hashUpdate
+    (
+        CryptoLib_HashContext ctx,
+        RPVOID buffer,
+        RU32 bufferSize
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    if( NULL != ctx &&
+        ( NULL != buffer || 0 == bufferSize ) )
+    {
+        CryptoLib_sha256Update( (CryptoLib_Sha256Context*)ctx, buffer, bufferSize );
+        isSuccess = TRUE;
+    }
+
+    return isSuccess;
+}
+
+RBOOL
+    CryptoLib_hashFinish
+    (
+        CryptoLib_HashContext ctx,
+        CryptoLib_Hash* pHash
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    if( NULL != ctx )
+    {
+        if( NULL != pHash )
+        {
+            CryptoLib_sha256Finish( (CryptoLib_Sha256Context*)ctx, pHash );
+            isSuccess = TRUE;
+        }
+
+        rpal_memory_free( ctx );
+    }
+
+    return isSuccess;
+}
 
 RBOOL
     CryptoLib_hashFile
@@ -691,7 +1044,7 @@ RBOOL
 {
     RBOOL isSuccess = FALSE;
 
-    mbedtls_sha256_context ctx = { 0 };
+    CryptoLib_Sha256Context ctx;
     RU8 buff[ 200 * 1024 ] = {0};
     rFile f = NULL;
     RU32 read = 0;
@@ -703,14 +1056,12 @@ RBOOL
                                       RPAL_FILE_OPEN_EXISTING |
                                       ( isAvoidTimestamps ? RPAL_FILE_OPEN_AVOID_TIMESTAMPS : 0 ) ) )
         {
-            mbedtls_sha256_init( &ctx );
-            mbedtls_sha256_starts( &ctx, 0 );
+            CryptoLib_sha256Init( &ctx );
             while( ( read = rFile_readUpTo( f, sizeof( buff ), buff ) ) > 0 )
             {
-                mbedtls_sha256_update( &ctx, buff, read );
+                CryptoLib_sha256Update( &ctx, buff, read );
             }
-            mbedtls_sha256_finish( &ctx, (RPU8)pHash );
-            mbedtls_sha256_free( &ctx );
+            CryptoLib_sha256Finish( &ctx, pHash );
             isSuccess = TRUE;
 
             rFile_close( f );
@@ -0,0 +1,868 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#define RPAL_FILE_ID   114
+
+#include "sha256.h"
+
+// The hardware kernels are built with per-function target attributes so the
+// rest of the library keeps the baseline instruction set, the CPU is only
+// asked at runtime whether they can be used.
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && \
+    ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( 4 < __GNUC__ || ( 4 == __GNUC__ && 9 <= __GNUC_MINOR__ ) ) ) )
+    #define _SHA256_HAS_SHANI
+    #define _SHANI_TARGET   __attribute__(( target( "sha,sse4.1,ssse3" ) ))
+    #include <cpuid.h>
+    #include <immintrin.h>
+#elif ( defined( _M_X64 ) || defined( _M_IX86 ) ) && defined( _MSC_VER ) && 1900 <= _MSC_VER
+    #define _SHA256_HAS_SHANI
+    #define _SHANI_TARGET
+    #include <intrin.h>
+    #include <immintrin.h>
+#endif
+
+#if defined( __aarch64__ ) && \
+    ( defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX ) ) && \
+    ( defined( __clang__ ) || ( defined( __GNUC__ ) && 6 <= __GNUC__ ) )
+    #define _SHA256_HAS_ARMV8
+    #ifdef __clang__
+        #define _ARMV8_TARGET   __attribute__(( target( "crypto" ) ))
+    #else
+        #define _ARMV8_TARGET   __attribute__(( target( "+crypto" ) ))
+    #endif
+    #include <arm_neon.h>
+    #ifdef RPAL_PLATFORM_LINUX
+        #include <sys/auxv.h>
+        #ifndef HWCAP_SHA2
+            #define HWCAP_SHA2  ( 1 << 6 )
+        #endif
+    #endif
+#endif
+
+typedef RVOID (*_Sha256Blocks)( RU32 state[ 8 ], const RU8* data, RU32 nBlocks );
+typedef RVOID (*_Sha256BlocksX2)( RU32 stateA[ 8 ], const RU8* dataA, RU32 stateB[ 8 ], const RU8* dataB, RU32 nBlocks );
+
+// One input of a multi-buffer hash: its full blocks are read in place, the
+// remainder and the padding are then read from the tail.
+typedef struct
+{
+    RU32 state[ 8 ];
+    const RU8* data;
+    RU32 nBlocks;
+    RU32 nTailBlocks;
+    RU8 tail[ CRYPTOLIB_SHA256_BLOCK_SIZE * 2 ];
+} _Sha256Lane;
+
+RPRIVATE const RU32 g_initialState[ 8 ] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+RPRIVATE const RU32 g_k[ 64 ] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define _ROTR(x,n)      ( ( (x) >> (n) ) | ( (x) << ( 32 - (n) ) ) )
+#define _BSIG0(x)       ( _ROTR( x, 2 ) ^ _ROTR( x, 13 ) ^ _ROTR( x, 22 ) )
+#define _BSIG1(x)       ( _ROTR( x, 6 ) ^ _ROTR( x, 11 ) ^ _ROTR( x, 25 ) )
+#define _SSIG0(x)       ( _ROTR( x, 7 ) ^ _ROTR( x, 18 ) ^ ( (x) >> 3 ) )
+#define _SSIG1(x)       ( _ROTR( x, 17 ) ^ _ROTR( x, 19 ) ^ ( (x) >> 10 ) )
+#define _CH(x,y,z)      ( (z) ^ ( (x) & ( (y) ^ (z) ) ) )
+#define _MAJ(x,y,z)     ( ( (x) & (y) ) | ( (z) & ( (x) | (y) ) ) )
+
+RPRIVATE
+RVOID
+    _blocksGeneric
+    (
+        RU32 state[ 8 ],
+        const RU8* data,
+        RU32 nBlocks
+    )
+{
+    RU32 w[ 64 ];
+    RU32 a, b, c, d, e, f, g, h;
+    RU32 t1 = 0;
+    RU32 t2 = 0;
+    RU32 i = 0;
+
+    while( 0 != nBlocks-- )
+    {
+        for( i = 0; i < 16; i++ )
+        {
+            w[ i ] = ( (RU32)data[ i * 4 ] << 24 ) |
+                     ( (RU32)data[ i * 4 + 1 ] << 16 ) |
+                     ( (RU32)data[ i * 4 + 2 ] << 8 ) |
+                     ( (RU32)data[ i * 4 + 3 ] );
+        }
+        for( i = 16; i < 64; i++ )
+        {
+            w[ i ] = _SSIG1( w[ i - 2 ] ) + w[ i - 7 ] + _SSIG0( w[ i - 15 ] ) + w[ i - 16 ];
+        }
+
+        a = state[ 0 ]; b = state[ 1 ]; c = state[ 2 ]; d = state[ 3 ];
+        e = state[ 4 ]; f = state[ 5 ]; g = state[ 6 ]; h = state[ 7 ];
+
+        for( i = 0; i < 64; i++ )
+        {
+            t1 = h + _BSIG1( e ) + _CH( e, f, g ) + g_k[ i ] + w[ i ];
+            t2 = _BSIG0( a ) + _MAJ( a, b, c );
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
+
+        state[ 0 ] += a; state[ 1 ] += b; state[ 2 ] += c; state[ 3 ] += d;
+        state[ 4 ] += e; state[ 5 ] += f; state[ 6 ] += g; state[ 7 ] += h;
+
+        data += CRYPTOLIB_SHA256_BLOCK_SIZE;
+    }
+}
+
+#ifdef _SHA256_HAS_SHANI
+// The SHA-NI state is kept as ABEF / CDGH, each round instruction does two
+// rounds so a quad round is two of them on the low then high message words.
+#define _SHANI_QROUND( s0, s1, m, k )                                                   \
+    do                                                                                  \
+    {                                                                                   \
+        wk = _mm_add_epi32( (m), _mm_loadu_si128( (const __m128i*)&g_k[ (k) ] ) );      \
+        (s1) = _mm_sha256rnds2_epu32( (s1), (s0), wk );                                 \
+        wk = _mm_shuffle_epi32( wk, 0x0E );                                             \
+        (s0) = _mm_sha256rnds2_epu32( (s0), (s1), wk );                                 \
+    } while( 0 )
+
+// Replaces w0 (W[t-16..t-13]) by W[t..t+3].
+#define _SHANI_SCHEDULE( w0, w1, w2, w3 )                                               \
+    (w0) = _mm_sha256msg2_epu32( _mm_add_epi32( _mm_sha256msg1_epu32( (w0), (w1) ),     \
+                                                _mm_alignr_epi8( (w3), (w2), 4 ) ),     \
+                                 (w3) )
+
+#define _SHANI_LOAD( m, p ) \
+    (m) = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i*)(p) ), mask )
+
+RPRIVATE
+_SHANI_TARGET
+RVOID
+    _shaNiToInternal
+    (
+        RU32 state[ 8 ],
+        __m128i* pS0,
+        __m128i* pS1
+    )
+{
+    __m128i tmp;
+
+    tmp = _mm_shuffle_epi32( _mm_loadu_si128( (const __m128i*)&state[ 0 ] ), 0xB1 );
+    *pS1 = _mm_shuffle_epi32( _mm_loadu_si128( (const __m128i*)&state[ 4 ] ), 0x1B );
+    *pS0 = _mm_alignr_epi8( tmp, *pS1, 8 );
+    *pS1 = _mm_blend_epi16( *pS1, tmp, 0xF0 );
+}
+
+RPRIVATE
+_SHANI_TARGET
+RVOID
+    _shaNiFromInternal
+    (
+        RU32 state[ 8 ],
+        __m128i s0,
+        __m128i s1
+    )
+{
+    __m128i tmp;
+
+    tmp = _mm_shuffle_epi32( s0, 0x1B );
+    s1 = _mm_shuffle_epi32( s1, 0xB1 );
+    _mm_storeu_si128( (__m128i*)&state[ 0 ], _mm_blend_epi16( tmp, s1, 0xF0 ) );
+    _mm_storeu_si128( (__m128i*)&state[ 4 ], _mm_alignr_epi8( s1, tmp, 8 ) );
+}
+
+RPRIVATE
+_SHANI_TARGET
+RVOID
+    _blocksShaNi
+    (
+        RU32 state[ 8 ],
+        const RU8* data,
+        RU32 nBlocks
+    )
+{
+    const __m128i mask = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+    __m128i s0, s1, saved0, saved1, wk;
+    __m128i m0, m1, m2, m3;
+    RU32 i = 0;
+
+    _shaNiToInternal( state, &s0, &s1 );
+
+    while( 0 != nBlocks-- )
+    {
+        saved0 = s0;
+        saved1 = s1;
+
+        _SHANI_LOAD( m0, data );
+        _SHANI_LOAD( m1, data + 16 );
+        _SHANI_LOAD( m2, data + 32 );
+        _SHANI_LOAD( m3, data + 48 );
+
+        _SHANI_QROUND( s0, s1, m0, 0 );
+        _SHANI_QROUND( s0, s1, m1, 4 );
+        _SHANI_QROUND( s0, s1, m2, 8 );
+        _SHANI_QROUND( s0, s1, m3, 12 );
+
+        for( i = 16; i < 64; i += 16 )
+        {
+            _SHANI_SCHEDULE( m0, m1, m2, m3 );
+            _SHANI_QROUND( s0, s1, m0, i );
+            _SHANI_SCHEDULE( m1, m2, m3, m0 );
+            _SHANI_QROUND( s0, s1, m1, i + 4 );
+            _SHANI_SCHEDULE( m2, m3, m0, m1 );
+            _SHANI_QROUND( s0, s1, m2, i + 8 );
+            _SHANI_SCHEDULE( m3, m0, m1, m2 );
+            _SHANI_QROUND( s0, s1, m3, i + 12 );
+        }
+
+        s0 = _mm_add_epi32( s0, saved0 );
+        s1 = _mm_add_epi32( s1, saved1 );
+
+        data += CRYPTOLIB_SHA256_BLOCK_SIZE;
+    }
+
+    _shaNiFromInternal( state, s0, s1 );
+}
+
+// Each round depends on the previous one so a single stream leaves the
+// SHA unit idle most of the time, two independent streams fill the gaps.
+RPRIVATE
+_SHANI_TARGET
+RVOID
+    _blocksShaNiX2
+    (
+        RU32 stateA[ 8 ],
+        const RU8* dataA,
+        RU32 stateB[ 8 ],
+        const RU8* dataB,
+        RU32 nBlocks
+    )
+{
+    const __m128i mask = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+    __m128i a0, a1, savedA0, savedA1;
+    __m128i b0, b1, savedB0, savedB1;
+    __m128i am0, am1, am2, am3;
+    __m128i bm0, bm1, bm2, bm3;
+    __m128i wk;
+    RU32 i = 0;
+
+    _shaNiToInternal( stateA, &a0, &a1 );
+    _shaNiToInternal( stateB, &b0, &b1 );
+
+    while( 0 != nBlocks-- )
+    {
+        savedA0 = a0;
+        savedA1 = a1;
+        savedB0 = b0;
+        savedB1 = b1;
+
+        _SHANI_LOAD( am0, dataA );
+        _SHANI_LOAD( bm0, dataB );
+        _SHANI_LOAD( am1, dataA + 16 );
+        _SHANI_LOAD( bm1, dataB + 16 );
+        _SHANI_LOAD( am2, dataA + 32 );
+        _SHANI_LOAD( bm2, dataB + 32 );
+        _SHANI_LOAD( am3, dataA + 48 );
+        _SHANI_LOAD( bm3, dataB + 48 );
+
+        _SHANI_QROUND( a0, a1, am0, 0 );
+        _SHANI_QROUND( b0, b1, bm0, 0 );
+        _SHANI_QROUND( a0, a1, am1, 4 );
+        _SHANI_QROUND( b0, b1, bm1, 4 );
+        _SHANI_QROUND( a0, a1, am2, 8 );
+        _SHANI_QROUND( b0, b1, bm2, 8 );
+        _SHANI_QROUND( a0, a1, am3, 12 );
+        _SHANI_QROUND( b0, b1, bm3, 12 );
+
+        for( i = 16; i < 64; i += 16 )
+        {
+            _SHANI_SCHEDULE( am0, am1, am2, am3 );
+            _SHANI_SCHEDULE( bm0, bm1, bm2, bm3 );
+            _SHANI_QROUND( a0, a1, am0, i );
+            _SHANI_QROUND( b0, b1, bm0, i );
+            _SHANI_SCHEDULE( am1, am2, am3, am0 );
+            _SHANI_SCHEDULE( bm1, bm2, bm3, bm0 );
+            _SHANI_QROUND( a0, a1, am1, i + 4 );
+            _SHANI_QROUND( b0, b1, bm1, i + 4 );
+            _SHANI_SCHEDULE( am2, am3, am0, am1 );
+            _SHANI_SCHEDULE( bm2, bm3, bm0, bm1 );
+            _SHANI_QROUND( a0, a1, am2, i + 8 );
+            _SHANI_QROUND( b0, b1, bm2, i + 8 );
+            _SHANI_SCHEDULE( am3, am0, am1, am2 );
+            _SHANI_SCHEDULE( bm3, bm0, bm1, bm2 );
+            _SHANI_QROUND( a0, a1, am3, i + 12 );
+            _SHANI_QROUND( b0, b1, bm3, i + 12 );
+        }
+
+        a0 = _mm_add_epi32( a0, savedA0 );
+        a1 = _mm_add_epi32( a1, savedA1 );
+        b0 = _mm_add_epi32( b0, savedB0 );
+        b1 = _mm_add_epi32( b1, savedB1 );
+
+        dataA += CRYPTOLIB_SHA256_BLOCK_SIZE;
+        dataB += CRYPTOLIB_SHA256_BLOCK_SIZE;
+    }
+
+    _shaNiFromInternal( stateA, a0, a1 );
+    _shaNiFromInternal( stateB, b0, b1 );
+}
+
+RPRIVATE
+RBOOL
+    _isShaNiSupported
+    (
+
+    )
+{
+    RBOOL isSupported = FALSE;
+#ifdef _MSC_VER
+    int regs[ 4 ] = { 0 };
+
+    __cpuid( regs, 0 );
+    if( 7 <= regs[ 0 ] )
+    {
+        __cpuidex( regs, 7, 0 );
+        if( 0 != ( regs[ 1 ] & ( 1 << 29 ) ) )
+        {
+            __cpuid( regs, 1 );
+            isSupported = 0 != ( regs[ 2 ] & ( 1 << 9 ) ) &&
+                          0 != ( regs[ 2 ] & ( 1 << 19 ) );
+        }
+    }
+#else
+    unsigned int a = 0;
+    unsigned int b = 0;
+    unsigned int c = 0;
+    unsigned int d = 0;
+
+    if( 7 <= __get_cpuid_max( 0, NULL ) )
+    {
+        __cpuid_count( 7, 0, a, b, c, d );
+        if( 0 != ( b & ( 1 << 29 ) ) &&
+            __get_cpuid( 1, &a, &b, &c, &d ) )
+        {
+            isSupported = 0 != ( c & ( 1 << 9 ) ) &&
+                          0 != ( c & ( 1 << 19 ) );
+        }
+    }
+#endif
+    return isSupported;
+}
+#endif
+
+#ifdef _SHA256_HAS_ARMV8
+#define _ARMV8_QROUND( s0, s1, m, k )                                   \
+    do                                                                  \
+    {                                                                   \
+        wk = vaddq_u32( (m), vld1q_u32( &g_k[ (k) ] ) );                \
+        prev = (s0);                                                    \
+        (s0) = vsha256hq_u32( (s0), (s1), wk );                         \
+        (s1) = vsha256h2q_u32( (s1), prev, wk );                        \
+    } while( 0 )
+
+#define _ARMV8_SCHEDULE( w0, w1, w2, w3 ) \
+    (w0) = vsha256su1q_u32( vsha256su0q_u32( (w0), (w1) ), (w2), (w3) )
+
+#define _ARMV8_LOAD( m, p ) \
+    (m) = vreinterpretq_u32_u8( vrev32q_u8( vld1q_u8( (p) ) ) )
+
+RPRIVATE
+_ARMV8_TARGET
+RVOID
+    _blocksArmv8
+    (
+        RU32 state[ 8 ],
+        const RU8* data,
+        RU32 nBlocks
+    )
+{
+    uint32x4_t s0, s1, saved0, saved1, prev, wk;
+    uint32x4_t m0, m1, m2, m3;
+    RU32 i = 0;
+
+    s0 = vld1q_u32( &state[ 0 ] );
+    s1 = vld1q_u32( &state[ 4 ] );
+
+    while( 0 != nBlocks-- )
+    {
+        saved0 = s0;
+        saved1 = s1;
+
+        _ARMV8_LOAD( m0, data );
+        _ARMV8_LOAD( m1, data + 16 );
+        _ARMV8_LOAD( m2, data + 32 );
+        _ARMV8_LOAD( m3, data + 48 );
+
+        _ARMV8_QROUND( s0, s1, m0, 0 );
+        _ARMV8_QROUND( s0, s1, m1, 4 );
+        _ARMV8_QROUND( s0, s1, m2, 8 );
+        _ARMV8_QROUND( s0, s1, m3, 12 );
+
+        for( i = 16; i < 64; i += 16 )
+        {
+            _ARMV8_SCHEDULE( m0, m1, m2, m3 );
+            _ARMV8_QROUND( s0, s1, m0, i );
+            _ARMV8_SCHEDULE( m1, m2, m3, m0 );
+            _ARMV8_QROUND( s0, s1, m1, i + 4 );
+            _ARMV8_SCHEDULE( m2, m3, m0, m1 );
+            _ARMV8_QROUND( s0, s1, m2, i + 8 );
+            _ARMV8_SCHEDULE( m3, m0, m1, m2 );
+            _ARMV8_QROUND( s0, s1, m3, i + 12 );
+        }
+
+        s0 = vaddq_u32( s0, saved0 );
+        s1 = vaddq_u32( s1, saved1 );
+
+        data += CRYPTOLIB_SHA256_BLOCK_SIZE;
+    }
+
+    vst1q_u32( &state[ 0 ], s0 );
+    vst1q_u32( &state[ 4 ], s1 );
+}
+
+RPRIVATE
+_ARMV8_TARGET
+RVOID
+    _blocksArmv8X2
+    (
+        RU32 stateA[ 8 ],
+        const RU8* dataA,
+        RU32 stateB[ 8 ],
+        const RU8* dataB,
+        RU32 nBlocks
+    )
+{
+    uint32x4_t a0, a1, savedA0, savedA1;
+    uint32x4_t b0, b1, savedB0, savedB1;
+    uint32x4_t am0, am1, am2, am3;
+    uint32x4_t bm0, bm1, bm2, bm3;
+    uint32x4_t prev, wk;
+    RU32 i = 0;
+
+    a0 = vld1q_u32( &stateA[ 0 ] );
+    a1 = vld1q_u32( &stateA[ 4 ] );
+    b0 = vld1q_u32( &stateB[ 0 ] );
+    b1 = vld1q_u32( &stateB[ 4 ] );
+
+    while( 0 != nBlocks-- )
+    {
+        savedA0 = a0;
+        savedA1 = a1;
+        savedB0 = b0;
+        savedB1 = b1;
+
+        _ARMV8_LOAD( am0, dataA );
+        _ARMV8_LOAD( bm0, dataB );
+        _ARMV8_LOAD( am1, dataA + 16 );
+        _ARMV8_LOAD( bm1, dataB + 16 );
+        _ARMV8_LOAD( am2, dataA + 32 );
+        _ARMV8_LOAD( bm2, dataB + 32 );
+        _ARMV8_LOAD( am3, dataA + 48 );
+        _ARMV8_LOAD( bm3, dataB + 48 );
+
+        _ARMV8_QROUND( a0, a1, am0, 0 );
+        _ARMV8_QROUND( b0, b1, bm0, 0 );
+        _ARMV8_QROUND( a0, a1, am1, 4 );
+        _ARMV8_QROUND( b0, b1, bm1, 4 );
+        _ARMV8_QROUND( a0, a1, am2, 8 );
+        _ARMV8_QROUND( b0, b1, bm2, 8 );
+        _ARMV8_QROUND( a0, a1, am3, 12 );
+        _ARMV8_QROUND( b0, b1, bm3, 12 );
+
+        for( i = 16; i < 64; i += 16 )
+        {
+            _ARMV8_SCHEDULE( am0, am1, am2, am3 );
+            _ARMV8_SCHEDULE( bm0, bm1, bm2, bm3 );
+            _ARMV8_QROUND( a0, a1, am0, i );
+            _ARMV8_QROUND( b0, b1, bm0, i );
+            _ARMV8_SCHEDULE( am1, am2, am3, am0 );
+            _ARMV8_SCHEDULE( bm1, bm2, bm3, bm0 );
+            _ARMV8_QROUND( a0, a1, am1, i + 4 );
+            _ARMV8_QROUND( b0, b1, bm1, i + 4 );
+            _ARMV8_SCHEDULE( am2, am3, am0, am1 );
+            _ARMV8_SCHEDULE( bm2, bm3, bm0, bm1 );
+            _ARMV8_QROUND( a0, a1, am2, i + 8 );
+            _ARMV8_QROUND( b0, b1, bm2, i + 8 );
+            _ARMV8_SCHEDULE( am3, am0, am1, am2 );
+            _ARMV8_SCHEDULE( bm3, bm0, bm1, bm2 );
+            _ARMV8_QROUND( a0, a1, am3, i + 12 );
+            _ARMV8_QROUND( b0, b1, bm3, i + 12 );
+        }
+
+        a0 = vaddq_u32( a0, savedA0 );
+        a1 = vaddq_u32( a1, savedA1 );
+        b0 = vaddq_u32( b0, savedB0 );
+        b1 = vaddq_u32( b1, savedB1 );
+
+        dataA += CRYPTOLIB_SHA256_BLOCK_SIZE;
+        dataB += CRYPTOLIB_SHA256_BLOCK_SIZE;
+    }
+
+    vst1q_u32( &stateA[ 0 ], a0 );
+    vst1q_u32( &stateA[ 4 ], a1 );
+    vst1q_u32( &stateB[ 0 ], b0 );
+    vst1q_u32( &stateB[ 4 ], b1 );
+}
+
+RPRIVATE
+RBOOL
+    _isArmv8Supported
+    (
+
+    )
+{
+#ifdef RPAL_PLATFORM_LINUX
+    return 0 != ( getauxval( AT_HWCAP ) & HWCAP_SHA2 );
+#else
+    // Every 64 bit ARM Mac has the crypto extensions.
+    return TRUE;
+#endif
+}
+#endif
+
+// Detection is lazy and racy by design: every thread reaches the same
+// answer and the generic kernel is always a valid choice in the meantime.
+RPRIVATE volatile RU32 g_impl = 0;
+RPRIVATE RBOOL g_isShaNiSupported = FALSE;
+RPRIVATE RBOOL g_isArmv8Supported = FALSE;
+RPRIVATE _Sha256Blocks g_blocks = _blocksGeneric;
+RPRIVATE _Sha256BlocksX2 g_blocksX2 = NULL;
+
+RPRIVATE
+RVOID
+    _selectImplementation
+    (
+        RU32 impl
+    )
+{
+    switch( impl )
+    {
+#ifdef _SHA256_HAS_SHANI
+        case CRYPTOLIB_SHA256_IMPL_SHANI:
+            g_blocks = _blocksShaNi;
+            g_blocksX2 = _blocksShaNiX2;
+            break;
+#endif
+#ifdef _SHA256_HAS_ARMV8
+        case CRYPTOLIB_SHA256_IMPL_ARMV8:
+            g_blocks = _blocksArmv8;
+            g_blocksX2 = _blocksArmv8X2;
+            break;
+#endif
+        default:
+            impl = CRYPTOLIB_SHA256_IMPL_GENERIC;
+            g_blocks = _blocksGeneric;
+            g_blocksX2 = NULL;
+            break;
+    }
+
+    g_impl = impl;
+}
+
+RPRIVATE
+RVOID
+    _detectImplementation
+    (
+
+    )
+{
+    RU32 impl = CRYPTOLIB_SHA256_IMPL_GENERIC;
+
+#ifdef _SHA256_HAS_SHANI
+    if( ( g_isShaNiSupported = _isShaNiSupported() ) )
+    {
+        impl = CRYPTOLIB_SHA256_IMPL_SHANI;
+    }
+#endif
+#ifdef _SHA256_HAS_ARMV8
+    if( ( g_isArmv8Supported = _isArmv8Supported() ) )
+    {
+        impl = CRYPTOLIB_SHA256_IMPL_ARMV8;
+    }
+#endif
+
+    _selectImplementation( impl );
+}
+
+#define _ENSURE_IMPLEMENTATION()    if( 0 == g_impl ){ _detectImplementation(); }
+
+// Pads the last partial block into one or two final blocks.
+RPRIVATE
+RU32
+    _padTail
+    (
+        RU8 tail[ CRYPTOLIB_SHA256_BLOCK_SIZE * 2 ],
+        const RU8* rest,
+        RU32 restSize,
+        RU64 totalSize
+    )
+{
+    RU32 nBlocks = 0;
+    RU32 end = 0;
+    RU64 nBits = totalSize << 3;
+    RU32 i = 0;
+
+    nBlocks = ( CRYPTOLIB_SHA256_BLOCK_SIZE >= restSize + 1 + sizeof( RU64 ) ) ? 1 : 2;
+    end = nBlocks * CRYPTOLIB_SHA256_BLOCK_SIZE;
+
+    if( 0 != restSize )
+    {
+        rpal_memory_memcpy( tail, (RPVOID)rest, restSize );
+    }
+    tail[ restSize ] = 0x80;
+    rpal_memory_zero( tail + restSize + 1, end - restSize - 1 - sizeof( RU64 ) );
+
+    for( i = 0; i < sizeof( RU64 ); i++ )
+    {
+        tail[ end - 1 - i ] = (RU8)( nBits >> ( 8 * i ) );
+    }
+
+    return nBlocks;
+}
+
+RPRIVATE
+RVOID
+    _stateToHash
+    (
+        RU32 state[ 8 ],
+        CryptoLib_Hash* pHash
+    )
+{
+    RU32 i = 0;
+
+    for( i = 0; i < 8; i++ )
+    {
+        pHash->_[ i * 4 ] = (RU8)( state[ i ] >> 24 );
+        pHash->_[ i * 4 + 1 ] = (RU8)( state[ i ] >> 16 );
+        pHash->_[ i * 4 + 2 ] = (RU8)( state[ i ] >> 8 );
+        pHash->_[ i * 4 + 3 ] = (RU8)( state[ i ] );
+    }
+}
+
+RVOID
+    CryptoLib_sha256Init
+    (
+        CryptoLib_Sha256Context* ctx
+    )
+{
+    _ENSURE_IMPLEMENTATION();
+
+    rpal_memory_memcpy( ctx->state, (RPVOID)g_initialState, sizeof( ctx->state ) );
+    ctx->total = 0;
+}
+
+RVOID
+    CryptoLib_sha256Update
+    (
+        CryptoLib_Sha256Context* ctx,
+        RPU8 buffer,
+        RU32 bufferSize
+    )
+{
+    RU32 used = (RU32)( ctx->total % CRYPTOLIB_SHA256_BLOCK_SIZE );
+    RU32 fill = 0;
+    RU32 nBlocks = 0;
+
+    ctx->total += bufferSize;
+
+    if( 0 != used )
+    {
+        fill = CRYPTOLIB_SHA256_BLOCK_SIZE - used;
+
+        if( bufferSize < fill )
+        {
+            rpal_memory_memcpy( ctx->buffer + used, buffer, bufferSize );
+            return;
+        }
+
+        rpal_memory_memcpy( ctx->buffer + used, buffer, fill );
+        g_blocks( ctx->state, ctx->buffer, 1 );
+        buffer += fill;
+        bufferSize -= fill;
+    }
+
+    // Full blocks are hashed straight from the caller's buffer.
+    if( 0 != ( nBlocks = bufferSize / CRYPTOLIB_SHA256_BLOCK_SIZE ) )
+    {
+        g_blocks( ctx->state, buffer, nBlocks );
+        buffer += nBlocks * CRYPTOLIB_SHA256_BLOCK_SIZE;
+        bufferSize -= nBlocks * CRYPTOLIB_SHA256_BLOCK_SIZE;
+    }
+
+    if( 0 != bufferSize )
+    {
+        rpal_memory_memcpy( ctx->buffer, buffer, bufferSize );
+    }
+}
+
+RVOID
+    CryptoLib_sha256Finish
+    (
+        CryptoLib_Sha256Context* ctx,
+        CryptoLib_Hash* pHash
+    )
+{
+    RU8 tail[ CRYPTOLIB_SHA256_BLOCK_SIZE * 2 ];
+    RU32 nBlocks = 0;
+
+    nBlocks = _padTail( tail,
+                        ctx->buffer,
+                        (RU32)( ctx->total % CRYPTOLIB_SHA256_BLOCK_SIZE ),
+                        ctx->total );
+    g_blocks( ctx->state, tail, nBlocks );
+
+    _stateToHash( ctx->state, pHash );
+}
+
+RPRIVATE
+RVOID
+    _initLane
+    (
+        _Sha256Lane* lane,
+        RPU8 buffer,
+        RU32 bufferSize
+    )
+{
+    rpal_memory_memcpy( lane->state, (RPVOID)g_initialState, sizeof( lane->state ) );
+    lane->data = buffer;
+    lane->nBlocks = bufferSize / CRYPTOLIB_SHA256_BLOCK_SIZE;
+    lane->nTailBlocks = _padTail( lane->tail,
+                                  buffer + ( lane->nBlocks * CRYPTOLIB_SHA256_BLOCK_SIZE ),
+                                  bufferSize % CRYPTOLIB_SHA256_BLOCK_SIZE,
+                                  bufferSize );
+
+    if( 0 == lane->nBlocks )
+    {
+        lane->data = lane->tail;
+        lane->nBlocks = lane->nTailBlocks;
+        lane->nTailBlocks = 0;
+    }
+}
+
+RPRIVATE
+RVOID
+    _advanceLane
+    (
+        _Sha256Lane* lane,
+        RU32 nBlocks
+    )
+{
+    lane->data += nBlocks * CRYPTOLIB_SHA256_BLOCK_SIZE;
+    lane->nBlocks -= nBlocks;
+
+    if( 0 == lane->nBlocks &&
+        0 != lane->nTailBlocks )
+    {
+        lane->data = lane->tail;
+        lane->nBlocks = lane->nTailBlocks;
+        lane->nTailBlocks = 0;
+    }
+}
+
+RVOID
+    CryptoLib_sha256Multi
+    (
+        RPU8* buffers,
+        RU32* bufferSizes,
+        RU32 nBuffers,
+        CryptoLib_Hash* pHashes
+    )
+{
+    _Sha256Lane lanes[ 2 ];
+    RU32 i = 0;
+    RU32 j = 0;
+    RU32 nLanes = 0;
+    RU32 nBlocks = 0;
+
+    _ENSURE_IMPLEMENTATION();
+
+    for( i = 0; i < nBuffers; i += nLanes )
+    {
+        nLanes = ( NULL != g_blocksX2 && i + 1 < nBuffers ) ? 2 : 1;
+
+        for( j = 0; j < nLanes; j++ )
+        {
+            _initLane( &lanes[ j ], buffers[ i + j ], bufferSizes[ i + j ] );
+        }
+
+        // Interleave for as long as both inputs have blocks left, the
+        // longer one is then finished on its own.
+        if( 2 == nLanes )
+        {
+            while( 0 != lanes[ 0 ].nBlocks &&
+                   0 != lanes[ 1 ].nBlocks )
+            {
+                nBlocks = MIN_OF( lanes[ 0 ].nBlocks, lanes[ 1 ].nBlocks );
+                g_blocksX2( lanes[ 0 ].state, lanes[ 0 ].data, lanes[ 1 ].state, lanes[ 1 ].data, nBlocks );
+                _advanceLane( &lanes[ 0 ], nBlocks );
+                _advanceLane( &lanes[ 1 ], nBlocks );
+            }
+        }
+
+        for( j = 0; j < nLanes; j++ )
+        {
+            while( 0 != lanes[ j ].nBlocks )
+            {
+                nBlocks = lanes[ j ].nBlocks;
+                g_blocks( lanes[ j ].state, lanes[ j ].data, nBlocks );
+                _advanceLane( &lanes[ j ], nBlocks );
+            }
+
+            _stateToHash( lanes[ j ].state, &pHashes[ i + j ] );
+        }
+    }
+}
+
+RU32
+    CryptoLib_sha256GetImplementation
+    (
+
+    )
+{
+    _ENSURE_IMPLEMENTATION();
+
+    return g_impl;
+}
+
+RBOOL
+    CryptoLib_sha256SetImplementation
+    (
+        RU32 impl
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    _ENSURE_IMPLEMENTATION();
+
+    if( CRYPTOLIB_SHA256_IMPL_GENERIC == impl ||
+        ( CRYPTOLIB_SHA256_IMPL_SHANI == impl && g_isShaNiSupported ) ||
+        ( CRYPTOLIB_SHA256_IMPL_ARMV8 == impl && g_isArmv8Supported ) )
+    {
+        _selectImplementation( impl );
+        isSuccess = TRUE;
+    }
+
+    return isSuccess;
+}
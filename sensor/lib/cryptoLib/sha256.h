@@ -0,0 +1,84 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _CRYPTO_LIB_SHA256_H
+#define _CRYPTO_LIB_SHA256_H
+
+#include <rpal/rpal.h>
+#include <cryptoLib/cryptoLib.h>
+
+//=============================================================================
+//  SHA-256 used by all the hashing in cryptoLib. The block function is picked
+//  at runtime: SHA-NI on x86, the SHA2 extensions on ARMv8 and portable C
+//  everywhere else.
+//=============================================================================
+#define CRYPTOLIB_SHA256_BLOCK_SIZE         64
+
+#define CRYPTOLIB_SHA256_IMPL_GENERIC       1
+#define CRYPTOLIB_SHA256_IMPL_SHANI         2
+#define CRYPTOLIB_SHA256_IMPL_ARMV8         3
+
+typedef struct
+{
+    RU32 state[ 8 ];
+    RU64 total;
+    RU8 buffer[ CRYPTOLIB_SHA256_BLOCK_SIZE ];
+} CryptoLib_Sha256Context;
+
+RVOID
+    CryptoLib_sha256Init
+    (
+        CryptoLib_Sha256Context* ctx
+    );
+
+RVOID
+    CryptoLib_sha256Update
+    (
+        CryptoLib_Sha256Context* ctx,
+        RPU8 buffer,
+        RU32 bufferSize
+    );
+
+RVOID
+    CryptoLib_sha256Finish
+    (
+        CryptoLib_Sha256Context* ctx,
+        CryptoLib_Hash* pHash
+    );
+
+RVOID
+    CryptoLib_sha256Multi
+    (
+        RPU8* buffers,
+        RU32* bufferSizes,
+        RU32 nBuffers,
+        CryptoLib_Hash* pHashes
+    );
+
+RU32
+    CryptoLib_sha256GetImplementation
+    (
+
+    );
+
+// Only meant for tests and benchmarks, fails if the CPU does not support it.
+RBOOL
+    CryptoLib_sha256SetImplementation
+    (
+        RU32 impl
+    );
+
+#endif
@@ -1399,7 +1399,7 @@ RU8
     RFLOAT pr = 0;
     RTIME curTime = 0;
 
-    curTime = rpal_time_getLocal();
+    curTime = SEC_FROM_NSEC( rpal_time_getMonotonicCoarseNs() );
     if( curTime < ctx->lastCheckTime + 1 )
     {
         percent = ctx->lastResult;
@@ -1450,8 +1450,7 @@ RVOID
     
     if( NULL != perfProfile )
     {
-        rpal_time_getCPU( &currentTime );
-        currentTime = SEC_FROM_MSEC( currentTime / NSEC_100_PER_MSEC );
+        currentTime = SEC_FROM_NSEC( rpal_time_getMonotonicCoarseNs() );
 
         if( 0 == perfProfile->lastUpdate ) perfProfile->lastUpdate = currentTime;
         if( 0 == perfProfile->lastSummary ) perfProfile->lastSummary = currentTime;
@@ -1459,17 +1458,6 @@ RVOID
         if( !isEnforce &&
             currentTime >= perfProfile->lastUpdate + 1 )
         {
-            // We look for time aberrations where the clock has changed by a large amount
-            // which may be due to some form of hibernation or rollover. We try to use a 
-            // realtime clock but for some reason sometimes it fails.
-            if( currentTime < perfProfile->lastUpdate )
-            {
-                // Let's not try to calculate the actual value, cut our losses and assume
-                // things haven't changed much.
-                perfProfile->lastUpdate = currentTime;
-                return;
-            }
-
             increment = (RU32)( perfProfile->timeoutIncrementPerSec * ( currentTime - perfProfile->lastUpdate ) );
             perfProfile->lastUpdate = currentTime;
             currentPerformance = libOs_getCurrentThreadCpuUsage( &perfProfile->threadTimeContext );
@@ -1689,10 +1677,10 @@ RU8
 
     if( 0 == lastCheckTime )
     {
-        lastCheckTime = rpal_time_getLocal();
+        lastCheckTime = SEC_FROM_NSEC( rpal_time_getMonotonicCoarseNs() );
     }
 
-    curTime = rpal_time_getLocal();
+    curTime = SEC_FROM_NSEC( rpal_time_getMonotonicCoarseNs() );
     if( curTime < lastCheckTime + 3 )
     {
         percent = lastResult;
@@ -21,6 +21,8 @@ limitations under the License.
 
 #ifdef RPAL_PLATFORM_WINDOWS
 #pragma warning( disable: 4127 ) // Disabling error on constant expression in condition
+#else
+#include <pthread.h>
 #endif
 
 //=============================================================================
@@ -29,6 +31,31 @@ limitations under the License.
 #define RPCM_IPV6_SIZE  16
 #define RPCM_MAX_FETCH_PATH_SIZE    10
 
+// Transient sets start with a buffer large enough for most events so that
+// building one does not realloc on every element.
+#define _TRANSIENT_CHUNK_SIZE       ( 64 * 1024 )
+#define _TRANSIENT_SET_SIZE         128
+
+//=============================================================================
+//  Transient Construction State
+//=============================================================================
+typedef struct _TransientState
+{
+    rMemoryArena arena;
+    RU32 depth;
+    struct _TransientState* prev;
+    struct _TransientState* next;
+} _TransientState;
+
+static rMutex g_transientMutex = NULL;
+static _TransientState* g_transientStates = NULL;
+#ifdef RPAL_PLATFORM_WINDOWS
+static DWORD g_transientTls = TLS_OUT_OF_INDEXES;
+#else
+static pthread_key_t g_transientTls = 0;
+static RBOOL g_isTransientTlsCreated = FALSE;
+#endif
+
 //=============================================================================
 //  Private Prototypes
 //=============================================================================
@@ -334,6 +361,7 @@ RBOOL
     initSet
     (
         _PElementSet set,
+        rMemoryArena arena,
 		RU32 from
     )
 {
@@ -343,7 +371,14 @@ RBOOL
     {
         set->nElements = 0;
         set->tag = RPCM_INVALID_TAG;
-        set->blob = rpal_blob_create_from( 0, 0, from );
+        if( NULL != arena )
+        {
+            set->blob = rpal_blob_createInArena_from( arena, _TRANSIENT_SET_SIZE, 0, from );
+        }
+        else
+        {
+            set->blob = rpal_blob_create_from( 0, 0, from );
+        }
         set->isReadTainted = FALSE;
 
         if( rpal_memory_isValid( set->blob ) )
@@ -955,7 +990,9 @@ RBOOL
             }
             else if( isElemVariable( header ) &&
                      IS_WITHIN_BOUNDS( header, sizeof( _ElemVarHeader ), buffer, bufferSize ) &&
-                     IS_WITHIN_BOUNDS( ( (_PElemVarHeader)header )->data, rpal_ntoh32( ( (_PElemVarHeader)header )->size ), buffer, bufferSize ) )
+                     // Bound the whole element and not just the data, empty data
+                     // ends the buffer without starting within it.
+                     IS_WITHIN_BOUNDS( header, (RU64)sizeof( _ElemVarHeader ) + rpal_ntoh32( ( (_PElemVarHeader)header )->size ), buffer, bufferSize ) )
             {
                 varHeader = (_PElemVarHeader)header;
 
@@ -1953,3 +1990,218 @@ rpcm_elem_record
 
     return resElem;
 }
+
+
+//=============================================================================
+//  Transient Construction
+//=============================================================================
+static RVOID
+    _freeTransientState
+    (
+        RPVOID state
+    )
+{
+    _TransientState* pState = (_TransientState*)state;
+
+    if( NULL == pState ||
+        !rMutex_lock( g_transientMutex ) )
+    {
+        return;
+    }
+
+    if( NULL != pState->prev )
+    {
+        pState->prev->next = pState->next;
+    }
+    else
+    {
+        g_transientStates = pState->next;
+    }
+    if( NULL != pState->next )
+    {
+        pState->next->prev = pState->prev;
+    }
+
+    rMutex_unlock( g_transientMutex );
+
+    rpal_memory_arena_free( pState->arena );
+    rpal_memory_free( pState );
+}
+
+static _TransientState*
+    _getTransientState
+    (
+        RBOOL isCreate
+    )
+{
+    _TransientState* pState = NULL;
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    if( TLS_OUT_OF_INDEXES == g_transientTls )
+    {
+        return NULL;
+    }
+    pState = TlsGetValue( g_transientTls );
+#else
+    if( !g_isTransientTlsCreated )
+    {
+        return NULL;
+    }
+    pState = pthread_getspecific( g_transientTls );
+#endif
+
+    if( NULL != pState ||
+        !isCreate )
+    {
+        return pState;
+    }
+
+    if( NULL != ( pState = rpal_memory_alloc( sizeof( *pState ) ) ) )
+    {
+        pState->depth = 0;
+        pState->prev = NULL;
+
+        if( NULL == ( pState->arena = rpal_memory_arena_create( _TRANSIENT_CHUNK_SIZE ) ) ||
+            !rMutex_lock( g_transientMutex ) )
+        {
+            rpal_memory_arena_free( pState->arena );
+            rpal_memory_free( pState );
+            return NULL;
+        }
+
+        pState->next = g_transientStates;
+        if( NULL != g_transientStates )
+        {
+            g_transientStates->prev = pState;
+        }
+        g_transientStates = pState;
+
+        rMutex_unlock( g_transientMutex );
+
+#ifdef RPAL_PLATFORM_WINDOWS
+        if( !TlsSetValue( g_transientTls, pState ) )
+#else
+        if( 0 != pthread_setspecific( g_transientTls, pState ) )
+#endif
+        {
+            _freeTransientState( pState );
+            pState = NULL;
+        }
+    }
+
+    return pState;
+}
+
+rMemoryArena
+    getTransientArena
+    (
+
+    )
+{
+    _TransientState* pState = NULL;
+
+    if( NULL != ( pState = _getTransientState( FALSE ) ) &&
+        0 != pState->depth )
+    {
+        return pState->arena;
+    }
+
+    return NULL;
+}
+
+RBOOL
+    rpcm_transient_init
+    (
+
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    if( NULL != g_transientMutex )
+    {
+        return TRUE;
+    }
+
+    if( NULL != ( g_transientMutex = rMutex_create() ) )
+    {
+#ifdef RPAL_PLATFORM_WINDOWS
+        isSuccess = ( TLS_OUT_OF_INDEXES != ( g_transientTls = TlsAlloc() ) );
+#else
+        // Threads exiting give their arena back, the rest are freed on deinit.
+        isSuccess = g_isTransientTlsCreated = ( 0 == pthread_key_create( &g_transientTls, _freeTransientState ) );
+#endif
+        if( !isSuccess )
+        {
+            rMutex_free( g_transientMutex );
+            g_transientMutex = NULL;
+        }
+    }
+
+    return isSuccess;
+}
+
+RVOID
+    rpcm_transient_deinit
+    (
+
+    )
+{
+    _TransientState* pState = NULL;
+
+    if( rMutex_lock( g_transientMutex ) )
+    {
+#ifdef RPAL_PLATFORM_WINDOWS
+        if( TLS_OUT_OF_INDEXES != g_transientTls )
+        {
+            TlsFree( g_transientTls );
+            g_transientTls = TLS_OUT_OF_INDEXES;
+        }
+#else
+        if( g_isTransientTlsCreated )
+        {
+            pthread_key_delete( g_transientTls );
+            g_isTransientTlsCreated = FALSE;
+        }
+#endif
+        // Sets still alive keep their own chunks.
+        while( NULL != ( pState = g_transientStates ) )
+        {
+            g_transientStates = pState->next;
+            rpal_memory_arena_free( pState->arena );
+            rpal_memory_free( pState );
+        }
+
+        rMutex_free( g_transientMutex );
+        g_transientMutex = NULL;
+    }
+}
+
+RVOID
+    rpcm_transient_begin
+    (
+
+    )
+{
+    _TransientState* pState = NULL;
+
+    if( NULL != ( pState = _getTransientState( TRUE ) ) )
+    {
+        pState->depth++;
+    }
+}
+
+RVOID
+    rpcm_transient_end
+    (
+
+    )
+{
+    _TransientState* pState = NULL;
+
+    if( NULL != ( pState = _getTransientState( FALSE ) ) &&
+        0 != pState->depth &&
+        0 == --pState->depth )
+    {
+        rpal_memory_arena_reset( pState->arena );
+    }
+}
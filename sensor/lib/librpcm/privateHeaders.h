@@ -166,9 +166,16 @@ RBOOL
     initSet
     (
         _PElementSet set,
+        rMemoryArena arena,
 		RU32 from
     );
 
+rMemoryArena
+    getTransientArena
+    (
+
+    );
+
 RBOOL
     freeSet
     (
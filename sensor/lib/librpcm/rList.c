@@ -29,12 +29,20 @@ rList
     )
 {
     _rList* list = NULL;
+    rMemoryArena arena = getTransientArena();
 
-    list = rpal_memory_alloc_from( sizeof( _rList ), from );
+    if( NULL != arena )
+    {
+        list = rpal_memory_arena_alloc_from( arena, sizeof( _rList ), from );
+    }
+    else
+    {
+        list = rpal_memory_alloc_from( sizeof( _rList ), from );
+    }
 
     if( rpal_memory_isValid( list ) )
     {
-        if( !initSet( &(list->set), from ) )
+        if( !initSet( &(list->set), arena, from ) )
         {
             rpal_memory_free( list );
             list = NULL;
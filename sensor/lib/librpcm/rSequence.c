@@ -27,12 +27,20 @@ rSequence
     )
 {
     _rSequence* seq = NULL;
+    rMemoryArena arena = getTransientArena();
 
-    seq = rpal_memory_alloc_from( sizeof( _rSequence ), from );
+    if( NULL != arena )
+    {
+        seq = rpal_memory_arena_alloc_from( arena, sizeof( _rSequence ), from );
+    }
+    else
+    {
+        seq = rpal_memory_alloc_from( sizeof( _rSequence ), from );
+    }
 
     if( rpal_memory_isValid( seq ) )
     {
-        if( !initSet( &(seq->set), from ) )
+        if( !initSet( &(seq->set), arena, from ) )
         {
             rpal_memory_free( seq );
             seq = NULL;
@@ -331,7 +331,7 @@ NetLibTcpConnection
     fd_set sockets;
     struct timeval timeout = { 1, 0 };
     int waitVal = 0;
-    RTIME expire = 0;
+    RU64 expire = 0;
     int n = 0;
 
     if( 0 != conn &&
@@ -339,11 +339,11 @@ NetLibTcpConnection
     {
         if( 0 != timeoutSec )
         {
-            expire = rpal_time_getLocal() + timeoutSec;
+            expire = rpal_time_getMonotonicCoarseNs() + NSEC_FROM_SEC( timeoutSec );
         }
 
         while( !rEvent_wait( stopEvent, 0 ) &&
-              ( 0 == timeoutSec || rpal_time_getLocal() <= expire ) )
+              ( 0 == timeoutSec || rpal_time_getMonotonicCoarseNs() <= expire ) )
         {
             FD_ZERO( &sockets );
             FD_SET( conn, &sockets );
@@ -473,7 +473,7 @@ RBOOL
     fd_set sockets;
     struct timeval timeout = { 1, 0 };
     int waitVal = 0;
-    RTIME expire = 0;
+    RU64 expire = 0;
     int n = 0;
 
     if( 0 != conn &&
@@ -484,12 +484,12 @@ RBOOL
 
         if( 0 != timeoutSec )
         {
-            expire = rpal_time_getLocal() + timeoutSec;
+            expire = rpal_time_getMonotonicCoarseNs() + NSEC_FROM_SEC( timeoutSec );
         }
 
         while( nReceived < bufferSize && 
                !rEvent_wait( stopEvent, 0 ) && 
-               ( 0 == timeoutSec || rpal_time_getLocal() <= expire ) )
+               ( 0 == timeoutSec || rpal_time_getMonotonicCoarseNs() <= expire ) )
         {
             FD_ZERO( &sockets );
             FD_SET( conn, &sockets );
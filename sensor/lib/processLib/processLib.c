@@ -39,6 +39,10 @@ static pfnNtQueryInformationFile queryFile = NULL;
 #include <sys/types.h>
 #include <unistd.h>
 #include <pwd.h>
+    #if defined( RPAL_PLATFORM_LINUX )
+        #include <fcntl.h>
+        #include <dirent.h>
+    #endif
     #if defined( RPAL_PLATFORM_MACOSX )
         #include <sys/sysctl.h>
         #include <libproc.h>
@@ -50,6 +54,58 @@ static pfnNtQueryInformationFile queryFile = NULL;
 #endif
 
 
+#ifdef RPAL_PLATFORM_LINUX
+static
+RBOOL
+    _getLinuxStartTime
+    (
+        RU32 pid,
+        RU64* pStartTime
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RCHAR statPath[ 32 ] = {0};
+    RCHAR statBuff[ 1024 ] = {0};
+    RPCHAR pField = NULL;
+    RS32 fd = (-1);
+    RS32 nRead = 0;
+    RU32 fieldIndex = 2;
+
+    rpal_string_snprintf( statPath, sizeof( statPath ), "/proc/%u/stat", pid );
+
+    if( 0 <= ( fd = open( statPath, O_RDONLY | O_CLOEXEC ) ) )
+    {
+        if( 0 < ( nRead = (RS32)read( fd, statBuff, sizeof( statBuff ) - 1 ) ) )
+        {
+            statBuff[ nRead ] = 0;
+
+            // The command name can contain spaces and parenthesis, so fields
+            // are counted from the last closing parenthesis.
+            if( NULL != ( pField = strrchr( statBuff, ')' ) ) )
+            {
+                while( NULL != ( pField = strchr( pField, ' ' ) ) )
+                {
+                    pField++;
+                    fieldIndex++;
+
+                    // Field 22 is the start time in clock ticks since boot.
+                    if( 22 == fieldIndex )
+                    {
+                        *pStartTime = strtoull( pField, NULL, 10 );
+                        isSuccess = TRUE;
+                        break;
+                    }
+                }
+            }
+        }
+
+        close( fd );
+    }
+
+    return isSuccess;
+}
+#endif
+
 RBOOL
     processLib_isPidInUse
     (
@@ -128,6 +184,59 @@ RBOOL
     return isInUse;
 }
 
+RBOOL
+    processLib_getProcessStartTime
+    (
+        RU32 pid,
+        RU64* pStartTime
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    if( NULL == pStartTime )
+    {
+        return FALSE;
+    }
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    HANDLE hProcess = NULL;
+    FILETIME creationTime = { 0 };
+    FILETIME exitTime = { 0 };
+    FILETIME kernelTime = { 0 };
+    FILETIME userTime = { 0 };
+
+    if( NULL != ( hProcess = OpenProcess( PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid ) ) )
+    {
+        if( GetProcessTimes( hProcess, &creationTime, &exitTime, &kernelTime, &userTime ) )
+        {
+            *pStartTime = ( (RU64)creationTime.dwHighDateTime << 32 ) | creationTime.dwLowDateTime;
+            isSuccess = TRUE;
+        }
+
+        CloseHandle( hProcess );
+    }
+#elif defined( RPAL_PLATFORM_LINUX )
+    isSuccess = _getLinuxStartTime( pid, pStartTime );
+#elif defined( RPAL_PLATFORM_MACOSX )
+    int mib[] = { CTL_KERN, KERN_PROC, KERN_PROC_PID, 0 };
+    struct kinfo_proc info = {0};
+    size_t size = sizeof( info );
+
+    mib[ 3 ] = pid;
+
+    if( 0 == sysctl( mib, ARRAY_N_ELEM( mib ), &info, &size, NULL, 0 ) &&
+        0 != size )
+    {
+        *pStartTime = ( (RU64)info.kp_proc.p_starttime.tv_sec * 1000000 ) + info.kp_proc.p_starttime.tv_usec;
+        isSuccess = TRUE;
+    }
+#else
+    rpal_debug_not_implemented();
+#endif
+
+    return isSuccess;
+}
+
 rSequence
     processLib_getProcessInfo
     (
@@ -1808,128 +1917,516 @@ static POBJECT_NAME_INFORMATION
 }
 #endif
 
-rList
-    processLib_getHandles
+#ifdef RPAL_PLATFORM_LINUX
+typedef struct
+{
+    RU32 fd;
+    rSequence record;
+
+} _fdRecord;
+
+typedef struct
+{
+    RU32 pid;
+    RU64 startTime;
+    RU32 generation;
+    RU32 nFds;
+    _fdRecord* fds;
+
+} _pidHandles;
+#endif
+
+typedef struct
+{
+#ifdef RPAL_PLATFORM_LINUX
+    rBTree pids;
+    RU32 generation;
+#endif
+    RU32 unused;
+
+} _processLibHandleCache;
+
+#ifdef RPAL_PLATFORM_LINUX
+static
+RVOID
+    _freePidHandles
     (
-        RU32 processId,
-        RBOOL isOnlyReturnNamed,
-        RPNCHAR optSubstring
+        _pidHandles* pEntry
     )
 {
-    rList handles = NULL;
-    rSequence handle = NULL;
+    RU32 i = 0;
 
-#ifdef RPAL_PLATFORM_WINDOWS
-    RWCHAR api_ntdll[] = _WCH("ntdll.dll");
-    RCHAR api_querysysinfo[] = "NtQuerySystemInformation";
-    RCHAR api_queryobj[] = "NtQueryObject";
-    RCHAR api_queryfile[] = "NtQueryInformationFile";
-    RWCHAR strFile[] = _WCH("File");
+    if( NULL != pEntry )
+    {
+        for( i = 0; i < pEntry->nFds; i++ )
+        {
+            rSequence_free( pEntry->fds[ i ].record );
+        }
 
-    HANDLE hSelf = NULL;
-    HANDLE hProcess = NULL;
-    PSYSTEM_HANDLE_INFORMATION pSysHandleInfo = NULL;
-    RU32 size = 0;
-    RU32 i = 0;
-    HANDLE hDupe = NULL;
-    POBJECT_NAME_INFORMATION pObjName = NULL;
-    POBJECT_TYPE_INFORMATION pObjType = NULL;
-    RU32 lastError = 0;
-    RBOOL isBlockable = FALSE;
-    RBOOL isFileHackSupported = FALSE;
-    RBOOL gotMinInfo = FALSE;
-    RU32 tmpSize = 1024;
+        rpal_memory_free( pEntry->fds );
+        pEntry->fds = NULL;
+        pEntry->nFds = 0;
+    }
+}
 
-    if( NULL == querySysInfo )
+static
+RVOID
+    _addLinuxFdInfo
+    (
+        RS32 fdInfoDirFd,
+        RPCHAR fdName,
+        rSequence record
+    )
+{
+    RCHAR infoBuff[ 512 ] = {0};
+    RPCHAR pLine = NULL;
+    RS32 fd = (-1);
+    RS32 nRead = 0;
+
+    if( 0 <= fdInfoDirFd &&
+        0 <= ( fd = openat( fdInfoDirFd, fdName, O_RDONLY | O_CLOEXEC ) ) )
     {
-        // This must be the first call so we will init the import
-        querySysInfo = (pfnNtQuerySystemInformation)GetProcAddress( LoadLibraryW( api_ntdll ), api_querysysinfo );
+        if( 0 < ( nRead = (RS32)read( fd, infoBuff, sizeof( infoBuff ) - 1 ) ) )
+        {
+            infoBuff[ nRead ] = 0;
+
+            if( NULL != ( pLine = strstr( infoBuff, "pos:" ) ) )
+            {
+                rSequence_addRU64( record, RP_TAGS_HANDLE_POSITION, strtoull( pLine + 4, NULL, 10 ) );
+            }
+
+            // Flags are reported in octal, like the open() constants.
+            if( NULL != ( pLine = strstr( infoBuff, "flags:" ) ) )
+            {
+                rSequence_addRU32( record, RP_TAGS_HANDLE_FLAGS, (RU32)strtoul( pLine + 6, NULL, 8 ) );
+            }
+        }
+
+        close( fd );
     }
+}
 
-    if( NULL == queryObj )
+static
+rSequence
+    _newLinuxHandleRecord
+    (
+        RS32 fdDirFd,
+        RPCHAR fdName,
+        RU32 pid,
+        RU32 fd
+    )
+{
+    rSequence record = NULL;
+    RCHAR target[ RPAL_MAX_PATH ] = {0};
+    RS32 size = 0;
+    RPCHAR type = "Other";
+    RPCHAR pInode = NULL;
+
+    if( 0 < ( size = (RS32)readlinkat( fdDirFd, fdName, target, sizeof( target ) - 1 ) ) )
     {
-        // This must be the first call so we will init the import
-        queryObj = (pfnNtQueryObject)GetProcAddress( LoadLibraryW( api_ntdll ), api_queryobj );
+        target[ size ] = 0;
+
+        // Non-file descriptors are named like "socket:[1234]" where the
+        // number is the inode, which is what ties them to /proc/net entries.
+        if( '/' == target[ 0 ] )
+        {
+            type = "File";
+        }
+        else if( 0 == rpal_memory_memcmp( target, "socket:[", 8 ) )
+        {
+            type = "Socket";
+            pInode = target + 8;
+        }
+        else if( 0 == rpal_memory_memcmp( target, "pipe:[", 6 ) )
+        {
+            type = "Pipe";
+            pInode = target + 6;
+        }
+        else if( 0 == rpal_memory_memcmp( target, "anon_inode:", 11 ) )
+        {
+            type = "AnonInode";
+        }
+
+        if( NULL != ( record = rSequence_new() ) )
+        {
+            if( !rSequence_addRU32( record, RP_TAGS_HANDLE_VALUE, fd ) ||
+                !rSequence_addRU32( record, RP_TAGS_PROCESS_ID, pid ) ||
+                !rSequence_addSTRINGA( record, RP_TAGS_HANDLE_TYPE, type ) ||
+                !rSequence_addSTRINGA( record, RP_TAGS_HANDLE_NAME, target ) ||
+                ( NULL != pInode &&
+                  !rSequence_addRU64( record, RP_TAGS_HANDLE_INODE, strtoull( pInode, NULL, 10 ) ) ) )
+            {
+                rSequence_free( record );
+                record = NULL;
+            }
+        }
     }
 
-    if( NULL == queryFile )
+    return record;
+}
+
+static
+RBOOL
+    _getLinuxHandles
+    (
+        RU32 pid,
+        RBOOL isOnlyReturnNamed,
+        RPNCHAR optSubstring,
+        RU32 flags,
+        _processLibHandleCache* pCache,
+        rList handles
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RCHAR dirPath[ 32 ] = {0};
+    DIR* fdDir = NULL;
+    RS32 fdInfoDirFd = (-1);
+    struct dirent* pEntry = NULL;
+    _pidHandles cached = {0};
+    _pidHandles current = {0};
+    RU32 allocated = 0;
+    RU32 fd = 0;
+    RU32 iCached = 0;
+    RU32 i = 0;
+    _fdRecord* pTmp = NULL;
+    rSequence record = NULL;
+    RPCHAR name = NULL;
+    RU32 selfPid = (RU32)getpid();
+
+    // Every fd resolves to a name, a path or a pseudo name like
+    // "socket:[1234]", an fd whose link can't be read was closed while we
+    // listed it and is skipped. So all handles are named either way.
+    UNREFERENCED_PARAMETER( isOnlyReturnNamed );
+
+    rpal_string_snprintf( dirPath, sizeof( dirPath ), "/proc/%u/fd", pid );
+
+    if( NULL == ( fdDir = opendir( dirPath ) ) )
     {
-        // This must be the first call so we will init the import
-        queryFile = (pfnNtQueryInformationFile)GetProcAddress( LoadLibraryW( api_ntdll ), api_queryfile );
+        return FALSE;
     }
 
-    if( OSLIB_VERSION_WINDOWS_2K3 < libOs_getOsVersion() )
+    current.pid = pid;
+
+    if( NULL != pCache )
     {
-        isFileHackSupported = TRUE;
+        _getLinuxStartTime( pid, &current.startTime );
+
+        if( rpal_btree_remove( pCache->pids, &pid, &cached, TRUE ) &&
+            cached.startTime != current.startTime )
+        {
+            // Same pid but a different process, nothing can be reused.
+            _freePidHandles( &cached );
+        }
     }
 
-    if( NULL != querySysInfo &&
-        NULL != queryObj &&
-        NULL != ( hSelf = OpenProcess( PROCESS_DUP_HANDLE, FALSE, GetCurrentProcessId() ) ) )
+    // Only the numbers are needed up front, they come back in order but
+    // sorting keeps the merge with the cached entries correct regardless.
+    while( NULL != ( pEntry = readdir( fdDir ) ) )
     {
-        if( NULL != ( handles = rList_new( RP_TAGS_HANDLE_INFO, RPCM_SEQUENCE ) ) )
+        // Skip the fd of the listing itself when looking at ourselves.
+        if( !rpal_string_stoi( pEntry->d_name, &fd ) ||
+            ( selfPid == pid &&
+              fd == (RU32)dirfd( fdDir ) ) )
         {
-            while( STATUS_INFO_LENGTH_MISMATCH == querySysInfo( SystemHandleInformation, pSysHandleInfo, size, (PULONG)&size ) )
-            {
-                // On XP the correct size is not actually returned, just 0, so we have to guess and brute force.
-                if( 0 == size )
-                {
-                    size = tmpSize;
-                    tmpSize *= 2;
-                }
+            continue;
+        }
 
-                if( NULL == ( pSysHandleInfo = rpal_memory_realloc( pSysHandleInfo, size ) ) )
-                {
-                    break;
-                }
+        if( current.nFds == allocated )
+        {
+            allocated = ( 0 == allocated ) ? 64 : allocated * 2;
+            if( NULL == ( pTmp = rpal_memory_realloc( current.fds, allocated * sizeof( _fdRecord ) ) ) )
+            {
+                break;
             }
+            current.fds = pTmp;
+        }
 
-            if( NULL != pSysHandleInfo )
-            {
-                for( i = 0; i < pSysHandleInfo->NumberOfHandles; i++ )
-                {
-                    if( 0 != processId &&
-                        pSysHandleInfo->Handles[ i ].UniqueProcessId != processId )
-                    {
-                        continue;
-                    }
+        current.fds[ current.nFds ].fd = fd;
+        current.fds[ current.nFds ].record = NULL;
+        current.nFds++;
+    }
 
-                    isBlockable = FALSE;
+    if( NULL != current.fds )
+    {
+        rpal_sort_array( current.fds, current.nFds, sizeof( _fdRecord ), (rpal_ordering_func)rpal_order_RU32 );
+    }
 
-                    // For now we do this the dumb way, which is to reopen
-                    // each process on every handle.
-                    if( NULL != ( hProcess = OpenProcess( PROCESS_DUP_HANDLE, 
-                                                          FALSE, 
-                                                          pSysHandleInfo->Handles[ i ].UniqueProcessId ) ) )
-                    {
-                        if( DuplicateHandle( hProcess, 
-                                             (HANDLE)pSysHandleInfo->Handles[ i ].HandleValue, 
-                                             hSelf, 
-                                             &hDupe, 
-                                             0, 
-                                             FALSE, 
-                                             DUPLICATE_SAME_ACCESS ) )
-                        {
-                            if( NULL != ( handle = rSequence_new() ) )
-                            {
-                                size = 0;
-                                pObjType = NULL;
-                                gotMinInfo = FALSE;
+    if( IS_FLAG_ENABLED( flags, PROCESSLIB_HANDLES_WITH_FDINFO ) )
+    {
+        rpal_string_snprintf( dirPath, sizeof( dirPath ), "/proc/%u/fdinfo", pid );
+        fdInfoDirFd = open( dirPath, O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+    }
 
-                                while( STATUS_INFO_LENGTH_MISMATCH == ( lastError = queryObj( hDupe, 
-                                                                                              ObjectTypeInformation, 
-                                                                                              pObjType, 
-                                                                                              size, 
-                                                                                              (PULONG)&size ) ) )
-                                {
-                                    if( NULL == ( pObjType = rpal_memory_realloc( pObjType, size ) ) )
-                                    {
-                                        break;
-                                    }
-                                }
+    isSuccess = TRUE;
 
-                                if( NULL != pObjType )
-                                {
+    for( i = 0; i < current.nFds; i++ )
+    {
+        // Both lists are sorted so the records of fds that are still open
+        // are moved over and only the new fds get resolved.
+        while( iCached < cached.nFds &&
+               cached.fds[ iCached ].fd < current.fds[ i ].fd )
+        {
+            rSequence_free( cached.fds[ iCached ].record );
+            cached.fds[ iCached ].record = NULL;
+            iCached++;
+        }
+
+        if( iCached < cached.nFds &&
+            cached.fds[ iCached ].fd == current.fds[ i ].fd )
+        {
+            current.fds[ i ].record = cached.fds[ iCached ].record;
+            cached.fds[ iCached ].record = NULL;
+            iCached++;
+        }
+        else
+        {
+            rpal_string_snprintf( dirPath, sizeof( dirPath ), "%u", current.fds[ i ].fd );
+            current.fds[ i ].record = _newLinuxHandleRecord( dirfd( fdDir ), dirPath, pid, current.fds[ i ].fd );
+        }
+
+        if( NULL == current.fds[ i ].record ||
+            ( NULL != optSubstring &&
+              ( !rSequence_getSTRINGA( current.fds[ i ].record, RP_TAGS_HANDLE_NAME, &name ) ||
+                NULL == rpal_string_strstr( name, optSubstring ) ) ) )
+        {
+            continue;
+        }
+
+        // The cache keeps its own copy, the position and flags change
+        // without the fd changing so they are never cached.
+        if( NULL != pCache ||
+            0 <= fdInfoDirFd )
+        {
+            record = rSequence_duplicate( current.fds[ i ].record );
+        }
+        else
+        {
+            record = current.fds[ i ].record;
+            current.fds[ i ].record = NULL;
+        }
+
+        if( NULL != record )
+        {
+            if( 0 <= fdInfoDirFd )
+            {
+                rpal_string_snprintf( dirPath, sizeof( dirPath ), "%u", current.fds[ i ].fd );
+                _addLinuxFdInfo( fdInfoDirFd, dirPath, record );
+            }
+
+            if( !rList_addSEQUENCE( handles, record ) )
+            {
+                rSequence_free( record );
+            }
+        }
+    }
+
+    if( 0 <= fdInfoDirFd )
+    {
+        close( fdInfoDirFd );
+    }
+
+    closedir( fdDir );
+
+    _freePidHandles( &cached );
+
+    if( NULL != pCache )
+    {
+        current.generation = pCache->generation;
+        if( !rpal_btree_add( pCache->pids, &current, TRUE ) )
+        {
+            _freePidHandles( &current );
+        }
+    }
+    else
+    {
+        _freePidHandles( &current );
+    }
+
+    return isSuccess;
+}
+#endif
+
+processLibHandleCache
+    processLib_newHandleCache
+    (
+
+    )
+{
+    _processLibHandleCache* pCache = NULL;
+
+    if( NULL != ( pCache = rpal_memory_alloc( sizeof( *pCache ) ) ) )
+    {
+        rpal_memory_zero( pCache, sizeof( *pCache ) );
+
+#ifdef RPAL_PLATFORM_LINUX
+        if( NULL == ( pCache->pids = rpal_btree_create( sizeof( _pidHandles ), 
+                                                        (rpal_btree_comp_f)rpal_order_RU32, 
+                                                        (rpal_btree_free_f)_freePidHandles ) ) )
+        {
+            rpal_memory_free( pCache );
+            pCache = NULL;
+        }
+#endif
+    }
+
+    return pCache;
+}
+
+RVOID
+    processLib_freeHandleCache
+    (
+        processLibHandleCache cache
+    )
+{
+    _processLibHandleCache* pCache = (_processLibHandleCache*)cache;
+
+    if( NULL != pCache )
+    {
+#ifdef RPAL_PLATFORM_LINUX
+        rpal_btree_destroy( pCache->pids, FALSE );
+#endif
+        rpal_memory_free( pCache );
+    }
+}
+
+rList
+    processLib_getHandles
+    (
+        RU32 processId,
+        RBOOL isOnlyReturnNamed,
+        RPNCHAR optSubstring
+    )
+{
+    return processLib_getHandlesEx( processId, isOnlyReturnNamed, optSubstring, 0, NULL );
+}
+
+rList
+    processLib_getHandlesEx
+    (
+        RU32 processId,
+        RBOOL isOnlyReturnNamed,
+        RPNCHAR optSubstring,
+        RU32 flags,
+        processLibHandleCache optCache
+    )
+{
+    rList handles = NULL;
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    rSequence handle = NULL;
+    RWCHAR api_ntdll[] = _WCH("ntdll.dll");
+    RCHAR api_querysysinfo[] = "NtQuerySystemInformation";
+    RCHAR api_queryobj[] = "NtQueryObject";
+    RCHAR api_queryfile[] = "NtQueryInformationFile";
+    RWCHAR strFile[] = _WCH("File");
+
+    HANDLE hSelf = NULL;
+    HANDLE hProcess = NULL;
+    PSYSTEM_HANDLE_INFORMATION pSysHandleInfo = NULL;
+    RU32 size = 0;
+    RU32 i = 0;
+    HANDLE hDupe = NULL;
+    POBJECT_NAME_INFORMATION pObjName = NULL;
+    POBJECT_TYPE_INFORMATION pObjType = NULL;
+    RU32 lastError = 0;
+    RBOOL isBlockable = FALSE;
+    RBOOL isFileHackSupported = FALSE;
+    RBOOL gotMinInfo = FALSE;
+    RU32 tmpSize = 1024;
+
+    UNREFERENCED_PARAMETER( flags );
+    UNREFERENCED_PARAMETER( optCache );
+
+    if( NULL == querySysInfo )
+    {
+        // This must be the first call so we will init the import
+        querySysInfo = (pfnNtQuerySystemInformation)GetProcAddress( LoadLibraryW( api_ntdll ), api_querysysinfo );
+    }
+
+    if( NULL == queryObj )
+    {
+        // This must be the first call so we will init the import
+        queryObj = (pfnNtQueryObject)GetProcAddress( LoadLibraryW( api_ntdll ), api_queryobj );
+    }
+
+    if( NULL == queryFile )
+    {
+        // This must be the first call so we will init the import
+        queryFile = (pfnNtQueryInformationFile)GetProcAddress( LoadLibraryW( api_ntdll ), api_queryfile );
+    }
+
+    if( OSLIB_VERSION_WINDOWS_2K3 < libOs_getOsVersion() )
+    {
+        isFileHackSupported = TRUE;
+    }
+
+    if( NULL != querySysInfo &&
+        NULL != queryObj &&
+        NULL != ( hSelf = OpenProcess( PROCESS_DUP_HANDLE, FALSE, GetCurrentProcessId() ) ) )
+    {
+        if( NULL != ( handles = rList_new( RP_TAGS_HANDLE_INFO, RPCM_SEQUENCE ) ) )
+        {
+            while( STATUS_INFO_LENGTH_MISMATCH == querySysInfo( SystemHandleInformation, pSysHandleInfo, size, (PULONG)&size ) )
+            {
+                // On XP the correct size is not actually returned, just 0, so we have to guess and brute force.
+                if( 0 == size )
+                {
+                    size = tmpSize;
+                    tmpSize *= 2;
+                }
+
+                if( NULL == ( pSysHandleInfo = rpal_memory_realloc( pSysHandleInfo, size ) ) )
+                {
+                    break;
+                }
+            }
+
+            if( NULL != pSysHandleInfo )
+            {
+                for( i = 0; i < pSysHandleInfo->NumberOfHandles; i++ )
+                {
+                    if( 0 != processId &&
+                        pSysHandleInfo->Handles[ i ].UniqueProcessId != processId )
+                    {
+                        continue;
+                    }
+
+                    isBlockable = FALSE;
+
+                    // For now we do this the dumb way, which is to reopen
+                    // each process on every handle.
+                    if( NULL != ( hProcess = OpenProcess( PROCESS_DUP_HANDLE, 
+                                                          FALSE, 
+                                                          pSysHandleInfo->Handles[ i ].UniqueProcessId ) ) )
+                    {
+                        if( DuplicateHandle( hProcess, 
+                                             (HANDLE)pSysHandleInfo->Handles[ i ].HandleValue, 
+                                             hSelf, 
+                                             &hDupe, 
+                                             0, 
+                                             FALSE, 
+                                             DUPLICATE_SAME_ACCESS ) )
+                        {
+                            if( NULL != ( handle = rSequence_new() ) )
+                            {
+                                size = 0;
+                                pObjType = NULL;
+                                gotMinInfo = FALSE;
+
+                                while( STATUS_INFO_LENGTH_MISMATCH == ( lastError = queryObj( hDupe, 
+                                                                                              ObjectTypeInformation, 
+                                                                                              pObjType, 
+                                                                                              size, 
+                                                                                              (PULONG)&size ) ) )
+                                {
+                                    if( NULL == ( pObjType = rpal_memory_realloc( pObjType, size ) ) )
+                                    {
+                                        break;
+                                    }
+                                }
+
+                                if( NULL != pObjType )
+                                {
                                     rSequence_addSTRINGW( handle, RP_TAGS_HANDLE_TYPE, pObjType->TypeName.Buffer );
 
                                     if( 0 == rpal_string_strcmp( pObjType->TypeName.Buffer, strFile ) )
@@ -2005,12 +2502,655 @@ rList
         CloseHandle( hSelf );
     }
 #elif defined( RPAL_PLATFORM_LINUX )
-    rpal_debug_not_implemented();
+    processLibProcEntry* procs = NULL;
+    _processLibHandleCache* pCache = (_processLibHandleCache*)optCache;
+    _pidHandles entry = {0};
+    RU32 i = 0;
+
+    if( NULL != ( handles = rList_new( RP_TAGS_HANDLE_INFO, RPCM_SEQUENCE ) ) )
+    {
+        if( NULL != pCache )
+        {
+            rpal_btree_manual_lock( pCache->pids );
+        }
+
+        if( 0 != processId )
+        {
+            if( !_getLinuxHandles( processId, isOnlyReturnNamed, optSubstring, flags, pCache, handles ) )
+            {
+                rList_free( handles );
+                handles = NULL;
+            }
+        }
+        else if( NULL != ( procs = processLib_getProcessEntries( FALSE ) ) )
+        {
+            if( NULL != pCache )
+            {
+                pCache->generation++;
+            }
+
+            for( i = 0; 0 != procs[ i ].pid; i++ )
+            {
+                _getLinuxHandles( procs[ i ].pid, isOnlyReturnNamed, optSubstring, flags, pCache, handles );
+            }
+
+            // A full sweep is a good time to forget about processes that are gone.
+            if( NULL != pCache &&
+                rpal_btree_minimum( pCache->pids, &entry, TRUE ) )
+            {
+                do
+                {
+                    if( entry.generation != pCache->generation &&
+                        rpal_btree_remove( pCache->pids, &entry.pid, &entry, TRUE ) )
+                    {
+                        _freePidHandles( &entry );
+                    }
+                }
+                while( rpal_btree_after( pCache->pids, &entry.pid, &entry, TRUE ) );
+            }
+
+            rpal_memory_free( procs );
+        }
+
+        if( NULL != pCache )
+        {
+            rpal_btree_manual_unlock( pCache->pids );
+        }
+    }
 #endif
 
     return handles;
 }
 
+// Cgroup path component prefixes used by container runtimes, the container
+// id follows the prefix, usually with a ".scope" suffix under systemd.
+static struct
+{
+    RPCHAR prefix;
+    RPCHAR runtime;
+} g_containerPrefixes[] = { { "docker-", "docker" },
+                            { "cri-containerd-", "containerd" },
+                            { "crio-", "cri-o" },
+                            { "libpod-", "podman" } };
+
+static
+RBOOL
+    _isHexString
+    (
+        RPCHAR str,
+        RU32 len
+    )
+{
+    RU32 i = 0;
+
+    for( i = 0; i < len; i++ )
+    {
+        if( !( ( '0' <= str[ i ] && '9' >= str[ i ] ) ||
+               ( 'a' <= str[ i ] && 'f' >= str[ i ] ) ) )
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+#ifdef RPAL_PLATFORM_LINUX
+// Namespaces reported, in the order of the tags.
+static RPCHAR g_containerNamespaces[] = { "pid", "mnt", "net", "user" };
+static rpcm_tag g_containerNamespaceTags[] = { RP_TAGS_PID_NAMESPACE,
+                                               RP_TAGS_MOUNT_NAMESPACE,
+                                               RP_TAGS_NETWORK_NAMESPACE,
+                                               RP_TAGS_USER_NAMESPACE };
+
+typedef struct
+{
+    RPCHAR path;
+    RU32 refCount;
+    RCHAR containerId[ PROCESSLIB_CONTAINER_ID_SIZE ];
+    RPCHAR runtime;
+
+} _cgroupInfo;
+
+typedef struct
+{
+    RU32 pid;
+    RU64 startTime;
+    RU64 namespaces[ ARRAY_N_ELEM( g_containerNamespaces ) ];
+    _cgroupInfo* cgroup;
+
+} _pidContainer;
+
+typedef struct
+{
+    rMutex lock;
+    rBTree pids;
+    rBTree cgroups;
+
+} _processLibContainerCache;
+
+static
+RS32
+    _cmpCgroupInfo
+    (
+        _cgroupInfo** info1,
+        _cgroupInfo** info2
+    )
+{
+    return rpal_string_strcmp( (*info1)->path, (*info2)->path );
+}
+
+static
+RVOID
+    _freeCgroupInfo
+    (
+        _cgroupInfo** pInfo
+    )
+{
+    if( NULL != pInfo &&
+        NULL != *pInfo )
+    {
+        rpal_memory_free( (*pInfo)->path );
+        rpal_memory_free( *pInfo );
+        *pInfo = NULL;
+    }
+}
+
+static
+RVOID
+    _releaseCgroupInfo
+    (
+        _processLibContainerCache* pCache,
+        _cgroupInfo* pInfo
+    )
+{
+    if( NULL != pInfo &&
+        0 == --pInfo->refCount &&
+        rpal_btree_remove( pCache->cgroups, &pInfo, NULL, TRUE ) )
+    {
+        _freeCgroupInfo( &pInfo );
+    }
+}
+
+// Picks the most specific path out of /proc/<pid>/cgroup: the unified
+// hierarchy when the process is not at its root, otherwise the first v1
+// hierarchy that places it somewhere.
+static
+RBOOL
+    _getLinuxCgroup
+    (
+        RU32 pid,
+        RPCHAR path,
+        RU32 pathSize
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RCHAR cgroupPath[ 32 ] = {0};
+    RCHAR buff[ 4096 ] = {0};
+    RPCHAR pLine = NULL;
+    RPCHAR pNext = NULL;
+    RPCHAR pPath = NULL;
+    RPCHAR pBest = NULL;
+    RS32 fd = (-1);
+    RS32 nRead = 0;
+
+    rpal_string_snprintf( cgroupPath, sizeof( cgroupPath ), "/proc/%u/cgroup", pid );
+
+    if( 0 <= ( fd = open( cgroupPath, O_RDONLY | O_CLOEXEC ) ) )
+    {
+        if( 0 < ( nRead = (RS32)read( fd, buff, sizeof( buff ) - 1 ) ) )
+        {
+            buff[ nRead ] = 0;
+
+            for( pLine = buff; NULL != pLine && 0 != *pLine; pLine = pNext )
+            {
+                if( NULL != ( pNext = strchr( pLine, '\n' ) ) )
+                {
+                    *pNext = 0;
+                    pNext++;
+                }
+
+                // Lines are "hierarchy-id:controllers:path".
+                if( NULL == ( pPath = strchr( pLine, ':' ) ) ||
+                    NULL == ( pPath = strchr( pPath + 1, ':' ) ) )
+                {
+                    continue;
+                }
+                pPath++;
+
+                if( NULL == pBest ||
+                    ( '/' == pBest[ 0 ] && 0 == pBest[ 1 ] ) ||
+                    ( '0' == pLine[ 0 ] && ':' == pLine[ 1 ] && !( '/' == pPath[ 0 ] && 0 == pPath[ 1 ] ) ) )
+                {
+                    pBest = pPath;
+                }
+            }
+
+            if( NULL != pBest &&
+                rpal_string_strlen( pBest ) < pathSize )
+            {
+                rpal_string_strcpy( path, pBest );
+                isSuccess = TRUE;
+            }
+        }
+
+        close( fd );
+    }
+
+    return isSuccess;
+}
+
+static
+RVOID
+    _getLinuxNamespaces
+    (
+        RU32 pid,
+        RU64* namespaces
+    )
+{
+    RCHAR nsPath[ 48 ] = {0};
+    RCHAR target[ 64 ] = {0};
+    RPCHAR pInode = NULL;
+    RS32 size = 0;
+    RU32 i = 0;
+
+    for( i = 0; i < ARRAY_N_ELEM( g_containerNamespaces ); i++ )
+    {
+        namespaces[ i ] = 0;
+
+        // Links are named like "pid:[4026531836]" where the number is the inode.
+        rpal_string_snprintf( nsPath, sizeof( nsPath ), "/proc/%u/ns/%s", pid, g_containerNamespaces[ i ] );
+        if( 0 < ( size = (RS32)readlink( nsPath, target, sizeof( target ) - 1 ) ) )
+        {
+            target[ size ] = 0;
+
+            if( NULL != ( pInode = strchr( target, '[' ) ) )
+            {
+                namespaces[ i ] = strtoull( pInode + 1, NULL, 10 );
+            }
+        }
+    }
+}
+
+static
+_cgroupInfo*
+    _newCgroupInfo
+    (
+        RPCHAR path
+    )
+{
+    _cgroupInfo* pInfo = NULL;
+
+    if( NULL != ( pInfo = rpal_memory_alloc( sizeof( *pInfo ) ) ) )
+    {
+        rpal_memory_zero( pInfo, sizeof( *pInfo ) );
+
+        if( NULL == ( pInfo->path = rpal_string_strdup( path ) ) )
+        {
+            rpal_memory_free( pInfo );
+            pInfo = NULL;
+        }
+        else
+        {
+            processLib_getContainerIdFromCgroup( path, pInfo->containerId, &pInfo->runtime );
+        }
+    }
+
+    return pInfo;
+}
+
+// Returns the cached info of the cgroup path with a reference taken on it.
+static
+_cgroupInfo*
+    _getCgroupInfo
+    (
+        _processLibContainerCache* pCache,
+        RPCHAR path
+    )
+{
+    _cgroupInfo key = {0};
+    _cgroupInfo* pKey = &key;
+    _cgroupInfo* pInfo = NULL;
+
+    key.path = path;
+
+    if( !rpal_btree_search( pCache->cgroups, &pKey, &pInfo, TRUE ) )
+    {
+        if( NULL != ( pInfo = _newCgroupInfo( path ) ) &&
+            !rpal_btree_add( pCache->cgroups, &pInfo, TRUE ) )
+        {
+            _freeCgroupInfo( &pInfo );
+        }
+    }
+
+    if( NULL != pInfo )
+    {
+        pInfo->refCount++;
+    }
+
+    return pInfo;
+}
+
+static
+rSequence
+    _newContainerSequence
+    (
+        _cgroupInfo* pCgroup,
+        RU64* namespaces
+    )
+{
+    rSequence info = NULL;
+    RU32 i = 0;
+
+    if( NULL != ( info = rSequence_new() ) )
+    {
+        if( !rSequence_addSTRINGA( info, RP_TAGS_CGROUP, pCgroup->path ) )
+        {
+            rSequence_free( info );
+            return NULL;
+        }
+
+        if( 0 != pCgroup->containerId[ 0 ] )
+        {
+            rSequence_addSTRINGA( info, RP_TAGS_CONTAINER_ID, pCgroup->containerId );
+        }
+
+        if( NULL != pCgroup->runtime )
+        {
+            rSequence_addSTRINGA( info, RP_TAGS_CONTAINER_RUNTIME, pCgroup->runtime );
+        }
+
+        for( i = 0; i < ARRAY_N_ELEM( g_containerNamespaces ); i++ )
+        {
+            if( 0 != namespaces[ i ] )
+            {
+                rSequence_addRU64( info, g_containerNamespaceTags[ i ], namespaces[ i ] );
+            }
+        }
+    }
+
+    return info;
+}
+#endif
+
+processLibContainerCache
+    processLib_newContainerCache
+    (
+
+    )
+{
+#ifdef RPAL_PLATFORM_LINUX
+    _processLibContainerCache* pCache = NULL;
+
+    if( NULL != ( pCache = rpal_memory_alloc( sizeof( *pCache ) ) ) )
+    {
+        rpal_memory_zero( pCache, sizeof( *pCache ) );
+
+        if( NULL == ( pCache->lock = rMutex_create() ) ||
+            NULL == ( pCache->pids = rpal_btree_create( sizeof( _pidContainer ),
+                                                        (rpal_btree_comp_f)rpal_order_RU32,
+                                                        NULL ) ) ||
+            NULL == ( pCache->cgroups = rpal_btree_create( sizeof( _cgroupInfo* ),
+                                                           (rpal_btree_comp_f)_cmpCgroupInfo,
+                                                           (rpal_btree_free_f)_freeCgroupInfo ) ) )
+        {
+            processLib_freeContainerCache( pCache );
+            pCache = NULL;
+        }
+    }
+
+    return pCache;
+#else
+    return NULL;
+#endif
+}
+
+RVOID
+    processLib_freeContainerCache
+    (
+        processLibContainerCache cache
+    )
+{
+#ifdef RPAL_PLATFORM_LINUX
+    _processLibContainerCache* pCache = (_processLibContainerCache*)cache;
+
+    if( NULL != pCache )
+    {
+        if( NULL != pCache->pids )
+        {
+            rpal_btree_destroy( pCache->pids, TRUE );
+        }
+        if( NULL != pCache->cgroups )
+        {
+            rpal_btree_destroy( pCache->cgroups, TRUE );
+        }
+        if( NULL != pCache->lock )
+        {
+            rMutex_free( pCache->lock );
+        }
+        rpal_memory_free( pCache );
+    }
+#else
+    UNREFERENCED_PARAMETER( cache );
+#endif
+}
+
+RVOID
+    processLib_forgetContainerInfo
+    (
+        processLibContainerCache cache,
+        RU32 processId
+    )
+{
+#ifdef RPAL_PLATFORM_LINUX
+    _processLibContainerCache* pCache = (_processLibContainerCache*)cache;
+    _pidContainer entry = {0};
+
+    if( NULL != pCache &&
+        rMutex_lock( pCache->lock ) )
+    {
+        if( rpal_btree_remove( pCache->pids, &processId, &entry, TRUE ) )
+        {
+            _releaseCgroupInfo( pCache, entry.cgroup );
+        }
+
+        rMutex_unlock( pCache->lock );
+    }
+#else
+    UNREFERENCED_PARAMETER( cache );
+    UNREFERENCED_PARAMETER( processId );
+#endif
+}
+
+rSequence
+    processLib_getContainerInfo
+    (
+        RU32 processId,
+        processLibContainerCache optCache
+    )
+{
+    rSequence info = NULL;
+
+#ifdef RPAL_PLATFORM_LINUX
+    _processLibContainerCache* pCache = (_processLibContainerCache*)optCache;
+    _pidContainer entry = {0};
+    _cgroupInfo* pCgroup = NULL;
+    RU64 startTime = 0;
+    RCHAR path[ 1024 ] = {0};
+
+    if( NULL == pCache )
+    {
+        if( _getLinuxCgroup( processId, path, sizeof( path ) ) &&
+            NULL != ( pCgroup = _newCgroupInfo( path ) ) )
+        {
+            _getLinuxNamespaces( processId, entry.namespaces );
+            info = _newContainerSequence( pCgroup, entry.namespaces );
+            _freeCgroupInfo( &pCgroup );
+        }
+
+        return info;
+    }
+
+    _getLinuxStartTime( processId, &startTime );
+
+    if( rMutex_lock( pCache->lock ) )
+    {
+        if( rpal_btree_search( pCache->pids, &processId, &entry, TRUE ) &&
+            entry.startTime != startTime )
+        {
+            // Same pid but a different process.
+            rpal_btree_remove( pCache->pids, &processId, NULL, TRUE );
+            _releaseCgroupInfo( pCache, entry.cgroup );
+            entry.cgroup = NULL;
+        }
+
+        if( NULL == entry.cgroup &&
+            _getLinuxCgroup( processId, path, sizeof( path ) ) &&
+            NULL != ( entry.cgroup = _getCgroupInfo( pCache, path ) ) )
+        {
+            entry.pid = processId;
+            entry.startTime = startTime;
+            _getLinuxNamespaces( processId, entry.namespaces );
+
+            if( !rpal_btree_add( pCache->pids, &entry, TRUE ) )
+            {
+                _releaseCgroupInfo( pCache, entry.cgroup );
+                entry.cgroup = NULL;
+            }
+        }
+
+        if( NULL != entry.cgroup )
+        {
+            info = _newContainerSequence( entry.cgroup, entry.namespaces );
+        }
+
+        rMutex_unlock( pCache->lock );
+    }
+#else
+    UNREFERENCED_PARAMETER( processId );
+    UNREFERENCED_PARAMETER( optCache );
+#endif
+
+    return info;
+}
+
+RBOOL
+    processLib_getContainerIdFromCgroup
+    (
+        RPCHAR cgroupPath,
+        RCHAR containerId[ PROCESSLIB_CONTAINER_ID_SIZE ],
+        RPCHAR* pRuntime
+    )
+{
+    RBOOL isFound = FALSE;
+    RPCHAR pEnd = NULL;
+    RPCHAR pStart = NULL;
+    RPCHAR pParent = NULL;
+    RU32 len = 0;
+    RU32 prefixLen = 0;
+    RU32 i = 0;
+
+    if( NULL == cgroupPath ||
+        NULL == containerId )
+    {
+        return FALSE;
+    }
+
+    containerId[ 0 ] = 0;
+    if( NULL != pRuntime )
+    {
+        *pRuntime = NULL;
+    }
+
+    // Components are looked at from the deepest one up, the innermost
+    // container wins when they are nested.
+    pEnd = cgroupPath + rpal_string_strlenA( cgroupPath );
+
+    while( !isFound &&
+           pEnd > cgroupPath )
+    {
+        for( pStart = pEnd; pStart > cgroupPath && '/' != *( pStart - 1 ); pStart-- );
+        len = (RU32)( pEnd - pStart );
+
+        if( 6 < len &&
+            0 == rpal_memory_memcmp( pEnd - 6, ".scope", 6 ) )
+        {
+            len -= 6;
+        }
+
+        for( i = 0; i < ARRAY_N_ELEM( g_containerPrefixes ) && !isFound; i++ )
+        {
+            prefixLen = rpal_string_strlenA( g_containerPrefixes[ i ].prefix );
+
+            if( prefixLen + 64 == len &&
+                0 == rpal_memory_memcmp( pStart, g_containerPrefixes[ i ].prefix, prefixLen ) &&
+                _isHexString( pStart + prefixLen, 64 ) )
+            {
+                rpal_memory_memcpy( containerId, pStart + prefixLen, 64 );
+                containerId[ 64 ] = 0;
+                if( NULL != pRuntime )
+                {
+                    *pRuntime = g_containerPrefixes[ i ].runtime;
+                }
+                isFound = TRUE;
+            }
+        }
+
+        // The parent component tells the runtime of bare ids and lxc names.
+        pParent = pStart;
+        if( pStart > cgroupPath )
+        {
+            for( pParent = pStart - 1; pParent > cgroupPath && '/' != *( pParent - 1 ); pParent-- );
+        }
+
+        if( isFound )
+        {
+            break;
+        }
+        else if( 64 == len &&
+                 _isHexString( pStart, 64 ) )
+        {
+            rpal_memory_memcpy( containerId, pStart, 64 );
+            containerId[ 64 ] = 0;
+            if( NULL != pRuntime &&
+                7 == pStart - pParent &&
+                0 == rpal_memory_memcmp( pParent, "docker/", 7 ) )
+            {
+                *pRuntime = "docker";
+            }
+            isFound = TRUE;
+        }
+        else if( 12 < len &&
+                 0 == rpal_memory_memcmp( pStart, "lxc.payload.", 12 ) )
+        {
+            len = MIN_OF( len - 12, PROCESSLIB_CONTAINER_ID_SIZE - 1 );
+            rpal_memory_memcpy( containerId, pStart + 12, len );
+            containerId[ len ] = 0;
+            if( NULL != pRuntime )
+            {
+                *pRuntime = "lxc";
+            }
+            isFound = TRUE;
+        }
+        else if( 0 != len &&
+                 4 == pStart - pParent &&
+                 0 == rpal_memory_memcmp( pParent, "lxc/", 4 ) )
+        {
+            len = MIN_OF( len, PROCESSLIB_CONTAINER_ID_SIZE - 1 );
+            rpal_memory_memcpy( containerId, pStart, len );
+            containerId[ len ] = 0;
+            if( NULL != pRuntime )
+            {
+                *pRuntime = "lxc";
+            }
+            isFound = TRUE;
+        }
+
+        pEnd = ( pStart > cgroupPath ) ? pStart - 1 : cgroupPath;
+    }
+
+    return isFound;
+}
 
 
 
@@ -47,6 +47,9 @@ RPAL_THREAD_FUNC
         {
             ret = (RU32)(-2);
 
+            // Each module has its own copy of rpal and so its own logger.
+            rpal_log_start( NULL, 0, 0 );
+
             if( 0 != ( hMain = rpal_thread_new( RpHcpI_mainThread, 
                                                 g_Module_Context->isTimeToStop ) ) )
             {
@@ -70,6 +73,7 @@ RPAL_THREAD_FUNC
                 rpal_debug_error( "failed spawning module main worker" );
             }
 
+            rpal_log_stop();
             rpal_Context_cleanup();
 
             rpal_Context_deinitialize();
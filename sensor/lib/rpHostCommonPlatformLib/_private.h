@@ -27,7 +27,8 @@ rBlob
     (
         RpHcp_ModuleId moduleId,
         rList messages,
-        RBOOL isIncludeUncompressedSize
+        RBOOL isIncludeUncompressedSize,
+        RU32 dictionaryVersion
     );
 
 RBOOL
@@ -38,6 +39,25 @@ RBOOL
         rList* pMessages
     );
 
+RBOOL
+    compressFrame
+    (
+        RPU8 data,
+        RU32 dataSize,
+        RU32 dictionaryVersion,
+        RPU8* pCompressed,
+        RU32* pCompressedSize
+    );
+
+RBOOL
+    decompressFrame
+    (
+        RPU8 compressed,
+        RU32 compressedSize,
+        RPU8 data,
+        RU32* pDataSize
+    );
+
 RBOOL
     sendFrame
     (
@@ -56,6 +76,27 @@ RBOOL
         RU32 timeoutSec
     );
 
+RBOOL
+    tlsConnect
+    (
+        rpHCPContext* pContext,
+        RPCHAR dest,
+        RPCHAR port,
+        RPCHAR caCert
+    );
+
+RVOID
+    tlsDisconnect
+    (
+
+    );
+
+RU32
+    getReconnectDelay
+    (
+        RU32 nFailedConnects
+    );
+
 RBOOL
     loadModule
     (
@@ -70,6 +111,30 @@ RBOOL
         rSequence seq
     );
 
+RBOOL
+    cacheModule
+    (
+        RPNCHAR cacheDir,
+        RpHcp_ModuleId moduleId,
+        RPU8 module,
+        RU32 moduleSize,
+        RPU8 signature,
+        CryptoLib_Hash* pHash
+    );
+
+RBOOL
+    uncacheModule
+    (
+        RPNCHAR cacheDir,
+        RpHcp_ModuleId moduleId
+    );
+
+rList
+    getCachedModules
+    (
+        RPNCHAR cacheDir
+    );
+
 RBOOL
     saveHcpId
     (
@@ -29,6 +29,7 @@ limitations under the License.
 #include <networkLib/networkLib.h>
 #include "git_info.h"
 #include <processLib/processLib.h>
+#include "frameDictionary_v1.h"
 
 #include <mbedtls/net.h>
 #include <mbedtls/ssl.h>
@@ -58,6 +59,24 @@ limitations under the License.
 #define _SSL_VALIDATION_FLAG    MBEDTLS_SSL_VERIFY_REQUIRED
 #endif
 
+// Building with HCP_RECORD_FRAMES writes every uncompressed frame sent to this
+// directory, scrubbed, as samples for tools/train_frame_dictionary.py.
+#define FRAME_RECORD_DIRECTORY  _NC( "hcp_frames" )
+
+typedef struct
+{
+    RU32 version;
+    RPU8 dictionary;
+    RU32 size;
+
+} FrameDictionary;
+
+// Preset deflate dictionaries for frames, advertised to the cloud in the headers.
+// A version must never be modified once shipped, add a new one instead.
+// The highest version is the one we advertise as preferred.
+RPRIVATE FrameDictionary g_frameDictionaries[] = {
+    { 1, g_hcpFrameDictionaryV1, sizeof( g_hcpFrameDictionaryV1 ) } };
+
 RPRIVATE
 struct
 {
@@ -74,18 +93,427 @@ RPRIVATE rMutex g_tlsMutex = NULL;;
 //=============================================================================
 //  Helpers
 //=============================================================================
+RPRIVATE
+FrameDictionary*
+    getFrameDictionary
+    (
+        RU32 version
+    )
+{
+    FrameDictionary* dictionary = NULL;
+    RU32 i = 0;
+
+    for( i = 0; i < ARRAY_N_ELEM( g_frameDictionaries ); i++ )
+    {
+        if( version == g_frameDictionaries[ i ].version )
+        {
+            dictionary = &g_frameDictionaries[ i ];
+            break;
+        }
+    }
+
+    return dictionary;
+}
+
+RBOOL
+    isFrameDictionarySupported
+    (
+        RU32 version
+    )
+{
+    return ( 0 == version || NULL != getFrameDictionary( version ) );
+}
+
+#ifdef HCP_RECORD_FRAMES
+// Recorded frames end up in the dictionary shipped with every sensor, so values
+// that identify the host or its users are blanked before hitting the disk.
+// Keep in sync with tools/train_frame_dictionary.py.
+RPRIVATE RU32 g_scrubbedRecordTags[] = { RP_TAGS_HOST_NAME,
+                                         RP_TAGS_COMMAND_LINE,
+                                         RP_TAGS_USER_NAME,
+                                         RP_TAGS_ENVIRONMENT_VARIABLE,
+                                         RP_TAGS_DOMAIN_NAME,
+                                         RP_TAGS_CNAME,
+                                         RP_TAGS_REMOTE_HOST,
+                                         RP_TAGS_STRING };
+RPRIVATE RPCHAR g_scrubbedRecordPrefixes[] = { "/home/",
+                                               "/root",
+                                               "/users/",
+                                               "\\users\\",
+                                               "\\documents and settings\\",
+                                               "/tmp/",
+                                               "/var/tmp/",
+                                               "\\temp\\" };
+
+RPRIVATE
+RBOOL
+    readRecordedU32
+    (
+        RPU8 buffer,
+        RU32 bufferSize,
+        RU32* pOffset,
+        RU32* pValue
+    )
+{
+    RBOOL isRead = FALSE;
+
+    if( (RU64)*pOffset + sizeof( RU32 ) <= bufferSize )
+    {
+        rpal_memory_memcpy( pValue, buffer + *pOffset, sizeof( RU32 ) );
+        *pValue = rpal_ntoh32( *pValue );
+        *pOffset += sizeof( RU32 );
+        isRead = TRUE;
+    }
+
+    return isRead;
+}
+
+RPRIVATE
+RVOID
+    scrubRecordedValue
+    (
+        RU32 tag,
+        RU8 type,
+        RPU8 value,
+        RU32 size
+    )
+{
+    RU32 start = 0;
+    RU32 end = size;
+    RU32 i = 0;
+    RU32 j = 0;
+    RU32 k = 0;
+    RBOOL isScrubbed = ( RPCM_BUFFER == type );
+    RPCHAR prefix = NULL;
+    RU8 c = 0;
+
+    for( i = 0; !isScrubbed && i < ARRAY_N_ELEM( g_scrubbedRecordTags ); i++ )
+    {
+        isScrubbed = ( tag == g_scrubbedRecordTags[ i ] );
+    }
+
+    // Otherwise only blank strings from the first user path on.
+    while( !isScrubbed && start < size )
+    {
+        for( j = 0; !isScrubbed && j < ARRAY_N_ELEM( g_scrubbedRecordPrefixes ); j++ )
+        {
+            prefix = g_scrubbedRecordPrefixes[ j ];
+
+            for( k = 0; 0 != prefix[ k ] && start + k < size; k++ )
+            {
+                c = value[ start + k ];
+                if( 'A' <= c && 'Z' >= c )
+                {
+                    c += 'a' - 'A';
+                }
+                if( c != (RU8)prefix[ k ] )
+                {
+                    break;
+                }
+            }
+
+            isScrubbed = ( 0 == prefix[ k ] );
+        }
+
+        if( !isScrubbed )
+        {
+            start++;
+        }
+    }
+
+    if( isScrubbed )
+    {
+        // Strings keep their terminator so they still look like strings.
+        if( 0 != size && 0 == value[ size - 1 ] )
+        {
+            end--;
+        }
+
+        for( i = start; i < end; i++ )
+        {
+            value[ i ] = 'x';
+        }
+    }
+}
+
+RPRIVATE
+RBOOL
+    scrubRecordedSet
+    (
+        RPU8 buffer,
+        RU32 bufferSize,
+        RU32* pOffset
+    )
+{
+    RBOOL isScrubbed = FALSE;
+    RU32 nElements = 0;
+    RU32 tag = 0;
+    RU8 type = 0;
+    RU32 size = 0;
+
+    if( readRecordedU32( buffer, bufferSize, pOffset, &nElements ) )
+    {
+        isScrubbed = TRUE;
+
+        while( isScrubbed && 0 != nElements-- )
+        {
+            isScrubbed = FALSE;
+
+            if( !readRecordedU32( buffer, bufferSize, pOffset, &tag ) ||
+                *pOffset >= bufferSize )
+            {
+                break;
+            }
+
+            type = buffer[ ( *pOffset )++ ];
+            size = 0;
+
+            switch( type )
+            {
+                case RPCM_RU8:
+                    size = sizeof( RU8 );
+                    break;
+                case RPCM_RU16:
+                    size = sizeof( RU16 );
+                    break;
+                case RPCM_RU32:
+                case RPCM_IPV4:
+                case RPCM_POINTER_32:
+                    size = sizeof( RU32 );
+                    break;
+                case RPCM_RU64:
+                case RPCM_TIMESTAMP:
+                case RPCM_POINTER_64:
+                case RPCM_TIMEDELTA:
+                case RPCM_DOUBLE:
+                    size = sizeof( RU64 );
+                    break;
+                case RPCM_IPV6:
+                    size = 16;
+                    break;
+                case RPCM_STRINGA:
+                case RPCM_STRINGW:
+                case RPCM_BUFFER:
+                    if( readRecordedU32( buffer, bufferSize, pOffset, &size ) &&
+                        (RU64)*pOffset + size <= bufferSize )
+                    {
+                        scrubRecordedValue( tag, type, buffer + *pOffset, size );
+                    }
+                    break;
+                case RPCM_SEQUENCE:
+                    isScrubbed = scrubRecordedSet( buffer, bufferSize, pOffset );
+                    continue;
+                case RPCM_LIST:
+                    // Skip the list's element tag and type.
+                    *pOffset += sizeof( RU32 ) + sizeof( RU8 );
+                    isScrubbed = scrubRecordedSet( buffer, bufferSize, pOffset );
+                    continue;
+                default:
+                    continue;
+            }
+
+            if( (RU64)*pOffset + size <= bufferSize )
+            {
+                *pOffset += size;
+                isScrubbed = TRUE;
+            }
+        }
+    }
+
+    return isScrubbed;
+}
+
+RPRIVATE
+RVOID
+    recordFrame
+    (
+        rBlob frame
+    )
+{
+    RPRIVATE volatile RU32 frameIndex = 0;
+    RNCHAR indexStr[ 16 ] = { 0 };
+    RPNCHAR path = NULL;
+    RPU8 scrubbed = NULL;
+    RU32 size = rpal_blob_getSize( frame );
+    // The module id followed by the tag and type of the list of messages.
+    RU32 offset = sizeof( RpHcp_ModuleId ) + sizeof( RU32 ) + sizeof( RU8 );
+
+    if( NULL != ( scrubbed = rpal_memory_duplicate( rpal_blob_getBuffer( frame ), size ) ) )
+    {
+        if( !scrubRecordedSet( scrubbed, size, &offset ) ||
+            offset != size )
+        {
+            rpal_debug_warning( "not recording a frame that could not be scrubbed" );
+        }
+        else
+        {
+            rDir_create( FRAME_RECORD_DIRECTORY );
+
+            if( NULL != rpal_string_itos( rInterlocked_increment32( &frameIndex ), indexStr, 10 ) &&
+                NULL != ( path = rpal_string_strdup( FRAME_RECORD_DIRECTORY ) ) &&
+                NULL != ( path = rpal_string_strcatEx( path, _NC( "/" ) ) ) &&
+                NULL != ( path = rpal_string_strcatEx( path, indexStr ) ) )
+            {
+                rpal_file_pathToLocalSep( path );
+
+                if( !rpal_file_write( path, scrubbed, size, TRUE ) )
+                {
+                    rpal_debug_warning( "failed to record frame" );
+                }
+            }
+        }
+    }
+
+    rpal_memory_free( path );
+    rpal_memory_free( scrubbed );
+}
+#endif
+
+RPRIVATE_TESTABLE
+RBOOL
+    compressFrame
+    (
+        RPU8 data,
+        RU32 dataSize,
+        RU32 dictionaryVersion,
+        RPU8* pCompressed,
+        RU32* pCompressedSize
+    )
+{
+    RBOOL isCompressed = FALSE;
+    z_stream stream = { 0 };
+    FrameDictionary* dictionary = NULL;
+    RPU8 buffer = NULL;
+    RU32 bufferSize = 0;
+
+    if( NULL != data &&
+        NULL != pCompressed &&
+        NULL != pCompressedSize )
+    {
+        // An unknown dictionary is not fatal, the frame is just sent without one.
+        if( 0 != dictionaryVersion &&
+            NULL == ( dictionary = getFrameDictionary( dictionaryVersion ) ) )
+        {
+            rpal_debug_warning( "unknown frame dictionary %d, not using one", dictionaryVersion );
+        }
+
+        if( Z_OK == deflateInit( &stream, Z_DEFAULT_COMPRESSION ) )
+        {
+            // The bound must be computed after the dictionary is set.
+            if( ( NULL == dictionary ||
+                  Z_OK == deflateSetDictionary( &stream, dictionary->dictionary, dictionary->size ) ) &&
+                0 != ( bufferSize = (RU32)deflateBound( &stream, dataSize ) ) &&
+                NULL != ( buffer = rpal_memory_alloc( bufferSize ) ) )
+            {
+                stream.next_in = data;
+                stream.avail_in = dataSize;
+                stream.next_out = buffer;
+                stream.avail_out = bufferSize;
+
+                if( Z_STREAM_END == deflate( &stream, Z_FINISH ) )
+                {
+                    *pCompressed = buffer;
+                    *pCompressedSize = (RU32)stream.total_out;
+                    isCompressed = TRUE;
+                }
+                else
+                {
+                    rpal_memory_free( buffer );
+                }
+            }
+
+            deflateEnd( &stream );
+        }
+    }
+
+    return isCompressed;
+}
+
+RPRIVATE_TESTABLE
+RBOOL
+    decompressFrame
+    (
+        RPU8 compressed,
+        RU32 compressedSize,
+        RPU8 data,
+        RU32* pDataSize
+    )
+{
+    RBOOL isDecompressed = FALSE;
+    z_stream stream = { 0 };
+    FrameDictionary* dictionary = NULL;
+    RS32 zErr = Z_OK;
+    RU32 i = 0;
+
+    if( NULL != compressed &&
+        NULL != data &&
+        NULL != pDataSize )
+    {
+        stream.next_in = compressed;
+        stream.avail_in = compressedSize;
+        stream.next_out = data;
+        stream.avail_out = *pDataSize;
+
+        if( Z_OK == inflateInit( &stream ) )
+        {
+            zErr = inflate( &stream, Z_FINISH );
+
+            // Frames without a dictionary decompress directly, otherwise the
+            // stream tells us which one to use through the dictionary's adler32.
+            if( Z_NEED_DICT == zErr )
+            {
+                for( i = 0; i < ARRAY_N_ELEM( g_frameDictionaries ); i++ )
+                {
+                    if( stream.adler == adler32( adler32( 0, NULL, 0 ),
+                                                 g_frameDictionaries[ i ].dictionary,
+                                                 g_frameDictionaries[ i ].size ) )
+                    {
+                        dictionary = &g_frameDictionaries[ i ];
+                        break;
+                    }
+                }
+
+                if( NULL != dictionary &&
+                    Z_OK == inflateSetDictionary( &stream, dictionary->dictionary, dictionary->size ) )
+                {
+                    zErr = inflate( &stream, Z_FINISH );
+                }
+                else
+                {
+                    rpal_debug_warning( "frame uses an unknown dictionary" );
+                }
+            }
+
+            if( Z_STREAM_END == zErr )
+            {
+                *pDataSize = (RU32)stream.total_out;
+                isDecompressed = TRUE;
+            }
+            else
+            {
+                rpal_debug_warning( "failed to decompress frame: %d", zErr );
+            }
+
+            inflateEnd( &stream );
+        }
+    }
+
+    return isDecompressed;
+}
+
 RPRIVATE_TESTABLE
 rBlob
     wrapFrame
     (
         RpHcp_ModuleId moduleId,
         rList messages,
-        RBOOL isIncludeUncompressedSize // For testing purposes
+        RBOOL isIncludeUncompressedSize, // For testing purposes
+        RU32 dictionaryVersion
     )
 {
     rBlob blob = NULL;
     RPU8 buffer = NULL;
-    RSIZET size = 0;
+    RU32 size = 0;
     RU32 uncompressedSize = 0;
 
     if( NULL != messages &&
@@ -99,16 +527,17 @@ rBlob
         }
         else
         {
-            uncompressedSize = rpal_blob_getSize( blob );
-            size = compressBound( uncompressedSize );
-            uncompressedSize = rpal_hton32( uncompressedSize );
-            if( NULL == ( buffer = rpal_memory_alloc( size ) ) ||
-                Z_OK != compress( buffer, 
-                                  (uLongf*)&size, 
-                                  rpal_blob_getBuffer( blob ), 
-                                  rpal_blob_getSize( blob ) ) ||
+#ifdef HCP_RECORD_FRAMES
+            recordFrame( blob );
+#endif
+            uncompressedSize = rpal_hton32( rpal_blob_getSize( blob ) );
+            if( !compressFrame( rpal_blob_getBuffer( blob ),
+                                rpal_blob_getSize( blob ),
+                                dictionaryVersion,
+                                &buffer,
+                                &size ) ||
               !rpal_blob_freeBufferOnly( blob ) ||
-              !rpal_blob_setBuffer( blob, buffer, (RU32)size ) ||
+              !rpal_blob_setBuffer( blob, buffer, size ) ||
               ( isIncludeUncompressedSize && 
                 !rpal_blob_insert( blob, &uncompressedSize, sizeof( uncompressedSize ), 0 ) ) )
             {
@@ -133,29 +562,30 @@ RBOOL
     )
 {
     RBOOL isUnwrapped = FALSE;
-    RSIZET uncompressedSize = 0;
+    RU32 uncompressedSize = 0;
     RPU8 uncompressedFrame = NULL;
-    RU32 uncompErr = 0;
     RU32 bytesConsumed = 0;
 
     if( NULL != frame &&
         NULL != pModuleId &&
-        NULL != pMessages )
+        NULL != pMessages &&
+        sizeof( RU32 ) <= rpal_blob_getSize( frame ) )
     {
         uncompressedSize = rpal_ntoh32( *(RU32*)rpal_blob_getBuffer( frame ) );
         if( FRAME_MAX_SIZE >= uncompressedSize &&
             NULL != ( uncompressedFrame = rpal_memory_alloc( uncompressedSize ) ) )
         {
-            if( Z_OK == ( uncompErr = uncompress( uncompressedFrame,
-                                                  (uLongf*)&uncompressedSize,
-                                                  (RPU8)( rpal_blob_getBuffer( frame ) ) + sizeof( RU32 ),
-                                                  rpal_blob_getSize( frame ) ) ) )
+            if( decompressFrame( (RPU8)( rpal_blob_getBuffer( frame ) ) + sizeof( RU32 ),
+                                 rpal_blob_getSize( frame ) - sizeof( RU32 ),
+                                 uncompressedFrame,
+                                 &uncompressedSize ) &&
+                sizeof( RpHcp_ModuleId ) <= uncompressedSize )
             {
                 *pModuleId = *(RpHcp_ModuleId*)uncompressedFrame;
 
                 if( rList_deserialise( pMessages,
                                        uncompressedFrame + sizeof( RpHcp_ModuleId ),
-                                       (RU32)uncompressedSize,
+                                       uncompressedSize - sizeof( RpHcp_ModuleId ),
                                        &bytesConsumed ) )
                 {
                     if( bytesConsumed + sizeof( RpHcp_ModuleId ) == uncompressedSize )
@@ -175,10 +605,6 @@ RBOOL
                     rpal_debug_warning( "failed to deserialize frame" );
                 }
             }
-            else
-            {
-                rpal_debug_warning( "failed to decompress frame: %d", uncompErr );
-            }
 
             rpal_memory_free( uncompressedFrame );
         }
@@ -212,7 +638,10 @@ RBOOL
     if( NULL != pContext &&
         NULL != messages )
     {
-        if( NULL != ( buffer = wrapFrame( moduleId, messages, isForAnotherSensor ) ) )
+        if( NULL != ( buffer = wrapFrame( moduleId,
+                                          messages,
+                                          isForAnotherSensor,
+                                          pContext->frameDictionary ) ) )
         {
             if( 0 != ( frameSize = rpal_blob_getSize( buffer ) ) &&
                 0 != ( frameSize = rpal_hton32( frameSize ) ) &&
@@ -271,7 +700,7 @@ RBOOL
     rBlob frame = NULL;
     RS32 mbedRet = 0;
     RU32 offset = 0;
-    RTIME endTime = ( 0 == timeoutSec ? 0 : rpal_time_getLocal() + timeoutSec );
+    RU64 endTime = ( 0 == timeoutSec ? 0 : rpal_time_getMonotonicCoarseNs() + NSEC_FROM_SEC( timeoutSec ) );
     
     if( NULL != pContext &&
         NULL != targetModuleId &&
@@ -308,7 +737,7 @@ RBOOL
                 break;
             }
         } while( !rEvent_wait( pContext->isBeaconTimeToStop, 100 ) &&
-                 ( 0 == endTime || rpal_time_getLocal() <= endTime ) );
+                 ( 0 == endTime || rpal_time_getMonotonicCoarseNs() <= endTime ) );
 
         if( isSuccess )
         {
@@ -352,7 +781,7 @@ RBOOL
                         break;
                     }
                 } while( !rEvent_wait( pContext->isBeaconTimeToStop, 100 ) &&
-                         ( 0 == endTime || rpal_time_getLocal() <= endTime ) );
+                         ( 0 == endTime || rpal_time_getMonotonicCoarseNs() <= endTime ) );
             }
         }
 
@@ -393,6 +822,9 @@ rList
     RU8 defaultCrashContext = 1;
     RPNCHAR currentPath = NULL;
     CryptoLib_Hash currentHash = { 0 };
+    rList modList = NULL;
+    rSequence modEntry = NULL;
+    RU32 moduleIndex = 0;
 
     if( NULL != ( wrapper = rList_new( RP_TAGS_MESSAGE, RPCM_SEQUENCE ) ) )
     {
@@ -455,6 +887,12 @@ rList
                 // The current version running.
                 rSequence_addRU32( headers, RP_TAGS_PACKAGE_VERSION, GIT_REVISION );
 
+                // The preferred frame dictionary, the cloud confirms the one
+                // to use with a command, until then frames use none.
+                rSequence_addRU32( headers,
+                                   RP_TAGS_HCP_FRAME_DICTIONARY,
+                                   g_frameDictionaries[ ARRAY_N_ELEM( g_frameDictionaries ) - 1 ].version );
+
                 // Get the hash of the current module.
                 if( NULL != ( currentPath = processLib_getCurrentModulePath() ) )
                 {
@@ -473,6 +911,35 @@ rList
                 {
                     rpal_debug_warning( "could not get current HCP path." );
                 }
+
+                // Modules already running, usually loaded from the module cache,
+                // so the cloud only has to confirm or replace them.
+                if( NULL != ( modList = rList_new( RP_TAGS_HCP_MODULE, RPCM_SEQUENCE ) ) )
+                {
+                    for( moduleIndex = 0; moduleIndex < RP_HCP_CONTEXT_MAX_MODULES; moduleIndex++ )
+                    {
+                        if( NULL != g_hcpContext.modules[ moduleIndex ].hModule &&
+                            NULL != ( modEntry = rSequence_new() ) )
+                        {
+                            if( !rSequence_addBUFFER( modEntry,
+                                                      RP_TAGS_HASH,
+                                                      (RPU8)&( g_hcpContext.modules[ moduleIndex ].hash ),
+                                                      sizeof( g_hcpContext.modules[ moduleIndex ].hash ) ) ||
+                                !rSequence_addRU8( modEntry,
+                                                   RP_TAGS_HCP_MODULE_ID,
+                                                   g_hcpContext.modules[ moduleIndex ].id ) ||
+                                !rList_addSEQUENCE( modList, modEntry ) )
+                            {
+                                rSequence_free( modEntry );
+                            }
+                        }
+                    }
+
+                    if( !rSequence_addLIST( headers, RP_TAGS_HCP_MODULES, modList ) )
+                    {
+                        rList_free( modList );
+                    }
+                }
             }
             else
             {
@@ -491,6 +958,245 @@ rList
     return wrapper;
 }
 
+RPRIVATE
+RVOID
+    forgetTlsSession
+    (
+        rpHCPContext* pContext
+    )
+{
+    if( NULL != pContext->tlsSession )
+    {
+        mbedtls_ssl_session_free( (mbedtls_ssl_session*)pContext->tlsSession );
+        rpal_memory_free( pContext->tlsSession );
+        pContext->tlsSession = NULL;
+    }
+}
+
+RPRIVATE
+RVOID
+    saveTlsSession
+    (
+        rpHCPContext* pContext
+    )
+{
+    RS32 mbedRet = 0;
+
+    if( NULL == pContext->tlsSession &&
+        NULL != ( pContext->tlsSession = rpal_memory_alloc( sizeof( mbedtls_ssl_session ) ) ) )
+    {
+        mbedtls_ssl_session_init( (mbedtls_ssl_session*)pContext->tlsSession );
+    }
+
+    if( NULL != pContext->tlsSession &&
+        0 != ( mbedRet = mbedtls_ssl_get_session( &g_tlsConnection.ssl,
+                                                  (mbedtls_ssl_session*)pContext->tlsSession ) ) )
+    {
+        rpal_debug_warning( "failed to keep TLS session: %d", mbedRet );
+        forgetTlsSession( pContext );
+    }
+}
+
+RPRIVATE_TESTABLE
+RU32
+    getReconnectDelay
+    (
+        RU32 nFailedConnects
+    )
+{
+    RU32 maxDelay = RP_HCP_RECONNECT_BASE_DELAY;
+    RU32 delay = 0;
+
+    while( 0 != nFailedConnects &&
+           RP_HCP_RECONNECT_MAX_DELAY > maxDelay )
+    {
+        maxDelay *= 2;
+        nFailedConnects--;
+    }
+    maxDelay = MIN_OF( maxDelay, RP_HCP_RECONNECT_MAX_DELAY );
+
+    // Full jitter, anywhere between now and the ceiling. We use the crypto random
+    // source so that sensors started together do not share a sequence.
+    if( !CryptoLib_genRandomBytes( (RPU8)&delay, sizeof( delay ) ) )
+    {
+        delay = rpal_rand();
+    }
+
+    return delay % ( maxDelay + 1 );
+}
+
+// The caller is responsible for holding the TLS lock.
+RPRIVATE_TESTABLE
+RBOOL
+    tlsConnect
+    (
+        rpHCPContext* pContext,
+        RPCHAR dest,
+        RPCHAR port,
+        RPCHAR caCert
+    )
+{
+    RBOOL isHandshakeComplete = FALSE;
+    RS32 mbedRet = 0;
+    RU64 tlsConnectTimeout = rpal_time_getMonotonicCoarseNs() + NSEC_FROM_SEC( TLS_CONNECT_TIMEOUT );
+
+    if( NULL == pContext ||
+        NULL == dest ||
+        NULL == port ||
+        NULL == caCert )
+    {
+        return FALSE;
+    }
+
+    rpal_memory_zero( &g_tlsConnection, sizeof( g_tlsConnection ) );
+
+    mbedtls_net_init( &g_tlsConnection.server_fd );
+    mbedtls_ssl_init( &g_tlsConnection.ssl );
+    mbedtls_ssl_config_init( &g_tlsConnection.conf );
+    mbedtls_x509_crt_init( &g_tlsConnection.cacert );
+    mbedtls_ctr_drbg_init( &g_tlsConnection.ctr_drbg );
+    mbedtls_entropy_init( &g_tlsConnection.entropy );
+
+    if( 0 == ( mbedRet = mbedtls_ctr_drbg_seed( &g_tlsConnection.ctr_drbg,
+                                                mbedtls_entropy_func,
+                                                &g_tlsConnection.entropy,
+                                                NULL,
+                                                0 ) ) )
+    {
+        if( 0 == ( mbedRet = mbedtls_x509_crt_parse( &g_tlsConnection.cacert,
+                                                     (RPU8)caCert,
+                                                     rpal_string_strlenA( caCert ) + 1 ) ) )
+        {
+            if( 0 == ( mbedRet = mbedtls_net_connect( &g_tlsConnection.server_fd,
+                                                      dest,
+                                                      port,
+                                                      MBEDTLS_NET_PROTO_TCP ) ) )
+            {
+                mbedtls_net_set_nonblock( &g_tlsConnection.server_fd );
+
+                if( 0 == ( mbedRet = mbedtls_ssl_config_defaults( &g_tlsConnection.conf,
+                                                                  MBEDTLS_SSL_IS_CLIENT,
+                                                                  MBEDTLS_SSL_TRANSPORT_STREAM,
+                                                                  MBEDTLS_SSL_PRESET_DEFAULT ) ) )
+                {
+                    mbedtls_ssl_conf_authmode( &g_tlsConnection.conf, _SSL_VALIDATION_FLAG );
+                    mbedtls_ssl_conf_ca_chain( &g_tlsConnection.conf, &g_tlsConnection.cacert, NULL );
+                    mbedtls_ssl_conf_rng( &g_tlsConnection.conf, mbedtls_ctr_drbg_random, &g_tlsConnection.ctr_drbg );
+
+                    if( 0 == ( mbedRet = mbedtls_ssl_setup( &g_tlsConnection.ssl, &g_tlsConnection.conf ) ) )
+                    {
+                        mbedtls_ssl_set_bio( &g_tlsConnection.ssl,
+                                             &g_tlsConnection.server_fd,
+                                             mbedtls_net_send,
+                                             mbedtls_net_recv,
+                                             NULL );
+
+                        // Offer the session of our last connection, if the cloud still
+                        // knows it we skip the certificate exchange and key agreement.
+                        if( NULL != pContext->tlsSession &&
+                            0 != ( mbedRet = mbedtls_ssl_set_session( &g_tlsConnection.ssl,
+                                                                      (mbedtls_ssl_session*)pContext->tlsSession ) ) )
+                        {
+                            rpal_debug_warning( "failed to offer previous TLS session: %d", mbedRet );
+                        }
+
+                        while( 0 != ( mbedRet = mbedtls_ssl_handshake( &g_tlsConnection.ssl ) ) )
+                        {
+                            if( ( MBEDTLS_ERR_SSL_WANT_READ != mbedRet &&
+                                  MBEDTLS_ERR_SSL_WANT_WRITE != mbedRet ) ||
+                                rEvent_wait( pContext->isBeaconTimeToStop, 100 ) ||
+                                rpal_time_getMonotonicCoarseNs() > tlsConnectTimeout )
+                            {
+                                break;
+                            }
+                        }
+
+                        if( 0 == mbedRet )
+                        {
+#ifndef HCP_NO_TLS_VALIDATION
+                            if( 0 == ( mbedRet = mbedtls_ssl_get_verify_result( &g_tlsConnection.ssl ) ) )
+                            {
+#endif
+                                isHandshakeComplete = TRUE;
+                                rpal_debug_info( "TLS handshake complete." );
+#ifndef HCP_NO_TLS_VALIDATION
+                            }
+                            else
+                            {
+                                rpal_debug_error( "failed to validate remote certificate: %d", mbedRet );
+                            }
+#endif
+                        }
+                        else
+                        {
+                            rpal_debug_error( "TLS handshake failed: %d", mbedRet );
+                        }
+
+                        // A failed handshake may have been caused by the session we offered,
+                        // failures to reach the cloud are not a reason to drop it however.
+                        if( !isHandshakeComplete )
+                        {
+                            forgetTlsSession( pContext );
+                        }
+                    }
+                }
+                else
+                {
+                    rpal_debug_error( "error setting TLS defaults: %d", mbedRet );
+                }
+            }
+            else
+            {
+                rpal_debug_error( "error connecting over TLS: %d", mbedRet );
+            }
+        }
+        else
+        {
+            rpal_debug_error( "error parsing C2 cert: %d", mbedRet );
+        }
+    }
+    else
+    {
+        rpal_debug_error( "failed to seed random number generator: %d", mbedRet );
+    }
+
+    if( isHandshakeComplete )
+    {
+        saveTlsSession( pContext );
+    }
+    else
+    {
+#ifdef RPAL_PLATFORM_DEBUG
+        {
+            RCHAR tmpError[ 1024 ] = { 0 };
+            mbedtls_strerror( mbedRet, tmpError, sizeof( tmpError ) );
+            rpal_debug_warning( "failed to handshake: " RF_STR_A, tmpError );
+        }
+#else
+        rpal_debug_warning( "failed to handshake" );
+#endif
+    }
+
+    return isHandshakeComplete;
+}
+
+// The caller is responsible for holding the TLS lock.
+RPRIVATE_TESTABLE
+RVOID
+    tlsDisconnect
+    (
+
+    )
+{
+    mbedtls_ssl_close_notify( &g_tlsConnection.ssl );
+    mbedtls_net_free( &g_tlsConnection.server_fd );
+    mbedtls_x509_crt_free( &g_tlsConnection.cacert );
+    mbedtls_ssl_free( &g_tlsConnection.ssl );
+    mbedtls_ssl_config_free( &g_tlsConnection.conf );
+    mbedtls_ctr_drbg_free( &g_tlsConnection.ctr_drbg );
+    mbedtls_entropy_free( &g_tlsConnection.entropy );
+}
+
 //=============================================================================
 //  Base beacon
 //=============================================================================
@@ -633,6 +1339,7 @@ RU32
     RCHAR currentPortStr[ 6 ] = { 0 };
     rThread syncThread = NULL;
     RBOOL isFirstConnection = TRUE;
+    RU32 nFailedConnects = 0;
 
     UNREFERENCED_PARAMETER( context );
 
@@ -672,114 +1379,16 @@ RU32
         RBOOL isHandshakeComplete = FALSE;
         RBOOL isHeadersSent = FALSE;
 
-        
-        RS32 mbedRet = 0;
-        RTIME tlsConnectTimeout = rpal_time_getLocal() + TLS_CONNECT_TIMEOUT;
-
         rMutex_lock( g_tlsMutex );
-
-        rpal_memory_zero( &g_tlsConnection, sizeof( g_tlsConnection ) );
-
-        mbedtls_net_init( &g_tlsConnection.server_fd );
-        mbedtls_ssl_init( &g_tlsConnection.ssl );
-        mbedtls_ssl_config_init( &g_tlsConnection.conf );
-        mbedtls_x509_crt_init( &g_tlsConnection.cacert );
-        mbedtls_ctr_drbg_init( &g_tlsConnection.ctr_drbg );
-        mbedtls_entropy_init( &g_tlsConnection.entropy );
-
-        if( 0 == ( mbedRet = mbedtls_ctr_drbg_seed( &g_tlsConnection.ctr_drbg,
-                                                    mbedtls_entropy_func,
-                                                    &g_tlsConnection.entropy,
-                                                    NULL,
-                                                    0 ) ) )
-        {
-            if( 0 == ( mbedRet = mbedtls_x509_crt_parse( &g_tlsConnection.cacert,
-                                                         getC2PublicKey(),
-                                                         rpal_string_strlenA( (RPCHAR)getC2PublicKey() ) + 1 ) ) )
-            {
-                if( 0 == ( mbedRet = mbedtls_net_connect( &g_tlsConnection.server_fd,
-                                                          currentDest, 
-                                                          currentPortStr, 
-                                                          MBEDTLS_NET_PROTO_TCP ) ) )
-                {
-                    mbedtls_net_set_nonblock( &g_tlsConnection.server_fd );
-
-                    if( 0 == ( mbedRet = mbedtls_ssl_config_defaults( &g_tlsConnection.conf,
-                                                                      MBEDTLS_SSL_IS_CLIENT,
-                                                                      MBEDTLS_SSL_TRANSPORT_STREAM,
-                                                                      MBEDTLS_SSL_PRESET_DEFAULT ) ) )
-                    {
-                        mbedtls_ssl_conf_authmode( &g_tlsConnection.conf, _SSL_VALIDATION_FLAG );
-                        mbedtls_ssl_conf_ca_chain( &g_tlsConnection.conf, &g_tlsConnection.cacert, NULL );
-                        mbedtls_ssl_conf_rng( &g_tlsConnection.conf, mbedtls_ctr_drbg_random, &g_tlsConnection.ctr_drbg );
-
-                        if( 0 == ( mbedRet = mbedtls_ssl_setup( &g_tlsConnection.ssl, &g_tlsConnection.conf ) ) )
-                        {
-                            mbedtls_ssl_set_bio( &g_tlsConnection.ssl,
-                                                 &g_tlsConnection.server_fd,
-                                                 mbedtls_net_send,
-                                                 mbedtls_net_recv,
-                                                 NULL );
-
-                            while( 0 != ( mbedRet = mbedtls_ssl_handshake( &g_tlsConnection.ssl ) ) )
-                            {
-                                if( ( MBEDTLS_ERR_SSL_WANT_READ != mbedRet &&
-                                      MBEDTLS_ERR_SSL_WANT_WRITE != mbedRet ) ||
-                                    rEvent_wait( g_hcpContext.isBeaconTimeToStop, 100 ) ||
-                                    rpal_time_getLocal() > tlsConnectTimeout )
-                                {
-                                    break;
-                                }
-                            }
-
-                            if( 0 == mbedRet )
-                            {
-#ifndef HCP_NO_TLS_VALIDATION
-                                if( 0 == ( mbedRet = mbedtls_ssl_get_verify_result( &g_tlsConnection.ssl ) ) )
-                                {
-#endif
-                                    isHandshakeComplete = TRUE;
-                                    rpal_debug_info( "TLS handshake complete." );
-#ifndef HCP_NO_TLS_VALIDATION
-                                }
-                                else
-                                {
-                                    rpal_debug_error( "failed to validate remote certificate: %d", mbedRet );
-                                }
-#endif
-                            }
-                            else
-                            {
-                                rpal_debug_error( "TLS handshake failed: %d", mbedRet );
-                            }
-                        }
-                    }
-                    else
-                    {
-                        rpal_debug_error( "error setting TLS defaults: %d", mbedRet );
-                    }
-                }
-                else
-                {
-                    rpal_debug_error( "error connecting over TLS: %d", mbedRet );
-                }
-            }
-            else
-            {
-                rpal_debug_error( "error parsing C2 cert: %d", mbedRet );
-            }
-        }
-        else
-        {
-            rpal_debug_error( "failed to seed random number generator: %d", mbedRet );
-        }
-
+        isHandshakeComplete = tlsConnect( &g_hcpContext, currentDest, currentPortStr, (RPCHAR)getC2PublicKey() );
         rMutex_unlock( g_tlsMutex );
         
         if( isHandshakeComplete )
         {
             // Send the headers
-            rList headers = generateHeaders( isFirstConnection );
+            rList headers = NULL;
+            g_hcpContext.frameDictionary = 0;
+            headers = generateHeaders( isFirstConnection );
             isFirstConnection = FALSE;
             if( NULL != headers )
             {
@@ -791,16 +1400,6 @@ RU32
                 rList_free( headers );
             }
         }
-        else
-        {
-#ifdef RPAL_PLATFORM_DEBUG
-            RCHAR tmpError[ 1024 ] = { 0 };
-            mbedtls_strerror( mbedRet, tmpError, sizeof( tmpError ) );
-            rpal_debug_warning( "failed to handshake: " RF_STR_A, tmpError );
-#else
-            rpal_debug_warning( "failed to handshake" );
-#endif
-        }
 
         if( !isHeadersSent )
         {
@@ -808,13 +1407,7 @@ RU32
             rMutex_lock( g_tlsMutex );
 
             // Clean up all crypto primitives
-            mbedtls_ssl_close_notify( &g_tlsConnection.ssl );
-            mbedtls_net_free( &g_tlsConnection.server_fd );
-            mbedtls_x509_crt_free( &g_tlsConnection.cacert );
-            mbedtls_ssl_free( &g_tlsConnection.ssl );
-            mbedtls_ssl_config_free( &g_tlsConnection.conf );
-            mbedtls_ctr_drbg_free( &g_tlsConnection.ctr_drbg );
-            mbedtls_entropy_free( &g_tlsConnection.entropy );
+            tlsDisconnect();
 
             rMutex_unlock( g_tlsMutex );
         }
@@ -875,13 +1468,7 @@ RU32
 
             if( rMutex_lock( g_tlsMutex ) )
             {
-                mbedtls_ssl_close_notify( &g_tlsConnection.ssl );
-                mbedtls_net_free( &g_tlsConnection.server_fd );
-                mbedtls_x509_crt_free( &g_tlsConnection.cacert );
-                mbedtls_ssl_free( &g_tlsConnection.ssl );
-                mbedtls_ssl_config_free( &g_tlsConnection.conf );
-                mbedtls_ctr_drbg_free( &g_tlsConnection.ctr_drbg );
-                mbedtls_entropy_free( &g_tlsConnection.entropy );
+                tlsDisconnect();
 
                 rMutex_unlock( g_tlsMutex );
             }
@@ -889,7 +1476,17 @@ RU32
             rpal_debug_info( "comms with cloud down" );
         }
 
-        rEvent_wait( g_hcpContext.isBeaconTimeToStop, MSEC_FROM_SEC( 10 ) );
+        // Back off exponentially while the cloud is unreachable. The whole range
+        // is randomized so a fleet disconnected at once does not return in lockstep.
+        if( isHeadersSent )
+        {
+            nFailedConnects = 0;
+        }
+        else
+        {
+            nFailedConnects++;
+        }
+        rEvent_wait( g_hcpContext.isBeaconTimeToStop, getReconnectDelay( nFailedConnects ) );
         rpal_debug_warning( "failed connecting, cycling destination" );
 
         if( currentDest == effectivePrimary )
@@ -909,6 +1506,8 @@ RU32
     rpal_thread_wait( syncThread, MSEC_FROM_SEC( 10 ) );
     rpal_thread_free( syncThread );
 
+    forgetTlsSession( &g_hcpContext );
+
     return 0;
 }
 
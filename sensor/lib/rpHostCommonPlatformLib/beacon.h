@@ -21,6 +21,10 @@ limitations under the License.
 #include <rpHostCommonPlatformLib/rpHCP_Common.h>
 #include <librpcm/librpcm.h>
 
+// Reconnects back off exponentially from the base delay up to the max delay.
+#define RP_HCP_RECONNECT_BASE_DELAY     MSEC_FROM_SEC( 5 )
+#define RP_HCP_RECONNECT_MAX_DELAY      MSEC_FROM_SEC( 60 * 5 )
+
 RBOOL
     startBeacons
     (
@@ -40,4 +44,10 @@ RBOOL
         rList toSend
     );
 
+RBOOL
+    isFrameDictionarySupported
+    (
+        RU32 version
+    );
+
 #endif
@@ -33,6 +33,8 @@ limitations under the License.
 
 #define RPAL_FILE_ID    51
 
+#define _MODULE_CACHE_EXT   _NC( ".mod" )
+
 RPRIVATE
 RVOID
     _cleanupModuleEntry
@@ -83,6 +85,10 @@ RU32
             rpal_memory_free( g_hcpContext.enrollmentToken );
         }
 
+        rpal_memory_free( g_hcpContext.moduleCacheDir );
+        g_hcpContext.moduleCacheDir = NULL;
+        MemorySetFallbackDirectory( NULL );
+
         // If the default crashContext is still present, remove it since
         // we are shutting down properly. If it's non-default leave it since
         // somehow we may have had a higher order crash we want to keep
@@ -104,6 +110,269 @@ RU32
     return 0;
 }
 
+//=============================================================================
+//  Module cache
+//  Modules are kept on disk exactly as received (signature included) in
+//  files named after the module hash. At startup the cached modules are
+//  verified again and loaded before we even reach the cloud.
+//=============================================================================
+RPRIVATE
+RPNCHAR
+    _getModuleCachePath
+    (
+        RPNCHAR cacheDir,
+        CryptoLib_Hash* pHash
+    )
+{
+    RPNCHAR path = NULL;
+    RNCHAR hashStr[ ( sizeof( CryptoLib_Hash ) * 2 ) + 1 ] = { 0 };
+    RPNCHAR hexChars = _NC( "0123456789abcdef" );
+    RU32 i = 0;
+
+    for( i = 0; i < sizeof( pHash->_ ); i++ )
+    {
+        hashStr[ i * 2 ] = hexChars[ pHash->_[ i ] >> 4 ];
+        hashStr[ ( i * 2 ) + 1 ] = hexChars[ pHash->_[ i ] & 0x0F ];
+    }
+
+    if( NULL != ( path = rpal_string_strdup( cacheDir ) ) &&
+        NULL != ( path = rpal_string_strcatEx( path, _NC( "/" ) ) ) &&
+        NULL != ( path = rpal_string_strcatEx( path, hashStr ) ) &&
+        NULL != ( path = rpal_string_strcatEx( path, _MODULE_CACHE_EXT ) ) )
+    {
+        rpal_file_pathToLocalSep( path );
+    }
+
+    return path;
+}
+
+RPRIVATE
+RBOOL
+    _isModuleLoaded
+    (
+        rpHCPContext* hcpContext,
+        RpHcp_ModuleId moduleId,
+        CryptoLib_Hash* pHash
+    )
+{
+    RBOOL isLoaded = FALSE;
+    RU32 moduleIndex = 0;
+
+    for( moduleIndex = 0; moduleIndex < RP_HCP_CONTEXT_MAX_MODULES; moduleIndex++ )
+    {
+        if( 0 != hcpContext->modules[ moduleIndex ].hThread &&
+            moduleId == hcpContext->modules[ moduleIndex ].id &&
+            0 == rpal_memory_memcmp( &hcpContext->modules[ moduleIndex ].hash, pHash, sizeof( *pHash ) ) )
+        {
+            isLoaded = TRUE;
+            break;
+        }
+    }
+
+    return isLoaded;
+}
+
+RPRIVATE_TESTABLE
+RBOOL
+    uncacheModule
+    (
+        RPNCHAR cacheDir,
+        RpHcp_ModuleId moduleId
+    )
+{
+    RBOOL isSuccess = FALSE;
+    rDir hDir = NULL;
+    rFileInfo fileInfo = { 0 };
+    rFile hFile = NULL;
+    RpHcp_ModuleId cachedId = 0;
+    RBOOL isMatch = FALSE;
+
+    if( NULL != cacheDir &&
+        rDir_open( cacheDir, &hDir ) )
+    {
+        isSuccess = TRUE;
+
+        while( rDir_next( hDir, &fileInfo ) )
+        {
+            if( IS_FLAG_ENABLED( RPAL_FILE_ATTRIBUTE_DIRECTORY, fileInfo.attributes ) ||
+                !rpal_string_endswith( fileInfo.fileName, _MODULE_CACHE_EXT ) )
+            {
+                continue;
+            }
+
+            // Only the header is needed to know which module this is.
+            isMatch = FALSE;
+            if( rFile_open( fileInfo.filePath, &hFile, RPAL_FILE_OPEN_EXISTING | RPAL_FILE_OPEN_READ ) )
+            {
+                isMatch = !rFile_read( hFile, sizeof( cachedId ), &cachedId ) ||
+                          moduleId == cachedId;
+                rFile_close( hFile );
+            }
+
+            if( isMatch &&
+                !rpal_file_delete( fileInfo.filePath, FALSE ) )
+            {
+                rpal_debug_warning( "could not remove cached module" );
+                isSuccess = FALSE;
+            }
+        }
+
+        rDir_close( hDir );
+    }
+
+    return isSuccess;
+}
+
+RPRIVATE_TESTABLE
+RBOOL
+    cacheModule
+    (
+        RPNCHAR cacheDir,
+        RpHcp_ModuleId moduleId,
+        RPU8 module,
+        RU32 moduleSize,
+        RPU8 signature,
+        CryptoLib_Hash* pHash
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RPNCHAR path = NULL;
+    rFile hFile = NULL;
+    rpHCPModuleCacheEntry header = { 0 };
+    rFileInfo info = { 0 };
+
+    if( NULL == cacheDir ||
+        NULL == module ||
+        0 == moduleSize ||
+        NULL == signature ||
+        NULL == pHash )
+    {
+        return FALSE;
+    }
+
+    if( NULL == ( path = _getModuleCachePath( cacheDir, pHash ) ) )
+    {
+        return FALSE;
+    }
+
+    if( rpal_file_getInfo( path, &info ) &&
+        sizeof( header ) + moduleSize == info.size )
+    {
+        // Already cached, this is typically a module we loaded from the cache.
+        isSuccess = TRUE;
+    }
+    else
+    {
+        // A module id only ever has one known-good version.
+        rDir_create( cacheDir );
+        uncacheModule( cacheDir, moduleId );
+
+        header.moduleId = moduleId;
+        rpal_memory_memcpy( header.signature, signature, sizeof( header.signature ) );
+        header.moduleSize = moduleSize;
+
+        if( rFile_open( path, &hFile, RPAL_FILE_OPEN_ALWAYS | RPAL_FILE_OPEN_WRITE ) )
+        {
+            if( rFile_write( hFile, sizeof( header ), &header ) &&
+                rFile_write( hFile, moduleSize, module ) )
+            {
+#if defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+                chmod( path, S_IRUSR | S_IWUSR );
+#endif
+                isSuccess = TRUE;
+            }
+
+            rFile_close( hFile );
+        }
+
+        if( !isSuccess )
+        {
+            // A partial entry would only fail verification at the next start.
+            rpal_file_delete( path, FALSE );
+            rpal_debug_warning( "could not cache module %d", moduleId );
+        }
+    }
+
+    rpal_memory_free( path );
+
+    return isSuccess;
+}
+
+RPRIVATE_TESTABLE
+rList
+    getCachedModules
+    (
+        RPNCHAR cacheDir
+    )
+{
+    rList modules = NULL;
+    rSequence mod = NULL;
+    rDir hDir = NULL;
+    rFileInfo fileInfo = { 0 };
+    RPU8 entry = NULL;
+    RU32 entrySize = 0;
+    rpHCPModuleCacheEntry* pEntry = NULL;
+
+    if( NULL == cacheDir )
+    {
+        return NULL;
+    }
+
+    if( NULL == ( modules = rList_new( RP_TAGS_HCP_MODULE, RPCM_SEQUENCE ) ) )
+    {
+        return NULL;
+    }
+
+    if( rDir_open( cacheDir, &hDir ) )
+    {
+        while( rDir_next( hDir, &fileInfo ) )
+        {
+            if( IS_FLAG_ENABLED( RPAL_FILE_ATTRIBUTE_DIRECTORY, fileInfo.attributes ) ||
+                !rpal_string_endswith( fileInfo.fileName, _MODULE_CACHE_EXT ) )
+            {
+                continue;
+            }
+
+            if( !rpal_file_read( fileInfo.filePath, (RPVOID*)&entry, &entrySize, FALSE ) )
+            {
+                continue;
+            }
+
+            pEntry = (rpHCPModuleCacheEntry*)entry;
+
+            // Entries are returned in the same shape as a load command, the
+            // signature is checked when the module gets loaded.
+            if( sizeof( *pEntry ) < entrySize &&
+                pEntry->moduleSize == entrySize - sizeof( *pEntry ) &&
+                NULL != ( mod = rSequence_new() ) )
+            {
+                if( !rSequence_addRU8( mod, RP_TAGS_HCP_MODULE_ID, pEntry->moduleId ) ||
+                    !rSequence_addBUFFER( mod, RP_TAGS_BINARY, pEntry->module, pEntry->moduleSize ) ||
+                    !rSequence_addBUFFER( mod, RP_TAGS_SIGNATURE, pEntry->signature, sizeof( pEntry->signature ) ) ||
+                    !rSequence_addSTRINGN( mod, RP_TAGS_FILE_PATH, fileInfo.filePath ) ||
+                    !rList_addSEQUENCE( modules, mod ) )
+                {
+                    rSequence_free( mod );
+                }
+            }
+            else
+            {
+                rpal_debug_warning( "invalid module cache entry" );
+                rpal_file_delete( fileInfo.filePath, FALSE );
+            }
+
+            rpal_memory_free( entry );
+        }
+
+        rDir_close( hDir );
+    }
+
+    return modules;
+}
+
+//=============================================================================
+//  Commands
+//=============================================================================
 RPRIVATE_TESTABLE
 RBOOL 
     loadModule
@@ -122,6 +391,10 @@ RBOOL
     RPU8 tmpSig = NULL;
     RU32 tmpSigSize = 0;
 
+    RpHcp_ModuleId moduleId = 0;
+    CryptoLib_Hash moduleHash = { 0 };
+    RBOOL isAlreadyLoaded = FALSE;
+
     rpal_thread_func pEntry = NULL;
 
     rpHCPModuleContext* modContext = NULL;
@@ -159,12 +432,25 @@ RBOOL
                                  &tmpSigSize ) &&
             CRYPTOLIB_SIGNATURE_SIZE == tmpSigSize )
         {
+            moduleId = hcpContext->modules[ moduleIndex ].id;
+
             // We got the data, now verify the buffer signature
-            if( CryptoLib_verify( tmpBuff, tmpSize, getRootPublicKey(), tmpSig ) )
+            if( CryptoLib_verify( tmpBuff, tmpSize, getRootPublicKey(), tmpSig ) &&
+                CryptoLib_hash( tmpBuff, tmpSize, &moduleHash ) )
             {
-                // Ready to load the module
-                rpal_debug_info( "loading module in memory" );
-                hcpContext->modules[ moduleIndex ].hModule = MemoryLoadLibrary( tmpBuff, tmpSize );
+                if( _isModuleLoaded( hcpContext, moduleId, &moduleHash ) )
+                {
+                    // The cloud is confirming a module we already loaded from the cache.
+                    rpal_debug_info( "module %d already loaded", moduleId );
+                    isAlreadyLoaded = TRUE;
+                    isSuccess = TRUE;
+                }
+                else
+                {
+                    // Ready to load the module
+                    rpal_debug_info( "loading module in memory" );
+                    hcpContext->modules[ moduleIndex ].hModule = MemoryLoadLibrary( tmpBuff, tmpSize );
+                }
 
                 if( NULL != hcpContext->modules[ moduleIndex ].hModule )
                 {
@@ -199,9 +485,20 @@ RBOOL
 
                             if( 0 != hcpContext->modules[ moduleIndex ].hThread )
                             {
-                                CryptoLib_hash( tmpBuff, tmpSize, &(hcpContext->modules[ moduleIndex ].hash ) );
+                                hcpContext->modules[ moduleIndex ].hash = moduleHash;
                                 hcpContext->modules[ moduleIndex ].isOsLoaded = FALSE;
                                 isSuccess = TRUE;
+
+                                // It's running so it is now our last known-good version.
+                                if( NULL != hcpContext->moduleCacheDir )
+                                {
+                                    cacheModule( hcpContext->moduleCacheDir,
+                                                 moduleId,
+                                                 tmpBuff,
+                                                 tmpSize,
+                                                 tmpSig,
+                                                 &moduleHash );
+                                }
                             }
                             else
                             {
@@ -214,7 +511,7 @@ RBOOL
                         rpal_debug_warning( "Could not find new module's entry point." );
                     }
                 }
-                else
+                else if( !isAlreadyLoaded )
                 {
                     rpal_debug_warning( "Error loading module in memory." );
                 }
@@ -229,8 +526,9 @@ RBOOL
             rpal_debug_warning( "Could not find core module components to load." );
         }
 
-        // Main cleanup
-        if( !isSuccess )
+        // Main cleanup, a module already loaded does not need this spot.
+        if( !isSuccess ||
+            isAlreadyLoaded )
         {
             if( NULL != modContext )
             {
@@ -255,6 +553,62 @@ RBOOL
 }
 
 
+RU32
+    loadCachedModules
+    (
+        rpHCPContext* hcpContext
+    )
+{
+    RU32 nLoaded = 0;
+    rList modules = NULL;
+    rSequence mod = NULL;
+    RPNCHAR path = NULL;
+    RPU8 module = NULL;
+    RU32 moduleSize = 0;
+    RPU8 signature = NULL;
+    RU32 signatureSize = 0;
+
+    if( NULL != hcpContext &&
+        NULL != ( modules = getCachedModules( hcpContext->moduleCacheDir ) ) )
+    {
+        while( rList_getSEQUENCE( modules, RP_TAGS_HCP_MODULE, &mod ) )
+        {
+            if( !rSequence_getSTRINGN( mod, RP_TAGS_FILE_PATH, &path ) ||
+                !rSequence_getBUFFER( mod, RP_TAGS_BINARY, &module, &moduleSize ) ||
+                !rSequence_getBUFFER( mod, RP_TAGS_SIGNATURE, &signature, &signatureSize ) )
+            {
+                continue;
+            }
+
+            // Only an entry that no longer verifies is dropped, a module failing
+            // to load for any other reason, like no free module slot, is kept.
+            if( !CryptoLib_verify( module, moduleSize, getRootPublicKey(), signature ) )
+            {
+                rpal_debug_warning( "dropping cached module that failed verification" );
+                rpal_file_delete( path, FALSE );
+            }
+            else if( loadModule( hcpContext, mod ) )
+            {
+                nLoaded++;
+            }
+            else
+            {
+                rpal_debug_warning( "could not load cached module" );
+            }
+        }
+
+        rList_free( modules );
+    }
+
+    if( 0 != nLoaded )
+    {
+        rpal_debug_info( "%d modules loaded from cache", nLoaded );
+    }
+
+    return nLoaded;
+}
+
+
 RPRIVATE_TESTABLE
 RBOOL 
     unloadModule
@@ -303,6 +657,12 @@ RBOOL
 
             _cleanupModuleEntry( &( hcpContext->modules[ moduleIndex ] ) );
         }
+
+        // The cloud no longer wants this module, don't bring it back at the next start.
+        if( NULL != hcpContext->moduleCacheDir )
+        {
+            uncacheModule( hcpContext->moduleCacheDir, moduleId );
+        }
     }
 
     return isSuccess;
@@ -457,6 +817,7 @@ RBOOL
     rpHCPId emptyId = { 0 };
     RU64 tmpTime = 0;
     rThread hQuitThread = 0;
+    RU32 frameDictionary = 0;
 
     rpHCPIdentStore identStore = {0};
     RPU8 token = NULL;
@@ -537,6 +898,21 @@ RBOOL
             case RP_HCP_COMMAND_UPGRADE:
                 isSuccess = upgradeHcp( seq );
                 break;
+            case RP_HCP_COMMAND_SET_FRAME_DICTIONARY:
+                if( rSequence_getRU32( seq, RP_TAGS_HCP_FRAME_DICTIONARY, &frameDictionary ) )
+                {
+                    // The cloud picks one of the dictionaries we advertised, 0 means none.
+                    if( isFrameDictionarySupported( frameDictionary ) )
+                    {
+                        g_hcpContext.frameDictionary = frameDictionary;
+                        isSuccess = TRUE;
+                    }
+                    else
+                    {
+                        rpal_debug_warning( "unsupported frame dictionary: %d", frameDictionary );
+                    }
+                }
+                break;
             default:
                 break;
             }
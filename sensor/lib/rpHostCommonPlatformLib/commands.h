@@ -19,6 +19,7 @@ limitations under the License.
 
 #include <rpal/rpal.h>
 #include <librpcm/librpcm.h>
+#include "globalContext.h"
 
 #define RP_HCP_COMMAND_LOAD_MODULE          0x01
 #define RP_HCP_COMMAND_UNLOAD_MODULE        0x02
@@ -26,6 +27,7 @@ limitations under the License.
 #define RP_HCP_COMMAND_SET_GLOBAL_TIME      0x04
 #define RP_HCP_COMMAND_QUIT                 0x05
 #define RP_HCP_COMMAND_UPGRADE              0x06
+#define RP_HCP_COMMAND_SET_FRAME_DICTIONARY 0x07
 
 
 RBOOL
@@ -40,5 +42,11 @@ RBOOL
 
     );
 
+RU32
+    loadCachedModules
+    (
+        rpHCPContext* hcpContext
+    );
+
 #endif
 
@@ -0,0 +1,1377 @@
+/* This file was automatically generated by tools/train_frame_dictionary.py. */
+/* Trained on 2000 synthetic frames, seed 42. */
+
+#ifndef _HCP_FRAME_DICTIONARY_V1_H
+#define _HCP_FRAME_DICTIONARY_V1_H
+
+#include <rpal/rpal.h>
+
+static RU8 g_hcpFrameDictionaryV1[] = {
+    0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xd0,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x6c,
+    0x9f, 0x59, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x03,
+    0x3a, 0x99, 0x89, 0xbb, 0x2f, 0xe9, 0xe3, 0x20, 0x49, 0x99, 0x34, 0x2d,
+    0xcb, 0x7b, 0xdb, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x77, 0x36, 0x1e, 0x55, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40,
+    0x30, 0xef, 0x42, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0xca, 0x06, 0x80, 0xa9, 0x34, 0x52, 0x3a, 0xec, 0xa1, 0x98, 0x91, 0x66,
+    0x57, 0x85, 0xf3, 0xf5, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xe1, 0x46, 0x35, 0x0f, 0x25, 0x63, 0x40, 0x00, 0x02, 0xb4, 0x00,
+    0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xcf, 0x5c, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xfb, 0xc7, 0xe7, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x44, 0x13, 0x54, 0x47, 0xd0, 0x49,
+    0x9f, 0x7a, 0x0c, 0x3b, 0xd6, 0x0d, 0x9e, 0xbc, 0x64, 0x62, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x35, 0xfe, 0xe1, 0xde, 0x62,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x09, 0xc0, 0x00, 0x02, 0x75, 0x00, 0x00,
+    0x00, 0x16, 0x03, 0x00, 0x00, 0x17, 0xea, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x40, 0x09, 0xe9, 0xfc, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xa2, 0xef, 0xcf, 0x98, 0x35, 0xe1, 0xf6,
+    0x6f, 0xd5, 0x9a, 0x48, 0x38, 0x6a, 0x59, 0xd2, 0x0f, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x40, 0x63, 0x7d, 0x8b, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xcd, 0x65, 0xe0, 0xbc, 0x5a, 0xcc, 0x0d, 0x54, 0xed,
+    0x85, 0xd9, 0x25, 0x5f, 0x09, 0xe2, 0xf0, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x3e, 0x7e, 0x76, 0x8d, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x71, 0x6d, 0x0c, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x1d, 0x80, 0xb2, 0x1e,
+    0x00, 0xba, 0xe1, 0x47, 0x87, 0xd9, 0x43, 0xe8, 0x52, 0xca, 0x56, 0x6e,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xf3, 0xfc, 0xe7,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x3f, 0x2c, 0x00, 0xd3, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xfe, 0xf3, 0x9b, 0x31, 0x3b, 0xcc, 0x15, 0x77, 0x58, 0x6e, 0xd0,
+    0x11, 0x30, 0x6e, 0xfc, 0x32, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xda, 0x1d, 0x02, 0x44, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00,
+    0x00, 0xd5, 0x55, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x3f, 0xe9, 0x78, 0x6c, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x32, 0xfe, 0xcb, 0xdc, 0x8f, 0x8f, 0x36, 0x01, 0x1b, 0x81, 0xc7,
+    0x01, 0xc4, 0xbd, 0xa7, 0xde, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x1e, 0x05, 0x58, 0x3f, 0xc9, 0x88, 0x1c, 0x00, 0x00, 0x00,
+    0x02, 0x09, 0xc0, 0x00, 0x02, 0x23, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00,
+    0x00, 0xfa, 0x4d, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x40, 0x60, 0x44, 0xa5, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x43, 0x5d, 0xa4, 0xd1, 0x27, 0xb7, 0xac, 0xac, 0x05, 0x4c, 0x68,
+    0x96, 0x96, 0xd6, 0xd3, 0x82, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xbc, 0x10, 0x4f, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x97, 0x92, 0x25, 0x6d, 0xd7,
+    0xf8, 0x98, 0x2a, 0xd6, 0xe8, 0xf8, 0x65, 0xa7, 0x68, 0xb0, 0xb3, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x72, 0x2d, 0xc9, 0x9a,
+    0x74, 0x3d, 0x57, 0xdc, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x40, 0x1b, 0x96, 0x35, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xa4, 0x44, 0x0e, 0x2a, 0xe6, 0x66, 0x87, 0xb8, 0xa9, 0x2d, 0x70,
+    0x27, 0x78, 0x52, 0x38, 0xa8, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x2a, 0x6a, 0xda, 0x99, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x02,
+    0x09, 0xc0, 0x00, 0x02, 0x48, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00,
+    0xc9, 0x24, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f,
+    0x0d, 0xe5, 0x30, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x48, 0xa8, 0x93, 0x9c, 0x9c, 0xca, 0xe9, 0x66, 0x32, 0xc8, 0x58, 0x74,
+    0x60, 0x81, 0x6a, 0xb4, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0xc0, 0x00, 0x02, 0xa5, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x91,
+    0x7f, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xd7,
+    0xd1, 0xe2, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x4c,
+    0x0c, 0x02, 0x3e, 0x1a, 0xb9, 0x8c, 0xc9, 0xe2, 0xec, 0x42, 0x69, 0x6c,
+    0x5d, 0xce, 0xdd, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0xf9, 0x57, 0x6e, 0x91, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x3f, 0xe5, 0xb6, 0xa0, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xac, 0x72, 0x66, 0x40, 0xfa, 0x09, 0x42, 0x40, 0x39, 0x04, 0x41,
+    0x55, 0xa1, 0x3b, 0x59, 0x9d, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x0c, 0x20, 0xf6, 0xb1, 0xfa, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xc3, 0xb5, 0xba, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x69, 0x79, 0x7a, 0x0b,
+    0xf2, 0xb0, 0x67, 0xce, 0x84, 0xf3, 0x8c, 0xd1, 0xdc, 0x4e, 0x0d, 0x06,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x74, 0xc4, 0xe3,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xa0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40,
+    0xa6, 0x84, 0x65, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x2e, 0xa1, 0x0c, 0x76, 0x3b, 0x7a, 0x6a, 0xba, 0x13, 0x9d, 0xf2, 0x14,
+    0xef, 0x8c, 0xb4, 0xff, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xd3, 0x9a, 0x2e, 0x02, 0x09, 0xc0, 0x00, 0x02, 0xed, 0x00, 0x00,
+    0x00, 0x16, 0x03, 0x00, 0x00, 0x11, 0xe5, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x3f, 0xba, 0xf0, 0x91, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xb8, 0xff, 0xbb, 0xfe, 0x8e, 0x70, 0xc6,
+    0xed, 0xd5, 0xe4, 0x59, 0x9c, 0xe6, 0x4a, 0x56, 0x49, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xa6, 0xf0, 0x2a, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x3f, 0xf6, 0xe5, 0x48, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xc2, 0xa5, 0x3f, 0x30, 0xc7, 0x6c, 0x3e, 0xe4,
+    0x3a, 0xb3, 0xf3, 0xf6, 0xe9, 0xdc, 0x6c, 0x00, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0xa4, 0x8e, 0x27, 0x4b, 0x8f, 0x95,
+    0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x37, 0x01,
+    0xbb, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x94, 0x32,
+    0x43, 0x76, 0x9a, 0x78, 0x0d, 0x33, 0x20, 0x85, 0x8a, 0x4b, 0xbb, 0x0c,
+    0x44, 0xc3, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x4a,
+    0x6e, 0xdf, 0x5c, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x3f, 0x72, 0x36, 0xe5, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x84, 0x2f, 0x77, 0x3a, 0x6f, 0x05, 0x5c, 0xf7,
+    0x36, 0xe6, 0x80, 0x74, 0xb2, 0xe4, 0x42, 0xd6, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xd8, 0x91, 0x75, 0xc0, 0x00, 0x02, 0x16,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xbe, 0x15, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x44, 0x7a, 0xf9, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x05, 0xe6, 0x57, 0xf3, 0x59,
+    0x13, 0x97, 0xfb, 0xfa, 0xcd, 0xf1, 0xb1, 0x76, 0xe6, 0x0f, 0xfd, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x31, 0xc8, 0xc0, 0x1b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x24, 0xaf, 0x8d, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x2d, 0xab, 0xd8, 0xe5, 0xb2, 0x58,
+    0x99, 0x8a, 0x46, 0x6c, 0x8d, 0x69, 0x2d, 0x60, 0x4e, 0x5c, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x92, 0xac, 0x31, 0x84, 0x9f,
+    0xcd, 0x38, 0xfc, 0x82, 0x02, 0x09, 0xc0, 0x00, 0x02, 0x3a, 0x00, 0x00,
+    0x00, 0x16, 0x03, 0x00, 0x00, 0x1b, 0xe2, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x3f, 0x97, 0xc0, 0x99, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x74, 0x08, 0x61, 0x31, 0x36, 0xc9, 0xd8,
+    0xf1, 0xfe, 0x56, 0x5c, 0x4c, 0xa8, 0x7e, 0xee, 0x7b, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xbf, 0xdf, 0x2a, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x3f, 0xb3, 0x6f, 0x92, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x9b, 0x10, 0x5a, 0x30, 0xab, 0xc1, 0x29, 0x9c,
+    0x4a, 0x17, 0xe1, 0x78, 0x15, 0xab, 0x0f, 0x6d, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x53, 0x6c, 0xff, 0x0f, 0xf2, 0xd6, 0x0e,
+    0x02, 0xaf, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x5b, 0xc4, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x78, 0xac, 0x1b,
+    0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x61, 0xd1, 0x16,
+    0xb1, 0xec, 0xdf, 0xc0, 0x39, 0xae, 0xec, 0x82, 0x60, 0x7a, 0x44, 0x2e,
+    0xe0, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x96, 0x8f,
+    0x6e, 0xd4, 0x09, 0xbc, 0x60, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x3f, 0x61, 0xe9, 0x54, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x22, 0xcd, 0x4d, 0x26, 0x48, 0x7e, 0x9f,
+    0xe1, 0xe4, 0xeb, 0x72, 0xea, 0x1c, 0x52, 0xc1, 0x54, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xfa, 0x96, 0x00, 0x00, 0x00, 0x2a,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xab, 0x8b, 0xcd, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xf1, 0x04, 0x37, 0xc8, 0x85,
+    0xbf, 0x51, 0x0f, 0x79, 0x1e, 0xa4, 0xc7, 0x20, 0x68, 0xf0, 0xfb, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x2e, 0xc7, 0xc5, 0x82,
+    0xd0, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x9c, 0x71, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x41, 0xbc, 0x5d, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x9f, 0x76, 0xe6, 0x99,
+    0x3e, 0x10, 0x22, 0x92, 0xb2, 0xb9, 0x2b, 0xea, 0x63, 0xe3, 0xa7, 0xd3,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x07, 0xdd,
+    0x5e, 0x10, 0x81, 0x37, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0xb5, 0xef, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x08, 0x79, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x09, 0x2f,
+    0x62, 0x69, 0x6e, 0x2f, 0x7a, 0x73, 0x68, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x3f, 0x48, 0x78, 0x6d, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xb6, 0x71, 0x86, 0xb5, 0xe8, 0x85, 0x30, 0x9d, 0xfd,
+    0x65, 0x46, 0x62, 0x3b, 0x5d, 0xf4, 0xeb, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xb5, 0x4b, 0xfc, 0xb0, 0xbb, 0xa4, 0xad, 0x7f,
+    0x30, 0x30, 0x61, 0x32, 0x66, 0x63, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03,
+    0x00, 0x00, 0xf0, 0x48, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0x1f, 0xf2, 0xd7, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x38, 0xa3, 0x47, 0xc9, 0xd5, 0xe5, 0xb4, 0xb6, 0xb1, 0x5d,
+    0x6d, 0x4e, 0x68, 0xea, 0x65, 0x37, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x9a, 0x02, 0x09, 0xc0, 0x00, 0x02, 0x28, 0x00, 0x00,
+    0x00, 0x16, 0x03, 0x00, 0x00, 0xd9, 0x04, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x3f, 0xef, 0xaf, 0x7e, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xde, 0xef, 0xb6, 0xf5, 0x79, 0x11, 0x59,
+    0xa7, 0x3d, 0x49, 0x85, 0x55, 0xe4, 0xad, 0xf1, 0x02, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xb6, 0xbe, 0xc0, 0x00, 0x02, 0x71,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xc5, 0xd5, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x66, 0x57, 0x88, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xfd, 0x9f, 0xba, 0x44, 0x92,
+    0x5a, 0x99, 0xbc, 0xbf, 0x26, 0x4f, 0xeb, 0xdc, 0xe9, 0xa9, 0xe2, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xd7, 0x70, 0xb8, 0x40,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x40, 0xcb, 0xc2, 0xbf, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xc7, 0x06, 0x13, 0x37, 0x0e, 0xa6, 0xeb, 0xc6, 0xdc, 0xbf, 0x3b,
+    0xc0, 0x31, 0xfc, 0x52, 0x2e, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xce, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x40, 0x42, 0x0f, 0xbe, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xf7, 0xb7, 0xef, 0x59, 0xcb, 0x1a, 0xb7, 0xba,
+    0x18, 0x54, 0x0d, 0xea, 0x67, 0x66, 0x7d, 0xd9, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xb8, 0xa8, 0x97, 0x02, 0x09, 0xc0, 0x00,
+    0x02, 0xaa, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x8d, 0x94, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x42, 0x6d, 0xda,
+    0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x4a, 0x95, 0xec,
+    0x4e, 0x57, 0x37, 0xc9, 0x5c, 0xa4, 0x22, 0xa0, 0x54, 0x68, 0xa4, 0xb9,
+    0xaa, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x19, 0x08,
+    0x36, 0x30, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x73, 0xe0,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x5a, 0xcc,
+    0xfe, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x8f, 0x47,
+    0xde, 0x75, 0x23, 0xa3, 0x2c, 0x39, 0x26, 0x96, 0x38, 0xad, 0x3c, 0x3f,
+    0x84, 0xac, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x29,
+    0x64, 0xf1, 0x5b, 0x3f, 0x35, 0x38, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03,
+    0x00, 0x00, 0xa6, 0x87, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x40, 0xbb, 0x07, 0xc6, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x25, 0xcd, 0x49, 0x51, 0x0d, 0x1c, 0x9e, 0xdc, 0xe2, 0x79,
+    0x61, 0x36, 0x95, 0xae, 0xaa, 0x22, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x4b, 0xf9, 0xfa, 0xbe, 0x34, 0x30, 0x30, 0x35, 0x34,
+    0x37, 0x61, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xe5, 0xa9,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x40, 0x5a,
+    0x1a, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xbd, 0xa8,
+    0x14, 0xc1, 0xdd, 0xbf, 0x8a, 0xc9, 0x2e, 0x65, 0x04, 0x4c, 0xa6, 0x87,
+    0x57, 0xc1, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x91,
+    0x00, 0x02, 0x09, 0xc0, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x16, 0x03,
+    0x00, 0x00, 0x67, 0x47, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0x9d, 0x76, 0x08, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xa3, 0x36, 0x49, 0xb0, 0x36, 0x86, 0x9e, 0x55, 0xc1, 0x19,
+    0xaa, 0x70, 0x80, 0x44, 0xec, 0x8a, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x68, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x40, 0x83, 0x28, 0xec, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xf9, 0xc8, 0x02, 0x19, 0x01, 0x66, 0x38, 0xb0, 0x07, 0x76,
+    0xa4, 0x66, 0x00, 0xca, 0x0d, 0xe4, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x8e, 0xfc, 0xd9, 0xdd, 0xda, 0xc0, 0x00, 0x02, 0x2c,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xda, 0x6c, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x6c, 0xa2, 0x0f, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x55, 0x67, 0xa1, 0xa8, 0x44,
+    0x11, 0x37, 0x33, 0x95, 0x85, 0x1b, 0xad, 0xc9, 0xbe, 0x48, 0x0e, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x39, 0x9f, 0x5d, 0x90,
+    0x30, 0x37, 0x65, 0x61, 0x34, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00,
+    0x00, 0x5e, 0x4a, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x3f, 0xa7, 0xba, 0x3c, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x2c, 0x18, 0x32, 0x46, 0xca, 0x3a, 0x9d, 0x69, 0x62, 0x85, 0xa5,
+    0xd6, 0x44, 0xf7, 0x4e, 0x78, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x78, 0x75, 0x00, 0x02, 0x09, 0xc0, 0x00, 0x02, 0x17, 0x00,
+    0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xcd, 0xaa, 0x6f, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xec, 0x31, 0xe6, 0xfa, 0x8d, 0x90,
+    0x7a, 0x38, 0x51, 0xc1, 0x98, 0x04, 0x71, 0x38, 0xb5, 0x9b, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x9f, 0xc0, 0x00, 0x02, 0xcc,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x6c, 0x77, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x74, 0xe5, 0xb7, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x33, 0x26, 0xbb, 0x1f, 0xc6,
+    0xf0, 0x68, 0x81, 0x6f, 0x28, 0x43, 0x5b, 0xa0, 0x51, 0x5f, 0xb2, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xb4, 0xe9, 0xaa, 0xa8,
+    0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xc2,
+    0xdb, 0x78, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x21,
+    0x91, 0x52, 0x5f, 0xa9, 0x70, 0x74, 0x26, 0x29, 0xd4, 0x59, 0xed, 0x98,
+    0x84, 0xe4, 0x2f, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x95, 0xee, 0xaa, 0x3c, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x3f, 0xe8, 0x8d, 0x89, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x09, 0x66, 0x9d, 0x49, 0x5b, 0xc3, 0x9d, 0x1c, 0xb5,
+    0xc5, 0x4e, 0xaa, 0x32, 0x68, 0x67, 0x8f, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xf8, 0xd0, 0x8b, 0x4f, 0x00, 0x00, 0x00, 0x02,
+    0x09, 0xc0, 0x00, 0x02, 0xe6, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00,
+    0x58, 0xd3, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f,
+    0x31, 0x7e, 0x55, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x7f, 0xd6, 0x57, 0xf7, 0xa1, 0xc2, 0x9a, 0x1a, 0xe5, 0xc9, 0xf3, 0x71,
+    0xd6, 0x79, 0x68, 0xd5, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x09, 0xc0, 0x00, 0x02, 0xca, 0x00, 0x00, 0x00, 0x16, 0x03,
+    0x00, 0x00, 0xa2, 0x46, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0xed, 0x60, 0x0d, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x2b, 0x5c, 0x74, 0x4c, 0xa1, 0x6a, 0x10, 0x76, 0x5e, 0xbd,
+    0xe1, 0xf6, 0xfb, 0x15, 0x3a, 0x43, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x43, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x3f, 0xba, 0xb5, 0x77, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x75, 0xa6, 0xa9, 0x2c, 0x82, 0xf2, 0x6b,
+    0x79, 0xbb, 0xe6, 0xd5, 0x7a, 0xf8, 0x3f, 0xf5, 0xc6, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x36, 0x4a, 0x02, 0x00, 0x00, 0x00,
+    0x0b, 0x81, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xa5, 0xd0, 0x00, 0x00, 0x00,
+    0x17, 0x03, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00,
+    0x00, 0x00, 0x16, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69, 0x62, 0x65,
+    0x00, 0x02, 0x09, 0xc0, 0x00, 0x02, 0xf4, 0x00, 0x00, 0x00, 0x16, 0x03,
+    0x00, 0x00, 0xe3, 0x96, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0xd9, 0x8a, 0xed, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x7b, 0x72, 0x91, 0x4f, 0x7a, 0x49, 0x90, 0x34, 0x06, 0x1b,
+    0x9f, 0xe9, 0x63, 0x4e, 0x85, 0x70, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x50, 0x31, 0x62, 0x62, 0x35, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x03, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x40, 0x4b, 0x27, 0x22, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x06, 0x56, 0x15, 0x0b, 0x42, 0x7b, 0x2a, 0x71,
+    0x10, 0x18, 0xe3, 0x23, 0x35, 0x7f, 0xc8, 0x50, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x64, 0x9f, 0x71, 0x30, 0x31, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x24, 0xd1, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xfa, 0x61, 0x28, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x45, 0x6c, 0x3a, 0xfd, 0x89, 0x14,
+    0x17, 0x7a, 0xac, 0x97, 0x02, 0xaf, 0xba, 0xae, 0x23, 0x34, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xe2, 0xea, 0x04, 0x9e, 0x08,
+    0x35, 0x32, 0x37, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xb4,
+    0xa8, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xa0,
+    0xd7, 0x23, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xfc,
+    0xe6, 0xe2, 0xe4, 0x1c, 0xbf, 0x8f, 0xd7, 0xac, 0xad, 0xe1, 0x66, 0xb1,
+    0xdf, 0x8c, 0x30, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x6e, 0x82, 0x6b, 0x6c, 0x02, 0x09, 0xc0, 0x00, 0x02, 0x11, 0x00, 0x00,
+    0x00, 0x16, 0x03, 0x00, 0x00, 0xa4, 0xc5, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x40, 0xb4, 0xf8, 0xaa, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xd7, 0x47, 0x96, 0xad, 0x7d, 0xdf, 0x19,
+    0xc6, 0x64, 0xaa, 0xd4, 0x93, 0x99, 0x74, 0x84, 0x89, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x93, 0xd2, 0x00, 0x02, 0x09, 0xc0,
+    0x00, 0x02, 0xd8, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x6e, 0x03,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x02, 0xc1,
+    0x3d, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x3f, 0x0f,
+    0x1f, 0x04, 0x9d, 0x5c, 0xe8, 0xe7, 0x67, 0xf4, 0x7f, 0x90, 0xea, 0xc4,
+    0xa3, 0x73, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x5e,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04, 0x81,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x29,
+    0x17, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x05, 0x47, 0x00, 0x00,
+    0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x2f, 0x75, 0x73, 0x72, 0x2f,
+    0x62, 0x69, 0x6e, 0x2f, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x40, 0xa3, 0x53, 0xfb, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x3b, 0xde, 0x22, 0xc6, 0xee, 0x1d, 0x7a, 0x70, 0x82,
+    0xb9, 0xd2, 0xaf, 0xf6, 0xdb, 0xae, 0x26, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xd6, 0xeb, 0x54, 0xd5, 0x00, 0x02, 0x09, 0xc0,
+    0x00, 0x02, 0x27, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x3c, 0xc7,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xbc, 0x61,
+    0x39, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x30, 0x53,
+    0xbf, 0x99, 0x92, 0x41, 0x32, 0xda, 0x2d, 0xbf, 0x72, 0x62, 0x59, 0x52,
+    0x47, 0xf6, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x75,
+    0x00, 0x02, 0x09, 0xc0, 0x00, 0x02, 0xd0, 0x00, 0x00, 0x00, 0x16, 0x03,
+    0x00, 0x00, 0x7e, 0x35, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0x5e, 0xc1, 0x43, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x71, 0x5a, 0x3c, 0x34, 0xab, 0x32, 0x72, 0x50, 0x0d, 0xcf,
+    0x5b, 0xcb, 0x6c, 0xa8, 0x4d, 0x7c, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xec, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0x2e, 0x14, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x0f, 0x5f, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x18, 0x2f,
+    0x75, 0x73, 0x72, 0x2f, 0x73, 0x62, 0x69, 0x6e, 0x02, 0x00, 0x00, 0x00,
+    0x0b, 0x81, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x03, 0x00, 0x00, 0x06, 0x2d, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00,
+    0x00, 0x00, 0x09, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x7a, 0x73, 0x68, 0x00,
+    0x00, 0x16, 0x03, 0x00, 0x00, 0x48, 0xb5, 0x00, 0x00, 0x00, 0x17, 0x03,
+    0x00, 0x00, 0x12, 0xd6, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00,
+    0x22, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x73, 0x79,
+    0x73, 0x74, 0x65, 0x6d, 0x64, 0x2f, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
+    0x64, 0x2d, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x64, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x05, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0xea, 0xce, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x0c, 0x89, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x2f,
+    0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x02, 0x00, 0x00, 0x00,
+    0x0b, 0x81, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x9a, 0x7a, 0x00, 0x00, 0x00,
+    0x17, 0x03, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00,
+    0x00, 0x00, 0x14, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69, 0x62, 0x65,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04, 0x81,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x1e,
+    0x45, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x0b, 0xb7, 0x00, 0x00,
+    0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x75, 0x73, 0x72, 0x2f,
+    0x73, 0x62, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x3a, 0x43, 0x3a, 0x5c, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73, 0x74, 0x65,
+    0x6d, 0x33, 0x32, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x50,
+    0x6f, 0x77, 0x65, 0x72, 0x53, 0x68, 0x65, 0x6c, 0x6c, 0x5c, 0x76, 0x31,
+    0x2e, 0x30, 0x5c, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x68, 0x65, 0x6c,
+    0x6c, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09,
+    0xef, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x2e, 0x43, 0x3a,
+    0x5c, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x46, 0x69, 0x6c,
+    0x65, 0x73, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x20, 0x44,
+    0x65, 0x66, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x5c, 0x4d, 0x73, 0x4d, 0x70,
+    0x45, 0x6e, 0x67, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xac, 0x70, 0xd6,
+    0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x8c, 0x30, 0x7b,
+    0xa5, 0xbf, 0x42, 0x8f, 0xdd, 0xd8, 0x3f, 0x15, 0x80, 0xae, 0xc6, 0xd2,
+    0xea, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xe8, 0x3d,
+    0x5c, 0x74, 0x28, 0x62, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0x6b, 0xae, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x05, 0xcb, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x14, 0x2f,
+    0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x00, 0x00, 0x00, 0x2a,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x92, 0x3c, 0x62, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x65, 0x02, 0xfb, 0x0e, 0xe4,
+    0xe6, 0x2d, 0xf5, 0xca, 0x1c, 0xbf, 0x05, 0x09, 0xc7, 0x18, 0x88, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x8c, 0x37, 0x28, 0x83,
+    0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xe9,
+    0xbe, 0xf8, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xb3,
+    0xfe, 0x33, 0x0e, 0x79, 0x6f, 0x85, 0x37, 0xd2, 0x4e, 0xd7, 0x8e, 0x8a,
+    0x91, 0xd9, 0xf7, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x3d, 0xca, 0x3f, 0x5b, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f,
+    0x3b, 0xd1, 0x13, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0xaa, 0xdf, 0xeb, 0x79, 0xc8, 0x69, 0x46, 0x2f, 0xcc, 0x6f, 0x46, 0xc6,
+    0x98, 0xfe, 0x32, 0x91, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x0e, 0xa4, 0x70, 0x10, 0xee, 0x39, 0x21, 0x2a, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x3f, 0xb4, 0xa2, 0x51, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x24, 0x43, 0x06, 0xe1, 0x6e, 0xd5, 0x3f, 0x99,
+    0x20, 0x7a, 0x06, 0x06, 0xff, 0xce, 0x1f, 0x9f, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xef, 0x0d, 0x5a, 0x55, 0x97, 0xe6, 0x5b,
+    0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xc8, 0x2f, 0x04, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x63, 0xb3, 0xc8, 0x7b,
+    0x1a, 0x7e, 0xa7, 0x79, 0xf2, 0x30, 0x56, 0x73, 0x08, 0xdf, 0xfd, 0xbb,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x24, 0xbb, 0xf1,
+    0x05, 0xb1, 0x3b, 0x2d, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x40, 0x0f, 0xfb, 0x37, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x9f, 0x0d, 0x9b, 0x0e, 0xd4, 0x77, 0x35, 0xec,
+    0x96, 0xdd, 0x58, 0xb4, 0x0d, 0xfa, 0x2c, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xdc, 0x2b, 0x87, 0x55, 0x00, 0x2a, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x3f, 0x7c, 0x21, 0x0b, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xe3, 0x33, 0xd3, 0xc9, 0x92, 0x2e, 0x6e,
+    0xf7, 0xa0, 0xc1, 0xa5, 0xf2, 0x9e, 0xb1, 0x2e, 0x87, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x28, 0x26, 0x40, 0x1e, 0xf4, 0x89,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04, 0x81,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x2d,
+    0xe0, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x10, 0x2f, 0x00, 0x00,
+    0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x75, 0x73, 0x72, 0x2f,
+    0x6c, 0x69, 0x62, 0x65, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x40, 0x20, 0x30, 0xe9, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x9a, 0x1c, 0x52, 0xc2, 0xc6, 0x6d, 0x5f, 0xc9, 0x53,
+    0xe3, 0x28, 0xc0, 0x8f, 0xb7, 0xfd, 0xcd, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x6d, 0xbc, 0x05, 0xa0, 0x00, 0x00, 0x2a, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x20, 0xde, 0x4c, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xed, 0x05, 0x29, 0x04, 0xdb, 0xc2,
+    0xd2, 0xe7, 0x82, 0x27, 0x8f, 0x90, 0x68, 0xa8, 0xeb, 0xa9, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xbb, 0x81, 0xa2, 0x1e, 0x8b,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xb0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f,
+    0x61, 0xc5, 0x4a, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x54, 0x0f, 0x64, 0x33, 0xf1, 0x1c, 0x56, 0x3d, 0xa0, 0x6a, 0x08, 0xe7,
+    0x3f, 0xff, 0xc4, 0x0b, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x80, 0x75, 0x3a, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x3f, 0xed, 0x4f, 0x38, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xcf, 0xe0, 0xc5, 0x3c, 0x5e, 0x23, 0xf8, 0x37, 0x25,
+    0xcf, 0x50, 0xb6, 0xf6, 0x4b, 0x39, 0x36, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x76, 0x4a, 0x8b, 0x6c, 0x00, 0x00, 0x2a, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xe2, 0x18, 0x25, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xcc, 0x50, 0x30, 0x58, 0x09, 0xe5,
+    0x91, 0x09, 0xcf, 0xa9, 0x14, 0x24, 0xec, 0xa8, 0xf7, 0xa4, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xba, 0xd0, 0x44, 0x70, 0xbe,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x3f, 0xb8, 0xad, 0x80, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xf6, 0x25, 0x63, 0x1a, 0xa5, 0x09, 0xe0, 0x65, 0x5b, 0x44, 0x95,
+    0x60, 0x65, 0xb2, 0xe8, 0x04, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x10, 0xce, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x0a, 0x81, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0x82, 0x67, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00,
+    0x00, 0x19, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x6c,
+    0x69, 0x62, 0x6f, 0x62, 0x6a, 0x63, 0x2e, 0x41, 0x35, 0x38, 0x2e, 0x78,
+    0x6d, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x19, 0xb5,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x51, 0x75,
+    0xe4, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xf4, 0x5e,
+    0xbf, 0x23, 0x31, 0xd1, 0x1b, 0x02, 0x7b, 0x47, 0x9f, 0xd4, 0xef, 0x39,
+    0xc8, 0x60, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x70,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x03, 0x81,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x60,
+    0x69, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x13, 0x49, 0x00, 0x00,
+    0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x2d, 0x2f, 0x53, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x2f, 0x4c, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x0a, 0x81, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0x43, 0x2b, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00,
+    0x00, 0x23, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73,
+    0x5c, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x02, 0x00, 0x00, 0x00,
+    0x0b, 0x81, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x03, 0x81, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x6a, 0xcb, 0x00, 0x00, 0x00,
+    0x17, 0x03, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00,
+    0x00, 0x00, 0x2d, 0x2f, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2f, 0x4c,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x03, 0x81,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x68,
+    0xe4, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x03, 0x26, 0x00, 0x00,
+    0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x2d, 0x2f, 0x53, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x2f, 0x4c, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x03, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0xb0, 0x76, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x04, 0x4b, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x0f, 0x2f,
+    0x75, 0x73, 0x72, 0x2f, 0x73, 0x62, 0x69, 0x6e, 0x53, 0x54, 0x45, 0x4d,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xb8, 0xb3, 0xf4, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x64, 0xab, 0x14, 0x33,
+    0xaa, 0x07, 0x63, 0xde, 0x0c, 0xe0, 0x77, 0x07, 0x92, 0x74, 0x87, 0x01,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x90, 0x0a, 0x26,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x09, 0xfa, 0x90, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xf3, 0xca, 0x62, 0x36,
+    0xaf, 0x4e, 0x89, 0xe6, 0xc4, 0x70, 0x91, 0x85, 0x2a, 0x2e, 0xb3, 0x3b,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xe0, 0xed, 0xd2,
+    0xda, 0x01, 0xe3, 0x39, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xbd, 0x35,
+    0x49, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xc4, 0x56,
+    0x89, 0xa0, 0x3d, 0x43, 0x18, 0x8f, 0x1c, 0x49, 0x8f, 0x62, 0x19, 0xc6,
+    0xef, 0x4f, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x57,
+    0xc4, 0xa2, 0x27, 0x1b, 0xb2, 0x4b, 0x00, 0x7b, 0x6f, 0x6e, 0x64, 0x65,
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xd6, 0x5b, 0xe8,
+    0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xbb, 0xfb, 0xae,
+    0x94, 0x07, 0xc8, 0xb1, 0x87, 0x30, 0xcc, 0xb0, 0x10, 0xef, 0xe1, 0x85,
+    0x1d, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xae, 0x82,
+    0x96, 0x9a, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x0b, 0xf4, 0x00,
+    0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x20, 0x43, 0x3a, 0x5c, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73, 0x74, 0x65,
+    0x6d, 0x33, 0x32, 0x5c, 0x63, 0x6f, 0x6e, 0x68, 0x6f, 0x73, 0x74, 0x2e,
+    0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00,
+    0x38, 0x5c, 0x3f, 0x3f, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x45, 0xf3,
+    0x21, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x17, 0x16,
+    0x86, 0x19, 0x3a, 0xf8, 0x02, 0x9d, 0xa9, 0xe2, 0x1a, 0x8c, 0x46, 0xf9,
+    0xbd, 0xbd, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x5a,
+    0x12, 0x46, 0xae, 0xcf, 0x36, 0x01, 0xa9, 0xe4, 0x6e, 0x64, 0x65, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xa9, 0x7c, 0xa3, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x9d, 0xb6, 0xf8, 0xb5,
+    0x2c, 0x99, 0x2a, 0xdd, 0x28, 0x81, 0xbc, 0xad, 0xfe, 0xbd, 0xbc, 0x35,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x5b, 0x3c, 0x31,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x24, 0x2e, 0xd8, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xb9, 0xd6, 0xcf, 0x68,
+    0x13, 0x41, 0x8a, 0xfd, 0x56, 0xd2, 0xc7, 0xce, 0xbc, 0xe0, 0x5a, 0xf3,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xcd, 0xfb, 0xe8,
+    0x58, 0xa0, 0x59, 0xbc, 0x75, 0x73, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x03, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x40, 0xd5, 0x31, 0x60, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xe8, 0x66, 0xd6, 0x31, 0x2c, 0x91, 0x3c, 0x2d,
+    0x6a, 0x2a, 0x35, 0xf2, 0x08, 0xf0, 0xfc, 0xd1, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xde, 0x6b, 0x6f, 0x02, 0x00, 0x00, 0x00,
+    0x0b, 0x81, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x3d, 0x43, 0x3a, 0x5c,
+    0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x33, 0x32, 0x5c, 0x4c, 0x6f, 0x67, 0x46, 0x69, 0x6c, 0x65,
+    0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x80, 0xeb, 0x61, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x91, 0xe4, 0x35, 0x42,
+    0xe1, 0x21, 0x2b, 0xdf, 0xc7, 0xe9, 0x9b, 0xe2, 0x7e, 0x92, 0x68, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x3f, 0xcb, 0x63, 0xe1,
+    0xc2, 0x1d, 0x47, 0xbf, 0x75, 0x73, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x03, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x40, 0x0d, 0x05, 0x50, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x7d, 0xb1, 0x21, 0xd3, 0xa3, 0x19, 0xf3, 0xd0,
+    0x15, 0x58, 0x97, 0x2b, 0xa3, 0x62, 0xde, 0x55, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x34, 0x76, 0x65, 0x53, 0x59, 0x53, 0x54,
+    0x45, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x8f, 0x15,
+    0x18, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x49, 0x50,
+    0x0c, 0xfe, 0xf4, 0x17, 0x08, 0xce, 0x55, 0x0c, 0x18, 0x47, 0xbf, 0x4f,
+    0xac, 0xef, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x32,
+    0x61, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x3a, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3e, 0xf8, 0x1d, 0xe3,
+    0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x78, 0x7a, 0x70,
+    0x57, 0x2f, 0xf7, 0x0d, 0x40, 0xf0, 0xdc, 0x7a, 0x1d, 0xd2, 0x10, 0x66,
+    0x7d, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x12, 0x93,
+    0xa1, 0xaf, 0x0d, 0x26, 0x45, 0x52, 0x56, 0x49, 0x43, 0x45, 0x00, 0x00,
+    0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xb5, 0x3a, 0x02, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xb7, 0x90, 0x11, 0x54, 0x8e, 0x5d,
+    0x31, 0xf1, 0xd8, 0xc4, 0xed, 0x99, 0x17, 0x2b, 0x6c, 0x16, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xca, 0x70, 0x6f, 0x6e, 0x64,
+    0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x60, 0xd3,
+    0x10, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x3e, 0x7d,
+    0x73, 0x7e, 0x66, 0xd3, 0x96, 0xc7, 0xc9, 0x7e, 0x9e, 0x37, 0xf2, 0x23,
+    0xda, 0x96, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x4d,
+    0x72, 0x6f, 0x6f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40,
+    0x75, 0xbf, 0x45, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x5d, 0x24, 0xe6, 0x2a, 0xc5, 0xfd, 0x59, 0x64, 0x73, 0xa7, 0x69, 0x0c,
+    0xb7, 0xb9, 0x05, 0xbf, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x86, 0xf8, 0xe7, 0x49, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x3f, 0xc5, 0x7d, 0x1d, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x28, 0xc2, 0x5c, 0xd5, 0x26, 0x92, 0x2f, 0xe3, 0x41,
+    0xb7, 0x2b, 0x40, 0xed, 0x93, 0x4f, 0x5b, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x88, 0xa4, 0xcf, 0x85, 0x72, 0x00, 0x00, 0x00,
+    0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x40, 0x9f, 0x1e, 0x19, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x15, 0xfd, 0x21, 0x01, 0xea, 0x3c, 0xa8,
+    0x6d, 0xb7, 0x47, 0x53, 0xeb, 0xa1, 0x97, 0xef, 0xe8, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xe7, 0xa1, 0xfe, 0xd5, 0xa6, 0xa2,
+    0x00, 0x17, 0x03, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x14, 0x06,
+    0x00, 0x00, 0x00, 0x20, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f,
+    0x77, 0x73, 0x5c, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c,
+    0x73, 0x76, 0x63, 0x68, 0x6f, 0x73, 0x74, 0x2e, 0x65, 0x78, 0x65, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x2e, 0x43, 0x3a, 0x5c,
+    0x57, 0x69, 0x6e, 0x64, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x3f, 0x42, 0x21, 0x5c, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x3a, 0xac, 0x63, 0xd5, 0x50, 0x27, 0xe2, 0x83, 0x00,
+    0x84, 0x40, 0x7c, 0xe5, 0xdd, 0x5f, 0x4a, 0x00, 0x00, 0x04, 0x0e, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xee, 0xa5, 0x06, 0x16, 0x65, 0x72, 0x00, 0x00,
+    0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x3d, 0x0e, 0xb4, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x92, 0xa2, 0x55, 0x1c, 0x37, 0x45,
+    0xbf, 0x9b, 0x8f, 0x57, 0xcb, 0x9f, 0x88, 0xda, 0x23, 0x75, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xcc, 0xdb, 0xa2, 0x38, 0x22,
+    0x00, 0x05, 0x75, 0x73, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0xde, 0x8b, 0xb9, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x53, 0x3e, 0x4e, 0xa0, 0x89, 0xf3, 0x98, 0x2c, 0xf3, 0x0c,
+    0x5c, 0x82, 0xe6, 0xf7, 0xea, 0x57, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xb9, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xa9, 0xec,
+    0x3b, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x85, 0x80,
+    0x30, 0xb2, 0x21, 0xa3, 0xc1, 0x72, 0x2a, 0x66, 0x12, 0x4e, 0x32, 0x82,
+    0x44, 0x31, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x04,
+    0x2f, 0xe3, 0x06, 0x24, 0x71, 0x60, 0x66, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x3f, 0x68, 0xff, 0x26, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x3c, 0x9f, 0xdc, 0x9c, 0x0d, 0x01, 0x4a, 0xe2,
+    0xc5, 0x3c, 0x19, 0x34, 0x5b, 0xbe, 0x64, 0xd0, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x7c, 0x2e, 0xf1, 0x10, 0x59, 0xd5, 0x97,
+    0x00, 0x05, 0x75, 0x73, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03,
+    0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0x10, 0x17, 0x31, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x89, 0x50, 0x62, 0x4a, 0xf5, 0xa0, 0x35, 0x4c, 0x70, 0x62,
+    0x0c, 0xaf, 0xae, 0x86, 0xd2, 0xdf, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xf1, 0x70, 0x6f, 0x6e, 0x64, 0x65, 0x72, 0x00, 0x00,
+    0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x4c, 0xa4, 0xae, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x20, 0x1a, 0x47, 0x92, 0x05, 0x26,
+    0x0f, 0xc4, 0xeb, 0x36, 0x8c, 0xff, 0x25, 0x8a, 0x84, 0x99, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x6a, 0x6f, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xc8, 0x05, 0x4d, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x52, 0xb8, 0x9c, 0xcd, 0x32, 0xf4,
+    0x24, 0x9e, 0x97, 0xf6, 0xf1, 0x8d, 0x1f, 0x49, 0xf3, 0xb1, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xa8, 0xb2, 0xd0, 0x81, 0x6e,
+    0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03,
+    0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x40, 0x62, 0x8c, 0xca, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x4f, 0xe7, 0x17, 0xc7, 0x8e, 0xef, 0xb8, 0xa1, 0x87, 0x71,
+    0x47, 0x67, 0xdc, 0xf3, 0x75, 0x81, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x1b, 0x65, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00,
+    0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x40, 0xc0, 0xd1, 0x36, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x8b, 0x75, 0xe2, 0x75, 0xf8, 0xe0, 0xda, 0x3c, 0x9d, 0xb5, 0xc2,
+    0xa8, 0xad, 0x71, 0xdd, 0x5f, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x2c, 0xa3, 0xc9, 0xa6, 0x48, 0x82, 0x72, 0x6f, 0x6f, 0x74,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x21, 0x1d, 0xcc, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x10, 0x90, 0x01, 0x2e,
+    0xdb, 0xa4, 0x98, 0x6f, 0xc5, 0x0b, 0x3a, 0xdd, 0xa2, 0xd7, 0x01, 0xcf,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x61, 0x34, 0xc6,
+    0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03,
+    0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x40, 0x8d, 0x09, 0x8f, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x1b, 0x02, 0x5e, 0x35, 0x7f, 0x44, 0xf0, 0x60, 0x7e, 0x7b,
+    0xdb, 0xe8, 0x5e, 0x13, 0x67, 0x9a, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x4c, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00,
+    0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x40, 0x17, 0xd7, 0xf5, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xee, 0xd3, 0x79, 0x05, 0x78, 0xcb, 0x77, 0x7a, 0xab, 0x40, 0x90,
+    0x92, 0xb4, 0x41, 0xf1, 0xc9, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x2b, 0x97, 0xe1, 0x49, 0xdd, 0xae, 0x00, 0x05, 0x75, 0x73,
+    0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x3b,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xe0, 0x62,
+    0xf3, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x88, 0xc0,
+    0x25, 0xc5, 0xfd, 0x9b, 0x20, 0xff, 0x2e, 0xa5, 0x03, 0x19, 0x7e, 0x7d,
+    0xf3, 0xe9, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xa5,
+    0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xa7, 0xb6, 0xe1, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x76, 0xc0, 0xa2, 0x6f, 0x9e, 0xe3,
+    0x24, 0x56, 0x9d, 0xb8, 0xd4, 0x2c, 0xd3, 0xce, 0xa1, 0x2a, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x7a, 0x42, 0x86, 0xe1, 0x29,
+    0x21, 0x05, 0xdc, 0x8b, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x12, 0x86,
+    0xbc, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xa5, 0xb1,
+    0x2c, 0x92, 0xd8, 0x4c, 0x6b, 0xe6, 0x43, 0x0a, 0x3f, 0x11, 0xfd, 0x1b,
+    0x8a, 0x27, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x8d,
+    0x76, 0xfe, 0x99, 0xe7, 0x18, 0x43, 0x6f, 0xea, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x03, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x40, 0x02, 0xfb, 0x6b, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x4e, 0x1b, 0xf5, 0x2f, 0x2f, 0x07, 0x9e, 0x3d,
+    0xff, 0x3a, 0xc7, 0xc7, 0xcb, 0xf0, 0xb4, 0x42, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xfe, 0xf2, 0x34, 0xe1, 0xe8, 0x1a, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xbb, 0x1c, 0x09, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x5f, 0xf3, 0x27, 0xac,
+    0xa0, 0x6a, 0x0e, 0xe0, 0x7e, 0x1d, 0x62, 0x6b, 0x4c, 0xcd, 0xf5, 0x47,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x79, 0x8d, 0x7d,
+    0x56, 0xb0, 0x03, 0x26, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f,
+    0x62, 0x34, 0x8c, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x34, 0xb4, 0x1f, 0x74, 0x1d, 0xfc, 0x57, 0x16, 0xdf, 0xbe, 0xb7, 0x41,
+    0x06, 0xd2, 0x4d, 0x3c, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x03, 0xe6, 0x36, 0xd1, 0x8a, 0x9b, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x3f, 0x98, 0xe1, 0xd1, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x5c, 0x40, 0x4b, 0xa9, 0xaf, 0x96, 0x43, 0x38,
+    0x7f, 0xec, 0x6e, 0x1e, 0x12, 0x73, 0xf6, 0x44, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xa2, 0xb4, 0xc0, 0x8f, 0xed, 0x4b, 0x39,
+    0x53, 0x54, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40,
+    0x18, 0x41, 0x05, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0xc8, 0x13, 0x52, 0x3e, 0xf9, 0xcd, 0x1e, 0x0b, 0x02, 0x77, 0xb8, 0x7f,
+    0x4d, 0x17, 0x99, 0x58, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xe3, 0x23, 0x1a, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x40, 0x5c, 0xfc, 0x72, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xd1, 0xc7, 0x86, 0xaf, 0xeb, 0x7e, 0x4b, 0x76, 0xde, 0x63,
+    0x78, 0x06, 0x0d, 0xe2, 0x04, 0x14, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x55, 0x76, 0xf0, 0xdf, 0xc4, 0x05, 0x75, 0x73, 0x65,
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x5e, 0x7f, 0xfa,
+    0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xa1, 0x67, 0x26,
+    0xd4, 0x27, 0xe6, 0xa4, 0x20, 0xa7, 0xf7, 0x92, 0x2a, 0x9d, 0x70, 0xf5,
+    0x18, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xbe, 0x50,
+    0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xf8, 0x24, 0x1e, 0x00, 0x00, 0x04,
+    0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x23, 0x26, 0x22, 0x25, 0x86, 0x88,
+    0xe4, 0x47, 0x75, 0x25, 0x81, 0x02, 0xa7, 0x98, 0xe7, 0x5d, 0x00, 0x00,
+    0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x49, 0x5d, 0xa8, 0xa8, 0xb9,
+    0x32, 0xa1, 0x96, 0x42, 0x61, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00,
+    0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x3f, 0x21, 0x1e, 0x70, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x1c, 0x4f, 0xd5, 0xb1, 0xfa, 0xca, 0x72, 0x2f, 0x72, 0x43, 0xf0,
+    0xac, 0xbe, 0x74, 0x98, 0xec, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x33, 0x1f, 0xe0, 0xb0, 0xa6, 0xd1, 0x45, 0x00, 0x00, 0x00,
+    0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x10, 0x08,
+    0x00, 0x00, 0x01, 0x5d, 0x3f, 0x4c, 0xbb, 0xdb, 0x00, 0x00, 0x04, 0x0d,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x79, 0x50, 0x89, 0x3b, 0xf1, 0x66, 0x80,
+    0x3c, 0xa2, 0x78, 0x27, 0xf5, 0x00, 0xd2, 0x5c, 0x20, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x5d, 0x1e, 0x10, 0x80, 0x25, 0xc2,
+    0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x25, 0x54, 0x8e, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xa7, 0x57, 0xeb, 0x85, 0x36,
+    0xa1, 0x5b, 0x7e, 0x1d, 0xa4, 0xb3, 0xea, 0xf6, 0xe3, 0x78, 0xe3, 0x00,
+    0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x85, 0xc3, 0x6c, 0x22,
+    0x03, 0x85, 0xbd, 0x98, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3e, 0xfb, 0xe4,
+    0xc3, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x4d, 0xaa,
+    0x02, 0xc1, 0x18, 0xc8, 0x1f, 0xeb, 0x9a, 0x34, 0x96, 0xe6, 0x33, 0x2f,
+    0xab, 0x59, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x07,
+    0x17, 0x25, 0xd8, 0xbf, 0xf1, 0x47, 0xf2, 0x94, 0x45, 0x52, 0x56, 0x49,
+    0x43, 0x45, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x05, 0xee,
+    0xcb, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x04, 0x75,
+    0x25, 0x84, 0x81, 0xa8, 0x94, 0xf7, 0x56, 0xf3, 0x90, 0x2f, 0xa4, 0xa5,
+    0x77, 0xa1, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x46,
+    0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f,
+    0x45, 0x3a, 0x76, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0xe9, 0xab, 0x2c, 0xc6, 0x19, 0xb6, 0x09, 0x6b, 0x8f, 0x4f, 0x2f, 0xed,
+    0xae, 0x6d, 0x56, 0x80, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x13, 0xad, 0xdc, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x3f, 0x27, 0xbd, 0xf0, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xb2, 0xb8, 0xf4, 0x4d, 0xd9, 0xa0, 0xed, 0x92, 0x15, 0x32, 0x1b,
+    0x0a, 0x43, 0x6e, 0xec, 0xb9, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x5f, 0x24, 0x7f, 0x4f, 0x0e, 0xf8, 0x05, 0x72, 0x6f, 0x6f,
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x55, 0x92, 0xa9,
+    0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x70, 0xf6, 0xd8,
+    0xbf, 0x8e, 0x49, 0xff, 0x45, 0x92, 0x7c, 0x23, 0x1b, 0xa5, 0xe0, 0x64,
+    0x84, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x18, 0xdb,
+    0x77, 0x2d, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03,
+    0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x40, 0xc5, 0x52, 0x6e, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xef, 0x1c, 0xd6, 0xfb, 0x9a, 0x24, 0x31, 0x66, 0x7e, 0xeb,
+    0x47, 0xd6, 0xc6, 0x27, 0xed, 0x6c, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xc0, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0x16, 0x1d, 0x4e, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xc0, 0x37, 0x1a, 0x87, 0xb7, 0x37, 0xa7, 0x41, 0x2e, 0xb5,
+    0x92, 0x04, 0x03, 0x28, 0x49, 0xee, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x97, 0x2a, 0xa4, 0x7c, 0x89, 0x00, 0x00, 0x5d, 0x03,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0xf9, 0x7c, 0x95, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xae, 0xd7, 0xd5, 0x64, 0x89, 0xc9, 0x0e, 0x72, 0x3d, 0x12,
+    0x64, 0xe2, 0x6c, 0x00, 0xce, 0xe1, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xd0, 0x45, 0xfa, 0x1e, 0x9d, 0xbd, 0x33, 0x9b, 0xcf,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x19, 0x97, 0x66, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x87, 0xd9, 0xdd, 0x33,
+    0x05, 0x69, 0x16, 0xa1, 0x7b, 0x0f, 0x16, 0xe5, 0x6e, 0x9d, 0xe9, 0x8e,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xdd, 0xa7, 0xa2,
+    0xf8, 0xde, 0xdb, 0x03, 0x56, 0x49, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x03, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x3f, 0x02, 0x93, 0x9d, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0x57, 0x7b, 0x08, 0x85, 0x34, 0xa2, 0xa2, 0x6c,
+    0x8e, 0xbc, 0x2e, 0xae, 0x19, 0x48, 0x4d, 0x48, 0x00, 0x00, 0x04, 0x0e,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xd9, 0x85, 0x86, 0x53, 0x54, 0x45, 0x4d,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x2f, 0xc6, 0xc4, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xc6, 0x60, 0x44, 0x20,
+    0x8e, 0xdd, 0x85, 0x70, 0x91, 0x73, 0x0d, 0x5e, 0xbd, 0xee, 0x3c, 0x24,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x6b, 0xc6, 0x83,
+    0x05, 0x75, 0x73, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x3f, 0x0a, 0xcd, 0xf2, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x6a, 0xb5, 0x65, 0x38, 0x1f, 0x6c, 0xd7, 0xe6, 0xc8, 0x6d, 0x9c,
+    0x62, 0xd6, 0x8e, 0x78, 0xba, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xad, 0x4e, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x0a, 0x81, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0xd2, 0xe6, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00,
+    0x00, 0x1b, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x6c,
+    0x69, 0x62, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x65, 0x56, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x87, 0x06, 0x00, 0x00, 0x00, 0x14, 0x4e, 0x54, 0x20, 0x41, 0x55, 0x54,
+    0x48, 0x4f, 0x52, 0x49, 0x54, 0x59, 0x5c, 0x53, 0x59, 0x53, 0x54, 0x45,
+    0x4d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3e, 0xf8, 0x45, 0x4e,
+    0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00,
+    0x00, 0x00, 0x05, 0x72, 0x6f, 0x6f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0x03, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x3f, 0xd1, 0x9b, 0xe6, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0x80, 0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69, 0x62,
+    0x63, 0x2e, 0x73, 0x6f, 0x2e, 0x36, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c,
+    0x00, 0x00, 0x7f, 0x0a, 0x1b, 0x0e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x21, 0xaa, 0xc2, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x98, 0x6e, 0x20, 0x2d, 0x69,
+    0x4e, 0x4f, 0x4e, 0x45, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00,
+    0x03, 0xe8, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x05, 0x75,
+    0x73, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00,
+    0x2b, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x3d,
+    0x56, 0x3a, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x02,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x03, 0x81,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x5d,
+    0xec, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x0a, 0x7f, 0x00, 0x00,
+    0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x13, 0x2f, 0x75, 0x73, 0x72, 0x2f,
+    0x73, 0x62, 0x69, 0x6e, 0x20, 0x42, 0x79, 0x70, 0x61, 0x73, 0x73, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x87, 0x06, 0x00, 0x00, 0x00, 0x14, 0x4e, 0x54, 0x20, 0x41, 0x55, 0x54,
+    0x48, 0x4f, 0x52, 0x49, 0x54, 0x59, 0x5c, 0x53, 0x59, 0x53, 0x54, 0x45,
+    0x4d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x32, 0xa4, 0x00, 0x00,
+    0x00, 0x17, 0x03, 0x00, 0x00, 0x0e, 0x3a, 0x00, 0x00, 0x00, 0x14, 0x06,
+    0x00, 0x00, 0x00, 0x21, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f,
+    0x77, 0x73, 0x5c, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c,
+    0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x2e, 0x65, 0x78, 0x65,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x21, 0x43, 0x3a,
+    0x72, 0x73, 0x69, 0x73, 0x74, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x41, 0x36, 0x32, 0x2e, 0x74,
+    0x72, 0x61, 0x63, 0x65, 0x76, 0x33, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03,
+    0x00, 0x00, 0x70, 0x13, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0xca, 0xc7, 0x24, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x35, 0x16, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32,
+    0x5c, 0x77, 0x73, 0x32, 0x5f, 0x33, 0x32, 0x2e, 0x64, 0x6c, 0x6c, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x05, 0xf0, 0x90, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+    0xd0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f,
+    0xf6, 0x2c, 0xc4, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x73, 0x74, 0x65, 0x6d,
+    0x33, 0x32, 0x5c, 0x75, 0x63, 0x72, 0x74, 0x62, 0x61, 0x73, 0x65, 0x2e,
+    0x64, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f,
+    0x07, 0x1a, 0x8b, 0x70, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x3f, 0x9d, 0x82, 0xec, 0x00, 0x00, 0x04, 0x0d, 0x07,
+    0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73,
+    0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x63, 0x72, 0x79, 0x70, 0x74, 0x33,
+    0x32, 0x2e, 0x64, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00,
+    0x00, 0x7f, 0x02, 0x6d, 0x1c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x64,
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x05, 0x72, 0x6f, 0x6f, 0x74, 0x00,
+    0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x30, 0x07, 0x3e, 0x00, 0x00,
+    0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xe6, 0x00, 0x02, 0x09, 0xc6,
+    0x33, 0x64, 0x08, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x16, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x59, 0x82, 0xd5, 0x00,
+    0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x81, 0x76, 0xb0, 0xeb,
+    0x42, 0x3c, 0x68, 0xbc, 0xb2, 0xb8, 0x40, 0xc4, 0x45, 0x29, 0x0e, 0x8d,
+    0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x67, 0xb2, 0xd1,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x0b, 0x81,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00,
+    0x10, 0x2f, 0x76, 0x61, 0x72, 0x2f, 0x6c, 0x6f, 0x67, 0x2f, 0x73, 0x79,
+    0x73, 0x6c, 0x6f, 0x67, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00,
+    0xbb, 0x0b, 0x00, 0x00, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73,
+    0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c,
+    0x33, 0x32, 0x2e, 0x64, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c,
+    0x00, 0x00, 0x7f, 0x03, 0x8b, 0x8d, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x2a,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xc7, 0x5c, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33,
+    0x32, 0x5c, 0x6d, 0x73, 0x76, 0x63, 0x72, 0x74, 0x2e, 0x64, 0x6c, 0x6c,
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x0e, 0x2f, 0x9a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1e, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x00, 0x00, 0x02, 0x09, 0xc6, 0x33, 0x64, 0x25, 0x00, 0x00, 0x00, 0x34,
+    0x02, 0x00, 0x35, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d,
+    0x40, 0xbb, 0x1e, 0xc5, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xba, 0x8b, 0x33, 0xb4, 0x80, 0xc7, 0x5a, 0x0a, 0x83, 0x90, 0x22,
+    0xad, 0xbd, 0xcc, 0x86, 0x65, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x45, 0x27, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0xf5, 0xd3, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x0d, 0xcd, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x09, 0x2f,
+    0x62, 0x69, 0x6e, 0x2f, 0x7a, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x09, 0xc6, 0x33, 0x64, 0x7a, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x86, 0x58,
+    0x01, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0xbf, 0xb4,
+    0xeb, 0x03, 0xd6, 0x3b, 0xa3, 0xa0, 0x37, 0x2c, 0x7e, 0x60, 0xcb, 0xea,
+    0x6f, 0x39, 0x00, 0x00, 0x04, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0x3c,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x0a, 0x81,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x9b,
+    0xd4, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x46, 0x2f, 0x53,
+    0x79, 0x73, 0x74, 0x65, 0x6d, 0x2f, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72,
+    0x79, 0x2f, 0x46, 0x72, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14,
+    0x05, 0x00, 0x00, 0x00, 0x1c, 0x2f, 0x76, 0x61, 0x72, 0x2f, 0x6c, 0x69,
+    0x62, 0x2f, 0x64, 0x70, 0x6b, 0x67, 0x2f, 0x75, 0x70, 0x64, 0x61, 0x74,
+    0x65, 0x73, 0x2f, 0x31, 0x34, 0x37, 0x32, 0x36, 0x05, 0x00, 0x00, 0x00,
+    0x14, 0x06, 0x00, 0x00, 0x00, 0x1d, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x5c, 0x54, 0x65, 0x6d, 0x70, 0x5c, 0x30, 0x30,
+    0x30, 0x30, 0x35, 0x37, 0x34, 0x62, 0x2e, 0x74, 0x6d, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x3b, 0x10, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x80, 0x56, 0xcf, 0x00, 0x00, 0x04,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x03, 0x81,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x13,
+    0xe2, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x06, 0xdc, 0x00, 0x00,
+    0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x2e, 0x43, 0x3a, 0x5c, 0x50, 0x72,
+    0x6f, 0x67, 0x72, 0x61, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00,
+    0x08, 0xcd, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x05, 0xd8, 0x00,
+    0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x18, 0x2f, 0x75, 0x73, 0x72,
+    0x2f, 0x73, 0x62, 0x69, 0x6e, 0x2f, 0x6d, 0x44, 0x4e, 0x53, 0x52, 0x65,
+    0x73, 0x70, 0x6f, 0x6e, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x05, 0x00, 0x00, 0x00, 0x18, 0x2f, 0x75, 0x73, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x20, 0x59, 0x00, 0x00, 0x00,
+    0x14, 0x05, 0x00, 0x00, 0x00, 0x26, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c,
+    0x69, 0x62, 0x2f, 0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d, 0x6c, 0x69,
+    0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69, 0x62, 0x73,
+    0x73, 0x6c, 0x2e, 0x73, 0x6f, 0x2e, 0x33, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x0a, 0x81,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x3e,
+    0x93, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x4e, 0x2f, 0x53,
+    0x79, 0x73, 0x74, 0x65, 0x6d, 0x2f, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72,
+    0x79, 0x2f, 0x46, 0x72, 0x05, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00,
+    0x00, 0x25, 0x2f, 0x72, 0x75, 0x6e, 0x2f, 0x73, 0x79, 0x73, 0x74, 0x65,
+    0x6d, 0x64, 0x2f, 0x6a, 0x6f, 0x75, 0x72, 0x6e, 0x61, 0x6c, 0x2f, 0x73,
+    0x74, 0x72, 0x65, 0x61, 0x6d, 0x73, 0x2f, 0x38, 0x3a, 0x35, 0x33, 0x30,
+    0x39, 0x36, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xa1, 0x1e,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x72, 0x65, 0x73, 0x6f,
+    0x6c, 0x76, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00,
+    0x03, 0xe8, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x05, 0x75,
+    0x73, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00,
+    0x3d, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0x98,
+    0x91, 0x11, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x59,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x05, 0x81,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x00,
+    0x10, 0x77, 0x77, 0x77, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+    0x2e, 0x63, 0x6f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x02, 0xbd, 0xd8,
+    0x00, 0x00, 0x00, 0x62, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+    0x73, 0x5c, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x6e,
+    0x74, 0x64, 0x6c, 0x6c, 0x2e, 0x64, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x0c, 0x00, 0x00, 0x7f, 0x00, 0xc0, 0x6c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x17, 0x03, 0x00,
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x20,
+    0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53,
+    0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x73, 0x76, 0x63, 0x68,
+    0x6f, 0x73, 0x74, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x06, 0x00, 0x00, 0x00, 0x44, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64,
+    0x6d, 0x62, 0x65, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x87, 0x06, 0x00,
+    0x00, 0x00, 0x14, 0x4e, 0x54, 0x20, 0x41, 0x55, 0x54, 0x48, 0x4f, 0x52,
+    0x49, 0x54, 0x59, 0x5c, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x00, 0x00,
+    0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5f, 0x36, 0x34, 0x2d, 0x6c, 0x69, 0x6e, 0x75,
+    0x78, 0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69, 0x62, 0x73, 0x79, 0x73,
+    0x74, 0x65, 0x6d, 0x64, 0x2e, 0x73, 0x6f, 0x2e, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x07, 0xcb, 0xb2, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xb0, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x73, 0x74, 0x65, 0x6d,
+    0x33, 0x32, 0x5c, 0x72, 0x70, 0x63, 0x72, 0x74, 0x34, 0x2e, 0x64, 0x6c,
+    0x6c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x0f, 0x8e,
+    0x93, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01,
+    0x5d, 0x3f, 0xb2, 0xf9, 0xe0, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x05, 0x81,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x00,
+    0x10, 0x61, 0x70, 0x69, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+    0x2e, 0x63, 0x6f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x02, 0x4d, 0x26,
+    0x00, 0x00, 0x00, 0x62, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c,
+    0x4b, 0x45, 0x52, 0x4e, 0x45, 0x4c, 0x42, 0x41, 0x53, 0x45, 0x2e, 0x64,
+    0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x03,
+    0x06, 0x5c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1b, 0x60, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x01, 0x5d, 0x40, 0x0f, 0xd3, 0x0f, 0x00, 0x00, 0x5c, 0x53, 0x79, 0x73,
+    0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x73, 0x65, 0x63, 0x68, 0x6f, 0x73,
+    0x74, 0x2e, 0x64, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00,
+    0x00, 0x7f, 0x00, 0x91, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0xce, 0xaf, 0x42, 0x00, 0x00, 0x04,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x05, 0x81,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x00,
+    0x11, 0x6d, 0x61, 0x69, 0x6c, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c,
+    0x65, 0x2e, 0x6e, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x02, 0x17,
+    0x4d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x24, 0x2f, 0x76, 0x61,
+    0x72, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x61, 0x70, 0x74, 0x2f, 0x6c, 0x69,
+    0x73, 0x74, 0x73, 0x2f, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x2f,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x03, 0x00, 0x00, 0xcd, 0x3c, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
+    0x00, 0x01, 0x5d, 0x40, 0x4f, 0x0b, 0x5e, 0x00, 0x63, 0x73, 0x66, 0x78,
+    0x76, 0x6e, 0x5f, 0x6e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x43, 0x2f, 0x30, 0x30, 0x30, 0x30,
+    0x63, 0x33, 0x35, 0x66, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00,
+    0xed, 0x16, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40,
+    0x5f, 0xdf, 0x4b, 0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x25, 0x2f, 0x75, 0x73, 0x72,
+    0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d,
+    0x6c, 0x69, 0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69,
+    0x62, 0x64, 0x6c, 0x2e, 0x73, 0x6f, 0x2e, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x0c, 0x00, 0x00, 0x7f, 0x0e, 0x4f, 0xcb, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x2a, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x05, 0x81, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5e,
+    0x05, 0x00, 0x00, 0x00, 0x13, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2e,
+    0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x6f, 0x72, 0x67, 0x00,
+    0x00, 0x00, 0x00, 0xb2, 0x02, 0xd4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x05, 0x00, 0x00, 0x00, 0x23, 0x2f, 0x76, 0x61, 0x72, 0x2f, 0x63, 0x61,
+    0x63, 0x68, 0x65, 0x2f, 0x61, 0x70, 0x74, 0x2f, 0x70, 0x6b, 0x67, 0x63,
+    0x61, 0x63, 0x68, 0x65, 0x2e, 0x62, 0x69, 0x6e, 0x2e, 0x30, 0x30, 0x38,
+    0x38, 0x32, 0x39, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xdc,
+    0x35, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xae,
+    0x00, 0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x16, 0x03, 0x00, 0x00, 0xca, 0x41, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00,
+    0x00, 0x11, 0x22, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x0e,
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x64, 0x61, 0x73,
+    0x68, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0x00, 0x2e, 0x2f,
+    0x62, 0x69, 0x6e, 0x2f, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73,
+    0x2f, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
+    0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x2f, 0x56, 0x65,
+    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2f, 0x43, 0x2f, 0x46, 0x6f, 0x75,
+    0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x0c, 0x00, 0x00, 0x7f, 0x01, 0xa6, 0x4d, 0x40, 0x00, 0x00, 0x00, 0x14,
+    0x06, 0x00, 0x00, 0x00, 0x2c, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x73, 0x5c, 0x50, 0x72, 0x65, 0x66, 0x65, 0x74, 0x63, 0x68,
+    0x5c, 0x53, 0x56, 0x43, 0x48, 0x4f, 0x53, 0x54, 0x2e, 0x45, 0x58, 0x45,
+    0x2d, 0x30, 0x30, 0x30, 0x30, 0x41, 0x36, 0x32, 0x32, 0x2e, 0x70, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xe6, 0xec, 0x00, 0x00,
+    0x69, 0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69, 0x62,
+    0x7a, 0x2e, 0x73, 0x6f, 0x2e, 0x31, 0x2e, 0x32, 0x2e, 0x31, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x02, 0x92, 0x30, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40,
+    0xa8, 0xdf, 0x38, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x14, 0x05, 0x00, 0x00, 0x00, 0x0f, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x73,
+    0x62, 0x69, 0x6e, 0x2f, 0x63, 0x72, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x05, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x73,
+    0x62, 0x69, 0x6e, 0x2f, 0x63, 0x72, 0x6f, 0x6e, 0x20, 0x2d, 0x66, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x75, 0x78,
+    0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69, 0x62, 0x73, 0x65, 0x6c, 0x69,
+    0x6e, 0x75, 0x78, 0x2e, 0x73, 0x6f, 0x2e, 0x31, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x0c, 0x00, 0x00, 0x7f, 0x0a, 0x35, 0x8d, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40, 0xc4, 0x82, 0xb2,
+    0x03, 0x00, 0x00, 0xdf, 0xc3, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x02, 0x16, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x26, 0x43,
+    0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79,
+    0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x77, 0x62, 0x65, 0x6d, 0x5c,
+    0x57, 0x6d, 0x69, 0x50, 0x72, 0x76, 0x53, 0x45, 0x2e, 0x65, 0x78, 0x65,
+    0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x4c,
+    0x6f, 0x67, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x57, 0x4d, 0x49, 0x5c,
+    0x52, 0x74, 0x42, 0x61, 0x63, 0x6b, 0x75, 0x70, 0x5c, 0x45, 0x74, 0x77,
+    0x52, 0x54, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x61, 0x66, 0x31, 0x35, 0x2e,
+    0x65, 0x74, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xf6,
+    0x58, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00,
+    0x00, 0x00, 0x18, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69, 0x62, 0x2f,
+    0x6c, 0x69, 0x62, 0x63, 0x2b, 0x2b, 0x2e, 0x31, 0x2e, 0x64, 0x79, 0x6c,
+    0x69, 0x62, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x07,
+    0xf8, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0xef, 0xce, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x21, 0x43,
+    0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79,
+    0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x61, 0x64, 0x76, 0x61, 0x70,
+    0x69, 0x33, 0x32, 0x2e, 0x64, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x0c, 0x00, 0x00, 0x7f, 0x0b, 0xb6, 0x55, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x09, 0x5d, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x43,
+    0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79,
+    0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x63, 0x6d, 0x64, 0x2e, 0x65,
+    0x78, 0x65, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x23,
+    0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x16, 0x03, 0x00, 0x00, 0x42, 0x19, 0x00, 0x00, 0x00, 0x17, 0x03,
+    0x00, 0x00, 0x10, 0x78, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00,
+    0x18, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c,
+    0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65, 0x72, 0x2e, 0x65, 0x78, 0x65,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x18, 0x43, 0x3a,
+    0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x24, 0x2f, 0x75, 0x73, 0x72,
+    0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d,
+    0x6c, 0x69, 0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69,
+    0x62, 0x6d, 0x2e, 0x73, 0x6f, 0x2e, 0x36, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x0c, 0x00, 0x00, 0x7f, 0x05, 0x31, 0x29, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x04, 0x00, 0x00, 0x00, 0x59, 0x29, 0x00, 0x00, 0x00, 0x17, 0x03,
+    0x00, 0x00, 0x08, 0x92, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00,
+    0x1e, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c,
+    0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x6c, 0x73, 0x61,
+    0x73, 0x73, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06,
+    0x00, 0x00, 0x00, 0x1e, 0x43, 0x3a, 0x5c, 0x57, 0x2b, 0x00, 0x00, 0x00,
+    0x14, 0x05, 0x00, 0x00, 0x00, 0x29, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c,
+    0x69, 0x62, 0x2f, 0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d, 0x6c, 0x69,
+    0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69, 0x62, 0x63,
+    0x72, 0x79, 0x70, 0x74, 0x6f, 0x2e, 0x73, 0x6f, 0x2e, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x0d, 0x54, 0x60, 0x20, 0x00,
+    0x2d, 0x6a, 0x6f, 0x75, 0x72, 0x6e, 0x61, 0x6c, 0x64, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x05, 0x00, 0x00, 0x00, 0x1e, 0x2f, 0x6c, 0x69, 0x62, 0x2f,
+    0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x64, 0x2f, 0x73, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x64, 0x2d, 0x6a, 0x6f, 0x75, 0x72, 0x6e, 0x61, 0x6c, 0x64,
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00,
+    0x1f, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c,
+    0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x75, 0x73, 0x65,
+    0x72, 0x33, 0x32, 0x2e, 0x64, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x0c, 0x00, 0x00, 0x7f, 0x09, 0x11, 0x35, 0xd0, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3f, 0x00, 0x00, 0x04,
+    0x0e, 0x07, 0x00, 0x00, 0x00, 0x10, 0xcb, 0xb3, 0x9d, 0x52, 0x4e, 0xad,
+    0x37, 0x0e, 0x17, 0x7e, 0x3b, 0xe1, 0x6b, 0x8c, 0x02, 0x1f, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x05, 0x81,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x00,
+    0x12, 0x6c, 0x6f, 0x67, 0x69, 0x6e, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70,
+    0x04, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00,
+    0x00, 0x2c, 0xa8, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x0f, 0xfc,
+    0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x75, 0x73,
+    0x72, 0x2f, 0x73, 0x62, 0x69, 0x6e, 0x2f, 0x6e, 0x67, 0x69, 0x6e, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0x00, 0x16, 0x6e, 0x67,
+    0x69, 0x6e, 0x78, 0x3a, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x19, 0x2f,
+    0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x6c, 0x69, 0x62, 0x6f,
+    0x62, 0x6a, 0x63, 0x2e, 0x41, 0x2e, 0x64, 0x79, 0x6c, 0x69, 0x62, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x08, 0x6a, 0xba, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x03, 0x00, 0x00, 0x04,
+    0x89, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x3a, 0x43, 0x3a,
+    0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73,
+    0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+    0x73, 0x50, 0x6f, 0x77, 0x65, 0x72, 0x53, 0x68, 0x65, 0x6c, 0x6c, 0x5c,
+    0x76, 0x31, 0x2e, 0x30, 0x5c, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x68,
+    0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x75, 0x73, 0x72,
+    0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d,
+    0x6c, 0x69, 0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x64,
+    0x2d, 0x6c, 0x69, 0x6e, 0x75, 0x78, 0x2d, 0x78, 0x38, 0x36, 0x2d, 0x36,
+    0x34, 0x2e, 0x73, 0x6f, 0x2e, 0x32, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c,
+    0x00, 0x00, 0x7f, 0x0c, 0x00, 0x00, 0x08, 0xc8, 0x00, 0x00, 0x00, 0x14,
+    0x06, 0x00, 0x00, 0x00, 0x22, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32,
+    0x5c, 0x74, 0x61, 0x73, 0x6b, 0x68, 0x6f, 0x73, 0x74, 0x77, 0x2e, 0x65,
+    0x78, 0x65, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x0e,
+    0x74, 0x61, 0x73, 0x6b, 0x68, 0x6f, 0x73, 0x74, 0x65, 0x63, 0x75, 0x72,
+    0x69, 0x74, 0x79, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72,
+    0x6b, 0x2f, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2f, 0x41,
+    0x2f, 0x53, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x03, 0x6b, 0xa4, 0xa0, 0x00, 0x00,
+    0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x70, 0x00,
+    0x2e, 0x65, 0x78, 0x65, 0x20, 0x2d, 0x6b, 0x20, 0x4c, 0x6f, 0x63, 0x61,
+    0x6c, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x4e, 0x65, 0x74, 0x77,
+    0x6f, 0x72, 0x6b, 0x52, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x65,
+    0x64, 0x20, 0x2d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x87, 0x06, 0x00, 0x00, 0x00, 0x14, 0x4e,
+    0x54, 0x20, 0x41, 0x55, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00,
+    0x31, 0xbe, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x01, 0xae, 0x00,
+    0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x2f, 0x75, 0x73, 0x72,
+    0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x62, 0x61, 0x73, 0x68, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x05, 0x00, 0x00, 0x00, 0x06, 0x2d, 0x62, 0x61, 0x73, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0x5c, 0x3f, 0x3f, 0x5c, 0x43, 0x3a, 0x5c, 0x57, 0x69, 0x6e, 0x64, 0x6f,
+    0x77, 0x73, 0x5c, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c,
+    0x63, 0x6f, 0x6e, 0x68, 0x6f, 0x73, 0x74, 0x2e, 0x65, 0x78, 0x65, 0x20,
+    0x30, 0x78, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x20, 0x2d,
+    0x46, 0x6f, 0x72, 0x63, 0x65, 0x56, 0x31, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x0c, 0x81, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x37, 0x43, 0x3a,
+    0x5c, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61,
+    0x5c, 0x4d, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x5c, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x57, 0x45, 0x52, 0x5c, 0x54,
+    0x65, 0x6d, 0x70, 0x5c, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+    0x14, 0x05, 0x00, 0x00, 0x00, 0x14, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x62,
+    0x69, 0x6e, 0x2f, 0x70, 0x79, 0x74, 0x68, 0x6f, 0x6e, 0x33, 0x2e, 0x31,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0x00, 0x2d, 0x2f,
+    0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x70, 0x79, 0x74, 0x68,
+    0x6f, 0x6e, 0x33, 0x20, 0x2f, 0x75, 0x73, 0x72, 0x00, 0x00, 0x00, 0x13,
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x73, 0x62, 0x69, 0x6e, 0x2f, 0x72, 0x73,
+    0x79, 0x73, 0x6c, 0x6f, 0x67, 0x64, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05,
+    0x00, 0x00, 0x00, 0x1d, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x73, 0x62, 0x69,
+    0x6e, 0x2f, 0x72, 0x73, 0x79, 0x73, 0x6c, 0x6f, 0x67, 0x64, 0x20, 0x2d,
+    0x6e, 0x20, 0x2d, 0x69, 0x4e, 0x4f, 0x4e, 0x45, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x3a, 0x43, 0x3a, 0x5c, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x73, 0x79, 0x73, 0x74, 0x65,
+    0x6d, 0x33, 0x32, 0x5c, 0x77, 0x62, 0x65, 0x6d, 0x5c, 0x77, 0x6d, 0x69,
+    0x70, 0x72, 0x76, 0x73, 0x65, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x2d, 0x73,
+    0x65, 0x63, 0x75, 0x72, 0x65, 0x64, 0x20, 0x2d, 0x45, 0x6d, 0x62, 0x65,
+    0x64, 0x64, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x0c,
+    0xb4, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x75,
+    0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x61, 0x70, 0x74, 0x2d, 0x67,
+    0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0x00, 0x0f,
+    0x61, 0x70, 0x74, 0x2d, 0x67, 0x65, 0x74, 0x20, 0x75, 0x70, 0x64, 0x61,
+    0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x17, 0x03, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x0f, 0x2f,
+    0x75, 0x73, 0x72, 0x2f, 0x73, 0x62, 0x69, 0x6e, 0x2f, 0x73, 0x73, 0x68,
+    0x64, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0x00, 0x12, 0x2f,
+    0x75, 0x73, 0x72, 0x2f, 0x73, 0x62, 0x69, 0x6e, 0x2f, 0x73, 0x73, 0x68,
+    0x64, 0x20, 0x2d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x45, 0x78, 0x70, 0x6c, 0x6f,
+    0x72, 0x65, 0x72, 0x2e, 0x45, 0x58, 0x45, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x87, 0x06, 0x00, 0x00,
+    0x00, 0x14, 0x4e, 0x54, 0x20, 0x41, 0x55, 0x54, 0x48, 0x4f, 0x52, 0x49,
+    0x54, 0x59, 0x5c, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x00, 0x00, 0x00,
+    0x00, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00,
+    0x00, 0x30, 0x22, 0x43, 0x3a, 0x5c, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61,
+    0x6d, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x57, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x73, 0x20, 0x44, 0x65, 0x66, 0x65, 0x6e, 0x64, 0x65, 0x72,
+    0x5c, 0x4d, 0x73, 0x4d, 0x70, 0x45, 0x6e, 0x67, 0x2e, 0x65, 0x78, 0x65,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x46, 0x81, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x14, 0x05, 0x00, 0x00, 0x00, 0x42, 0x2f, 0x70, 0x72, 0x69, 0x76, 0x61,
+    0x74, 0x65, 0x2f, 0x76, 0x61, 0x72, 0x2f, 0x66, 0x6f, 0x6c, 0x64, 0x65,
+    0x72, 0x73, 0x2f, 0x7a, 0x7a, 0x2f, 0x7a, 0x79, 0x78, 0x76, 0x70, 0x78,
+    0x76, 0x71, 0x36, 0x63, 0x73, 0x66, 0x78, 0x76, 0x6e, 0x5f, 0x6e, 0x30,
+    0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x00, 0x13, 0x75, 0x70, 0x64,
+    0x61, 0x74, 0x65, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e,
+    0x6f, 0x72, 0x67, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x02, 0x21, 0xf0, 0x00,
+    0x00, 0x00, 0x62, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x09, 0xc0,
+    0x00, 0x02, 0xa7, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x7b, 0x48,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1b, 0x2f, 0x75, 0x73, 0x72,
+    0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x6c, 0x69, 0x62, 0x53, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x2e, 0x42, 0x2e, 0x64, 0x79, 0x6c, 0x69, 0x62, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x7f, 0x0f, 0x9d, 0x92, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e,
+    0x05, 0x00, 0x00, 0x00, 0x10, 0x63, 0x64, 0x6e, 0x2e, 0x65, 0x78, 0x61,
+    0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x6e, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00,
+    0xb2, 0x02, 0x89, 0xbc, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00, 0x1c, 0x00,
+    0x00, 0x00, 0x02, 0x09, 0xc0, 0x00, 0x02, 0x61, 0x00, 0x00, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0x40, 0x50, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00,
+    0x32, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2e,
+    0x65, 0x78, 0x65, 0x20, 0x2d, 0x4e, 0x6f, 0x50, 0x72, 0x6f, 0x66, 0x69,
+    0x6c, 0x65, 0x20, 0x2d, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6f,
+    0x6e, 0x50, 0x6f, 0x6c, 0x69, 0x63, 0x79, 0x20, 0x42, 0x79, 0x70, 0x61,
+    0x73, 0x73, 0x00, 0x00, 0x00, 0x2e, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x73,
+    0x68, 0x20, 0x2d, 0x63, 0x20, 0x72, 0x75, 0x6e, 0x2d, 0x70, 0x61, 0x72,
+    0x74, 0x73, 0x20, 0x2d, 0x2d, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x20,
+    0x2f, 0x65, 0x74, 0x63, 0x2f, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x64, 0x61,
+    0x69, 0x6c, 0x79, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x03,
+    0xe8, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x02, 0x09, 0x0a,
+    0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x34, 0x02, 0x98, 0x87, 0x00, 0x00,
+    0x00, 0x33, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x09,
+    0xc6, 0x33, 0x64, 0x10, 0x00, 0x00, 0x00, 0x34, 0x02, 0x01, 0xbb, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x0e, 0x32, 0xb0,
+    0x00, 0x00, 0x04, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x42, 0xcc,
+    0x6e, 0x33, 0x20, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 0x2f,
+    0x75, 0x6e, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x2d, 0x75,
+    0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00,
+    0x09, 0x77, 0x77, 0x77, 0x2d, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x5d, 0x03, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00,
+    0x00, 0x2a, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x78,
+    0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d, 0x6c, 0x69, 0x6e, 0x75, 0x78, 0x2d,
+    0x67, 0x6e, 0x75, 0x2f, 0x6c, 0x69, 0x62, 0x70, 0x74, 0x68, 0x72, 0x65,
+    0x61, 0x64, 0x2e, 0x73, 0x6f, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x0c, 0x00, 0x00, 0x7f, 0x04, 0x71, 0x86, 0x80, 0x00, 0x09, 0x78, 0x00,
+    0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x75, 0x73, 0x72,
+    0x2f, 0x6c, 0x69, 0x62, 0x65, 0x78, 0x65, 0x63, 0x2f, 0x78, 0x70, 0x63,
+    0x70, 0x72, 0x6f, 0x78, 0x79, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00,
+    0x00, 0x00, 0x23, 0x78, 0x70, 0x63, 0x70, 0x72, 0x6f, 0x78, 0x79, 0x20,
+    0x63, 0x6f, 0x6d, 0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 0x6d, 0x64,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x0b, 0x81, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x2f, 0x70,
+    0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x2f, 0x76, 0x61, 0x72, 0x2f, 0x64,
+    0x62, 0x2f, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x74, 0x69, 0x63,
+    0x73, 0x2f, 0x50, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x2f, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x2d,
+    0x2f, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2f, 0x4c, 0x69, 0x62, 0x72,
+    0x61, 0x72, 0x79, 0x2f, 0x43, 0x6f, 0x72, 0x65, 0x53, 0x65, 0x72, 0x76,
+    0x69, 0x63, 0x65, 0x73, 0x2f, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x73,
+    0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x05, 0x00, 0x00, 0x00, 0x2d, 0x2f, 0x53, 0x6d, 0x33, 0x32, 0x5c,
+    0x63, 0x6d, 0x64, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x2f, 0x63, 0x20, 0x76,
+    0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x87, 0x06, 0x00, 0x00, 0x00, 0x1d, 0x4e, 0x54, 0x20,
+    0x41, 0x55, 0x54, 0x48, 0x4f, 0x52, 0x49, 0x54, 0x59, 0x5c, 0x4e, 0x45,
+    0x54, 0x57, 0x4f, 0x52, 0x4b, 0x20, 0x53, 0x45, 0x52, 0x56, 0x49, 0x43,
+    0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2f, 0x43, 0x6f, 0x72, 0x65, 0x46,
+    0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x66, 0x72,
+    0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x2f, 0x56, 0x65, 0x72, 0x73,
+    0x69, 0x6f, 0x6e, 0x73, 0x2f, 0x41, 0x2f, 0x43, 0x6f, 0x72, 0x65, 0x46,
+    0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x0c, 0x00, 0x00, 0x16, 0x6e, 0x67, 0x69, 0x6e, 0x78, 0x3a,
+    0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63,
+    0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00,
+    0x68, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x10, 0x73, 0x79,
+    0x73, 0x74, 0x65, 0x6d, 0x64, 0x2d, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76,
+    0x65, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x69, 0x6e, 0x64, 0x6f,
+    0x77, 0x73, 0x5c, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x33, 0x32, 0x5c,
+    0x73, 0x76, 0x63, 0x68, 0x6f, 0x73, 0x74, 0x2e, 0x65, 0x78, 0x65, 0x20,
+    0x2d, 0x6b, 0x20, 0x6e, 0x65, 0x74, 0x73, 0x76, 0x63, 0x73, 0x20, 0x2d,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x87, 0x06, 0x00, 0x00, 0x00, 0x14, 0x4e, 0x54, 0x20, 0x41,
+    0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04, 0x81, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x90, 0xb8, 0x00,
+    0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x12, 0x98, 0x00, 0x00, 0x00, 0x14,
+    0x05, 0x00, 0x00, 0x00, 0x22, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x69,
+    0x62, 0x2f, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x64, 0x2f, 0x73, 0x79,
+    0x73, 0x74, 0x65, 0x6d, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x62, 0x69, 0x6e,
+    0x2f, 0x7a, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00,
+    0x00, 0x05, 0x2d, 0x7a, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00,
+    0x0f, 0x5f, 0x6d, 0x64, 0x6e, 0x73, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+    0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x73, 0x65, 0x72, 0x76,
+    0x69, 0x63, 0x65, 0x73, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x87, 0x06, 0x00,
+    0x00, 0x00, 0x1b, 0x4e, 0x54, 0x20, 0x41, 0x55, 0x54, 0x48, 0x4f, 0x52,
+    0x49, 0x54, 0x59, 0x5c, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x20, 0x53, 0x45,
+    0x52, 0x56, 0x49, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x20, 0x43, 0x3a, 0x5c,
+    0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x5c, 0x53, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x33, 0x32, 0x5c, 0x63, 0x6f, 0x6d, 0x62, 0x61, 0x73, 0x65,
+    0x2e, 0x64, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00,
+    0x7f, 0x06, 0x5f, 0xae, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x0a,
+    0x81, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00,
+    0xc1, 0x05, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x42, 0x2f,
+    0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2f, 0x4c, 0x69, 0x62, 0x72, 0x61,
+    0x72, 0x79, 0x2f, 0x46, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b,
+    0x73, 0x2f, 0x53, 0x65, 0x63, 0x75, 0x72, 0x69, 0x61, 0x70, 0x70, 0x6c,
+    0x65, 0x2e, 0x6d, 0x64, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x2e, 0x73,
+    0x68, 0x61, 0x72, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00,
+    0x00, 0x01, 0xf5, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x05,
+    0x75, 0x73, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00,
+    0x00, 0x21, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x01, 0x5d, 0x40,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x03, 0x81, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xe2, 0x1c, 0x00, 0x00,
+    0x00, 0x17, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x05,
+    0x00, 0x00, 0x00, 0x18, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x73, 0x62, 0x69,
+    0x6e, 0x2f, 0x6d, 0x44, 0x4e, 0x53, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+    0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x05,
+    0x81, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00,
+    0x00, 0x11, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70,
+    0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x02,
+    0x4f, 0xb5, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x09, 0xc0, 0x00, 0x02, 0xa3, 0x00, 0x00, 0x73, 0x74, 0x64, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0x00, 0x14, 0x2f, 0x75, 0x73,
+    0x72, 0x2f, 0x6c, 0x69, 0x62, 0x65, 0x78, 0x65, 0x63, 0x2f, 0x74, 0x72,
+    0x75, 0x73, 0x74, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x05, 0x72,
+    0x6f, 0x6f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x07, 0x81,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xa0,
+    0x1f, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x01, 0x00, 0x00, 0x00, 0x32, 0x81,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x09, 0x0a, 0x00, 0x00,
+    0x73, 0x00, 0x00, 0x00 };
+
+#endif
@@ -62,6 +62,16 @@ typedef struct
 } rpHCPIdentStore;
 
 
+typedef struct
+{
+    RpHcp_ModuleId moduleId;
+    RU8 signature[ CRYPTOLIB_SIGNATURE_SIZE ];
+    RU32 moduleSize;
+    RU8 module[];
+
+} rpHCPModuleCacheEntry;
+
+
 typedef struct
 {
     // Global State
@@ -80,9 +90,12 @@ typedef struct
 
     // Current Connection
     rEvent isCloudOnline;
+    RU32 frameDictionary;
+    RPVOID tlsSession;  // mbedtls_ssl_session of the last connection, for resumption
 
     // Modules Management
     rpHCPModuleInfo modules[ RP_HCP_CONTEXT_MAX_MODULES ];
+    RPNCHAR moduleCacheDir;
 
     // Ident token
     RPU8 enrollmentToken;
@@ -25,6 +25,7 @@ limitations under the License.
 #include "commands.h"
 #include "crashHandling.h"
 #include "crypto.h"
+#include <MemoryModule/MemoryModule.h>
 
 #if defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
 #include <dlfcn.h>
@@ -241,6 +242,10 @@ RBOOL
     RU16 tmpPort = 0;
     
     OBFUSCATIONLIB_DECLARE( storePath, RP_HCP_CONFIG_IDENT_STORE );
+    OBFUSCATIONLIB_DECLARE( moduleCachePath, RP_HCP_CONFIG_MODULE_CACHE );
+#if defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+    OBFUSCATIONLIB_DECLARE( moduleLoadPath, RP_HCP_CONFIG_MODULE_LOAD_DIR );
+#endif
 
     rpal_debug_info( "launching hcp" );
 
@@ -341,6 +346,24 @@ RBOOL
             getStoreConf( (RPNCHAR)storePath, &g_hcpContext );  /* Sets the agent ID platform. */
             OBFUSCATIONLIB_TOGGLE( storePath );
 
+#if defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+            // Used when a module cannot be loaded from memory, never /tmp
+            // since it is often mounted noexec and readable by everyone.
+            OBFUSCATIONLIB_TOGGLE( moduleLoadPath );
+            if( !MemorySetFallbackDirectory( (RPNCHAR)moduleLoadPath ) )
+            {
+                rpal_debug_warning( "error setting module load directory" );
+            }
+            OBFUSCATIONLIB_TOGGLE( moduleLoadPath );
+#endif
+
+            // Start the last known-good modules right away instead of waiting
+            // for the cloud to send them again.
+            OBFUSCATIONLIB_TOGGLE( moduleCachePath );
+            g_hcpContext.moduleCacheDir = rpal_string_strdup( (RPNCHAR)moduleCachePath );
+            OBFUSCATIONLIB_TOGGLE( moduleCachePath );
+            loadCachedModules( &g_hcpContext );
+
             if( startBeacons() )
             {
                 isInitSuccessful = TRUE;
@@ -381,6 +404,9 @@ RBOOL
 
         rpal_memory_free( g_hcpContext.primaryUrl );
         rpal_memory_free( g_hcpContext.secondaryUrl );
+        rpal_memory_free( g_hcpContext.moduleCacheDir );
+        g_hcpContext.moduleCacheDir = NULL;
+        MemorySetFallbackDirectory( NULL );
 
         if( NULL != g_hcpContext.enrollmentToken &&
             0 != g_hcpContext.enrollmentTokenSize )
@@ -29,9 +29,11 @@ typedef struct
     RU32 readOffset;
 } _rBlob, *_prBlob;
 
+static
 rBlob
-	rpal_blob_create_from
+	_createBlob
 	(
+		rMemoryArena arena,
 		RU32 initialSize,
 		RU32 growBy,
 		RU32 from
@@ -39,13 +41,27 @@ rBlob
 {
 	rBlob blob = NULL;
 
-	blob = rpal_memory_alloc_from( sizeof( _rBlob ), from );
+	if( NULL != arena )
+	{
+		blob = rpal_memory_arena_alloc_from( arena, sizeof( _rBlob ), from );
+	}
+	else
+	{
+		blob = rpal_memory_alloc_from( sizeof( _rBlob ), from );
+	}
 
 	if( rpal_memory_isValid( blob ) )
 	{
 		if( 0 != initialSize )
 		{
-			((_prBlob)blob)->pData = rpal_memory_alloc_from( initialSize + sizeof( RWCHAR ), from );
+			if( NULL != arena )
+			{
+				((_prBlob)blob)->pData = rpal_memory_arena_alloc_from( arena, initialSize + sizeof( RWCHAR ), from );
+			}
+			else
+			{
+				((_prBlob)blob)->pData = rpal_memory_alloc_from( initialSize + sizeof( RWCHAR ), from );
+			}
 
 			if( !rpal_memory_isValid( ((_prBlob)blob)->pData ) )
 			{
@@ -81,6 +97,29 @@ rBlob
 	return blob;
 }
 
+rBlob
+	rpal_blob_create_from
+	(
+		RU32 initialSize,
+		RU32 growBy,
+		RU32 from
+	)
+{
+	return _createBlob( NULL, initialSize, growBy, from );
+}
+
+rBlob
+	rpal_blob_createInArena_from
+	(
+		rMemoryArena arena,
+		RU32 initialSize,
+		RU32 growBy,
+		RU32 from
+	)
+{
+	return _createBlob( arena, initialSize, growBy, from );
+}
+
 RVOID
 	rpal_blob_free
 	(
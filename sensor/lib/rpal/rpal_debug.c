@@ -14,7 +14,1295 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
-#include <rpal_debug.h>
+#include <rpal.h>
+
+#ifndef RPAL_PLATFORM_WINDOWS
+#include <pthread.h>
+#endif
+
+#define RPAL_FILE_ID        113
+
+#define _LOG_RING_SIZE              64
+#define _LOG_MAX_ARGS               12
+#define _LOG_PAYLOAD_SIZE           256
+#define _LOG_MAX_FILE_LEVELS        32
+#define _LOG_MAX_LINE               1024
+#define _LOG_MAX_SPEC               32
+#define _LOG_WRITER_INTERVAL        100
+#define _LOG_WRITE_BUFFER_SIZE      (64 * 1024)
+
+#define _LOG_ARG_NONE               0
+#define _LOG_ARG_INT                1
+#define _LOG_ARG_LONG               2
+#define _LOG_ARG_LLONG              3
+#define _LOG_ARG_SIZE               4
+#define _LOG_ARG_DOUBLE             5
+#define _LOG_ARG_LDOUBLE            6
+#define _LOG_ARG_PTR                7
+#define _LOG_ARG_STR                8
+#define _LOG_ARG_WSTR               9
+#define _LOG_ARG_SKIP               10
+
+typedef struct
+{
+    RU32 length;
+    RU32 nStars;
+    RU8 argClass;
+
+} _LogSpec;
+
+typedef union
+{
+    RU64 u;
+    double d;
+    RPVOID p;
+
+} _LogArg;
+
+typedef struct
+{
+    rpal_log_site* site;
+    RU64 timestamp;
+    RU32 nSuppressed;
+    RU32 nArgs;
+    RU32 payloadUsed;
+    RU8 classes[ _LOG_MAX_ARGS ];
+    _LogArg args[ _LOG_MAX_ARGS ];
+    RU8 payload[ _LOG_PAYLOAD_SIZE ];
+
+} _LogRecord;
+
+// A single producer, single consumer ring. Only the owning thread advances
+// head and only the writer, under g_log_mutex, advances tail. The list of
+// rings is protected by g_log_ringsMutex since the writer itself may log
+// while it's draining.
+typedef struct _LogRing
+{
+    volatile RU32 head;
+    volatile RU32 tail;
+    volatile RU32 nDropped;
+    volatile RU32 isOrphaned;
+#ifdef RPAL_PLATFORM_WINDOWS
+    HANDLE hThread;
+#endif
+    struct _LogRing* next;
+    _LogRecord records[ _LOG_RING_SIZE ];
+
+} _LogRing;
+
+typedef struct
+{
+    RCHAR fileName[ 64 ];
+    volatile RU32 level;
+
+} _LogFileLevel;
+
+volatile RU32 g_rpal_log_generation = 1;
+
+RPRIVATE volatile RU32 g_log_level = RPAL_LOG_DEFAULT_LEVEL;
+RPRIVATE volatile RU32 g_log_rateLimit = RPAL_LOG_DEFAULT_RATE_LIMIT;
+RPRIVATE _LogFileLevel g_log_fileLevels[ _LOG_MAX_FILE_LEVELS ] = { 0 };
+RPRIVATE volatile RU32 g_log_nFileLevels = 0;
+RPRIVATE volatile RU32 g_log_fileLevelsLock = 0;
+
+RPRIVATE volatile RU32 g_log_isRunning = FALSE;
+RPRIVATE volatile RU32 g_log_nInFlight = 0;
+RPRIVATE rMutex g_log_mutex = NULL;
+RPRIVATE rMutex g_log_ringsMutex = NULL;
+RPRIVATE rEvent g_log_stopEvent = NULL;
+RPRIVATE rThread g_log_writer = NULL;
+RPRIVATE _LogRing* g_log_rings = NULL;
+#ifdef RPAL_PLATFORM_WINDOWS
+RPRIVATE DWORD g_log_tls = TLS_OUT_OF_INDEXES;
+#else
+RPRIVATE pthread_key_t g_log_tls = 0;
+#endif
+
+RPRIVATE RPNCHAR g_log_filePath = NULL;
+RPRIVATE RU32 g_log_maxFileSize = 0;
+RPRIVATE RU32 g_log_maxFiles = 0;
+RPRIVATE RPCHAR g_log_writeBuffer = NULL;
+RPRIVATE RU32 g_log_writeBufferUsed = 0;
+
+RPRIVATE RPCHAR g_log_levelNames[] = { "",
+                                       "CRITICAL !!!!! ",
+                                       "ERROR ++++++++ ",
+                                       "WARNING ====== ",
+                                       "INFO --------- " };
+
+RPRIVATE
+RVOID
+    _emitConsole
+    (
+        RPCHAR line
+    )
+{
+#ifdef RPAL_PLATFORM_WINDOWS
+    OutputDebugStringA( line );
+    printf( "%s", line );
+#elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+    fputs( line, stderr );
+    fflush( stderr );
+#endif
+}
+
+RPRIVATE
+RU32
+    _clampFormatted
+    (
+        int ret,
+        RU32 size
+    )
+{
+    if( 0 > ret || 0 == size )
+    {
+        return 0;
+    }
+
+    return MIN_OF( (RU32)ret, size - 1 );
+}
+
+RPRIVATE
+RU32
+    _formatPrefix
+    (
+        rpal_log_site* site,
+        RU64 timestamp,
+        RPCHAR out,
+        RU32 size
+    )
+{
+    RPCHAR levelName = "";
+
+    if( site->level < ARRAY_N_ELEM( g_log_levelNames ) )
+    {
+        levelName = g_log_levelNames[ site->level ];
+    }
+
+    return _clampFormatted( rpal_string_snprintf( out,
+                                                  size,
+                                                  "%s%s: %d %s() " RF_U64 " - ",
+                                                  levelName,
+                                                  site->file,
+                                                  site->line,
+                                                  site->function,
+                                                  timestamp ),
+                            size );
+}
+
+RPRIVATE
+RU32
+    _formatSuffix
+    (
+        RU32 nSuppressed,
+        RPCHAR out,
+        RU32 size
+    )
+{
+    if( 0 != nSuppressed )
+    {
+        return _clampFormatted( rpal_string_snprintf( out, size, " [%u suppressed]\n", nSuppressed ), size );
+    }
+
+    return _clampFormatted( rpal_string_snprintf( out, size, "%s", "\n" ), size );
+}
+
+//=============================================================================
+//  Format parsing, shared by the capture of the arguments and the writer.
+//=============================================================================
+RPRIVATE
+RBOOL
+    _parseSpec
+    (
+        RPCHAR spec,
+        _LogSpec* pSpec
+    )
+{
+    RPCHAR c = spec + 1;
+    RCHAR length = 0;
+
+    pSpec->nStars = 0;
+    pSpec->argClass = _LOG_ARG_NONE;
+
+    while( '-' == *c || '+' == *c || ' ' == *c || '#' == *c || '0' == *c || '\'' == *c )
+    {
+        c++;
+    }
+
+    if( '*' == *c )
+    {
+        pSpec->nStars++;
+        c++;
+    }
+    while( '0' <= *c && '9' >= *c )
+    {
+        c++;
+    }
+
+    if( '.' == *c )
+    {
+        c++;
+        if( '*' == *c )
+        {
+            pSpec->nStars++;
+            c++;
+        }
+        while( '0' <= *c && '9' >= *c )
+        {
+            c++;
+        }
+    }
+
+    // Normalize the length modifiers: 'h' for anything promoted to an int,
+    // 'q' for 64 bit integers and 'z' for pointer sized integers.
+    if( 'h' == *c )
+    {
+        length = 'h';
+        c++;
+        if( 'h' == *c )
+        {
+            c++;
+        }
+    }
+    else if( 'l' == *c )
+    {
+        length = 'l';
+        c++;
+        if( 'l' == *c )
+        {
+            length = 'q';
+            c++;
+        }
+    }
+    else if( 'q' == *c || 'j' == *c )
+    {
+        length = 'q';
+        c++;
+    }
+    else if( 'z' == *c || 't' == *c )
+    {
+        length = 'z';
+        c++;
+    }
+    else if( 'L' == *c )
+    {
+        length = 'L';
+        c++;
+    }
+    else if( 'w' == *c )
+    {
+        length = 'l';
+        c++;
+    }
+    else if( 'I' == *c )
+    {
+        c++;
+        if( '6' == c[ 0 ] && '4' == c[ 1 ] )
+        {
+            length = 'q';
+            c += 2;
+        }
+        else if( '3' == c[ 0 ] && '2' == c[ 1 ] )
+        {
+            c += 2;
+        }
+        else
+        {
+            length = 'z';
+        }
+    }
+
+    switch( *c )
+    {
+        case 'd':
+        case 'i':
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            if( 'q' == length )
+            {
+                pSpec->argClass = _LOG_ARG_LLONG;
+            }
+            else if( 'l' == length )
+            {
+                pSpec->argClass = _LOG_ARG_LONG;
+            }
+            else if( 'z' == length )
+            {
+                pSpec->argClass = _LOG_ARG_SIZE;
+            }
+            else
+            {
+                pSpec->argClass = _LOG_ARG_INT;
+            }
+            break;
+        case 'c':
+        case 'C':
+            pSpec->argClass = _LOG_ARG_INT;
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            pSpec->argClass = 'L' == length ? _LOG_ARG_LDOUBLE : _LOG_ARG_DOUBLE;
+            break;
+        case 'p':
+            pSpec->argClass = _LOG_ARG_PTR;
+            break;
+        case 's':
+            pSpec->argClass = 'l' == length ? _LOG_ARG_WSTR : _LOG_ARG_STR;
+            break;
+        case 'S':
+            pSpec->argClass = _LOG_ARG_WSTR;
+            break;
+        case 'n':
+            pSpec->argClass = _LOG_ARG_SKIP;
+            break;
+        case '%':
+            break;
+        default:
+            return FALSE;
+    }
+
+    pSpec->length = (RU32)( c + 1 - spec );
+
+    return TRUE;
+}
+
+RPRIVATE
+RVOID
+    _captureString
+    (
+        _LogRecord* record,
+        _LogArg* arg,
+        RPVOID str,
+        RBOOL isWide
+    )
+{
+    RU32 charSize = isWide ? sizeof( RWCHAR ) : sizeof( RCHAR );
+    RU32 offset = 0;
+    RU32 available = 0;
+    RU32 nChars = 0;
+
+    // Strings are copied since they rarely outlive the call, offsets
+    // are kept aligned for wide characters.
+    offset = ( record->payloadUsed + charSize - 1 ) / charSize * charSize;
+    if( NULL == str ||
+        offset + charSize > sizeof( record->payload ) )
+    {
+        arg->u = (RU64)( -1 );
+        return;
+    }
+
+    available = ( sizeof( record->payload ) - offset ) / charSize - 1;
+
+    if( isWide )
+    {
+        while( nChars < available && 0 != ( (RPWCHAR)str )[ nChars ] )
+        {
+            ( (RPWCHAR)( record->payload + offset ) )[ nChars ] = ( (RPWCHAR)str )[ nChars ];
+            nChars++;
+        }
+        ( (RPWCHAR)( record->payload + offset ) )[ nChars ] = 0;
+    }
+    else
+    {
+        while( nChars < available && 0 != ( (RPCHAR)str )[ nChars ] )
+        {
+            ( (RPCHAR)( record->payload + offset ) )[ nChars ] = ( (RPCHAR)str )[ nChars ];
+            nChars++;
+        }
+        ( (RPCHAR)( record->payload + offset ) )[ nChars ] = 0;
+    }
+
+    arg->u = offset;
+    record->payloadUsed = offset + ( nChars + 1 ) * charSize;
+}
+
+RPRIVATE
+RVOID
+    _captureArgs
+    (
+        _LogRecord* record,
+        RPCHAR format,
+        va_list args
+    )
+{
+    RPCHAR c = format;
+    _LogSpec spec = { 0 };
+    RU32 i = 0;
+    _LogArg* arg = NULL;
+
+    record->nArgs = 0;
+    record->payloadUsed = 0;
+
+    while( NULL != c && 0 != *c )
+    {
+        if( '%' != *c )
+        {
+            c++;
+            continue;
+        }
+
+        if( !_parseSpec( c, &spec ) )
+        {
+            // Unknown conversion, the writer will print the rest as is
+            // so we cannot safely consume further arguments.
+            break;
+        }
+        c += spec.length;
+
+        if( _LOG_ARG_NONE == spec.argClass )
+        {
+            continue;
+        }
+
+        if( record->nArgs + spec.nStars + 1 > _LOG_MAX_ARGS )
+        {
+            break;
+        }
+
+        for( i = 0; i < spec.nStars; i++ )
+        {
+            record->classes[ record->nArgs ] = _LOG_ARG_INT;
+            record->args[ record->nArgs ].u = (RU32)va_arg( args, int );
+            record->nArgs++;
+        }
+
+        arg = &record->args[ record->nArgs ];
+        record->classes[ record->nArgs ] = spec.argClass;
+        record->nArgs++;
+
+        switch( spec.argClass )
+        {
+            case _LOG_ARG_INT:
+                arg->u = (RU32)va_arg( args, int );
+                break;
+            case _LOG_ARG_LONG:
+                arg->u = (RU64)va_arg( args, long );
+                break;
+            case _LOG_ARG_LLONG:
+                arg->u = (RU64)va_arg( args, long long );
+                break;
+            case _LOG_ARG_SIZE:
+                arg->u = (RU64)va_arg( args, size_t );
+                break;
+            case _LOG_ARG_DOUBLE:
+                arg->d = va_arg( args, double );
+                break;
+            case _LOG_ARG_LDOUBLE:
+                arg->d = (double)va_arg( args, long double );
+                break;
+            case _LOG_ARG_PTR:
+            case _LOG_ARG_SKIP:
+                arg->p = va_arg( args, RPVOID );
+                break;
+            case _LOG_ARG_STR:
+                _captureString( record, arg, va_arg( args, RPCHAR ), FALSE );
+                break;
+            case _LOG_ARG_WSTR:
+                _captureString( record, arg, va_arg( args, RPWCHAR ), TRUE );
+                break;
+        }
+    }
+}
+
+#define _LOG_FORMAT_ONE(value) ( 0 == spec.nStars ? \
+                                 rpal_string_snprintf( out + used, size - used, tmpSpec, (value) ) : \
+                                 ( 1 == spec.nStars ? \
+                                   rpal_string_snprintf( out + used, size - used, tmpSpec, stars[ 0 ], (value) ) : \
+                                   rpal_string_snprintf( out + used, size - used, tmpSpec, stars[ 0 ], stars[ 1 ], (value) ) ) )
+
+RPRIVATE
+RU32
+    _formatRecord
+    (
+        _LogRecord* record,
+        RPCHAR out,
+        RU32 size
+    )
+{
+    RPCHAR c = record->site->format;
+    _LogSpec spec = { 0 };
+    RCHAR tmpSpec[ _LOG_MAX_SPEC ] = { 0 };
+    int stars[ 2 ] = { 0 };
+    RU32 argIndex = 0;
+    RU32 used = 0;
+    RU32 i = 0;
+    _LogArg* arg = NULL;
+    int ret = 0;
+
+    if( 0 == size )
+    {
+        return 0;
+    }
+
+    while( 0 != *c && used + 1 < size )
+    {
+        if( '%' != *c )
+        {
+            out[ used++ ] = *c++;
+            continue;
+        }
+
+        if( !_parseSpec( c, &spec ) ||
+            ( _LOG_ARG_NONE != spec.argClass && argIndex + spec.nStars + 1 > record->nArgs ) ||
+            sizeof( tmpSpec ) <= spec.length )
+        {
+            // Arguments past what we could capture, print the rest raw.
+            while( 0 != *c && used + 1 < size )
+            {
+                out[ used++ ] = *c++;
+            }
+            break;
+        }
+
+        if( _LOG_ARG_NONE == spec.argClass )
+        {
+            out[ used++ ] = '%';
+            c += spec.length;
+            continue;
+        }
+
+        rpal_memory_memcpy( tmpSpec, c, spec.length );
+        tmpSpec[ spec.length ] = 0;
+        c += spec.length;
+
+        for( i = 0; i < spec.nStars; i++ )
+        {
+            stars[ i ] = (int)record->args[ argIndex++ ].u;
+        }
+        arg = &record->args[ argIndex++ ];
+
+        switch( spec.argClass )
+        {
+            case _LOG_ARG_INT:
+                ret = _LOG_FORMAT_ONE( (int)arg->u );
+                break;
+            case _LOG_ARG_LONG:
+                ret = _LOG_FORMAT_ONE( (long)arg->u );
+                break;
+            case _LOG_ARG_LLONG:
+                ret = _LOG_FORMAT_ONE( (long long)arg->u );
+                break;
+            case _LOG_ARG_SIZE:
+                ret = _LOG_FORMAT_ONE( (size_t)arg->u );
+                break;
+            case _LOG_ARG_DOUBLE:
+                ret = _LOG_FORMAT_ONE( arg->d );
+                break;
+            case _LOG_ARG_LDOUBLE:
+                ret = _LOG_FORMAT_ONE( (long double)arg->d );
+                break;
+            case _LOG_ARG_PTR:
+                ret = _LOG_FORMAT_ONE( arg->p );
+                break;
+            case _LOG_ARG_STR:
+                ret = _LOG_FORMAT_ONE( (RU64)( -1 ) == arg->u ? "(null)" : (RPCHAR)( record->payload + arg->u ) );
+                break;
+            case _LOG_ARG_WSTR:
+                ret = _LOG_FORMAT_ONE( (RU64)( -1 ) == arg->u ? L"(null)" : (RPWCHAR)( record->payload + arg->u ) );
+                break;
+            default:
+                ret = 0;
+                break;
+        }
+
+        used += _clampFormatted( ret, size - used );
+    }
+
+    out[ used ] = 0;
+
+    return used;
+}
+
+//=============================================================================
+//  Sinks
+//=============================================================================
+RPRIVATE
+RPNCHAR
+    _rotatedPath
+    (
+        RU32 index
+    )
+{
+    RPNCHAR path = NULL;
+    RNCHAR suffix[ 16 ] = { 0 };
+
+    if( 0 == index )
+    {
+        return rpal_string_strdup( g_log_filePath );
+    }
+
+    suffix[ 0 ] = _NC( '.' );
+    rpal_string_itos( index, suffix + 1, 10 );
+
+    if( NULL != ( path = rpal_string_strdup( g_log_filePath ) ) )
+    {
+        path = rpal_string_strcatEx( path, suffix );
+    }
+
+    return path;
+}
+
+RPRIVATE
+RVOID
+    _rotateLogFile
+    (
+
+    )
+{
+    RU32 i = 0;
+    RPNCHAR from = NULL;
+    RPNCHAR to = NULL;
+
+    // file.N-1 is dropped, file.N-2 becomes file.N-1 and so on down to
+    // the current file becoming file.1.
+    if( 1 < g_log_maxFiles )
+    {
+        if( NULL != ( to = _rotatedPath( g_log_maxFiles - 1 ) ) )
+        {
+            rpal_file_delete( to, FALSE );
+        }
+
+        for( i = g_log_maxFiles - 1; i > 0; i-- )
+        {
+            if( NULL != ( from = _rotatedPath( i - 1 ) ) &&
+                NULL != to )
+            {
+                rpal_file_move( from, to );
+            }
+            rpal_memory_free( to );
+            to = from;
+            from = NULL;
+        }
+        rpal_memory_free( to );
+    }
+    else
+    {
+        rpal_file_delete( g_log_filePath, FALSE );
+    }
+}
+
+// The file is opened for each batch so that everything written is on disk
+// if we crash and so that a log file deleted from under us is recreated.
+RPRIVATE
+RVOID
+    _flushWriteBuffer
+    (
+
+    )
+{
+    rFile hFile = NULL;
+    RU64 fileSize = 0;
+
+    if( 0 == g_log_writeBufferUsed )
+    {
+        return;
+    }
+
+    if( rFile_open( g_log_filePath, &hFile, RPAL_FILE_OPEN_WRITE | RPAL_FILE_OPEN_ALWAYS ) )
+    {
+        fileSize = rFile_seek( hFile, 0, rFileSeek_END );
+
+        if( 0 != fileSize &&
+            fileSize + g_log_writeBufferUsed > g_log_maxFileSize )
+        {
+            rFile_close( hFile );
+            hFile = NULL;
+            _rotateLogFile();
+
+            if( !rFile_open( g_log_filePath, &hFile, RPAL_FILE_OPEN_WRITE | RPAL_FILE_OPEN_ALWAYS ) )
+            {
+                hFile = NULL;
+            }
+        }
+
+        if( NULL != hFile )
+        {
+            rFile_write( hFile, g_log_writeBufferUsed, g_log_writeBuffer );
+            rFile_close( hFile );
+        }
+    }
+
+    g_log_writeBufferUsed = 0;
+}
+
+RPRIVATE
+RVOID
+    _emitLine
+    (
+        RPCHAR line,
+        RU32 lineSize
+    )
+{
+    if( NULL == g_log_filePath ||
+        NULL == g_log_writeBuffer )
+    {
+        _emitConsole( line );
+        return;
+    }
+
+    // Batches are kept under the maximum file size so that rotating before
+    // writing a batch keeps the files under it.
+    if( g_log_writeBufferUsed + lineSize > MIN_OF( _LOG_WRITE_BUFFER_SIZE, g_log_maxFileSize ) )
+    {
+        _flushWriteBuffer();
+    }
+
+    rpal_memory_memcpy( g_log_writeBuffer + g_log_writeBufferUsed, line, lineSize );
+    g_log_writeBufferUsed += lineSize;
+}
+
+RPRIVATE
+RVOID
+    _emitRecord
+    (
+        _LogRecord* record
+    )
+{
+    RCHAR line[ _LOG_MAX_LINE ] = { 0 };
+    RU32 used = 0;
+
+    used = _formatPrefix( record->site, record->timestamp, line, sizeof( line ) );
+    used += _formatRecord( record, line + used, sizeof( line ) - used );
+    used += _formatSuffix( record->nSuppressed, line + used, sizeof( line ) - used );
+
+    _emitLine( line, used );
+}
+
+//=============================================================================
+//  Rings and the writer.
+//=============================================================================
+RPRIVATE
+RVOID
+    _orphanRing
+    (
+        RPVOID ring
+    )
+{
+    // The thread is exiting, the writer frees the ring once it's drained.
+    rInterlocked_increment32( &g_log_nInFlight );
+    if( rInterlocked_get32( &g_log_isRunning ) &&
+        NULL != ring )
+    {
+        rInterlocked_set32( &( (_LogRing*)ring )->isOrphaned, TRUE );
+    }
+    rInterlocked_decrement32( &g_log_nInFlight );
+}
+
+RPRIVATE
+_LogRing*
+    _getRing
+    (
+
+    )
+{
+    _LogRing* ring = NULL;
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    ring = TlsGetValue( g_log_tls );
+#else
+    ring = pthread_getspecific( g_log_tls );
+#endif
+
+    if( NULL != ring )
+    {
+        return ring;
+    }
+
+    // Rings live outside of the rpal memory accounting, they are owned by
+    // the logger and freed on rpal_log_stop.
+    if( NULL == ( ring = malloc( sizeof( *ring ) ) ) )
+    {
+        return NULL;
+    }
+    memset( ring, 0, sizeof( *ring ) );
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    ring->hThread = OpenThread( SYNCHRONIZE, FALSE, GetCurrentThreadId() );
+    TlsSetValue( g_log_tls, ring );
+#else
+    pthread_setspecific( g_log_tls, ring );
+#endif
+
+    if( rMutex_lock( g_log_ringsMutex ) )
+    {
+        ring->next = g_log_rings;
+        g_log_rings = ring;
+        rMutex_unlock( g_log_ringsMutex );
+    }
+
+    return ring;
+}
+
+RPRIVATE
+RVOID
+    _freeRing
+    (
+        _LogRing* ring
+    )
+{
+#ifdef RPAL_PLATFORM_WINDOWS
+    if( NULL != ring->hThread )
+    {
+        CloseHandle( ring->hThread );
+    }
+#endif
+    free( ring );
+}
+
+// Must be called with g_log_mutex held.
+RPRIVATE
+RVOID
+    _drainRings
+    (
+
+    )
+{
+    _LogRing* ring = NULL;
+    _LogRing* next = NULL;
+    _LogRing** pPrev = NULL;
+    RU32 head = 0;
+    RU32 nDropped = 0;
+    RBOOL isOrphaned = FALSE;
+    RCHAR line[ 64 ] = { 0 };
+
+    // New rings are only ever pushed at the head of the list and only the
+    // drain removes them, so once we have the head the rest is stable.
+    if( !rMutex_lock( g_log_ringsMutex ) )
+    {
+        return;
+    }
+    ring = g_log_rings;
+    rMutex_unlock( g_log_ringsMutex );
+
+    for( ; NULL != ring; ring = next )
+    {
+        next = ring->next;
+
+        isOrphaned = rInterlocked_get32( &ring->isOrphaned );
+#ifdef RPAL_PLATFORM_WINDOWS
+        if( NULL != ring->hThread &&
+            WAIT_OBJECT_0 == WaitForSingleObject( ring->hThread, 0 ) )
+        {
+            isOrphaned = TRUE;
+        }
+#endif
+
+        head = rInterlocked_get32( &ring->head );
+        while( ring->tail != head )
+        {
+            _emitRecord( &ring->records[ ring->tail % _LOG_RING_SIZE ] );
+            rInterlocked_increment32( &ring->tail );
+        }
+
+        if( 0 != ( nDropped = rInterlocked_set32( &ring->nDropped, 0 ) ) )
+        {
+            _emitLine( line, _clampFormatted( rpal_string_snprintf( line,
+                                                                    sizeof( line ),
+                                                                    "log ring full, %u records dropped\n",
+                                                                    nDropped ),
+                                              sizeof( line ) ) );
+        }
+
+        if( isOrphaned &&
+            rMutex_lock( g_log_ringsMutex ) )
+        {
+            pPrev = &g_log_rings;
+            while( NULL != *pPrev && ring != *pPrev )
+            {
+                pPrev = &( *pPrev )->next;
+            }
+            if( NULL != *pPrev )
+            {
+                *pPrev = ring->next;
+            }
+            rMutex_unlock( g_log_ringsMutex );
+            _freeRing( ring );
+        }
+    }
+
+    if( NULL != g_log_filePath )
+    {
+        _flushWriteBuffer();
+    }
+}
+
+RPRIVATE
+RU32
+    RPAL_THREAD_FUNC _logWriter
+    (
+        RPVOID ctx
+    )
+{
+    UNREFERENCED_PARAMETER( ctx );
+
+    while( !rEvent_wait( g_log_stopEvent, _LOG_WRITER_INTERVAL ) )
+    {
+        if( rMutex_lock( g_log_mutex ) )
+        {
+            _drainRings();
+            rMutex_unlock( g_log_mutex );
+        }
+    }
+
+    return 0;
+}
+
+//=============================================================================
+//  Public API
+//=============================================================================
+RBOOL
+    rpal_log_start
+    (
+        RPNCHAR filePath,
+        RU32 maxFileSize,
+        RU32 maxFiles
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RBOOL isTlsCreated = FALSE;
+
+    if( rInterlocked_get32( &g_log_isRunning ) )
+    {
+        return FALSE;
+    }
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    isTlsCreated = ( TLS_OUT_OF_INDEXES != ( g_log_tls = TlsAlloc() ) );
+#else
+    isTlsCreated = ( 0 == pthread_key_create( &g_log_tls, _orphanRing ) );
+#endif
+
+    if( isTlsCreated &&
+        NULL != ( g_log_mutex = rMutex_create() ) &&
+        NULL != ( g_log_ringsMutex = rMutex_create() ) &&
+        NULL != ( g_log_stopEvent = rEvent_create( TRUE ) ) )
+    {
+        isSuccess = TRUE;
+
+        if( NULL != filePath )
+        {
+            g_log_maxFileSize = 0 == maxFileSize ? (RU32)( -1 ) : maxFileSize;
+            g_log_maxFiles = maxFiles;
+            g_log_writeBufferUsed = 0;
+            if( NULL == ( g_log_filePath = rpal_string_strdup( filePath ) ) ||
+                NULL == ( g_log_writeBuffer = rpal_memory_alloc( _LOG_WRITE_BUFFER_SIZE ) ) )
+            {
+                isSuccess = FALSE;
+            }
+        }
+
+        if( isSuccess )
+        {
+            rInterlocked_set32( &g_log_isRunning, TRUE );
+
+            if( NULL == ( g_log_writer = rpal_thread_new( _logWriter, NULL ) ) )
+            {
+                rInterlocked_set32( &g_log_isRunning, FALSE );
+                isSuccess = FALSE;
+            }
+        }
+    }
+
+    if( !isSuccess )
+    {
+        rpal_memory_free( g_log_filePath );
+        g_log_filePath = NULL;
+        rpal_memory_free( g_log_writeBuffer );
+        g_log_writeBuffer = NULL;
+        rEvent_free( g_log_stopEvent );
+        g_log_stopEvent = NULL;
+        rMutex_free( g_log_mutex );
+        g_log_mutex = NULL;
+        rMutex_free( g_log_ringsMutex );
+        g_log_ringsMutex = NULL;
+        if( isTlsCreated )
+        {
+#ifdef RPAL_PLATFORM_WINDOWS
+            TlsFree( g_log_tls );
+#else
+            pthread_key_delete( g_log_tls );
+#endif
+        }
+    }
+
+    return isSuccess;
+}
+
+RVOID
+    rpal_log_stop
+    (
+
+    )
+{
+    _LogRing* ring = NULL;
+
+    if( !rInterlocked_get32( &g_log_isRunning ) )
+    {
+        return;
+    }
+
+    rEvent_set( g_log_stopEvent );
+    rpal_thread_wait( g_log_writer, RINFINITE );
+    rpal_thread_free( g_log_writer );
+    g_log_writer = NULL;
+
+    // New records go to stderr from now on, wait for the ones in progress
+    // before draining and freeing the rings.
+    rInterlocked_set32( &g_log_isRunning, FALSE );
+    while( 0 != rInterlocked_get32( &g_log_nInFlight ) )
+    {
+        rpal_thread_sleep( 1 );
+    }
+
+    if( rMutex_lock( g_log_mutex ) )
+    {
+        _drainRings();
+        rMutex_unlock( g_log_mutex );
+    }
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    TlsFree( g_log_tls );
+#else
+    pthread_key_delete( g_log_tls );
+#endif
+
+    while( NULL != ( ring = g_log_rings ) )
+    {
+        g_log_rings = ring->next;
+        _freeRing( ring );
+    }
+
+    rpal_memory_free( g_log_filePath );
+    g_log_filePath = NULL;
+    rpal_memory_free( g_log_writeBuffer );
+    g_log_writeBuffer = NULL;
+    rEvent_free( g_log_stopEvent );
+    g_log_stopEvent = NULL;
+    rMutex_free( g_log_mutex );
+    g_log_mutex = NULL;
+    rMutex_free( g_log_ringsMutex );
+    g_log_ringsMutex = NULL;
+}
+
+RVOID
+    rpal_log_flush
+    (
+
+    )
+{
+    rInterlocked_increment32( &g_log_nInFlight );
+
+    if( rInterlocked_get32( &g_log_isRunning ) &&
+        rMutex_lock( g_log_mutex ) )
+    {
+        _drainRings();
+        rMutex_unlock( g_log_mutex );
+    }
+
+    rInterlocked_decrement32( &g_log_nInFlight );
+}
+
+RVOID
+    rpal_log_setLevel
+    (
+        RU32 level
+    )
+{
+    rInterlocked_set32( &g_log_level, level );
+    rInterlocked_increment32( &g_rpal_log_generation );
+}
+
+RBOOL
+    rpal_log_setFileLevel
+    (
+        RPCHAR fileName,
+        RU32 level
+    )
+{
+    RBOOL isSuccess = FALSE;
+    RU32 i = 0;
+    RU32 nLevels = 0;
+
+    if( NULL == fileName ||
+        sizeof( g_log_fileLevels[ 0 ].fileName ) <= rpal_string_strlenA( fileName ) )
+    {
+        return FALSE;
+    }
+
+    // Setting levels is rare, a spinlock keeps the readers lock free: an
+    // entry is never removed and is only made visible once it is complete.
+    while( 0 != rInterlocked_set32( &g_log_fileLevelsLock, 1 ) )
+    {
+        rpal_thread_sleep( 0 );
+    }
+
+    nLevels = rInterlocked_get32( &g_log_nFileLevels );
+    for( i = 0; i < nLevels; i++ )
+    {
+        if( 0 == rpal_string_strcmpA( g_log_fileLevels[ i ].fileName, fileName ) )
+        {
+            rInterlocked_set32( &g_log_fileLevels[ i ].level, level );
+            isSuccess = TRUE;
+            break;
+        }
+    }
+
+    if( !isSuccess &&
+        nLevels < ARRAY_N_ELEM( g_log_fileLevels ) )
+    {
+        rpal_memory_memcpy( g_log_fileLevels[ nLevels ].fileName, fileName, rpal_string_strlenA( fileName ) + 1 );
+        g_log_fileLevels[ nLevels ].level = level;
+        rInterlocked_increment32( &g_log_nFileLevels );
+        isSuccess = TRUE;
+    }
+
+    rInterlocked_set32( &g_log_fileLevelsLock, 0 );
+
+    rInterlocked_increment32( &g_rpal_log_generation );
+
+    return isSuccess;
+}
+
+RVOID
+    rpal_log_setRateLimit
+    (
+        RU32 perSecond
+    )
+{
+    rInterlocked_set32( &g_log_rateLimit, perSecond );
+}
+
+RBOOL
+    rpal_log_refreshSite
+    (
+        rpal_log_site* site
+    )
+{
+    RU32 generation = 0;
+    RU32 threshold = 0;
+    RU32 nLevels = 0;
+    RU32 fileLevel = 0;
+    RU32 i = 0;
+    RU32 siteLen = 0;
+    RU32 nameLen = 0;
+    RPCHAR name = NULL;
+
+    generation = rInterlocked_get32( &g_rpal_log_generation );
+    threshold = rInterlocked_get32( &g_log_level );
+
+    // Per-file levels match the end of __FILE__, so either a file name or
+    // a partial path can be used.
+    siteLen = rpal_string_strlenA( site->file );
+    nLevels = rInterlocked_get32( &g_log_nFileLevels );
+    for( i = 0; i < nLevels; i++ )
+    {
+        name = g_log_fileLevels[ i ].fileName;
+        nameLen = rpal_string_strlenA( name );
+        fileLevel = rInterlocked_get32( &g_log_fileLevels[ i ].level );
+
+        if( RPAL_LOG_LEVEL_DEFAULT != fileLevel &&
+            nameLen <= siteLen &&
+            0 == rpal_memory_memcmp( site->file + siteLen - nameLen, name, nameLen ) &&
+            ( nameLen == siteLen ||
+              '/' == site->file[ siteLen - nameLen - 1 ] ||
+              '\\' == site->file[ siteLen - nameLen - 1 ] ) )
+        {
+            threshold = fileLevel;
+            break;
+        }
+    }
+
+    site->threshold = threshold;
+    site->generation = generation;
+
+    return site->level <= threshold;
+}
+
+RVOID
+    rpal_log_write
+    (
+        rpal_log_site* site,
+        ...
+    )
+{
+    va_list args;
+    RU32 rateLimit = 0;
+    RU32 now = 0;
+    RU32 nSuppressed = 0;
+    _LogRing* ring = NULL;
+    _LogRecord* record = NULL;
+    RU32 head = 0;
+    RBOOL isRecorded = FALSE;
+    RCHAR line[ _LOG_MAX_LINE ] = { 0 };
+    RU32 used = 0;
+
+    if( NULL == site )
+    {
+        return;
+    }
+
+    // Rate limiting is per call site over one second windows, the races
+    // between threads on the window boundary only make it approximate.
+    if( 0 != ( rateLimit = rInterlocked_get32( &g_log_rateLimit ) ) )
+    {
+        now = (RU32)rpal_time_getLocal();
+        if( site->window != now )
+        {
+            site->window = now;
+            rInterlocked_set32( &site->nInWindow, 0 );
+        }
+        if( rInterlocked_increment32( &site->nInWindow ) > rateLimit )
+        {
+            rInterlocked_increment32( &site->nSuppressed );
+            return;
+        }
+    }
+    nSuppressed = rInterlocked_set32( &site->nSuppressed, 0 );
+
+    va_start( args, site );
+
+    rInterlocked_increment32( &g_log_nInFlight );
+    if( rInterlocked_get32( &g_log_isRunning ) &&
+        NULL != ( ring = _getRing() ) )
+    {
+        head = ring->head;
+        if( _LOG_RING_SIZE <= head - rInterlocked_get32( &ring->tail ) )
+        {
+            rInterlocked_increment32( &ring->nDropped );
+        }
+        else
+        {
+            record = &ring->records[ head % _LOG_RING_SIZE ];
+            record->site = site;
+            record->timestamp = rpal_time_getLocal();
+            record->nSuppressed = nSuppressed;
+            _captureArgs( record, site->format, args );
+
+            // Publishes the record to the writer.
+            rInterlocked_increment32( &ring->head );
+        }
+        isRecorded = TRUE;
+    }
+    rInterlocked_decrement32( &g_log_nInFlight );
+
+    if( !isRecorded )
+    {
+        used = _formatPrefix( site, rpal_time_getLocal(), line, sizeof( line ) );
+        used += _clampFormatted( vsnprintf( line + used, sizeof( line ) - used, site->format, args ), sizeof( line ) - used );
+        _formatSuffix( nSuppressed, line + used, sizeof( line ) - used );
+        _emitConsole( line );
+    }
+
+    va_end( args );
+}
 
 RVOID
     rpal_debug_print
@@ -17,6 +17,10 @@ limitations under the License.
 // This definition is required for FTW on Linux, it MUST be the first line
 // in the source, not even an ifdef.
 #define _XOPEN_SOURCE 500
+#ifdef __linux__
+    // getdents64, fstatat and statx.
+    #define _GNU_SOURCE
+#endif
 
 #include <rpal/rpal_file.h>
 
@@ -27,6 +31,11 @@ limitations under the License.
     #include <sys/stat.h>
     #include <unistd.h>
     #include <ftw.h>
+#ifdef RPAL_PLATFORM_LINUX
+    #include <fcntl.h>
+    #include <errno.h>
+    #include <sys/syscall.h>
+#endif
 #elif defined( RPAL_PLATFORM_WINDOWS )
     #include <shobjidl.h>
     #include <shlguid.h>
@@ -34,12 +43,57 @@ limitations under the License.
     #include <shellapi.h>
 #endif
 
+#define _CRAWL_LIST_BUFFER_SIZE     (64 * 1024)
+#define _CRAWL_MAX_THREADS          16
+#define _CRAWL_MAX_PENDING_RESULTS  1024
+
+#ifdef RPAL_PLATFORM_LINUX
+// Layout of the records returned by getdents64, not exposed by all libcs.
 typedef struct
 {
-    rStack stack;
+    RU64 d_ino;
+    RU64 d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+
+} _linuxDirent64;
+#endif
+
+struct _rDirCrawl;
+
+typedef struct
+{
+    struct _rDirCrawl* pCrawl;
+    rThread hThread;
+    RPNCHAR dirExp;
+    RPU8 buffer;
+
+} _rDirCrawlWorker;
+
+typedef struct _rDirCrawl
+{
+    rStack dirs;
+    rStack results;
     RPNCHAR dirExp;
     RPNCHAR* fileExp;
+    RPNCHAR* pruneExp;
     RU32 nMaxDepth;
+    RU32 flags;
+    RU64 rootDevice;
+
+    // Everything below is only used when crawling with worker threads.
+    rMutex lock;
+    rEvent workEvent;
+    rEvent resultEvent;
+    rEvent roomEvent;
+    RU32 nBusy;
+    RBOOL isDone;
+    volatile RBOOL isStopping;
+    RU32 nThreads;
+    RU32 nStarted;
+    _rDirCrawlWorker* workers;
+    _rDirCrawlWorker syncWorker;
 
 } _rDirCrawl, *_prDirCrawl;
 
@@ -873,59 +927,6 @@ RPNCHAR
     return fileName;
 }
 
-static
-rDirCrawl
-    _newCrawlDir
-    (
-        RPNCHAR rootExpr,
-        RPNCHAR fileExpr[],
-        RU32 nMaxDepth
-    )
-{
-    _prDirCrawl pCrawl = NULL;
-
-    if( NULL != rootExpr &&
-        NULL != fileExpr )
-    {
-        pCrawl = rpal_memory_alloc( sizeof( _rDirCrawl ) );
-
-        if( NULL != pCrawl )
-        {
-            pCrawl->stack = rStack_new( sizeof( rFileInfo ) );
-
-            if( NULL != pCrawl->stack )
-            {
-                pCrawl->dirExp = NULL;
-                pCrawl->fileExp = NULL;
-                pCrawl->nMaxDepth = nMaxDepth;
-                
-                rpal_string_expand( rootExpr, &(pCrawl->dirExp) );
-                pCrawl->fileExp = fileExpr;
-
-                if( NULL == pCrawl->dirExp ||
-                    NULL == pCrawl->fileExp )
-                {
-                    rpal_memory_free( pCrawl->dirExp );
-                    rStack_free( pCrawl->stack, NULL );
-                    rpal_memory_free( pCrawl );
-                    pCrawl = NULL;
-                }
-                else
-                {
-                    rpal_file_pathToLocalSep( pCrawl->dirExp );
-                }
-            }
-            else
-            {
-                rpal_memory_free( pCrawl );
-                pCrawl = NULL;
-            }
-        }
-    }
-
-    return pCrawl;
-}
-
 RBOOL
     _strHasWildcards
     (
@@ -1126,6 +1127,486 @@ RVOID
 }
 
 
+static
+RBOOL
+    _crawlIsPruned
+    (
+        _prDirCrawl pCrawl,
+        RPNCHAR dirPath
+    )
+{
+    RBOOL isPruned = FALSE;
+    RPNCHAR* tmpExp = NULL;
+
+    if( NULL != pCrawl->pruneExp )
+    {
+        tmpExp = pCrawl->pruneExp;
+        while( NULL != *tmpExp )
+        {
+            if( rpal_string_match( *tmpExp, dirPath, TRUE ) )
+            {
+                isPruned = TRUE;
+                break;
+            }
+
+            tmpExp++;
+        }
+    }
+
+    return isPruned;
+}
+
+static
+RVOID
+    _crawlClassify
+    (
+        _rDirCrawlWorker* pWorker,
+        rFileInfo* pInfo,
+        RBOOL* pIsReported,
+        RBOOL* pIsDescended
+    )
+{
+    _prDirCrawl pCrawl = pWorker->pCrawl;
+    RBOOL isDir = IS_FLAG_ENABLED( pInfo->attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY );
+    RBOOL isPartial = FALSE;
+
+    *pIsReported = _isFileInfoInCrawl( pWorker->dirExp, pCrawl->fileExp, pCrawl->nMaxDepth, pInfo, FALSE );
+    *pIsDescended = FALSE;
+
+    if( isDir )
+    {
+        // A directory may not match itself but still lead to matches deeper.
+        isPartial = _isFileInfoInCrawl( pWorker->dirExp, pCrawl->fileExp, pCrawl->nMaxDepth, pInfo, TRUE );
+
+        // This is a shortcut if depth is 0, we will never want to drill down further
+        if( ( *pIsReported || isPartial ) &&
+            0 != pCrawl->nMaxDepth &&
+            !_crawlIsPruned( pCrawl, pInfo->filePath ) )
+        {
+            *pIsDescended = TRUE;
+        }
+    }
+}
+
+static
+RBOOL
+    _crawlPushDir
+    (
+        _prDirCrawl pCrawl,
+        rFileInfo* pInfo
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    if( rMutex_lock( pCrawl->lock ) )
+    {
+        if( rStack_push( pCrawl->dirs, pInfo ) )
+        {
+            isSuccess = TRUE;
+
+            if( NULL != pCrawl->workEvent )
+            {
+                rEvent_set( pCrawl->workEvent );
+            }
+        }
+
+        rMutex_unlock( pCrawl->lock );
+    }
+
+    return isSuccess;
+}
+
+static
+RBOOL
+    _crawlPushResult
+    (
+        _prDirCrawl pCrawl,
+        rFileInfo* pInfo
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    if( rMutex_lock( pCrawl->lock ) )
+    {
+        // With workers, the consumer sets the pace so we don't buffer the
+        // whole file system in memory if it stops reading for a while.
+        while( NULL != pCrawl->roomEvent &&
+               !pCrawl->isStopping &&
+               _CRAWL_MAX_PENDING_RESULTS <= rStack_getSize( pCrawl->results ) )
+        {
+            rEvent_unset( pCrawl->roomEvent );
+            rMutex_unlock( pCrawl->lock );
+            rEvent_wait( pCrawl->roomEvent, RINFINITE );
+            rMutex_lock( pCrawl->lock );
+        }
+
+        if( !pCrawl->isStopping &&
+            rStack_push( pCrawl->results, pInfo ) )
+        {
+            isSuccess = TRUE;
+
+            if( NULL != pCrawl->resultEvent )
+            {
+                rEvent_set( pCrawl->resultEvent );
+            }
+        }
+
+        rMutex_unlock( pCrawl->lock );
+    }
+
+    return isSuccess;
+}
+
+#ifdef RPAL_PLATFORM_LINUX
+static
+RBOOL
+    _crawlStatEntry
+    (
+        RS32 dirFd,
+        rFileInfo* pInfo
+    )
+{
+    RBOOL isSuccess = FALSE;
+    struct stat fileInfo = {0};
+#ifdef STATX_TYPE
+    struct statx fileInfoX = {0};
+    static RBOOL isStatxMissing = FALSE;
+#endif
+
+    pInfo->attributes = 0;
+    pInfo->creationTime = 0;
+    pInfo->lastAccessTime = 0;
+    pInfo->modificationTime = 0;
+    pInfo->size = 0;
+
+#ifdef STATX_TYPE
+    // Only ask for what goes in the rFileInfo and never force a sync with
+    // a remote file system, cached attributes are good enough for a crawl.
+    if( !isStatxMissing )
+    {
+        if( 0 == statx( dirFd, 
+                        pInfo->fileName, 
+                        AT_STATX_DONT_SYNC, 
+                        STATX_TYPE | STATX_MODE | STATX_SIZE | STATX_ATIME | STATX_MTIME | STATX_CTIME, 
+                        &fileInfoX ) )
+        {
+            if( S_ISDIR( fileInfoX.stx_mode ) )
+            {
+                ENABLE_FLAG( pInfo->attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY );
+            }
+            if( IS_FLAG_ENABLED( S_IXUSR, fileInfoX.stx_mode ) )
+            {
+                ENABLE_FLAG( pInfo->attributes, RPAL_FILE_ATTRIBUTE_EXECUTE );
+            }
+
+            pInfo->creationTime = (RU64)fileInfoX.stx_ctime.tv_sec;
+            pInfo->lastAccessTime = (RU64)fileInfoX.stx_atime.tv_sec;
+            pInfo->modificationTime = (RU64)fileInfoX.stx_mtime.tv_sec;
+            pInfo->size = (RU64)fileInfoX.stx_size;
+
+            return TRUE;
+        }
+        else if( ENOSYS != errno )
+        {
+            return FALSE;
+        }
+
+        isStatxMissing = TRUE;
+    }
+#endif
+
+    if( 0 == fstatat( dirFd, pInfo->fileName, &fileInfo, 0 ) )
+    {
+        if( S_ISDIR( fileInfo.st_mode ) )
+        {
+            ENABLE_FLAG( pInfo->attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY );
+        }
+        if( IS_FLAG_ENABLED( S_IXUSR, fileInfo.st_mode ) )
+        {
+            ENABLE_FLAG( pInfo->attributes, RPAL_FILE_ATTRIBUTE_EXECUTE );
+        }
+
+        pInfo->creationTime = ( (RU64) fileInfo.st_ctime );
+        pInfo->lastAccessTime = ( (RU64) fileInfo.st_atime );
+        pInfo->modificationTime = ( (RU64) fileInfo.st_mtime );
+        pInfo->size = ( (RU64) fileInfo.st_size );
+
+        isSuccess = TRUE;
+    }
+
+    return isSuccess;
+}
+
+static
+RVOID
+    _crawlListDir
+    (
+        _rDirCrawlWorker* pWorker,
+        RPNCHAR dirPath
+    )
+{
+    _prDirCrawl pCrawl = pWorker->pCrawl;
+    RNCHAR sep[] = RPAL_FILE_LOCAL_DIR_SEP_N;
+    RS32 dirFd = (-1);
+    struct stat dirInfo = {0};
+    RS32 nRead = 0;
+    RS32 offset = 0;
+    _linuxDirent64* pEntry = NULL;
+    RU32 prefixLen = 0;
+    RU32 nameLen = 0;
+    rFileInfo info = {0};
+    RBOOL isReported = FALSE;
+    RBOOL isDescended = FALSE;
+    RBOOL isStatDone = FALSE;
+
+    prefixLen = rpal_string_strlen( dirPath );
+
+    if( 0 == prefixLen ||
+        ARRAY_N_ELEM( info.filePath ) - 2 <= prefixLen )
+    {
+        return;
+    }
+
+    if( 0 > ( dirFd = open( dirPath, O_RDONLY | O_DIRECTORY | O_CLOEXEC ) ) )
+    {
+        return;
+    }
+
+    if( IS_FLAG_ENABLED( pCrawl->flags, RPAL_FILE_CRAWL_SAME_DEVICE ) &&
+        ( 0 != fstat( dirFd, &dirInfo ) ||
+          (RU64)dirInfo.st_dev != pCrawl->rootDevice ) )
+    {
+        close( dirFd );
+        return;
+    }
+
+    rpal_string_strcpy( info.filePath, dirPath );
+    if( sep[ 0 ] != info.filePath[ prefixLen - 1 ] )
+    {
+        info.filePath[ prefixLen ] = sep[ 0 ];
+        prefixLen++;
+    }
+    info.fileName = info.filePath + prefixLen;
+
+    // One syscall returns as many entries as fit in the buffer and the entry
+    // type comes with it, so most entries never need a stat.
+    while( !pCrawl->isStopping &&
+           0 < ( nRead = (RS32)syscall( SYS_getdents64, dirFd, pWorker->buffer, _CRAWL_LIST_BUFFER_SIZE ) ) )
+    {
+        for( offset = 0; offset < nRead; offset += pEntry->d_reclen )
+        {
+            pEntry = (_linuxDirent64*)( pWorker->buffer + offset );
+
+            if( 0 == rpal_string_strcmp( ".", pEntry->d_name ) ||
+                0 == rpal_string_strcmp( "..", pEntry->d_name ) )
+            {
+                continue;
+            }
+
+            nameLen = rpal_string_strlen( pEntry->d_name );
+            if( ARRAY_N_ELEM( info.filePath ) - 1 <= prefixLen + nameLen )
+            {
+                continue;
+            }
+
+            rpal_memory_memcpy( info.fileName, pEntry->d_name, nameLen + 1 );
+
+            info.attributes = 0;
+            info.creationTime = 0;
+            info.lastAccessTime = 0;
+            info.modificationTime = 0;
+            info.size = 0;
+            isStatDone = FALSE;
+
+            if( DT_DIR == pEntry->d_type )
+            {
+                ENABLE_FLAG( info.attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY );
+            }
+            else if( DT_LNK == pEntry->d_type ||
+                     DT_UNKNOWN == pEntry->d_type )
+            {
+                // Links are followed like a stat would, and some file systems
+                // don't report types at all, either way we need the inode.
+                if( !_crawlStatEntry( dirFd, &info ) )
+                {
+                    continue;
+                }
+                isStatDone = TRUE;
+            }
+
+            _crawlClassify( pWorker, &info, &isReported, &isDescended );
+
+            if( isReported )
+            {
+                if( !isStatDone &&
+                    !IS_FLAG_ENABLED( pCrawl->flags, RPAL_FILE_CRAWL_NO_METADATA ) )
+                {
+                    _crawlStatEntry( dirFd, &info );
+                }
+
+                _crawlPushResult( pCrawl, &info );
+            }
+
+            if( isDescended )
+            {
+                _crawlPushDir( pCrawl, &info );
+            }
+        }
+    }
+
+    close( dirFd );
+}
+#else
+static
+RVOID
+    _crawlListDir
+    (
+        _rDirCrawlWorker* pWorker,
+        RPNCHAR dirPath
+    )
+{
+    _prDirCrawl pCrawl = pWorker->pCrawl;
+    rDir hDir = NULL;
+    rFileInfo info = {0};
+    RBOOL isReported = FALSE;
+    RBOOL isDescended = FALSE;
+#ifdef RPAL_PLATFORM_MACOSX
+    struct stat dirInfo = {0};
+
+    if( IS_FLAG_ENABLED( pCrawl->flags, RPAL_FILE_CRAWL_SAME_DEVICE ) &&
+        ( 0 != stat( dirPath, &dirInfo ) ||
+          (RU64)dirInfo.st_dev != pCrawl->rootDevice ) )
+    {
+        return;
+    }
+#endif
+
+    if( rDir_open( dirPath, &hDir ) )
+    {
+        while( !pCrawl->isStopping &&
+               rDir_next( hDir, &info ) )
+        {
+            _crawlClassify( pWorker, &info, &isReported, &isDescended );
+
+            if( isReported )
+            {
+                _crawlPushResult( pCrawl, &info );
+            }
+
+            if( isDescended )
+            {
+                _crawlPushDir( pCrawl, &info );
+            }
+        }
+
+        rDir_close( hDir );
+    }
+}
+#endif
+
+static
+RBOOL
+    _crawlInitWorker
+    (
+        _rDirCrawlWorker* pWorker,
+        _prDirCrawl pCrawl
+    )
+{
+    RBOOL isSuccess = FALSE;
+
+    pWorker->pCrawl = pCrawl;
+    pWorker->hThread = NULL;
+    pWorker->buffer = NULL;
+
+    // Matching tokenizes the expression in place so every worker needs its own.
+    if( NULL != ( pWorker->dirExp = rpal_string_strdup( pCrawl->dirExp ) ) )
+    {
+#ifdef RPAL_PLATFORM_LINUX
+        if( NULL != ( pWorker->buffer = rpal_memory_alloc( _CRAWL_LIST_BUFFER_SIZE ) ) )
+        {
+            isSuccess = TRUE;
+        }
+        else
+        {
+            rpal_memory_free( pWorker->dirExp );
+            pWorker->dirExp = NULL;
+        }
+#else
+        isSuccess = TRUE;
+#endif
+    }
+
+    return isSuccess;
+}
+
+static
+RVOID
+    _crawlFreeWorker
+    (
+        _rDirCrawlWorker* pWorker
+    )
+{
+    rpal_memory_free( pWorker->dirExp );
+    rpal_memory_free( pWorker->buffer );
+    pWorker->dirExp = NULL;
+    pWorker->buffer = NULL;
+}
+
+static
+RU32
+    RPAL_THREAD_FUNC
+    _crawlWorkerThread
+    (
+        RPVOID ctx
+    )
+{
+    _rDirCrawlWorker* pWorker = (_rDirCrawlWorker*)ctx;
+    _prDirCrawl pCrawl = pWorker->pCrawl;
+    rFileInfo dir = {0};
+
+    while( rMutex_lock( pCrawl->lock ) )
+    {
+        if( pCrawl->isStopping ||
+            pCrawl->isDone )
+        {
+            rMutex_unlock( pCrawl->lock );
+            break;
+        }
+
+        if( rStack_pop( pCrawl->dirs, &dir ) )
+        {
+            pCrawl->nBusy++;
+            rMutex_unlock( pCrawl->lock );
+
+            _crawlListDir( pWorker, dir.filePath );
+
+            rMutex_lock( pCrawl->lock );
+            pCrawl->nBusy--;
+
+            // Nobody is listing anything and nothing is left to list, so
+            // nothing new can show up either.
+            if( 0 == pCrawl->nBusy &&
+                rStack_isEmpty( pCrawl->dirs ) )
+            {
+                pCrawl->isDone = TRUE;
+                rEvent_set( pCrawl->workEvent );
+                rEvent_set( pCrawl->resultEvent );
+            }
+
+            rMutex_unlock( pCrawl->lock );
+        }
+        else
+        {
+            rEvent_unset( pCrawl->workEvent );
+            rMutex_unlock( pCrawl->lock );
+            rEvent_wait( pCrawl->workEvent, RINFINITE );
+        }
+    }
+
+    return 0;
+}
+
+
 rDirCrawl
     rpal_file_crawlStart
     (
@@ -1134,20 +1615,55 @@ rDirCrawl
         RU32 nMaxDepth
     )
 {
+    return rpal_file_crawlStartEx( rootExpr, fileExpr, nMaxDepth, NULL );
+}
+
+rDirCrawl
+    rpal_file_crawlStartEx
+    (
+        RPNCHAR rootExpr,
+        RPNCHAR fileExpr[],
+        RU32 nMaxDepth,
+        rDirCrawlOptions* pOptions
+    )
+{
+    RBOOL isSuccess = FALSE;
     _prDirCrawl pCrawl = NULL;
     RPNCHAR staticRoot = NULL;
     RPNCHAR tmpStr = NULL;
     RPNCHAR state = NULL;
     RPNCHAR sep = RPAL_FILE_LOCAL_DIR_SEP_N;
-    rDir hDir = NULL;
-    rFileInfo info = {0};
+    rFileInfo root = {0};
+    RU32 i = 0;
+#if defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+    struct stat rootInfo = {0};
+#endif
 
-    pCrawl = _newCrawlDir( rootExpr, fileExpr, nMaxDepth );
-    
-    if( NULL != pCrawl )
+    if( NULL == rootExpr ||
+        NULL == fileExpr ||
+        NULL == ( pCrawl = rpal_memory_alloc( sizeof( _rDirCrawl ) ) ) )
     {
-        pCrawl->nMaxDepth = nMaxDepth;
-        
+        return NULL;
+    }
+
+    rpal_memory_zero( pCrawl, sizeof( *pCrawl ) );
+    pCrawl->fileExp = fileExpr;
+    pCrawl->nMaxDepth = nMaxDepth;
+
+    if( NULL != pOptions )
+    {
+        pCrawl->flags = pOptions->flags;
+        pCrawl->pruneExp = pOptions->pruneExpr;
+        pCrawl->nThreads = MIN_OF( pOptions->nThreads, _CRAWL_MAX_THREADS );
+    }
+
+    if( rpal_string_expand( rootExpr, &(pCrawl->dirExp) ) &&
+        NULL != ( pCrawl->dirs = rStack_new( sizeof( rFileInfo ) ) ) &&
+        NULL != ( pCrawl->results = rStack_new( sizeof( rFileInfo ) ) ) &&
+        NULL != ( pCrawl->lock = rMutex_create() ) )
+    {
+        rpal_file_pathToLocalSep( pCrawl->dirExp );
+
         if( NULL != ( tmpStr = rpal_string_strtok( pCrawl->dirExp, sep[ 0 ], &state ) ) )
         {
             do
@@ -1166,49 +1682,73 @@ rDirCrawl
             }
             while( NULL != ( tmpStr = rpal_string_strtok( NULL, sep[ 0 ], &state ) ) );
         }
+    }
 
-        if( NULL != staticRoot )
+    if( NULL != staticRoot &&
+        RPAL_MAX_PATH > rpal_string_strlen( staticRoot ) )
+    {
+        staticRoot[ rpal_string_strlen( staticRoot ) - 1 ] = 0;
+        rpal_string_strcpy( root.filePath, staticRoot );
+        ENABLE_FLAG( root.attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY );
+
+#if defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+        if( 0 == stat( root.filePath, &rootInfo ) )
         {
-            staticRoot[ rpal_string_strlen( staticRoot ) - 1 ] = 0;
-            
-            if( rDir_open( staticRoot, &hDir ) )
-            {
-                while( rDir_next( hDir, &info ) )
-                {
-                    if( _isFileInfoInCrawl( pCrawl->dirExp, 
-                                            pCrawl->fileExp, 
-                                            pCrawl->nMaxDepth, 
-                                            &info,
-                                            IS_FLAG_ENABLED( info.attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY ) ) ||
-                        ( IS_FLAG_ENABLED( info.attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY ) &&  // If a directory is not
-                          _isFileInfoInCrawl( pCrawl->dirExp,                                 // to be crawled, it may
-                                              pCrawl->fileExp,                                // still be a perfect match.
-                                              pCrawl->nMaxDepth, 
-                                              &info, 
-                                              FALSE ) ) )
-                    {
-                        // Match dir against dir and file again file???????
-                        if( !rStack_push( pCrawl->stack, &info ) )
-                        {
-                            rpal_file_crawlStop( pCrawl );
-                            pCrawl = NULL;
-                            break;
-                        }
-                    }
+            pCrawl->rootDevice = (RU64)rootInfo.st_dev;
+        }
+#endif
+
+        // The root itself is never reported, only listed.
+        if( rStack_push( pCrawl->dirs, &root ) &&
+            ( 0 != pCrawl->nThreads ||
+              _crawlInitWorker( &pCrawl->syncWorker, pCrawl ) ) )
+        {
+            isSuccess = TRUE;
+        }
+    }
+
+    rpal_memory_free( staticRoot );
+
+    if( isSuccess &&
+        0 != pCrawl->nThreads )
+    {
+        if( NULL != ( pCrawl->workers = rpal_memory_alloc( sizeof( _rDirCrawlWorker ) * pCrawl->nThreads ) ) &&
+            NULL != ( pCrawl->workEvent = rEvent_create( TRUE ) ) &&
+            NULL != ( pCrawl->resultEvent = rEvent_create( TRUE ) ) &&
+            NULL != ( pCrawl->roomEvent = rEvent_create( TRUE ) ) )
+        {
+            rEvent_set( pCrawl->workEvent );
+
+            for( i = 0; i < pCrawl->nThreads; i++ )
+            {
+                if( !_crawlInitWorker( &pCrawl->workers[ i ], pCrawl ) )
+                {
+                    isSuccess = FALSE;
+                    break;
                 }
 
-                rDir_close( hDir );
-            }
+                pCrawl->nStarted++;
 
-            rpal_memory_free( staticRoot );
+                if( NULL == ( pCrawl->workers[ i ].hThread = rpal_thread_new( _crawlWorkerThread, 
+                                                                              &pCrawl->workers[ i ] ) ) )
+                {
+                    isSuccess = FALSE;
+                    break;
+                }
+            }
         }
         else
         {
-            rpal_file_crawlStop( pCrawl );
-            pCrawl = NULL;
+            isSuccess = FALSE;
         }
     }
 
+    if( !isSuccess )
+    {
+        rpal_file_crawlStop( pCrawl );
+        pCrawl = NULL;
+    }
+
     return pCrawl;
 }
 
@@ -1223,72 +1763,60 @@ RBOOL
     RBOOL isSuccess = FALSE;
 
     _prDirCrawl pCrawl = (_prDirCrawl)hCrawl;
-    rFileInfo info = {0};
-    rDir tmpDir = NULL;
+    rFileInfo dir = {0};
     
-    if( NULL != pCrawl )
+    if( NULL != pCrawl &&
+        NULL != pFileInfo )
     {
-        while( !isSuccess &&
-               rStack_pop( pCrawl->stack, &info ) )
+        if( 0 == pCrawl->nThreads )
         {
-            // The ptr in the info is a local ptr, so it probably changes when we 
-            // moved the memory so we have to "re-base" it using the path.
-            _fixFileInfoAfterPop( &info );
-
-            // If it's a directory, we will report it but drill down
-            if( IS_FLAG_ENABLED( info.attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY ) )
+            // Synchronous crawl, list the next directory on demand.
+            while( !isSuccess )
             {
-                // Dirs on the stack do NOT necessarily match the criteria. We may have pushed
-                // them simply because they PARTIALLY matched the criteria and therefore we needed
-                // them to keep drilling down...
-                if( _isFileInfoInCrawl( pCrawl->dirExp, pCrawl->fileExp, pCrawl->nMaxDepth, &info, FALSE ) )
+                if( rStack_pop( pCrawl->results, pFileInfo ) )
                 {
-                    *pFileInfo = info;
-                    _fixFileInfoAfterPop( pFileInfo );
                     isSuccess = TRUE;
                 }
-
-                // This is a shortcut if depth is 0, we will never want to drill down further
-                if( 0 != pCrawl->nMaxDepth )
+                else if( rStack_pop( pCrawl->dirs, &dir ) )
                 {
-                    if( rDir_open( info.filePath, &tmpDir ) )
-                    {
-                        while( rDir_next( tmpDir, &info ) )
-                        {
-                            if( _isFileInfoInCrawl( pCrawl->dirExp, 
-                                                    pCrawl->fileExp, 
-                                                    pCrawl->nMaxDepth, 
-                                                    &info, 
-                                                    IS_FLAG_ENABLED( info.attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY ) ) ||
-                                ( IS_FLAG_ENABLED( info.attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY ) &&  // If a directory is not
-                                  _isFileInfoInCrawl( pCrawl->dirExp,                                   // to be crawled, it may
-                                                      pCrawl->fileExp,                                  // still be a perfect match.
-                                                      pCrawl->nMaxDepth, 
-                                                      &info, 
-                                                      FALSE ) ) )
-                            {
-                                if( !rStack_push( pCrawl->stack, &info ) )
-                                {
-                                    // This is bad, but not much we can do
-                                    isSuccess = FALSE;
-                                    break;
-                                }
-                            }
-                        }
-
-                        rDir_close( tmpDir );
-                    }
+                    _crawlListDir( &pCrawl->syncWorker, dir.filePath );
+                }
+                else
+                {
+                    break;
                 }
             }
-            else
+        }
+        else
+        {
+            while( rMutex_lock( pCrawl->lock ) )
             {
-                // Files on the stack are always matching since we check before
-                // pushing them onto the stack.
-                *pFileInfo = info;
-                _fixFileInfoAfterPop( pFileInfo );
-                isSuccess = TRUE;
+                if( rStack_pop( pCrawl->results, pFileInfo ) )
+                {
+                    rEvent_set( pCrawl->roomEvent );
+                    rMutex_unlock( pCrawl->lock );
+                    isSuccess = TRUE;
+                    break;
+                }
+
+                if( pCrawl->isDone )
+                {
+                    rMutex_unlock( pCrawl->lock );
+                    break;
+                }
+
+                rEvent_unset( pCrawl->resultEvent );
+                rMutex_unlock( pCrawl->lock );
+                rEvent_wait( pCrawl->resultEvent, RINFINITE );
             }
         }
+
+        if( isSuccess )
+        {
+            // The ptr in the info is a local ptr, so it probably changes when we 
+            // moved the memory so we have to "re-base" it using the path.
+            _fixFileInfoAfterPop( pFileInfo );
+        }
     }
 
     return isSuccess;
@@ -1323,10 +1851,42 @@ RVOID
     )
 {
     _prDirCrawl pCrawl = (_prDirCrawl)hDirCrawl;
+    RU32 i = 0;
 
     if( NULL != hDirCrawl )
     {
-        rStack_free( pCrawl->stack, NULL );
+        if( NULL != pCrawl->workers )
+        {
+            if( rMutex_lock( pCrawl->lock ) )
+            {
+                pCrawl->isStopping = TRUE;
+                rEvent_set( pCrawl->workEvent );
+                rEvent_set( pCrawl->roomEvent );
+                rMutex_unlock( pCrawl->lock );
+            }
+
+            for( i = 0; i < pCrawl->nStarted; i++ )
+            {
+                if( NULL != pCrawl->workers[ i ].hThread )
+                {
+                    rpal_thread_wait( pCrawl->workers[ i ].hThread, RINFINITE );
+                    rpal_thread_free( pCrawl->workers[ i ].hThread );
+                }
+
+                _crawlFreeWorker( &pCrawl->workers[ i ] );
+            }
+
+            rpal_memory_free( pCrawl->workers );
+        }
+
+        _crawlFreeWorker( &pCrawl->syncWorker );
+
+        rEvent_free( pCrawl->workEvent );
+        rEvent_free( pCrawl->resultEvent );
+        rEvent_free( pCrawl->roomEvent );
+        rMutex_free( pCrawl->lock );
+        rStack_free( pCrawl->dirs, NULL );
+        rStack_free( pCrawl->results, NULL );
         rpal_memory_free( pCrawl->dirExp );
         rpal_memory_free( pCrawl );
     }
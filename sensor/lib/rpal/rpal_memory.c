@@ -48,6 +48,12 @@ typedef struct
 
 #define RPAL_MEMORY_GET_STUB(ptr) ( (rpal_pMemStub)((RPU8)(ptr) - sizeof( rpal_memStub )) )
 
+// Allocations carved out of an arena chunk carry this tag in their stubs and
+// are preceded by a pointer to their chunk.
+#define RPAL_MEMORY_ARENA_TAG   0x616e6572
+
+#define RPAL_MEMORY_GET_ARENA_CHUNK(ptr) ( *(rpal_pMemArenaChunk*)((RPU8)RPAL_MEMORY_GET_STUB( ptr ) - sizeof( RPVOID )) )
+
 static volatile RU32 g_rpal_memory_totalBytes = 0;
 
 
@@ -60,6 +66,26 @@ RU32 g_rpal_memory_subTagBytes[ 1 << 20 ] = {0};
 
 #endif
 
+// A chunk holds one reference per live allocation, plus one for as long as it
+// is the current chunk of its arena.
+typedef struct
+{
+    volatile RU32   nRefs;
+    RU32            size;
+    RU32            used;
+
+} rpal_memArenaChunk, *rpal_pMemArenaChunk;
+
+typedef struct
+{
+    rpal_pMemArenaChunk chunk;
+    RU32                chunkSize;
+
+} rpal_memArena;
+
+#define RPAL_MEMORY_ARENA_ALIGN(size)       ( ( (size) + sizeof( RU64 ) - 1 ) & ~( sizeof( RU64 ) - 1 ) )
+#define RPAL_MEMORY_ARENA_CHUNK_DATA(chunk) ( (RPU8)(chunk) + RPAL_MEMORY_ARENA_ALIGN( sizeof( rpal_memArenaChunk ) ) )
+
 //=============================================================================
 //  Helpers
 //=============================================================================
@@ -113,6 +139,38 @@ RVOID
 #endif
 }
 
+static
+rpal_pMemArenaChunk
+    _rpal_memory_arena_newChunk
+    (
+        RU32 size
+    )
+{
+    rpal_pMemArenaChunk chunk = NULL;
+
+    if( NULL != ( chunk = rpal_memory_alloc( RPAL_MEMORY_ARENA_ALIGN( sizeof( rpal_memArenaChunk ) ) + size ) ) )
+    {
+        chunk->nRefs = 1;
+        chunk->size = size;
+        chunk->used = 0;
+    }
+
+    return chunk;
+}
+
+static
+RVOID
+    _rpal_memory_arena_releaseChunk
+    (
+        rpal_pMemArenaChunk chunk
+    )
+{
+    if( 0 == rInterlocked_decrement32( &chunk->nRefs ) )
+    {
+        rpal_memory_free( chunk );
+    }
+}
+
 //=============================================================================
 //  API
 //=============================================================================
@@ -249,19 +307,32 @@ RVOID,
         RPVOID ptr
 )
 {
+    RBOOL isFromArena = FALSE;
+
 	if( rpal_memory_isValid( ptr ) )
 	{
-        rInterlocked_add32( &g_rpal_memory_totalBytes, (RS32)0 - (RS32)(RPAL_MEMORY_GET_STUB( ptr )->size) );
+        // Arena allocations are accounted for by their chunk.
+        if( !( isFromArena = ( RPAL_MEMORY_ARENA_TAG == RPAL_MEMORY_GET_STUB( ptr )->tag ) ) )
+        {
+            rInterlocked_add32( &g_rpal_memory_totalBytes, (RS32)0 - (RS32)(RPAL_MEMORY_GET_STUB( ptr )->size) );
 
 #ifdef RPAL_FEATURE_MEMORY_ACCOUNTING
-        rInterlocked_add32( &g_rpal_memory_subTagBytes[ RPAL_MEMORY_GET_STUB( ptr )->subTag % ARRAY_N_ELEM( g_rpal_memory_subTagBytes ) ], (RS32)0 - (RS32)(RPAL_MEMORY_GET_STUB( ptr )->size) );
+            rInterlocked_add32( &g_rpal_memory_subTagBytes[ RPAL_MEMORY_GET_STUB( ptr )->subTag % ARRAY_N_ELEM( g_rpal_memory_subTagBytes ) ], (RS32)0 - (RS32)(RPAL_MEMORY_GET_STUB( ptr )->size) );
 #endif
+        }
 
         rpal_memory_zero( ptr, (RPAL_MEMORY_GET_STUB( ptr )->size) );
         rpal_memory_zero( (RPU8)ptr + RPAL_MEMORY_GET_STUB( ptr )->size, sizeof( rpal_memStub ) );
         rpal_memory_zero( RPAL_MEMORY_GET_STUB( ptr ), sizeof( rpal_memStub ) );
 
-		_rpal_do_free( RPAL_MEMORY_GET_STUB( ptr ) );
+        if( isFromArena )
+        {
+            _rpal_memory_arena_releaseChunk( RPAL_MEMORY_GET_ARENA_CHUNK( ptr ) );
+        }
+        else
+        {
+		    _rpal_do_free( RPAL_MEMORY_GET_STUB( ptr ) );
+        }
 	}
 }
 
@@ -306,6 +377,20 @@ RPVOID,
     {
         newPtr = rpal_memory_alloc( newSize );
     }
+    else if( rpal_memory_isValid( originalPtr ) &&
+             RPAL_MEMORY_ARENA_TAG == RPAL_MEMORY_GET_STUB( originalPtr )->tag )
+    {
+        // Growing an arena allocation moves it to the heap for good.
+        if( NULL != ( newPtr = rpal_memory_allocEx( newSize, 0, RPAL_MEMORY_GET_STUB( originalPtr )->subTag ) ) )
+        {
+            rpal_memory_memcpy( newPtr, originalPtr, MIN_OF( newSize, RPAL_MEMORY_GET_STUB( originalPtr )->size ) );
+            rpal_memory_free( originalPtr );
+        }
+        else
+        {
+            rpal_debug_critical( "realloc failed for 0x%016X ---> %d bytes", originalPtr, newSize );
+        }
+    }
     else if( rpal_memory_isValid( originalPtr ) )
     {
         newPtr = _rpal_do_realloc( RPAL_MEMORY_GET_STUB( originalPtr ),
@@ -575,6 +660,161 @@ RPVOID
     return res;
 }
 
+rMemoryArena
+    rpal_memory_arena_create
+    (
+        RU32 chunkSize
+    )
+{
+    rpal_memArena* arena = NULL;
+
+    // Arena allocations are freed through the root rpal, one older than
+    // RPAL_VERSION_2 would take them for heap allocations.
+    if( 0 != chunkSize &&
+        NULL != g_rpal_context &&
+        RPAL_VERSION_2 <= g_rpal_context->version &&
+        NULL != ( arena = rpal_memory_alloc( sizeof( rpal_memArena ) ) ) )
+    {
+        arena->chunkSize = chunkSize;
+
+        if( NULL == ( arena->chunk = _rpal_memory_arena_newChunk( chunkSize ) ) )
+        {
+            rpal_memory_free( arena );
+            arena = NULL;
+        }
+    }
+
+    return arena;
+}
+
+RVOID
+    rpal_memory_arena_free
+    (
+        rMemoryArena arena
+    )
+{
+    rpal_memArena* pArena = (rpal_memArena*)arena;
+
+    if( rpal_memory_isValid( arena ) )
+    {
+        if( NULL != pArena->chunk )
+        {
+            _rpal_memory_arena_releaseChunk( pArena->chunk );
+        }
+
+        rpal_memory_free( arena );
+    }
+}
+
+RPVOID
+    rpal_memory_arena_alloc_from
+    (
+        rMemoryArena arena,
+        RSIZET size,
+        RU32 from
+    )
+{
+    RPVOID ptr = NULL;
+    rpal_memArena* pArena = (rpal_memArena*)arena;
+#ifdef RPAL_FEATURE_MEMORY_SECURITY
+    RSIZET blockSize = RPAL_MEMORY_ARENA_ALIGN( sizeof( RPVOID ) + ( 2 * sizeof( rpal_memStub ) ) + size );
+    RPU8 block = NULL;
+#endif
+
+    if( NULL == pArena )
+    {
+        return NULL;
+    }
+
+#ifndef RPAL_FEATURE_MEMORY_SECURITY
+    ptr = rpal_memory_alloc_from( size, from );
+#else
+    if( blockSize > pArena->chunkSize )
+    {
+        return rpal_memory_alloc_from( size, from );
+    }
+
+    // A full chunk is left to the allocations it holds.
+    if( NULL != pArena->chunk &&
+        pArena->chunk->size - pArena->chunk->used < blockSize )
+    {
+        _rpal_memory_arena_releaseChunk( pArena->chunk );
+        pArena->chunk = NULL;
+    }
+
+    if( NULL == pArena->chunk &&
+        NULL == ( pArena->chunk = _rpal_memory_arena_newChunk( pArena->chunkSize ) ) )
+    {
+        return NULL;
+    }
+
+    block = RPAL_MEMORY_ARENA_CHUNK_DATA( pArena->chunk ) + pArena->chunk->used;
+    pArena->chunk->used += (RU32)blockSize;
+    rInterlocked_increment32( &pArena->chunk->nRefs );
+
+    ptr = block + sizeof( RPVOID ) + sizeof( rpal_memStub );
+    RPAL_MEMORY_GET_ARENA_CHUNK( ptr ) = pArena->chunk;
+
+    RPAL_MEMORY_GET_STUB( ptr )->moduleId = rpal_Context_getIdentifier();
+    RPAL_MEMORY_GET_STUB( ptr )->size = size;
+    RPAL_MEMORY_GET_STUB( ptr )->tag = RPAL_MEMORY_ARENA_TAG;
+    RPAL_MEMORY_GET_STUB( ptr )->subTag = from;
+    RPAL_MEMORY_GET_STUB( ptr )->magic = RPAL_MEMORY_STUB_MAGIC;
+
+    rpal_memory_memcpy( (RPU8)ptr + size, RPAL_MEMORY_GET_STUB( ptr ), sizeof( rpal_memStub ) );
+
+    rpal_memory_zero( ptr, size );
+#endif
+
+    return ptr;
+}
+
+RVOID
+    rpal_memory_arena_reset
+    (
+        rMemoryArena arena
+    )
+{
+    rpal_memArena* pArena = (rpal_memArena*)arena;
+
+    if( NULL != pArena &&
+        NULL != pArena->chunk )
+    {
+        // Only this thread can add references, so if ours is the last one
+        // nothing can come back to the chunk and it can be reused as is.
+        if( 1 == rInterlocked_get32( &pArena->chunk->nRefs ) )
+        {
+            pArena->chunk->used = 0;
+        }
+        else
+        {
+            _rpal_memory_arena_releaseChunk( pArena->chunk );
+            pArena->chunk = NULL;
+        }
+    }
+}
+
+RBOOL
+    rpal_memory_isFromArena
+    (
+        RPVOID ptr
+    )
+{
+    RBOOL isFromArena = FALSE;
+
+#ifdef RPAL_FEATURE_MEMORY_SECURITY
+    if( rpal_memory_isValid( ptr ) &&
+        RPAL_MEMORY_ARENA_TAG == RPAL_MEMORY_GET_STUB( ptr )->tag )
+    {
+        isFromArena = TRUE;
+    }
+#else
+    UNREFERENCED_PARAMETER( ptr );
+#endif
+
+    return isFromArena;
+}
+
 #ifdef RPAL_FEATURE_MEMORY_ACCOUNTING
 RPAL_DEFINE_API
 ( 
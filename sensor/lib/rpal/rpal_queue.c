@@ -190,16 +190,16 @@ RBOOL
     RBOOL isSuccess = FALSE;
 
     _rPQueue q = (_rPQueue)queue;
-    RU64 tmpTime = 0; // Oy I whish I had a WaitForMultipleObjects
+    RU64 endTime = 0; // Oy I whish I had a WaitForMultipleObjects
 
     if( rpal_memory_isValid( queue ) )
     {
-        tmpTime = rpal_time_getLocal();
+        endTime = rpal_time_getMonotonicNs() + NSEC_FROM_MSEC( milliSecTimeout );
 
         do
         {
             if( 0 != milliSecTimeout &&
-                milliSecTimeout < ( rpal_time_getLocal() - tmpTime ) )
+                endTime < rpal_time_getMonotonicNs() )
             {
                 // Since we can't wait for both the event and the mutex
                 // there is a chance we get the event but by the time we get to the
@@ -0,0 +1,329 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <rpal/rpal_string_extract.h>
+
+#define RPAL_FILE_ID    15
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && 2 <= _M_IX86_FP )
+    #define _USE_SSE2
+    #include <emmintrin.h>
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+    #define _USE_NEON
+    #include <arm_neon.h>
+#endif
+
+#ifdef RPAL_PLATFORM_WINDOWS
+    #include <intrin.h>
+#endif
+
+// Characters are classified in blocks of this many bytes, each
+// class of characters becoming a bitmask over the block.
+#define _BLOCK_SIZE     64
+
+typedef struct
+{
+    RBOOL isInRun;
+    RU64 start;
+} _RunState;
+
+typedef struct
+{
+    RPU8 pBuff;
+    RU32 minLength;
+    RU32 maxLength;
+    rpal_string_span_f callback;
+    RPVOID ctx;
+} _ExtractContext;
+
+//=============================================================================
+//  PRIVATE FUNCTIONS
+//=============================================================================
+static
+RU32
+    _ctz64
+    (
+        RU64 x
+    )
+{
+#ifdef RPAL_PLATFORM_WINDOWS
+    unsigned long i = 0;
+#ifdef RPAL_PLATFORM_64_BIT
+    _BitScanForward64( &i, x );
+#else
+    if( 0 != (RU32)x )
+    {
+        _BitScanForward( &i, (RU32)x );
+    }
+    else
+    {
+        _BitScanForward( &i, (RU32)( x >> 32 ) );
+        i += 32;
+    }
+#endif
+    return (RU32)i;
+#else
+    return (RU32)__builtin_ctzll( x );
+#endif
+}
+
+// Compacts the bits at even positions into the low 32 bits.
+static
+RU64
+    _evenBits
+    (
+        RU64 x
+    )
+{
+    x &= 0x5555555555555555ULL;
+    x = ( x | ( x >> 1 ) ) & 0x3333333333333333ULL;
+    x = ( x | ( x >> 2 ) ) & 0x0F0F0F0F0F0F0F0FULL;
+    x = ( x | ( x >> 4 ) ) & 0x00FF00FF00FF00FFULL;
+    x = ( x | ( x >> 8 ) ) & 0x0000FFFF0000FFFFULL;
+    x = ( x | ( x >> 16 ) ) & 0x00000000FFFFFFFFULL;
+    return x;
+}
+
+#ifdef _USE_NEON
+static
+RU64
+    _neonMoveMask
+    (
+        uint8x16_t v
+    )
+{
+    static const RU8 weights[ 16 ] = { 1, 2, 4, 8, 16, 32, 64, 128, 
+                                       1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t t = vandq_u8( v, vld1q_u8( weights ) );
+
+    return (RU64)vaddv_u8( vget_low_u8( t ) ) | 
+           ( (RU64)vaddv_u8( vget_high_u8( t ) ) << 8 );
+}
+#endif
+
+// Classify a block of up to _BLOCK_SIZE bytes into a mask of printable
+// bytes and a mask of zero bytes.
+static
+RVOID
+    _classifyBlock
+    (
+        RPU8 p,
+        RU32 n,
+        RU64* pPrintable,
+        RU64* pZero
+    )
+{
+    RU64 printable = 0;
+    RU64 zero = 0;
+    RU32 i = 0;
+
+#if defined( _USE_SSE2 )
+    if( _BLOCK_SIZE == n )
+    {
+        __m128i low = _mm_set1_epi8( 0x1F );
+        __m128i high = _mm_set1_epi8( 0x7F );
+        __m128i nul = _mm_setzero_si128();
+        __m128i v;
+
+        for( i = 0; i < _BLOCK_SIZE; i += 16 )
+        {
+            v = _mm_loadu_si128( (__m128i*)( p + i ) );
+            // Signed comparison also rejects the 0x80-0xFF range.
+            printable |= (RU64)(RU16)_mm_movemask_epi8( _mm_and_si128( _mm_cmpgt_epi8( v, low ),
+                                                                      _mm_cmplt_epi8( v, high ) ) ) << i;
+            zero |= (RU64)(RU16)_mm_movemask_epi8( _mm_cmpeq_epi8( v, nul ) ) << i;
+        }
+
+        *pPrintable = printable;
+        *pZero = zero;
+        return;
+    }
+#elif defined( _USE_NEON )
+    if( _BLOCK_SIZE == n )
+    {
+        uint8x16_t low = vdupq_n_u8( 0x20 );
+        uint8x16_t high = vdupq_n_u8( 0x7E );
+        uint8x16_t v;
+
+        for( i = 0; i < _BLOCK_SIZE; i += 16 )
+        {
+            v = vld1q_u8( p + i );
+            printable |= _neonMoveMask( vandq_u8( vcgeq_u8( v, low ), vcleq_u8( v, high ) ) ) << i;
+            zero |= _neonMoveMask( vceqq_u8( v, vdupq_n_u8( 0 ) ) ) << i;
+        }
+
+        *pPrintable = printable;
+        *pZero = zero;
+        return;
+    }
+#endif
+
+    for( i = 0; i < n; i++ )
+    {
+        if( 0x20 <= p[ i ] && 0x7E >= p[ i ] )
+        {
+            printable |= ( (RU64)1 << i );
+        }
+        else if( 0 == p[ i ] )
+        {
+            zero |= ( (RU64)1 << i );
+        }
+    }
+
+    *pPrintable = printable;
+    *pZero = zero;
+}
+
+// Walks the transitions in a mask of printable characters, so the cost is
+// proportional to the number of runs and not the number of characters.
+static
+RBOOL
+    _scanRuns
+    (
+        _ExtractContext* ctx,
+        _RunState* state,
+        RU64 mask,
+        RU32 nBits,
+        RU64 base,
+        RU8 encoding
+    )
+{
+    RBOOL isContinue = TRUE;
+    RU32 cur = 0;
+    RU64 bits = 0;
+    RU64 validBits = ( 64 == nBits ? ~(RU64)0 : ( ( (RU64)1 << nBits ) - 1 ) );
+    rpal_string_span span = { 0 };
+
+    mask &= validBits;
+
+    while( cur < nBits )
+    {
+        if( !state->isInRun )
+        {
+            if( 0 == ( bits = mask & ( ~(RU64)0 << cur ) ) )
+            {
+                break;
+            }
+
+            cur = _ctz64( bits );
+            state->isInRun = TRUE;
+            state->start = base + cur;
+        }
+        else
+        {
+            if( 0 == ( bits = ~mask & validBits & ( ~(RU64)0 << cur ) ) )
+            {
+                // The run continues in the next block.
+                break;
+            }
+
+            cur = _ctz64( bits );
+            state->isInRun = FALSE;
+            span.length = (RU32)MIN_OF( base + cur - state->start, (RU32)(-1) );
+
+            if( span.length >= ctx->minLength &&
+                span.length <= ctx->maxLength )
+            {
+                span.encoding = encoding;
+                span.offset = state->start * ( RPAL_STRING_EXTRACT_UTF16LE == encoding ? 2 : 1 );
+
+                if( !ctx->callback( ctx->ctx, ctx->pBuff, &span ) )
+                {
+                    isContinue = FALSE;
+                    break;
+                }
+            }
+
+            cur++;
+        }
+    }
+
+    return isContinue;
+}
+
+//=============================================================================
+//  PUBLIC API
+//=============================================================================
+RBOOL
+    rpal_string_extractSpans
+    (
+        RPU8 pBuff,
+        RU64 size,
+        RU32 encodings,
+        RU32 minLength,
+        RU32 maxLength,
+        rpal_string_span_f callback,
+        RPVOID ctx
+    )
+{
+    RBOOL isSuccess = FALSE;
+    _ExtractContext context = { 0 };
+    _RunState asciiState = { 0 };
+    _RunState wideState = { 0 };
+    RU64 offset = 0;
+    RU32 n = 0;
+    RU64 printable = 0;
+    RU64 zero = 0;
+
+    if( NULL != pBuff &&
+        NULL != callback &&
+        0 != ( encodings & ( RPAL_STRING_EXTRACT_ASCII | RPAL_STRING_EXTRACT_UTF16LE ) ) )
+    {
+        context.pBuff = pBuff;
+        context.minLength = MAX_OF( minLength, 1 );
+        context.maxLength = maxLength;
+        context.callback = callback;
+        context.ctx = ctx;
+
+        isSuccess = TRUE;
+
+        for( offset = 0; offset < size; offset += n )
+        {
+            n = (RU32)MIN_OF( size - offset, _BLOCK_SIZE );
+
+            _classifyBlock( pBuff + offset, n, &printable, &zero );
+
+            if( 0 == printable &&
+                !asciiState.isInRun &&
+                !wideState.isInRun )
+            {
+                continue;
+            }
+
+            if( IS_FLAG_ENABLED( encodings, RPAL_STRING_EXTRACT_ASCII ) &&
+                !_scanRuns( &context, &asciiState, printable, n, offset, RPAL_STRING_EXTRACT_ASCII ) )
+            {
+                break;
+            }
+
+            // A UTF-16LE printable unit is a printable low byte followed by a zero
+            // high byte. Blocks are an even size so units never straddle them.
+            if( IS_FLAG_ENABLED( encodings, RPAL_STRING_EXTRACT_UTF16LE ) &&
+                !_scanRuns( &context, 
+                            &wideState, 
+                            _evenBits( printable ) & _evenBits( zero >> 1 ), 
+                            n / 2, 
+                            offset / 2, 
+                            RPAL_STRING_EXTRACT_UTF16LE ) )
+            {
+                break;
+            }
+        }
+    }
+
+    return isSuccess;
+}
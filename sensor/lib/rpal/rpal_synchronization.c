@@ -14,6 +14,11 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+// Required for pthread_mutex_clocklock.
+#if defined( __linux ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
 #include <rpal.h>
 
 #define RPAL_FILE_ID    11
@@ -22,8 +27,19 @@ limitations under the License.
 #include <pthread.h>
 #include <time.h>
 #include <sys/time.h>
+#include <errno.h>
+#endif
+
+#if defined( RPAL_PLATFORM_LINUX ) && defined( __GLIBC_PREREQ )
+#if __GLIBC_PREREQ( 2, 30 )
+#define _HAS_MUTEX_CLOCKLOCK
+#endif
 #endif
 
+// When the mutex cannot wait on the monotonic clock we wait in short
+// slices against the realtime clock and check the monotonic deadline.
+#define _MUTEX_WAIT_SLICE_MSEC  50
+
 typedef struct
 {
 #ifdef RPAL_PLATFORM_WINDOWS
@@ -67,6 +83,28 @@ typedef struct
 } _rRwLock;
 
 
+#ifdef RPAL_PLATFORM_LINUX
+static
+RVOID
+    _getDeadline
+    (
+        clockid_t clockId,
+        RU64 timeoutNs,
+        struct timespec* pDeadline
+    )
+{
+    clock_gettime( clockId, pDeadline );
+
+    pDeadline->tv_sec += (time_t)SEC_FROM_NSEC( timeoutNs );
+    pDeadline->tv_nsec += (long)( timeoutNs % NSEC_PER_SEC );
+    if( pDeadline->tv_nsec >= NSEC_PER_SEC )
+    {
+        pDeadline->tv_sec += ( pDeadline->tv_nsec / NSEC_PER_SEC );
+        pDeadline->tv_nsec = pDeadline->tv_nsec % NSEC_PER_SEC;
+    }
+}
+#endif
+
 //=============================================================================
 //  rMutex API
 //=============================================================================
@@ -139,15 +177,36 @@ RBOOL
         
         if( RINFINITE != timeout )
         {
-            clock_gettime( CLOCK_REALTIME, &abs_time );
-            
-            abs_time.tv_sec += ( timeout / 1000 );
-            abs_time.tv_nsec += ( ( timeout % 1000 ) * 1000000 );
+#ifdef _HAS_MUTEX_CLOCKLOCK
+            _getDeadline( CLOCK_MONOTONIC, NSEC_FROM_MSEC( timeout ), &abs_time );
             
-            if( 0 == pthread_mutex_timedlock( &((_rMutex*)mutex)->hMutex, &abs_time ) )
+            if( 0 == pthread_mutex_clocklock( &((_rMutex*)mutex)->hMutex, CLOCK_MONOTONIC, &abs_time ) )
             {
                 isSuccess = TRUE;
             }
+#else
+            // pthread_mutex_timedlock only supports the realtime clock, so a clock
+            // jump would stretch or cut the wait. We bound each wait to a slice
+            // and keep the real deadline on the monotonic clock.
+            RU64 endTime = rpal_time_getMonotonicNs() + NSEC_FROM_MSEC( timeout );
+            RU64 curTime = 0;
+            int err = 0;
+
+            do
+            {
+                curTime = rpal_time_getMonotonicNs();
+                _getDeadline( CLOCK_REALTIME,
+                              MIN_OF( ( endTime > curTime ? endTime - curTime : 0 ), 
+                                      NSEC_FROM_MSEC( _MUTEX_WAIT_SLICE_MSEC ) ),
+                              &abs_time );
+                
+                if( 0 == ( err = pthread_mutex_timedlock( &((_rMutex*)mutex)->hMutex, &abs_time ) ) )
+                {
+                    isSuccess = TRUE;
+                }
+            } while( ETIMEDOUT == err &&
+                     rpal_time_getMonotonicNs() < endTime );
+#endif
         }
         else
         {
@@ -384,7 +443,18 @@ rEvent
             rpal_memory_free( evt );
             evt = NULL;
         }
-#elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+#elif defined( RPAL_PLATFORM_LINUX )
+        pthread_condattr_t condAttr;
+        pthread_mutex_init( &evt->hMutex, NULL );
+        // Timed waits are expressed against the monotonic clock so that
+        // changes to the wall clock do not affect them.
+        pthread_condattr_init( &condAttr );
+        pthread_condattr_setclock( &condAttr, CLOCK_MONOTONIC );
+        pthread_cond_init( &evt->hCond, &condAttr );
+        pthread_condattr_destroy( &condAttr );
+        evt->isManualReset = isManualReset;
+        evt->isOn = FALSE;
+#elif defined( RPAL_PLATFORM_MACOSX )
         pthread_mutex_init( &evt->hMutex, NULL );
         pthread_cond_init( &evt->hCond, NULL );
         evt->isManualReset = isManualReset;
@@ -437,21 +507,18 @@ RBOOL
         rInterlocked_decrement32( &evt->waitCount );
 #elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
         struct timespec abs_time;
-        struct timeval cur_time;
-        struct timezone ts;
         int err = 0;
-        gettimeofday( &cur_time, &ts );
-        
-        abs_time.tv_sec = cur_time.tv_sec;
-        abs_time.tv_nsec = cur_time.tv_usec * 1000;
-        
-        abs_time.tv_sec += ( timeout / 1000 );
-        abs_time.tv_nsec += ( ( timeout % 1000 ) * 1000000 );
-        if( abs_time.tv_nsec >= 1000000000 )
+#ifdef RPAL_PLATFORM_LINUX
+        if( RINFINITE != timeout )
         {
-            abs_time.tv_sec += ( abs_time.tv_nsec / 1000000000 );
-            abs_time.tv_nsec = abs_time.tv_nsec % 1000000000;
+            _getDeadline( CLOCK_MONOTONIC, NSEC_FROM_MSEC( timeout ), &abs_time );
         }
+#else
+        // No monotonic condition variables here, but relative waits
+        // are immune to clock changes so we track the deadline ourselves.
+        RU64 endTime = rpal_time_getMonotonicNs() + NSEC_FROM_MSEC( timeout );
+        RU64 curTime = 0;
+#endif
         
         if( 0 == pthread_mutex_lock( &evt->hMutex ) )
         {
@@ -472,7 +539,18 @@ RBOOL
                 {
                     if( RINFINITE != timeout )
                     {
+#ifdef RPAL_PLATFORM_LINUX
                         err = pthread_cond_timedwait( &evt->hCond, &evt->hMutex, &abs_time );
+#else
+                        curTime = rpal_time_getMonotonicNs();
+                        if( curTime >= endTime )
+                        {
+                            break;
+                        }
+                        abs_time.tv_sec = (time_t)SEC_FROM_NSEC( endTime - curTime );
+                        abs_time.tv_nsec = (long)( ( endTime - curTime ) % NSEC_PER_SEC );
+                        err = pthread_cond_timedwait_relative_np( &evt->hCond, &evt->hMutex, &abs_time );
+#endif
                     }
                     else
                     {
@@ -579,7 +579,7 @@ RU32
                         rpal_collection_remove( thread.pPool->tasksRunning, NULL, NULL, _ptrCmp, &thread );
                         rMutex_unlock( thread.pPool->counterMutex );
                     }
-                    thread.timeEnteredIdle = rpal_time_getLocal();
+                    thread.timeEnteredIdle = SEC_FROM_NSEC( rpal_time_getMonotonicCoarseNs() );
                 }
                 else if( !rEvent_wait( thread.timeToStopEvent, 1 ) )
                 {
@@ -590,7 +590,7 @@ RU32
                         if( thread.pPool->minThreads < ( thread.pPool->nThreads - thread.pPool->nCurrentlyProcessing ) &&
                             rQueue_getSize( thread.pPool->taskQueue, &qSize ) &&
                             0 == qSize &&
-                            rpal_time_getLocal() >= ( thread.timeEnteredIdle + thread.pPool->threadTtl ) )
+                            SEC_FROM_NSEC( rpal_time_getMonotonicCoarseNs() ) >= ( thread.timeEnteredIdle + thread.pPool->threadTtl ) )
                         {
                             // We will manually go remove THIS thread entry from the stack
                             rpal_debug_info( "thread pool decreasing because of IDLE time." );
@@ -684,7 +684,7 @@ RBOOL
         tmpThread.hThread = 0;
         tmpThread.timeToStopEvent = NULL;
         tmpThread.pPool = pool;
-        tmpThread.timeEnteredIdle = rpal_time_getLocal();
+        tmpThread.timeEnteredIdle = SEC_FROM_NSEC( rpal_time_getMonotonicCoarseNs() );
 
         // We SET the timeToQuitEvent before creating the thread because we use
         // it as a processing gate to know when the thread has copied its context
@@ -38,12 +38,21 @@ limitations under the License.
 // be trivial, no protection for now...
 static RU64 g_rpal_time_globalOffset = 0;
 
+// Overrides of the system time sources, only used for testing.
+static rpal_time_source_f g_rpal_time_wallSource = NULL;
+static rpal_time_source_f g_rpal_time_monotonicSource = NULL;
+
 RU64
     rpal_time_getLocal
     (
 
     )
 {
+    if( NULL != g_rpal_time_wallSource )
+    {
+        return SEC_FROM_NSEC( g_rpal_time_wallSource( TRUE ) );
+    }
+
 #ifdef RPAL_PLATFORM_WINDOWS
     return _time64( NULL );
 #elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
@@ -238,15 +247,22 @@ RU64
     RU64 cpuDelta = 0;
     RU64 ts = 0;
 
+    if( NULL != g_rpal_time_wallSource )
+    {
+        ts = MSEC_FROM_NSEC( g_rpal_time_wallSource( FALSE ) );
+    }
+    else
+    {
 #ifdef RPAL_PLATFORM_WINDOWS
-    FILETIME ft = { 0 };
-    GetSystemTimeAsFileTime( &ft );
-    ts = MS_FILETIME_TO_MSEC_EPOCH( (RU64)ft.dwLowDateTime + ( (RU64)ft.dwHighDateTime << 32 ) );
+        FILETIME ft = { 0 };
+        GetSystemTimeAsFileTime( &ft );
+        ts = MS_FILETIME_TO_MSEC_EPOCH( (RU64)ft.dwLowDateTime + ( (RU64)ft.dwHighDateTime << 32 ) );
 #else
-    struct timeval tv = { 0 };
-    gettimeofday( &tv, NULL );
-    ts = MSEC_FROM_SEC((RU64)tv.tv_sec) + MSEC_FROM_USEC( (RU64)tv.tv_usec );
+        struct timeval tv = { 0 };
+        gettimeofday( &tv, NULL );
+        ts = MSEC_FROM_SEC((RU64)tv.tv_sec) + MSEC_FROM_USEC( (RU64)tv.tv_usec );
 #endif
+    }
 
     if( 0 != lastLocalTime &&
         MSEC_FROM_SEC( 10 ) < DELTA_OF( lastLocalTime, ts ) )
@@ -439,22 +455,8 @@ RU32
     RU32 t = 0;
 #ifdef RPAL_PLATFORM_WINDOWS
     t = GetTickCount();
-#elif defined( RPAL_PLATFORM_LINUX )
-    struct timespec abs_time;
-    clock_gettime( CLOCK_REALTIME, &abs_time );
-    t = ( abs_time.tv_sec * 1000 ) + ( abs_time.tv_nsec / 1000000 );
-#elif defined( RPAL_PLATFORM_MACOSX )
-    const int64_t kOneMillion = 1000 * 1000;
-    static mach_timebase_info_data_t s_timebase_info;
-    
-    if ( s_timebase_info.denom == 0 )
-    {
-        (void) mach_timebase_info( &s_timebase_info );
-    }
-    
-    // mach_absolute_time() returns billionth of seconds,
-    // so divide by one million to get milliseconds
-    t = (RU32)( ( mach_absolute_time() * s_timebase_info.numer ) / ( kOneMillion * s_timebase_info.denom ) );
+#elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+    t = (RU32)MSEC_FROM_NSEC( rpal_time_getMonotonicNs() );
 #endif
     return t;
 }
@@ -479,28 +481,114 @@ RU64
         // Overflow
         total = ( 0xFFFFFFFF - start ) + now;
     }
+#elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
+    // Unsigned 32 bit arithmetic takes care of the rollover.
+    total = (RU32)( (RU32)MSEC_FROM_NSEC( rpal_time_getMonotonicNs() ) - start );
+#endif
+    return total;
+}
+
+static
+RU64
+    _getSystemMonotonicNs
+    (
+        RBOOL isCoarse
+    )
+{
+    RU64 t = 0;
+#ifdef RPAL_PLATFORM_WINDOWS
+    static RU64 ticksPerSecond = 0;
+    LARGE_INTEGER freq = { 0 };
+    LARGE_INTEGER ticks = { 0 };
+
+    UNREFERENCED_PARAMETER( isCoarse );
+
+    if( 0 == ticksPerSecond &&
+        QueryPerformanceFrequency( &freq ) )
+    {
+        ticksPerSecond = freq.QuadPart;
+    }
+
+    if( 0 != ticksPerSecond &&
+        QueryPerformanceCounter( &ticks ) )
+    {
+        // Split to avoid overflowing on large tick counts.
+        t = NSEC_FROM_SEC( ticks.QuadPart / ticksPerSecond ) +
+            ( ( ticks.QuadPart % ticksPerSecond ) * NSEC_PER_SEC ) / ticksPerSecond;
+    }
 #elif defined( RPAL_PLATFORM_LINUX )
-    struct timespec abs_time;
-    RU32 t = 0;
-    clock_gettime( CLOCK_REALTIME, &abs_time );
-    t = ( abs_time.tv_sec * 1000 ) + ( abs_time.tv_nsec / 1000000 );
-    total = t - start;
+    struct timespec ts = { 0 };
+    clockid_t clockId = CLOCK_MONOTONIC;
+
+    // Both clocks are serviced by the vDSO, the coarse one only reads the
+    // last tick value without touching the hardware counter.
+#ifdef CLOCK_MONOTONIC_COARSE
+    if( isCoarse )
+    {
+        clockId = CLOCK_MONOTONIC_COARSE;
+    }
+#else
+    UNREFERENCED_PARAMETER( isCoarse );
+#endif
+
+    if( 0 == clock_gettime( clockId, &ts ) ||
+        ( clockId != CLOCK_MONOTONIC &&
+          0 == clock_gettime( CLOCK_MONOTONIC, &ts ) ) )
+    {
+        t = NSEC_FROM_SEC( ts.tv_sec ) + (RU64)ts.tv_nsec;
+    }
 #elif defined( RPAL_PLATFORM_MACOSX )
-    RU32 t = 0;
-    const int64_t kOneMillion = 1000 * 1000;
     static mach_timebase_info_data_t s_timebase_info;
-    
-    if ( s_timebase_info.denom == 0 )
+
+    UNREFERENCED_PARAMETER( isCoarse );
+
+    if( 0 == s_timebase_info.denom )
     {
-        (void) mach_timebase_info( &s_timebase_info );
+        (void)mach_timebase_info( &s_timebase_info );
     }
-    
-    // mach_absolute_time() returns billionth of seconds,
-    // so divide by one million to get milliseconds
-    t = (RU32)( ( mach_absolute_time() * s_timebase_info.numer ) / ( kOneMillion * s_timebase_info.denom ) );
-    total = t - start;
+
+    t = ( mach_absolute_time() * s_timebase_info.numer ) / s_timebase_info.denom;
 #endif
-    return total;
+    return t;
+}
+
+RU64
+    rpal_time_getMonotonicNs
+    (
+
+    )
+{
+    if( NULL != g_rpal_time_monotonicSource )
+    {
+        return g_rpal_time_monotonicSource( FALSE );
+    }
+
+    return _getSystemMonotonicNs( FALSE );
+}
+
+RU64
+    rpal_time_getMonotonicCoarseNs
+    (
+
+    )
+{
+    if( NULL != g_rpal_time_monotonicSource )
+    {
+        return g_rpal_time_monotonicSource( TRUE );
+    }
+
+    return _getSystemMonotonicNs( TRUE );
+}
+
+RVOID
+    rpal_time_setSources
+    (
+        rpal_time_source_f wallSource,
+        rpal_time_source_f monotonicSource
+    )
+{
+    g_rpal_time_wallSource = wallSource;
+    g_rpal_time_monotonicSource = monotonicSource;
 }
 
 #ifdef RPAL_PLATFORM_WINDOWS
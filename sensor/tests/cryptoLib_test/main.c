@@ -2,6 +2,9 @@
 #include <cryptoLib/cryptoLib.h>
 #include <Basic.h>
 
+#include <../lib/cryptoLib/sha256.h>
+#include <mbedtls/sha256.h>
+
 #define RPAL_FILE_ID     91
 
 RU8 g_test_priv[ CRYPTOLIB_ASYM_KEY_SIZE_PRI ] = {
@@ -140,6 +143,7 @@ void test_deinit( void )
 void test_hashing( void )
 {
     CryptoLib_Hash hash = { 0 };
+    CryptoLib_HashContext hashCtx = NULL;
     RPCHAR test_str_1 = "thisisatest";
     RU8 test_hash_1[ CRYPTOLIB_HASH_SIZE ] = { 0xa7, 0xc9, 0x62, 0x62, 0xc2, 0x1d, 0xb9, 0xa0, 
                                                0x6f, 0xd4, 0x9e, 0x30, 0x7d, 0x69, 0x4f, 0xd9, 
@@ -152,6 +156,19 @@ void test_hashing( void )
     CU_ASSERT_FALSE( CryptoLib_hash( 0, sizeof( test_str_1 ), &hash ) );
     CU_ASSERT_FALSE( CryptoLib_hash( test_str_1, 0, &hash ) );
     CU_ASSERT_FALSE( CryptoLib_hash( test_str_1, sizeof( test_str_1 ), NULL ) );
+
+    // Incremental hashing over arbitrary splits gives the same result.
+    rpal_memory_zero( &hash, sizeof( hash ) );
+    CU_ASSERT_NOT_EQUAL_FATAL( ( hashCtx = CryptoLib_hashInit() ), NULL );
+    CU_ASSERT_TRUE( CryptoLib_hashUpdate( hashCtx, test_str_1, 4 ) );
+    CU_ASSERT_TRUE( CryptoLib_hashUpdate( hashCtx, test_str_1 + 4, 0 ) );
+    CU_ASSERT_TRUE( CryptoLib_hashUpdate( hashCtx, test_str_1 + 4, rpal_string_strlenA( test_str_1 ) - 4 ) );
+    CU_ASSERT_TRUE( CryptoLib_hashFinish( hashCtx, &hash ) );
+    CU_ASSERT_EQUAL( rpal_memory_memcmp( &hash, test_hash_1, sizeof( hash ) ), 0 );
+
+    CU_ASSERT_NOT_EQUAL_FATAL( ( hashCtx = CryptoLib_hashInit() ), NULL );
+    CU_ASSERT_FALSE( CryptoLib_hashFinish( hashCtx, NULL ) );
+    CU_ASSERT_FALSE( CryptoLib_hashUpdate( NULL, test_str_1, 4 ) );
 }
 
 void test_file_hashing( void )
@@ -175,6 +192,244 @@ void test_file_hashing( void )
     CU_ASSERT_FALSE( CryptoLib_hashFile( testFileName, NULL, FALSE ) );
 }
 
+#define _HASH_MAX_SMALL_SIZE        300
+#define _HASH_LARGE_SIZE            ( ( 1024 * 1024 ) + 13 )
+#define _HASH_N_MULTI               7
+
+RPRIVATE
+RVOID
+    _fillTestData
+    (
+        RPU8 buffer,
+        RU32 bufferSize
+    )
+{
+    RU32 seed = 0x12345678;
+    RU32 i = 0;
+
+    for( i = 0; i < bufferSize; i++ )
+    {
+        seed = ( seed * 1103515245 ) + 12345;
+        buffer[ i ] = (RU8)( seed >> 16 );
+    }
+}
+
+RPRIVATE
+RVOID
+    _checkHashImplementation
+    (
+        RPU8 data
+    )
+{
+    CryptoLib_Hash hash = { 0 };
+    RU8 expected[ CRYPTOLIB_HASH_SIZE ] = { 0 };
+    CryptoLib_HashContext hashCtx = NULL;
+    RPVOID buffers[ _HASH_N_MULTI ] = { 0 };
+    RU32 sizes[ _HASH_N_MULTI ] = { 0 };
+    CryptoLib_Hash hashes[ _HASH_N_MULTI ] = { 0 };
+    RU32 size = 0;
+    RU32 offset = 0;
+    RU32 chunk = 0;
+    RU32 i = 0;
+    RU32 nMismatches = 0;
+
+    // Every size around the block and padding boundaries.
+    for( size = 1; size <= _HASH_MAX_SMALL_SIZE; size++ )
+    {
+        mbedtls_sha256( data, size, expected, 0 );
+        CU_ASSERT_TRUE( CryptoLib_hash( data, size, &hash ) );
+        if( 0 != rpal_memory_memcmp( &hash, expected, sizeof( expected ) ) )
+        {
+            nMismatches++;
+        }
+    }
+    CU_ASSERT_EQUAL( nMismatches, 0 );
+
+    mbedtls_sha256( data, _HASH_LARGE_SIZE, expected, 0 );
+    CU_ASSERT_TRUE( CryptoLib_hash( data, _HASH_LARGE_SIZE, &hash ) );
+    CU_ASSERT_EQUAL( rpal_memory_memcmp( &hash, expected, sizeof( expected ) ), 0 );
+
+    // Incremental updates that never line up with blocks.
+    CU_ASSERT_NOT_EQUAL_FATAL( ( hashCtx = CryptoLib_hashInit() ), NULL );
+    for( offset = 0, chunk = 1; offset < _HASH_LARGE_SIZE; offset += chunk, chunk = ( chunk * 7 ) % 1021 + 1 )
+    {
+        CU_ASSERT_TRUE( CryptoLib_hashUpdate( hashCtx, data + offset, MIN_OF( chunk, _HASH_LARGE_SIZE - offset ) ) );
+    }
+    CU_ASSERT_TRUE( CryptoLib_hashFinish( hashCtx, &hash ) );
+    CU_ASSERT_EQUAL( rpal_memory_memcmp( &hash, expected, sizeof( expected ) ), 0 );
+
+    // Mixed sizes so lanes finish at different times, including empty ones.
+    nMismatches = 0;
+    for( size = 0; size <= _HASH_MAX_SMALL_SIZE; size += 13 )
+    {
+        for( i = 0; i < _HASH_N_MULTI; i++ )
+        {
+            sizes[ i ] = ( size * ( i + 1 ) ) % ( _HASH_MAX_SMALL_SIZE + 1 );
+            buffers[ i ] = 0 == sizes[ i ] ? NULL : data + i;
+        }
+        CU_ASSERT_TRUE( CryptoLib_hashMulti( buffers, sizes, _HASH_N_MULTI, hashes ) );
+
+        for( i = 0; i < _HASH_N_MULTI; i++ )
+        {
+            mbedtls_sha256( data + i, sizes[ i ], expected, 0 );
+            if( 0 != rpal_memory_memcmp( &hashes[ i ], expected, sizeof( expected ) ) )
+            {
+                nMismatches++;
+            }
+        }
+    }
+    CU_ASSERT_EQUAL( nMismatches, 0 );
+
+    buffers[ 0 ] = data;
+    buffers[ 1 ] = data;
+    sizes[ 0 ] = _HASH_LARGE_SIZE;
+    sizes[ 1 ] = 200;
+    CU_ASSERT_TRUE( CryptoLib_hashMulti( buffers, sizes, 2, hashes ) );
+    mbedtls_sha256( data, _HASH_LARGE_SIZE, expected, 0 );
+    CU_ASSERT_EQUAL( rpal_memory_memcmp( &hashes[ 0 ], expected, sizeof( expected ) ), 0 );
+    mbedtls_sha256( data, 200, expected, 0 );
+    CU_ASSERT_EQUAL( rpal_memory_memcmp( &hashes[ 1 ], expected, sizeof( expected ) ), 0 );
+}
+
+void test_hash_implementations( void )
+{
+    RPU8 data = NULL;
+    RU32 impl = 0;
+    RU32 defaultImpl = 0;
+    RU32 nTested = 0;
+    RPVOID buffers[ 2 ] = { 0 };
+    RU32 sizes[ 2 ] = { 0 };
+    CryptoLib_Hash hashes[ 2 ] = { 0 };
+
+    data = rpal_memory_alloc( _HASH_LARGE_SIZE + _HASH_N_MULTI );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( data, NULL );
+    _fillTestData( data, _HASH_LARGE_SIZE + _HASH_N_MULTI );
+
+    defaultImpl = CryptoLib_sha256GetImplementation();
+
+    for( impl = CRYPTOLIB_SHA256_IMPL_GENERIC; impl <= CRYPTOLIB_SHA256_IMPL_ARMV8; impl++ )
+    {
+        if( CryptoLib_sha256SetImplementation( impl ) )
+        {
+            CU_ASSERT_EQUAL( CryptoLib_sha256GetImplementation(), impl );
+            _checkHashImplementation( data );
+            nTested++;
+        }
+    }
+
+    CU_ASSERT_TRUE( 1 <= nTested );
+    CU_ASSERT_TRUE( CryptoLib_sha256SetImplementation( defaultImpl ) );
+
+    buffers[ 0 ] = NULL;
+    sizes[ 0 ] = 1;
+    CU_ASSERT_FALSE( CryptoLib_hashMulti( buffers, sizes, 1, hashes ) );
+    CU_ASSERT_FALSE( CryptoLib_hashMulti( NULL, sizes, 1, hashes ) );
+    CU_ASSERT_FALSE( CryptoLib_hashMulti( buffers, sizes, 1, NULL ) );
+    CU_ASSERT_TRUE( CryptoLib_hashMulti( buffers, sizes, 0, hashes ) );
+
+    rpal_memory_free( data );
+}
+
+RPRIVATE
+RU32
+    _hashThroughput
+    (
+        RPU8 data,
+        RU32 totalSize,
+        RU32 chunkSize,
+        RBOOL isMulti,
+        RBOOL isReference
+    )
+{
+    RU64 startTime = 0;
+    RU64 elapsed = 0;
+    CryptoLib_Hash hash = { 0 };
+    RPVOID buffers[ 8 ] = { 0 };
+    RU32 sizes[ 8 ] = { 0 };
+    CryptoLib_Hash hashes[ 8 ] = { 0 };
+    RU32 nChunks = totalSize / chunkSize;
+    RU32 i = 0;
+    RU32 j = 0;
+
+    startTime = rpal_time_getMonotonicNs();
+
+    if( isMulti )
+    {
+        for( i = 0; i + ARRAY_N_ELEM( buffers ) <= nChunks; i += ARRAY_N_ELEM( buffers ) )
+        {
+            for( j = 0; j < ARRAY_N_ELEM( buffers ); j++ )
+            {
+                buffers[ j ] = data + ( ( i + j ) * chunkSize );
+                sizes[ j ] = chunkSize;
+            }
+            CryptoLib_hashMulti( buffers, sizes, ARRAY_N_ELEM( buffers ), hashes );
+        }
+    }
+    else
+    {
+        for( i = 0; i < nChunks; i++ )
+        {
+            if( isReference )
+            {
+                mbedtls_sha256( data + ( i * chunkSize ), chunkSize, (RPU8)&hash, 0 );
+            }
+            else
+            {
+                CryptoLib_hash( data + ( i * chunkSize ), chunkSize, &hash );
+            }
+        }
+    }
+
+    elapsed = MAX_OF( rpal_time_getMonotonicNs() - startTime, 1 );
+
+    // MB per second.
+    return (RU32)( ( (RU64)nChunks * chunkSize * 1000 ) / elapsed );
+}
+
+void test_hash_benchmark( void )
+{
+    RU32 totalSize = 16 * 1024 * 1024;
+    RU32 chunkSizes[] = { 64, 1024, 16 * 1024 * 1024 };
+    RPCHAR implNames[] = { "", "generic", "sha-ni", "armv8" };
+    RPU8 data = NULL;
+    RU32 defaultImpl = 0;
+    RU32 impl = 0;
+    RU32 i = 0;
+
+    data = rpal_memory_alloc( totalSize );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( data, NULL );
+    _fillTestData( data, totalSize );
+
+    defaultImpl = CryptoLib_sha256GetImplementation();
+    printf( "\n" );
+
+    for( i = 0; i < ARRAY_N_ELEM( chunkSizes ); i++ )
+    {
+        printf( "%d byte inputs: mbedtls %d MB/s",
+                chunkSizes[ i ],
+                _hashThroughput( data, totalSize, chunkSizes[ i ], FALSE, TRUE ) );
+
+        for( impl = CRYPTOLIB_SHA256_IMPL_GENERIC; impl <= CRYPTOLIB_SHA256_IMPL_ARMV8; impl++ )
+        {
+            if( CryptoLib_sha256SetImplementation( impl ) )
+            {
+                printf( ", %s %d MB/s", implNames[ impl ], _hashThroughput( data, totalSize, chunkSizes[ i ], FALSE, FALSE ) );
+
+                if( chunkSizes[ i ] < totalSize )
+                {
+                    printf( ", %s multi %d MB/s", implNames[ impl ], _hashThroughput( data, totalSize, chunkSizes[ i ], TRUE, FALSE ) );
+                }
+            }
+        }
+
+        printf( "\n" );
+    }
+
+    CU_ASSERT_TRUE( CryptoLib_sha256SetImplementation( defaultImpl ) );
+
+    rpal_memory_free( data );
+}
+
 void test_random_bytes( void )
 {
     RU8 test_buff[ 63 ] = { 0 };
@@ -187,6 +442,117 @@ void test_random_bytes( void )
     CU_ASSERT_FALSE( CryptoLib_genRandomBytes( test_buff, 0 ) );
 }
 
+#define _N_UNIQUE_IDS           100000
+#define _N_UNIQUE_ID_THREADS    4
+
+RPRIVATE
+RS32
+    _orderIds
+    (
+        RPU8 id1,
+        RPU8 id2
+    )
+{
+    return rpal_memory_memcmp( id1, id2, CRYPTOLIB_UNIQUE_ID_SIZE );
+}
+
+typedef struct
+{
+    RPU8 ids;
+    RU32 nErrors;
+} _UniqueIdsCtx;
+
+RPRIVATE
+RU32
+RPAL_THREAD_FUNC
+    _genIdsThread
+    (
+        _UniqueIdsCtx* ctx
+    )
+{
+    RU32 i = 0;
+
+    for( i = 0; i < _N_UNIQUE_IDS; i++ )
+    {
+        if( !CryptoLib_genUniqueId( ctx->ids + ( i * CRYPTOLIB_UNIQUE_ID_SIZE ) ) )
+        {
+            ctx->nErrors++;
+        }
+    }
+
+    return 0;
+}
+
+void test_unique_ids( void )
+{
+    RPU8 ids = NULL;
+    rThread threads[ _N_UNIQUE_ID_THREADS ] = { 0 };
+    _UniqueIdsCtx contexts[ _N_UNIQUE_ID_THREADS ] = { 0 };
+    RU32 nIds = _N_UNIQUE_IDS * _N_UNIQUE_ID_THREADS;
+    RU32 nDuplicates = 0;
+    RU32 i = 0;
+    RU8 emptyId[ CRYPTOLIB_UNIQUE_ID_SIZE ] = { 0 };
+    RU64 startTime = 0;
+    RU64 randomTime = 0;
+    RU64 uniqueTime = 0;
+
+    CU_ASSERT_FALSE( CryptoLib_genUniqueId( NULL ) );
+
+    ids = rpal_memory_alloc( nIds * CRYPTOLIB_UNIQUE_ID_SIZE );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( ids, NULL );
+
+    // Generate from several threads at once, each with its own state.
+    for( i = 0; i < _N_UNIQUE_ID_THREADS; i++ )
+    {
+        contexts[ i ].ids = ids + ( i * _N_UNIQUE_IDS * CRYPTOLIB_UNIQUE_ID_SIZE );
+        threads[ i ] = rpal_thread_new( (rpal_thread_func)_genIdsThread, &contexts[ i ] );
+        CU_ASSERT_PTR_NOT_EQUAL( threads[ i ], NULL );
+    }
+
+    for( i = 0; i < _N_UNIQUE_ID_THREADS; i++ )
+    {
+        if( NULL != threads[ i ] )
+        {
+            CU_ASSERT_TRUE( rpal_thread_wait( threads[ i ], RINFINITE ) );
+            CU_ASSERT_EQUAL( contexts[ i ].nErrors, 0 );
+            rpal_thread_free( threads[ i ] );
+        }
+    }
+
+    CU_ASSERT_TRUE( rpal_sort_array( ids, nIds, CRYPTOLIB_UNIQUE_ID_SIZE, (rpal_ordering_func)_orderIds ) );
+    for( i = 1; i < nIds; i++ )
+    {
+        if( 0 == _orderIds( ids + ( ( i - 1 ) * CRYPTOLIB_UNIQUE_ID_SIZE ), ids + ( i * CRYPTOLIB_UNIQUE_ID_SIZE ) ) )
+        {
+            nDuplicates++;
+        }
+    }
+    CU_ASSERT_EQUAL( nDuplicates, 0 );
+    CU_ASSERT_NOT_EQUAL( rpal_memory_memcmp( ids, emptyId, sizeof( emptyId ) ), 0 );
+
+    // Compare with the general purpose random generator.
+    startTime = rpal_time_getMonotonicNs();
+    for( i = 0; i < _N_UNIQUE_IDS; i++ )
+    {
+        CryptoLib_genRandomBytes( ids + ( i * CRYPTOLIB_UNIQUE_ID_SIZE ), CRYPTOLIB_UNIQUE_ID_SIZE );
+    }
+    randomTime = rpal_time_getMonotonicNs() - startTime;
+
+    startTime = rpal_time_getMonotonicNs();
+    for( i = 0; i < _N_UNIQUE_IDS; i++ )
+    {
+        CryptoLib_genUniqueId( ids + ( i * CRYPTOLIB_UNIQUE_ID_SIZE ) );
+    }
+    uniqueTime = rpal_time_getMonotonicNs() - startTime;
+
+    printf( "\n%d ids: random bytes %d us, unique ids %d us\n",
+            _N_UNIQUE_IDS,
+            (RU32)( randomTime / 1000 ),
+            (RU32)( uniqueTime / 1000 ) );
+
+    rpal_memory_free( ids );
+}
+
 void test_sym_encryption( void )
 {
     RU8 test_key[ CRYPTOLIB_SYM_KEY_SIZE ] = { 0 };
@@ -435,7 +801,10 @@ int
                 if( NULL == CU_add_test( suite, "initialize", test_init ) ||
                     NULL == CU_add_test( suite, "hashing", test_hashing ) ||
                     NULL == CU_add_test( suite, "file_hashing", test_file_hashing ) ||
+                    NULL == CU_add_test( suite, "hash_implementations", test_hash_implementations ) ||
+                    NULL == CU_add_test( suite, "hash_benchmark", test_hash_benchmark ) ||
                     NULL == CU_add_test( suite, "random", test_random_bytes ) ||
+                    NULL == CU_add_test( suite, "unique_ids", test_unique_ids ) ||
                     NULL == CU_add_test( suite, "sym_crypt", test_sym_encryption ) ||
                     NULL == CU_add_test( suite, "signature", test_sig ) ||
                     NULL == CU_add_test( suite, "asym_crypt", test_asym ) ||
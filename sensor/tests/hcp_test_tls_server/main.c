@@ -0,0 +1,247 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "tlsTestServer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <mbedtls/net.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/ssl_cache.h>
+#include <mbedtls/ssl_ticket.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+
+// Nothing from rpal is linked in here, only its types are used.
+
+typedef struct
+{
+    mbedtls_net_context listenFd;
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context ctr_drbg;
+    mbedtls_ssl_config conf;
+    mbedtls_x509_crt cert;
+    mbedtls_pk_context key;
+    mbedtls_ssl_cache_context cache;
+    mbedtls_ssl_ticket_context ticket;
+    volatile RU32 nResumed;
+
+} _TlsTestServer;
+
+// The callbacks get the server as their context so they can count resumptions.
+static
+int
+    _cacheGet
+    (
+        void* ctx,
+        mbedtls_ssl_session* session
+    )
+{
+    _TlsTestServer* server = (_TlsTestServer*)ctx;
+    int ret = mbedtls_ssl_cache_get( &server->cache, session );
+
+    if( 0 == ret )
+    {
+        server->nResumed++;
+    }
+
+    return ret;
+}
+
+static
+int
+    _cacheSet
+    (
+        void* ctx,
+        const mbedtls_ssl_session* session
+    )
+{
+    return mbedtls_ssl_cache_set( &( (_TlsTestServer*)ctx )->cache, session );
+}
+
+static
+int
+    _ticketWrite
+    (
+        void* ctx,
+        const mbedtls_ssl_session* session,
+        unsigned char* start,
+        const unsigned char* end,
+        size_t* tlen,
+        uint32_t* lifetime
+    )
+{
+    return mbedtls_ssl_ticket_write( &( (_TlsTestServer*)ctx )->ticket, session, start, end, tlen, lifetime );
+}
+
+static
+int
+    _ticketParse
+    (
+        void* ctx,
+        mbedtls_ssl_session* session,
+        unsigned char* buf,
+        size_t len
+    )
+{
+    _TlsTestServer* server = (_TlsTestServer*)ctx;
+    int ret = mbedtls_ssl_ticket_parse( &server->ticket, session, buf, len );
+
+    if( 0 == ret )
+    {
+        server->nResumed++;
+    }
+
+    return ret;
+}
+
+TlsTestServer
+    TlsTestServer_new
+    (
+        RPCHAR port,
+        RPU8 cert,
+        RU32 certSize,
+        RPU8 key,
+        RU32 keySize
+    )
+{
+    _TlsTestServer* server = NULL;
+
+    if( NULL != port &&
+        NULL != cert &&
+        NULL != key &&
+        NULL != ( server = calloc( 1, sizeof( *server ) ) ) )
+    {
+        mbedtls_net_init( &server->listenFd );
+        mbedtls_entropy_init( &server->entropy );
+        mbedtls_ctr_drbg_init( &server->ctr_drbg );
+        mbedtls_ssl_config_init( &server->conf );
+        mbedtls_x509_crt_init( &server->cert );
+        mbedtls_pk_init( &server->key );
+        mbedtls_ssl_cache_init( &server->cache );
+        mbedtls_ssl_ticket_init( &server->ticket );
+
+        if( 0 == mbedtls_ctr_drbg_seed( &server->ctr_drbg, mbedtls_entropy_func, &server->entropy, NULL, 0 ) &&
+            0 == mbedtls_x509_crt_parse( &server->cert, cert, certSize ) &&
+            0 == mbedtls_pk_parse_key( &server->key, key, keySize, NULL, 0 ) &&
+            0 == mbedtls_ssl_config_defaults( &server->conf,
+                                              MBEDTLS_SSL_IS_SERVER,
+                                              MBEDTLS_SSL_TRANSPORT_STREAM,
+                                              MBEDTLS_SSL_PRESET_DEFAULT ) &&
+            0 == mbedtls_ssl_conf_own_cert( &server->conf, &server->cert, &server->key ) &&
+            0 == mbedtls_ssl_ticket_setup( &server->ticket,
+                                           mbedtls_ctr_drbg_random,
+                                           &server->ctr_drbg,
+                                           MBEDTLS_CIPHER_AES_256_GCM,
+                                           60 ) &&
+            0 == mbedtls_net_bind( &server->listenFd, "127.0.0.1", port, MBEDTLS_NET_PROTO_TCP ) )
+        {
+            mbedtls_ssl_conf_rng( &server->conf, mbedtls_ctr_drbg_random, &server->ctr_drbg );
+            mbedtls_ssl_conf_session_cache( &server->conf, server, _cacheGet, _cacheSet );
+            mbedtls_ssl_conf_session_tickets_cb( &server->conf, _ticketWrite, _ticketParse, server );
+        }
+        else
+        {
+            TlsTestServer_free( server );
+            server = NULL;
+        }
+    }
+
+    return server;
+}
+
+RU32
+    TlsTestServer_serve
+    (
+        TlsTestServer server,
+        RU32 nConnections
+    )
+{
+    _TlsTestServer* pServer = (_TlsTestServer*)server;
+    mbedtls_net_context clientFd;
+    mbedtls_ssl_context ssl;
+    RU32 nHandshakes = 0;
+    RU32 i = 0;
+    int ret = 0;
+
+    for( i = 0; NULL != pServer && i < nConnections; i++ )
+    {
+        mbedtls_net_init( &clientFd );
+        mbedtls_ssl_init( &ssl );
+
+        if( 0 == mbedtls_net_accept( &pServer->listenFd, &clientFd, NULL, 0, NULL ) &&
+            0 == mbedtls_ssl_setup( &ssl, &pServer->conf ) )
+        {
+            mbedtls_ssl_set_bio( &ssl, &clientFd, mbedtls_net_send, mbedtls_net_recv, NULL );
+
+            do
+            {
+                ret = mbedtls_ssl_handshake( &ssl );
+            } while( MBEDTLS_ERR_SSL_WANT_READ == ret ||
+                     MBEDTLS_ERR_SSL_WANT_WRITE == ret );
+
+            if( 0 == ret )
+            {
+                nHandshakes++;
+                mbedtls_ssl_close_notify( &ssl );
+            }
+        }
+
+        mbedtls_ssl_free( &ssl );
+        mbedtls_net_free( &clientFd );
+    }
+
+    return nHandshakes;
+}
+
+RU32
+    TlsTestServer_getResumed
+    (
+        TlsTestServer server
+    )
+{
+    RU32 nResumed = 0;
+
+    if( NULL != server )
+    {
+        nResumed = ( (_TlsTestServer*)server )->nResumed;
+    }
+
+    return nResumed;
+}
+
+RVOID
+    TlsTestServer_free
+    (
+        TlsTestServer server
+    )
+{
+    _TlsTestServer* pServer = (_TlsTestServer*)server;
+
+    if( NULL != pServer )
+    {
+        mbedtls_net_free( &pServer->listenFd );
+        mbedtls_ssl_ticket_free( &pServer->ticket );
+        mbedtls_ssl_cache_free( &pServer->cache );
+        mbedtls_pk_free( &pServer->key );
+        mbedtls_x509_crt_free( &pServer->cert );
+        mbedtls_ssl_config_free( &pServer->conf );
+        mbedtls_ctr_drbg_free( &pServer->ctr_drbg );
+        mbedtls_entropy_free( &pServer->entropy );
+        free( pServer );
+    }
+}
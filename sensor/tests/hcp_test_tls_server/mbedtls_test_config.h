@@ -0,0 +1,28 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _HCP_TEST_MBEDTLS_TEST_CONFIG_H
+#define _HCP_TEST_MBEDTLS_TEST_CONFIG_H
+
+// The sensor's mbedtls is client only, the server side is only ever
+// built into this test library, through MBEDTLS_CONFIG_FILE.
+#define MBEDTLS_SSL_SRV_C
+#define MBEDTLS_SSL_CACHE_C
+#define MBEDTLS_SSL_TICKET_C
+
+#include <mbedtls/config.h>
+
+#endif
@@ -0,0 +1,60 @@
+/*
+Copyright 2015 refractionPOINT
+
+Licensed under the Apache License, Version 2.0 ( the "License" );
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http ://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _HCP_TEST_TLS_TEST_SERVER_H
+#define _HCP_TEST_TLS_TEST_SERVER_H
+
+#include <rpal/rpal.h>
+
+// Stand-in for the cloud in hcp_test, resuming sessions from tickets or its
+// session cache. It carries its own mbedtls with server support which is never
+// visible outside of this library.
+typedef RPVOID TlsTestServer;
+
+RPAL_EXPORT
+TlsTestServer
+    TlsTestServer_new
+    (
+        RPCHAR port,
+        RPU8 cert,
+        RU32 certSize,
+        RPU8 key,
+        RU32 keySize
+    );
+
+RPAL_EXPORT
+RU32
+    TlsTestServer_serve
+    (
+        TlsTestServer server,
+        RU32 nConnections
+    );
+
+RPAL_EXPORT
+RU32
+    TlsTestServer_getResumed
+    (
+        TlsTestServer server
+    );
+
+RPAL_EXPORT
+RVOID
+    TlsTestServer_free
+    (
+        TlsTestServer server
+    );
+
+#endif
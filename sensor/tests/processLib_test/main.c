@@ -4,6 +4,11 @@
 #include <rpHostCommonPlatformLib/rTags.h>
 #include <Basic.h>
 
+#ifdef RPAL_PLATFORM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 
 #ifdef RPAL_PLATFORM_WINDOWS
 static RBOOL 
@@ -311,11 +316,229 @@ void
 
     CU_ASSERT_TRUE( 0 != nHandles );
     CU_ASSERT_TRUE( 0 != nNamedHandles );
+#elif defined( RPAL_PLATFORM_LINUX )
+    rList handles = NULL;
+    rSequence handle = NULL;
+    processLibHandleCache cache = NULL;
+    RU32 pid = processLib_getCurrentPid();
+    RS32 pipeFds[ 2 ] = { -1, -1 };
+    FILE* hFile = NULL;
+    FILE* hStatus = NULL;
+    RU32 fileFd = 0;
+    RU32 statusFd = 0;
+    RU32 fd = 0;
+    RU32 flags = 0;
+    RU64 pos = 0;
+    RU64 inode = 0;
+    RPCHAR type = NULL;
+    RPCHAR name = NULL;
+    RBOOL isFileFound = FALSE;
+    RBOOL isPipeFound = FALSE;
+    RU32 nHandles = 0;
+    RU32 nSecondPass = 0;
+
+    CU_ASSERT_EQUAL_FATAL( pipe( pipeFds ), 0 );
+    hFile = fopen( "./handles_test.dat", "w+" );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( hFile, NULL );
+    CU_ASSERT_EQUAL( fwrite( "0123456789", 1, 10, hFile ), 10 );
+    fflush( hFile );
+    fileFd = (RU32)fileno( hFile );
+
+    // Typed records with the file position.
+    handles = processLib_getHandlesEx( pid, TRUE, NULL, PROCESSLIB_HANDLES_WITH_FDINFO, NULL );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( handles, NULL );
+    while( rList_getSEQUENCE( handles, RP_TAGS_HANDLE_INFO, &handle ) )
+    {
+        nHandles++;
+        CU_ASSERT_TRUE( rSequence_getRU32( handle, RP_TAGS_HANDLE_VALUE, &fd ) );
+        CU_ASSERT_TRUE( rSequence_getSTRINGA( handle, RP_TAGS_HANDLE_TYPE, &type ) );
+        CU_ASSERT_TRUE( rSequence_getSTRINGA( handle, RP_TAGS_HANDLE_NAME, &name ) );
+
+        if( fd == fileFd )
+        {
+            isFileFound = TRUE;
+            CU_ASSERT_EQUAL( rpal_string_strcmp( type, "File" ), 0 );
+            CU_ASSERT_PTR_NOT_EQUAL( rpal_string_strstr( name, "handles_test.dat" ), NULL );
+            CU_ASSERT_TRUE( rSequence_getRU64( handle, RP_TAGS_HANDLE_POSITION, &pos ) );
+            CU_ASSERT_EQUAL( pos, 10 );
+            CU_ASSERT_TRUE( rSequence_getRU32( handle, RP_TAGS_HANDLE_FLAGS, &flags ) );
+            CU_ASSERT_TRUE( IS_FLAG_ENABLED( flags, O_RDWR ) );
+        }
+        else if( fd == (RU32)pipeFds[ 0 ] )
+        {
+            isPipeFound = TRUE;
+            CU_ASSERT_EQUAL( rpal_string_strcmp( type, "Pipe" ), 0 );
+            CU_ASSERT_TRUE( rSequence_getRU64( handle, RP_TAGS_HANDLE_INODE, &inode ) );
+            CU_ASSERT_NOT_EQUAL( inode, 0 );
+        }
+    }
+    rList_free( handles );
+    CU_ASSERT_TRUE( isFileFound );
+    CU_ASSERT_TRUE( isPipeFound );
+
+    // Substring filtering.
+    handles = processLib_getHandles( pid, TRUE, "handles_test.dat" );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( handles, NULL );
+    CU_ASSERT_EQUAL( rList_getNumElements( handles ), 1 );
+    rList_free( handles );
+
+    // Incremental mode tracks opened and closed fds across calls.
+    cache = processLib_newHandleCache();
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( cache, NULL );
+    handles = processLib_getHandlesEx( pid, TRUE, NULL, 0, cache );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( handles, NULL );
+    CU_ASSERT_EQUAL( rList_getNumElements( handles ), nHandles );
+    rList_free( handles );
+
+    // A number reused between two calls keeps its cached record, so the new
+    // fd is opened before the old ones are closed.
+    hStatus = fopen( "/proc/self/status", "r" );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( hStatus, NULL );
+    statusFd = (RU32)fileno( hStatus );
+    close( pipeFds[ 1 ] );
+    close( pipeFds[ 0 ] );
+    isFileFound = FALSE;
+    handles = processLib_getHandlesEx( pid, TRUE, NULL, 0, cache );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( handles, NULL );
+    while( rList_getSEQUENCE( handles, RP_TAGS_HANDLE_INFO, &handle ) )
+    {
+        nSecondPass++;
+        CU_ASSERT_TRUE( rSequence_getRU32( handle, RP_TAGS_HANDLE_VALUE, &fd ) );
+        CU_ASSERT_NOT_EQUAL( fd, (RU32)pipeFds[ 0 ] );
+        if( fd == statusFd &&
+            rSequence_getSTRINGA( handle, RP_TAGS_HANDLE_NAME, &name ) &&
+            NULL != rpal_string_strstr( name, "/status" ) )
+        {
+            isFileFound = TRUE;
+        }
+    }
+    rList_free( handles );
+    CU_ASSERT_EQUAL( nSecondPass, nHandles - 1 );
+    CU_ASSERT_TRUE( isFileFound );
+
+    fclose( hStatus );
+    fclose( hFile );
+    unlink( "./handles_test.dat" );
+
+    // A full sweep through the cache.
+    handles = processLib_getHandlesEx( 0, TRUE, NULL, 0, cache );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( handles, NULL );
+    CU_ASSERT_NOT_EQUAL( rList_getNumElements( handles ), 0 );
+    rList_free( handles );
+
+    processLib_freeHandleCache( cache );
 #else
     CU_ASSERT_EQUAL( processLib_getHandles( 0, FALSE, NULL ), NULL );
 #endif
 }
 
+void
+    test_containerInfo
+    (
+        void
+    )
+{
+    RCHAR id[ PROCESSLIB_CONTAINER_ID_SIZE ] = {0};
+    RPCHAR runtime = NULL;
+    RPCHAR hexId = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+    RCHAR path[ 512 ] = {0};
+
+    // Cgroup paths of the common runtimes.
+    rpal_string_snprintf( path, sizeof( path ), "/docker/%s", hexId );
+    CU_ASSERT_TRUE( processLib_getContainerIdFromCgroup( path, id, &runtime ) );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( id, hexId ), 0 );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( runtime, "docker" ), 0 );
+
+    rpal_string_snprintf( path, sizeof( path ), "/system.slice/docker-%s.scope", hexId );
+    CU_ASSERT_TRUE( processLib_getContainerIdFromCgroup( path, id, &runtime ) );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( id, hexId ), 0 );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( runtime, "docker" ), 0 );
+
+    rpal_string_snprintf( path, sizeof( path ), "/kubepods.slice/kubepods-burstable.slice/kubepods-burstable-pod1a2b3c4d_5e6f.slice/cri-containerd-%s.scope", hexId );
+    CU_ASSERT_TRUE( processLib_getContainerIdFromCgroup( path, id, &runtime ) );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( id, hexId ), 0 );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( runtime, "containerd" ), 0 );
+
+    rpal_string_snprintf( path, sizeof( path ), "/kubepods/besteffort/pod1a2b3c4d-5e6f/%s", hexId );
+    CU_ASSERT_TRUE( processLib_getContainerIdFromCgroup( path, id, &runtime ) );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( id, hexId ), 0 );
+    CU_ASSERT_PTR_EQUAL( runtime, NULL );
+
+    rpal_string_snprintf( path, sizeof( path ), "/kubepods.slice/crio-%s.scope", hexId );
+    CU_ASSERT_TRUE( processLib_getContainerIdFromCgroup( path, id, &runtime ) );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( runtime, "cri-o" ), 0 );
+
+    rpal_string_snprintf( path, sizeof( path ), "/machine.slice/libpod-%s.scope/container", hexId );
+    CU_ASSERT_TRUE( processLib_getContainerIdFromCgroup( path, id, &runtime ) );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( id, hexId ), 0 );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( runtime, "podman" ), 0 );
+
+    CU_ASSERT_TRUE( processLib_getContainerIdFromCgroup( "/lxc.payload.web01/system.slice", id, &runtime ) );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( id, "web01" ), 0 );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( runtime, "lxc" ), 0 );
+
+    CU_ASSERT_TRUE( processLib_getContainerIdFromCgroup( "/lxc/db01", id, &runtime ) );
+    CU_ASSERT_EQUAL( rpal_string_strcmpA( id, "db01" ), 0 );
+
+    // Host processes and look-alikes.
+    CU_ASSERT_FALSE( processLib_getContainerIdFromCgroup( "/", id, &runtime ) );
+    CU_ASSERT_FALSE( processLib_getContainerIdFromCgroup( "/user.slice/user-1000.slice/session-2.scope", id, &runtime ) );
+    CU_ASSERT_FALSE( processLib_getContainerIdFromCgroup( "/system.slice/docker-0123.scope", id, &runtime ) );
+    CU_ASSERT_EQUAL( id[ 0 ], 0 );
+    CU_ASSERT_PTR_EQUAL( runtime, NULL );
+
+#ifdef RPAL_PLATFORM_LINUX
+    {
+        processLibContainerCache cache = NULL;
+        rSequence info = NULL;
+        RPCHAR cgroup = NULL;
+        RU64 ns = 0;
+        RU64 cachedNs = 0;
+        RCHAR target[ 64 ] = {0};
+        RU32 pid = processLib_getCurrentPid();
+
+        CU_ASSERT_NOT_EQUAL_FATAL( readlink( "/proc/self/ns/pid", target, sizeof( target ) - 1 ), -1 );
+
+        // Uncached.
+        info = processLib_getContainerInfo( pid, NULL );
+        CU_ASSERT_PTR_NOT_EQUAL_FATAL( info, NULL );
+        CU_ASSERT_TRUE( rSequence_getSTRINGA( info, RP_TAGS_CGROUP, &cgroup ) );
+        CU_ASSERT_EQUAL( cgroup[ 0 ], '/' );
+        CU_ASSERT_TRUE( rSequence_getRU64( info, RP_TAGS_PID_NAMESPACE, &ns ) );
+        CU_ASSERT_EQUAL( ns, strtoull( rpal_string_strstr( target, "[" ) + 1, NULL, 10 ) );
+        CU_ASSERT_TRUE( rSequence_getRU64( info, RP_TAGS_MOUNT_NAMESPACE, &ns ) );
+        CU_ASSERT_TRUE( rSequence_getRU64( info, RP_TAGS_NETWORK_NAMESPACE, &ns ) );
+        CU_ASSERT_TRUE( rSequence_getRU64( info, RP_TAGS_USER_NAMESPACE, &ns ) );
+        rSequence_free( info );
+
+        // Cached, the second lookup comes from the cache and matches.
+        cache = processLib_newContainerCache();
+        CU_ASSERT_PTR_NOT_EQUAL_FATAL( cache, NULL );
+        info = processLib_getContainerInfo( pid, cache );
+        CU_ASSERT_PTR_NOT_EQUAL_FATAL( info, NULL );
+        CU_ASSERT_TRUE( rSequence_getRU64( info, RP_TAGS_PID_NAMESPACE, &ns ) );
+        rSequence_free( info );
+        info = processLib_getContainerInfo( pid, cache );
+        CU_ASSERT_PTR_NOT_EQUAL_FATAL( info, NULL );
+        CU_ASSERT_TRUE( rSequence_getRU64( info, RP_TAGS_PID_NAMESPACE, &cachedNs ) );
+        CU_ASSERT_EQUAL( ns, cachedNs );
+        rSequence_free( info );
+
+        // Our parent most likely shares our cgroup, so shares the entry.
+        info = processLib_getContainerInfo( (RU32)getppid(), cache );
+        CU_ASSERT_PTR_NOT_EQUAL( info, NULL );
+        rSequence_free( info );
+
+        processLib_forgetContainerInfo( cache, pid );
+        processLib_forgetContainerInfo( cache, (RU32)getppid() );
+        CU_ASSERT_EQUAL( processLib_getContainerInfo( 0x7FFFFFFF, cache ), NULL );
+        processLib_freeContainerCache( cache );
+    }
+#else
+    CU_ASSERT_EQUAL( processLib_getContainerInfo( processLib_getCurrentPid(), NULL ), NULL );
+#endif
+}
+
 int
     main
     (
@@ -347,6 +570,7 @@ int
                     NULL == CU_add_test( suite, "memmap", test_memmap ) ||
                     NULL == CU_add_test( suite, "currentModule", test_currentModule ) ||
                     NULL == CU_add_test( suite, "handles", test_handles ) ||
+                    NULL == CU_add_test( suite, "containerInfo", test_containerInfo ) ||
                     NULL == CU_add_test( suite, "memoryLeaks", test_memoryLeaks ) )
                 {
                     rpal_debug_error( "%s", CU_get_error_msg() );
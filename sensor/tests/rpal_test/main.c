@@ -61,6 +61,186 @@ void test_events(void)
     rEvent_free( evt );
 }
 
+static RU64 g_mockMonotonicNs = 0;
+
+static RU64 _manualMonotonicClock( RBOOL isCoarse )
+{
+    UNREFERENCED_PARAMETER( isCoarse );
+    return g_mockMonotonicNs;
+}
+
+typedef struct
+{
+    RS32 jumpSec;
+    RU32 restoreAfterMs;
+    RS32 observedJumpSec;
+} _ClockJump;
+
+static RU64 g_mockWallBaseNs = 0;
+static RU64 g_mockWallBaseMonotonicNs = 0;
+static RS32 g_mockWallJumpSec = 0;
+
+// Follows the real time from when it was installed, shifted by whatever
+// jump is in effect. A backward jump wraps around in the unsigned addition.
+static RU64 _jumpingWallClock( RBOOL isCoarse )
+{
+    UNREFERENCED_PARAMETER( isCoarse );
+    return g_mockWallBaseNs + ( rpal_time_getMonotonicNs() - g_mockWallBaseMonotonicNs ) + NSEC_FROM_SEC( g_mockWallJumpSec );
+}
+
+static RU32 RPAL_THREAD_FUNC _wallClockJumper( RPVOID ctx )
+{
+    _ClockJump* jump = (_ClockJump*)ctx;
+    RU64 before = 0;
+
+    rpal_thread_sleep( 100 );
+    before = rpal_time_getLocal();
+    g_mockWallJumpSec = jump->jumpSec;
+    jump->observedJumpSec = (RS32)( rpal_time_getLocal() - before );
+    rpal_thread_sleep( jump->restoreAfterMs );
+    g_mockWallJumpSec = 0;
+
+    return 0;
+}
+
+// Waits 500ms on an event, or a queue, while the rpal wall clock jumps by
+// jumpSec 100ms into the wait and jumps back restoreAfterMs later. The jump
+// goes through the wall time source so the host clock is left alone.
+// Returns the elapsed time on the monotonic clock.
+static RU64 _timedWaitAcrossJump( RS32 jumpSec, RU32 restoreAfterMs, RBOOL isQueue )
+{
+    _ClockJump jump = { 0 };
+    rThread jumper = NULL;
+    rEvent evt = NULL;
+    rQueue q = NULL;
+    RPVOID pElem = NULL;
+    RU32 elemSize = 0;
+    RU64 start = 0;
+    RU64 elapsed = 0;
+
+    jump.jumpSec = jumpSec;
+    jump.restoreAfterMs = restoreAfterMs;
+
+    g_mockWallBaseNs = NSEC_FROM_MSEC( rpal_time_getGlobalPreciseTime() );
+    g_mockWallBaseMonotonicNs = rpal_time_getMonotonicNs();
+    g_mockWallJumpSec = 0;
+    rpal_time_setSources( _jumpingWallClock, NULL );
+
+    if( isQueue )
+    {
+        CU_ASSERT_TRUE_FATAL( rQueue_create( &q, NULL, 3 ) );
+    }
+    else
+    {
+        CU_ASSERT_PTR_NOT_EQUAL_FATAL( ( evt = rEvent_create( FALSE ) ), NULL );
+    }
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( ( jumper = rpal_thread_new( _wallClockJumper, &jump ) ), NULL );
+
+    start = rpal_time_getMonotonicNs();
+    if( isQueue )
+    {
+        CU_ASSERT_FALSE( rQueue_remove( q, &pElem, &elemSize, 500 ) );
+    }
+    else
+    {
+        CU_ASSERT_FALSE( rEvent_wait( evt, 500 ) );
+    }
+    elapsed = rpal_time_getMonotonicNs() - start;
+
+    rpal_thread_wait( jumper, RINFINITE );
+    rpal_thread_free( jumper );
+    if( isQueue )
+    {
+        rQueue_free( q );
+    }
+    else
+    {
+        rEvent_free( evt );
+    }
+
+    rpal_time_setSources( NULL, NULL );
+
+    // The jump was seen by the wall clock.
+    CU_ASSERT_TRUE( jump.observedJumpSec >= jumpSec - 1 && jump.observedJumpSec <= jumpSec + 1 );
+
+    return elapsed;
+}
+
+void test_monotonicTime(void)
+{
+    RU64 t1 = 0;
+    RU64 t2 = 0;
+    RU32 start = 0;
+    RU32 i = 0;
+    rEvent evt = NULL;
+    rQueue q = NULL;
+    RPVOID pElem = NULL;
+    RU32 elemSize = 0;
+
+    t1 = rpal_time_getMonotonicNs();
+    CU_ASSERT_NOT_EQUAL( t1, 0 );
+    for( i = 0; i < 1000; i++ )
+    {
+        t2 = rpal_time_getMonotonicNs();
+        CU_ASSERT_TRUE( t2 >= t1 );
+        t1 = t2;
+    }
+
+    t1 = rpal_time_getMonotonicCoarseNs();
+    rpal_thread_sleep( 20 );
+    t2 = rpal_time_getMonotonicCoarseNs();
+    CU_ASSERT_TRUE( t2 > t1 );
+
+    evt = rEvent_create( FALSE );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( evt, NULL );
+    t1 = rpal_time_getMonotonicNs();
+    CU_ASSERT_FALSE( rEvent_wait( evt, 100 ) );
+    t2 = rpal_time_getMonotonicNs() - t1;
+    CU_ASSERT_TRUE( t2 >= NSEC_FROM_MSEC( 90 ) );
+    CU_ASSERT_TRUE( t2 < NSEC_FROM_SEC( 2 ) );
+    rEvent_free( evt );
+
+    CU_ASSERT_TRUE( rQueue_create( &q, NULL, 3 ) );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( q, NULL );
+    t1 = rpal_time_getMonotonicNs();
+    CU_ASSERT_FALSE( rQueue_remove( q, &pElem, &elemSize, 100 ) );
+    t2 = rpal_time_getMonotonicNs() - t1;
+    CU_ASSERT_TRUE( t2 >= NSEC_FROM_MSEC( 90 ) );
+    CU_ASSERT_TRUE( t2 < NSEC_FROM_SEC( 2 ) );
+    rQueue_free( q );
+
+    // The wall clock jumping during a timed wait should neither cut it short
+    // nor stretch it. A wait on the wall clock would return right away on the
+    // jump forward and only when the clock is restored on the jump back.
+    t2 = _timedWaitAcrossJump( 60 * 60, 100, FALSE );
+    CU_ASSERT_TRUE( t2 >= NSEC_FROM_MSEC( 450 ) );
+    CU_ASSERT_TRUE( t2 < NSEC_FROM_MSEC( 1000 ) );
+
+    t2 = _timedWaitAcrossJump( -60 * 60, 1000, FALSE );
+    CU_ASSERT_TRUE( t2 >= NSEC_FROM_MSEC( 450 ) );
+    CU_ASSERT_TRUE( t2 < NSEC_FROM_MSEC( 1000 ) );
+
+    t2 = _timedWaitAcrossJump( 60 * 60, 100, TRUE );
+    CU_ASSERT_TRUE( t2 >= NSEC_FROM_MSEC( 450 ) );
+    CU_ASSERT_TRUE( t2 < NSEC_FROM_MSEC( 1000 ) );
+
+    t2 = _timedWaitAcrossJump( -60 * 60, 1000, TRUE );
+    CU_ASSERT_TRUE( t2 >= NSEC_FROM_MSEC( 450 ) );
+    CU_ASSERT_TRUE( t2 < NSEC_FROM_MSEC( 1000 ) );
+
+    // Elapsed time follows the monotonic source only.
+    g_mockMonotonicNs = NSEC_FROM_SEC( 42 );
+    rpal_time_setSources( NULL, _manualMonotonicClock );
+    CU_ASSERT_EQUAL( rpal_time_getMonotonicNs(), NSEC_FROM_SEC( 42 ) );
+    start = rpal_time_getMilliSeconds();
+    CU_ASSERT_EQUAL( rpal_time_elapsedMilliSeconds( start ), 0 );
+    g_mockMonotonicNs += NSEC_FROM_MSEC( 1500 );
+    CU_ASSERT_EQUAL( rpal_time_elapsedMilliSeconds( start ), 1500 );
+
+    rpal_time_setSources( NULL, NULL );
+    CU_ASSERT_NOT_EQUAL( rpal_time_getMonotonicNs(), NSEC_FROM_SEC( 42 ) + NSEC_FROM_MSEC( 1500 ) );
+}
+
 void test_handleManager(void)
 {
     RU32 dummy1 = 42;
@@ -372,26 +552,163 @@ void test_dir(void)
     rDir_close( hDir );
 }
 
-void test_crawler(void)
+static RBOOL _createCrawlFile( RPNCHAR path )
 {
+    RBOOL isCreated = FALSE;
+    rFile hFile = NULL;
+    RU8 data[] = { 0x41, 0x42, 0x43, 0x44 };
+
+    if( rFile_open( path, &hFile, RPAL_FILE_OPEN_ALWAYS | RPAL_FILE_OPEN_WRITE ) )
+    {
+        isCreated = rFile_write( hFile, sizeof( data ), data );
+        rFile_close( hFile );
+    }
+
+    return isCreated;
+}
+
+static RU32 _countCrawl( RPNCHAR root, RPNCHAR fileExp[], RU32 depth, rDirCrawlOptions* pOptions, RU32* pNDirs )
+{
+    RU32 nFiles = 0;
     rDirCrawl hCrawl = NULL;
     rFileInfo info = {0};
+
+    *pNDirs = 0;
+
+    if( NULL != ( hCrawl = rpal_file_crawlStartEx( root, fileExp, depth, pOptions ) ) )
+    {
+        while( rpal_file_crawlNextFile( hCrawl, &info ) )
+        {
+            CU_ASSERT_PTR_NOT_EQUAL( info.fileName, NULL );
+            CU_ASSERT_EQUAL( info.fileName, info.filePath + rpal_string_strlen( info.filePath ) - rpal_string_strlen( info.fileName ) );
+
+            if( IS_FLAG_ENABLED( info.attributes, RPAL_FILE_ATTRIBUTE_DIRECTORY ) )
+            {
+                ( *pNDirs )++;
+            }
+            else
+            {
+                nFiles++;
+
+                if( NULL == pOptions ||
+                    !IS_FLAG_ENABLED( pOptions->flags, RPAL_FILE_CRAWL_NO_METADATA ) )
+                {
+                    CU_ASSERT_EQUAL( info.size, 4 );
+                    CU_ASSERT_NOT_EQUAL( info.modificationTime, 0 );
+                }
+            }
+        }
+
+        rpal_file_crawlStop( hCrawl );
+    }
+
+    return nFiles;
+}
+
+void test_crawler(void)
+{
+    RU32 i = 0;
+    RU32 j = 0;
+    RU32 nDirs = 0;
+    RNCHAR path[ RPAL_MAX_PATH ] = {0};
+    RNCHAR subDir[] = _NC( "./tmp_crawl_dir/sub0" );
+    RNCHAR fileName[] = _NC( "/file0" );
+    RPNCHAR root = _NC( "./tmp_crawl_dir" );
+    RPNCHAR allFiles[] = { _NC( "*" ), NULL };
+    RPNCHAR txtFiles[] = { _NC( "*.txt" ), NULL };
 #ifdef RPAL_PLATFORM_WINDOWS
-    RPWCHAR fileArr[] = { _WCH("*.dll"), _WCH("*.exe"), NULL };
-    hCrawl = rpal_file_crawlStart( _WCH("C:\\test\\"), fileArr, 2 );
-#elif defined( RPAL_PLATFORM_LINUX ) || defined( RPAL_PLATFORM_MACOSX )
-    RPNCHAR fileArr[] = { _NC("*.pub"), _NC("*.txt"), NULL };
-    hCrawl = rpal_file_crawlStart( _NC("/home/server/"), fileArr, 2 );
+    RPNCHAR pruned[] = { _NC( "*\\sub3" ), NULL };
+#else
+    RPNCHAR pruned[] = { _NC( "*/sub3" ), NULL };
 #endif
+    rDirCrawlOptions options = {0};
+    rDirCrawl hCrawl = NULL;
+    rFileInfo info = {0};
+
+    // Build a small tree: 4 sub directories with 2 levels each, and files
+    // with two different extensions at every level.
+    CU_ASSERT_TRUE_FATAL( rDir_create( root ) );
+    for( i = 0; i < 4; i++ )
+    {
+        subDir[ 19 ] = (RNCHAR)( _NC( '0' ) + i );
+        CU_ASSERT_TRUE_FATAL( rDir_create( subDir ) );
+        rpal_string_strcpy( path, subDir );
+        rpal_string_strcat( path, _NC( "/deep" ) );
+        CU_ASSERT_TRUE_FATAL( rDir_create( path ) );
+
+        for( j = 0; j < 5; j++ )
+        {
+            fileName[ 5 ] = (RNCHAR)( _NC( '0' ) + j );
+
+            rpal_string_strcpy( path, subDir );
+            rpal_string_strcat( path, fileName );
+            rpal_string_strcat( path, _NC( ".txt" ) );
+            CU_ASSERT_TRUE_FATAL( _createCrawlFile( path ) );
+
+            rpal_string_strcpy( path, subDir );
+            rpal_string_strcat( path, fileName );
+            rpal_string_strcat( path, _NC( ".bin" ) );
+            CU_ASSERT_TRUE_FATAL( _createCrawlFile( path ) );
+
+            rpal_string_strcpy( path, subDir );
+            rpal_string_strcat( path, _NC( "/deep" ) );
+            rpal_string_strcat( path, fileName );
+            rpal_string_strcat( path, _NC( ".txt" ) );
+            CU_ASSERT_TRUE_FATAL( _createCrawlFile( path ) );
+        }
+    }
+    CU_ASSERT_TRUE_FATAL( _createCrawlFile( _NC( "./tmp_crawl_dir/top.txt" ) ) );
+
+    // Original iterator API, synchronous.
+    hCrawl = rpal_file_crawlStart( root, txtFiles, 2 );
     CU_ASSERT_PTR_NOT_EQUAL_FATAL( hCrawl, NULL );
-    
+    i = 0;
     while( rpal_file_crawlNextFile( hCrawl, &info ) )
     {
-        rpal_debug_info( "FILE" );
-        printf( RF_STR_A "\n", info.filePath );
+        CU_ASSERT_TRUE( rpal_string_match( _NC( "*.txt" ), info.fileName, TRUE ) );
+        i++;
     }
-    
     rpal_file_crawlStop( hCrawl );
+    CU_ASSERT_EQUAL( i, 41 );
+
+    // Depth limits are respected.
+    CU_ASSERT_EQUAL( _countCrawl( root, txtFiles, 0, NULL, &nDirs ), 1 );
+    CU_ASSERT_EQUAL( _countCrawl( root, txtFiles, 1, NULL, &nDirs ), 41 );
+    CU_ASSERT_EQUAL( _countCrawl( root, allFiles, 2, NULL, &nDirs ), 61 );
+    CU_ASSERT_EQUAL( nDirs, 8 );
+
+    // Worker threads produce the same results.
+    options.nThreads = 4;
+    CU_ASSERT_EQUAL( _countCrawl( root, allFiles, 2, &options, &nDirs ), 61 );
+    CU_ASSERT_EQUAL( nDirs, 8 );
+    CU_ASSERT_EQUAL( _countCrawl( root, txtFiles, 2, &options, &nDirs ), 41 );
+
+    // Names only, no metadata.
+    options.flags = RPAL_FILE_CRAWL_NO_METADATA | RPAL_FILE_CRAWL_SAME_DEVICE;
+    CU_ASSERT_EQUAL( _countCrawl( root, allFiles, 2, &options, &nDirs ), 61 );
+    CU_ASSERT_EQUAL( nDirs, 8 );
+
+    // Pruned directories are reported but not descended.
+    options.flags = 0;
+    options.pruneExpr = pruned;
+    CU_ASSERT_EQUAL( _countCrawl( root, allFiles, 2, &options, &nDirs ), 46 );
+    CU_ASSERT_EQUAL( nDirs, 7 );
+    options.nThreads = 0;
+    CU_ASSERT_EQUAL( _countCrawl( root, allFiles, 2, &options, &nDirs ), 46 );
+    CU_ASSERT_EQUAL( nDirs, 7 );
+
+    // Stopping early with workers still listing.
+    options.nThreads = 2;
+    options.pruneExpr = NULL;
+    hCrawl = rpal_file_crawlStartEx( root, allFiles, 2, &options );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( hCrawl, NULL );
+    CU_ASSERT_TRUE( rpal_file_crawlNextFile( hCrawl, &info ) );
+    rpal_file_crawlStop( hCrawl );
+
+    // A missing root yields an empty crawl.
+    CU_ASSERT_EQUAL( _countCrawl( _NC( "./tmp_crawl_dir_missing" ), allFiles, 2, &options, &nDirs ), 0 );
+
+    CU_ASSERT_TRUE( rpal_file_delete( root, FALSE ) );
 }
 
 
@@ -435,6 +752,159 @@ void test_file(void)
 }
 
 
+typedef struct
+{
+    rpal_string_span spans[ 64 ];
+    RU32 nSpans;
+} _SpanCollector;
+
+static RBOOL _collectSpan( _SpanCollector* ctx, RPU8 pBuff, rpal_string_span* span )
+{
+    UNREFERENCED_PARAMETER( pBuff );
+
+    if( ARRAY_N_ELEM( ctx->spans ) > ctx->nSpans )
+    {
+        ctx->spans[ ctx->nSpans ] = *span;
+        ctx->nSpans++;
+    }
+
+    return TRUE;
+}
+
+static RBOOL _countSpans( RU32* pCount, RPU8 pBuff, rpal_string_span* span )
+{
+    UNREFERENCED_PARAMETER( pBuff );
+    UNREFERENCED_PARAMETER( span );
+    ( *pCount )++;
+    return TRUE;
+}
+
+// Straight byte by byte reference implementation.
+static RU32 _countSpansReference( RPU8 pBuff, RU32 size, RU32 minLength, RU32 maxLength )
+{
+    RU32 n = 0;
+    RU32 i = 0;
+    RU32 runStart = 0;
+    RBOOL isInRun = FALSE;
+    RBOOL isPrint = FALSE;
+
+    for( i = 0; i < size; i++ )
+    {
+        isPrint = ( 0x20 <= pBuff[ i ] && 0x7E >= pBuff[ i ] );
+        if( !isInRun && isPrint )
+        {
+            isInRun = TRUE;
+            runStart = i;
+        }
+        else if( isInRun && !isPrint )
+        {
+            isInRun = FALSE;
+            if( i - runStart >= minLength && i - runStart <= maxLength )
+            {
+                n++;
+            }
+        }
+    }
+
+    isInRun = FALSE;
+    for( i = 0; i + 1 < size; i += 2 )
+    {
+        isPrint = ( 0x20 <= pBuff[ i ] && 0x7E >= pBuff[ i ] && 0 == pBuff[ i + 1 ] );
+        if( !isInRun && isPrint )
+        {
+            isInRun = TRUE;
+            runStart = i;
+        }
+        else if( isInRun && !isPrint )
+        {
+            isInRun = FALSE;
+            if( ( i - runStart ) / 2 >= minLength && ( i - runStart ) / 2 <= maxLength )
+            {
+                n++;
+            }
+        }
+    }
+
+    return n;
+}
+
+void test_stringExtract( void )
+{
+    RU8 buff[ 300 ] = { 0 };
+    RU8 asciiStr[] = "hello world";
+    RU8 wideStr[] = { 'a', 0, 'b', 0, 'c', 0, 'd', 0, 'e', 0, 'f', 0, 0, 0 };
+    _SpanCollector collector = { 0 };
+    RU32 i = 0;
+    RU32 j = 0;
+    RU32 count = 0;
+    RPU8 randBuff = NULL;
+    RU32 randSize = 0;
+
+    // ASCII string straddling a block boundary and a UTF-16LE string
+    // at an odd offset which should not be seen as UTF-16LE.
+    rpal_memory_memcpy( buff + 60, asciiStr, sizeof( asciiStr ) );
+    rpal_memory_memcpy( buff + 130, wideStr, sizeof( wideStr ) );
+    rpal_memory_memcpy( buff + 201, wideStr, sizeof( wideStr ) );
+    // Unterminated run at the end of the buffer is not reported.
+    for( i = sizeof( buff ) - 10; i < sizeof( buff ); i++ )
+    {
+        buff[ i ] = 'x';
+    }
+
+    CU_ASSERT_TRUE( rpal_string_extractSpans( buff, 
+                                              sizeof( buff ), 
+                                              RPAL_STRING_EXTRACT_ASCII | RPAL_STRING_EXTRACT_UTF16LE, 
+                                              4, 
+                                              128, 
+                                              (rpal_string_span_f)_collectSpan, 
+                                              &collector ) );
+    CU_ASSERT_EQUAL_FATAL( collector.nSpans, 2 );
+    CU_ASSERT_EQUAL( collector.spans[ 0 ].encoding, RPAL_STRING_EXTRACT_ASCII );
+    CU_ASSERT_EQUAL( collector.spans[ 0 ].offset, 60 );
+    CU_ASSERT_EQUAL( collector.spans[ 0 ].length, sizeof( asciiStr ) - 1 );
+    CU_ASSERT_EQUAL( collector.spans[ 1 ].encoding, RPAL_STRING_EXTRACT_UTF16LE );
+    CU_ASSERT_EQUAL( collector.spans[ 1 ].offset, 130 );
+    CU_ASSERT_EQUAL( collector.spans[ 1 ].length, 6 );
+
+    collector.nSpans = 0;
+    CU_ASSERT_TRUE( rpal_string_extractSpans( buff, 
+                                              sizeof( buff ), 
+                                              RPAL_STRING_EXTRACT_ASCII, 
+                                              4, 
+                                              8, 
+                                              (rpal_string_span_f)_collectSpan, 
+                                              &collector ) );
+    CU_ASSERT_EQUAL( collector.nSpans, 0 );
+
+    // Compare against the reference on random printable-heavy buffers of all sizes.
+    randBuff = rpal_memory_alloc( 4096 );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( randBuff, NULL );
+    for( i = 0; i < 200; i++ )
+    {
+        randSize = ( rpal_rand() % 4096 ) + 1;
+        for( j = 0; j < randSize; j++ )
+        {
+            switch( rpal_rand() % 4 )
+            {
+                case 0: randBuff[ j ] = 0; break;
+                case 1: randBuff[ j ] = (RU8)rpal_rand(); break;
+                default: randBuff[ j ] = 'a' + ( rpal_rand() % 26 ); break;
+            }
+        }
+
+        count = 0;
+        rpal_string_extractSpans( randBuff, 
+                                  randSize, 
+                                  RPAL_STRING_EXTRACT_ASCII | RPAL_STRING_EXTRACT_UTF16LE, 
+                                  2, 
+                                  10, 
+                                  (rpal_string_span_f)_countSpans, 
+                                  &count );
+        CU_ASSERT_EQUAL( count, _countSpansReference( randBuff, randSize, 2, 10 ) );
+    }
+    rpal_memory_free( randBuff );
+}
+
 void test_bloom( void )
 {
     rBloom b = NULL;
@@ -905,6 +1375,171 @@ void test_btree( void )
 }
 
 
+#define _LOG_TEST_THREADS   4
+#define _LOG_TEST_RECORDS   30
+
+RPRIVATE
+RU32
+    _countInLog
+    (
+        RPNCHAR path,
+        RPCHAR needle
+    )
+{
+    RU32 count = 0;
+    RPVOID buffer = NULL;
+    RU32 bufferSize = 0;
+    RPCHAR content = NULL;
+    RPCHAR cur = NULL;
+
+    if( rpal_file_read( path, &buffer, &bufferSize, FALSE ) )
+    {
+        if( NULL != ( content = rpal_memory_alloc( bufferSize + 1 ) ) )
+        {
+            rpal_memory_memcpy( content, buffer, bufferSize );
+            content[ bufferSize ] = 0;
+
+            cur = content;
+            while( NULL != ( cur = strstr( cur, needle ) ) )
+            {
+                count++;
+                cur++;
+            }
+
+            rpal_memory_free( content );
+        }
+
+        rpal_memory_free( buffer );
+    }
+
+    return count;
+}
+
+RPRIVATE
+RU32
+    RPAL_THREAD_FUNC _logTestThread
+    (
+        RPVOID ctx
+    )
+{
+    RU32 threadId = (RU32)(RSIZET)ctx;
+    RU32 i = 0;
+
+    for( i = 0; i < _LOG_TEST_RECORDS; i++ )
+    {
+        rpal_debug_info( "thread %d record %02d", threadId, i );
+    }
+
+    return 0;
+}
+
+void test_logging(void)
+{
+    RPNCHAR logDir = _NC( "./tmp_log_dir" );
+    RPNCHAR logFile = _NC( "./tmp_log_dir/test.log" );
+    RPNCHAR rotated1 = _NC( "./tmp_log_dir/test.log.1" );
+    RPNCHAR rotated2 = _NC( "./tmp_log_dir/test.log.2" );
+    RPNCHAR rotated3 = _NC( "./tmp_log_dir/test.log.3" );
+    RPCHAR tmpStr = NULL;
+    rThread threads[ _LOG_TEST_THREADS ] = { 0 };
+    RCHAR needle[ 64 ] = { 0 };
+    RU32 i = 0;
+    RU32 j = 0;
+    RU32 nLines = 0;
+
+    rpal_file_delete( logDir, FALSE );
+    CU_ASSERT_TRUE_FATAL( rDir_create( logDir ) );
+    CU_ASSERT_TRUE_FATAL( rpal_log_start( logFile, 1024 * 1024, 3 ) );
+    rpal_log_setRateLimit( 0 );
+
+    // Arguments are copied when logging, not when writing.
+    tmpStr = rpal_string_strdupA( "transient" );
+    rpal_debug_info( "args %d %s " RF_U64 " %.2f %x %%", -42, tmpStr, (RU64)1 << 40, 1.5, 0xBEEF );
+    rpal_memory_free( tmpStr );
+    rpal_debug_info( "missing %s", NULL );
+
+    // Per-file levels override the global one.
+    CU_ASSERT_TRUE( rpal_log_setFileLevel( "main.c", RPAL_LOG_LEVEL_ERROR ) );
+    rpal_debug_info( "dropped info" );
+    rpal_debug_error( "kept error" );
+    CU_ASSERT_TRUE( rpal_log_setFileLevel( "main.c", RPAL_LOG_LEVEL_DEFAULT ) );
+    rpal_log_setLevel( RPAL_LOG_LEVEL_WARNING );
+    rpal_debug_info( "dropped info" );
+    rpal_log_setLevel( RPAL_LOG_DEFAULT_LEVEL );
+    rpal_debug_info( "kept info" );
+
+    // A call site over its rate is suppressed until the next second.
+    rpal_log_setRateLimit( 5 );
+    for( i = 0; i < 21; i++ )
+    {
+        if( 20 == i )
+        {
+            rpal_thread_sleep( MSEC_FROM_SEC( 1 ) + 100 );
+        }
+        rpal_debug_warning( "rate limited" );
+    }
+    rpal_log_setRateLimit( 0 );
+
+    for( i = 0; i < ARRAY_N_ELEM( threads ); i++ )
+    {
+        threads[ i ] = rpal_thread_new( _logTestThread, (RPVOID)(RSIZET)i );
+        CU_ASSERT_PTR_NOT_EQUAL( threads[ i ], NULL );
+    }
+    for( i = 0; i < ARRAY_N_ELEM( threads ); i++ )
+    {
+        rpal_thread_wait( threads[ i ], RINFINITE );
+        rpal_thread_free( threads[ i ] );
+    }
+
+    rpal_log_flush();
+
+    CU_ASSERT_EQUAL( _countInLog( logFile, "args -42 transient 1099511627776 1.50 beef %" ), 1 );
+    CU_ASSERT_EQUAL( _countInLog( logFile, "missing (null)" ), 1 );
+    CU_ASSERT_EQUAL( _countInLog( logFile, "dropped info" ), 0 );
+    CU_ASSERT_EQUAL( _countInLog( logFile, "kept error" ), 1 );
+    CU_ASSERT_EQUAL( _countInLog( logFile, "kept info" ), 1 );
+    nLines = _countInLog( logFile, "rate limited" );
+    CU_ASSERT_TRUE( 6 <= nLines && 11 >= nLines );
+    CU_ASSERT_TRUE( 1 <= _countInLog( logFile, "suppressed]" ) );
+
+    for( i = 0; i < _LOG_TEST_THREADS; i++ )
+    {
+        for( j = 0; j < _LOG_TEST_RECORDS; j++ )
+        {
+            rpal_string_snprintf( needle, sizeof( needle ), "thread %d record %02d\n", i, j );
+            CU_ASSERT_EQUAL( _countInLog( logFile, needle ), 1 );
+        }
+    }
+
+    rpal_log_stop();
+
+    // Rotation keeps at most 3 files of at most the maximum size each.
+    CU_ASSERT_TRUE_FATAL( rpal_log_start( logFile, 4096, 3 ) );
+    for( i = 0; i < 200; i++ )
+    {
+        rpal_debug_info( "filling the log file with record %d", i );
+        if( 0 == i % 20 )
+        {
+            rpal_log_flush();
+        }
+    }
+    rpal_log_stop();
+
+    CU_ASSERT_TRUE( 4096 >= rpal_file_getSize( logFile, FALSE ) );
+    CU_ASSERT_TRUE( 4096 >= rpal_file_getSize( rotated1, FALSE ) );
+    CU_ASSERT_TRUE( 0 != rpal_file_getSize( rotated2, FALSE ) );
+    CU_ASSERT_TRUE( 4096 >= rpal_file_getSize( rotated2, FALSE ) );
+    CU_ASSERT_EQUAL( rpal_file_getSize( rotated3, FALSE ), (RU32)( -1 ) );
+    CU_ASSERT_EQUAL( _countInLog( logFile, "record 199\n" ), 1 );
+
+    // Once stopped, logging is synchronous again.
+    rpal_debug_info( "logged after stop" );
+    CU_ASSERT_EQUAL( _countInLog( logFile, "logged after stop" ), 0 );
+
+    rpal_file_delete( logDir, FALSE );
+}
+
+
 int
     main
     (
@@ -927,6 +1562,7 @@ int
             if( NULL != ( suite = CU_add_suite( "rpal", NULL, NULL ) ) )
             {
                 if( NULL == CU_add_test( suite, "events", test_events ) ||
+                    NULL == CU_add_test( suite, "monotonicTime", test_monotonicTime ) ||
                     NULL == CU_add_test( suite, "handleManager", test_handleManager ) ||
                     NULL == CU_add_test( suite, "strings", test_strings ) ||
                     NULL == CU_add_test( suite, "blob", test_blob ) ||
@@ -939,9 +1575,11 @@ int
                     NULL == CU_add_test( suite, "crawl", test_crawler ) ||
                     NULL == CU_add_test( suite, "file", test_file ) ||
                     NULL == CU_add_test( suite, "bloom", test_bloom ) ||
+                    NULL == CU_add_test( suite, "stringExtract", test_stringExtract ) ||
                     NULL == CU_add_test( suite, "btree", test_btree ) ||
                     NULL == CU_add_test( suite, "threadpool", test_threadpool ) ||
                     NULL == CU_add_test( suite, "sortsearch", test_sortsearch ) ||
+                    NULL == CU_add_test( suite, "logging", test_logging ) ||
                     NULL == CU_add_test( suite, "memoryLeaks", test_memoryLeaks ) )
                 {
                     rpal_debug_error( "%s", CU_get_error_msg() );
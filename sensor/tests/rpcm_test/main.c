@@ -247,6 +247,33 @@ void test_SerialiseAndDeserialise(void)
 
         rpal_memory_free( garbage );
     }
+
+    // An empty variable element, as sent by the cloud, ends the buffer exactly
+    // and the buffer must not need to extend past it. We can't add one here so
+    // the trailing 1 byte buffer gets its size patched to 0 and its data cut.
+    seq = rSequence_new();
+    blob = rpal_blob_create( 0, 0 );
+    CU_ASSERT_FATAL( NULL != seq );
+    CU_ASSERT_FATAL( NULL != blob );
+    CU_ASSERT_TRUE( rSequence_addRU8( seq, 42, 10 ) );
+    CU_ASSERT_TRUE( rSequence_addBUFFER( seq, 43, (RPU8)"x", 1 ) );
+    CU_ASSERT_TRUE_FATAL( rSequence_serialise( seq, blob ) );
+    rSequence_free( seq );
+    seq = NULL;
+
+    size = rpal_blob_getSize( blob ) - 1;
+    rpal_memory_zero( (RPU8)rpal_blob_getBuffer( blob ) + size - sizeof( RU32 ), sizeof( RU32 ) );
+
+    CU_ASSERT_TRUE( rSequence_deserialise( &seq, (RPU8)rpal_blob_getBuffer( blob ), size, &consumed ) );
+    CU_ASSERT_EQUAL( consumed, size );
+    CU_ASSERT_TRUE( rSequence_getBUFFER( seq, 43, (RPU8*)&ptr, &count ) );
+    CU_ASSERT_EQUAL( count, 0 );
+    rSequence_free( seq );
+    seq = NULL;
+
+    CU_ASSERT_FALSE( rSequence_deserialise( &seq, (RPU8)rpal_blob_getBuffer( blob ), size - 1, &consumed ) );
+    CU_ASSERT_EQUAL( seq, NULL );
+    rpal_blob_free( blob );
 }
 
 
@@ -477,6 +504,137 @@ void test_EstimateSize( void )
     rSequence_free( seq );
 }
 
+void test_transient( void )
+{
+    rSequence seq = NULL;
+    rSequence kept = NULL;
+    rSequence dup = NULL;
+    rSequence tmpSeq = NULL;
+    rList list = NULL;
+    RPVOID firstAddr = NULL;
+    RU8 bigBuffer[ 1024 ] = { 0 };
+    RPU8 tmpBuffer = NULL;
+    RU32 tmpSize = 0;
+    RU32 tmp32 = 0;
+    RU32 i = 0;
+
+    // Nothing changes before the init.
+    rpcm_transient_begin();
+    seq = rSequence_new();
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( seq, NULL );
+    CU_ASSERT_FALSE( rpal_memory_isFromArena( seq ) );
+    rSequence_free( seq );
+    rpcm_transient_end();
+
+    CU_ASSERT_TRUE_FATAL( rpcm_transient_init() );
+
+    // A root rpal that predates arenas could not free from them, the scope
+    // falls back to the heap.
+    g_rpal_context->version = RPAL_VERSION_1;
+    CU_ASSERT_PTR_EQUAL( rpal_memory_arena_create( 1024 ), NULL );
+    rpcm_transient_begin();
+    seq = rSequence_new();
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( seq, NULL );
+    CU_ASSERT_FALSE( rpal_memory_isFromArena( seq ) );
+    rSequence_free( seq );
+    rpcm_transient_end();
+    g_rpal_context->version = RPAL_VERSION_CURRENT;
+
+    // Sets built in a scope come from the arena, nested ones included.
+    rpcm_transient_begin();
+    seq = rSequence_new();
+    list = rList_new( 1, RPCM_RU32 );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( seq, NULL );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( list, NULL );
+    CU_ASSERT_TRUE( rpal_memory_isFromArena( seq ) );
+    CU_ASSERT_TRUE( rpal_memory_isFromArena( list ) );
+    firstAddr = seq;
+
+    CU_ASSERT_TRUE( rList_addRU32( list, 1 ) );
+    CU_ASSERT_TRUE( rList_addRU32( list, 2 ) );
+    CU_ASSERT_TRUE( rSequence_addLIST( seq, 66, list ) );
+    CU_ASSERT_TRUE( rSequence_addSTRINGA( seq, 24, "hello" ) );
+
+    // Outgrowing the initial buffer moves it to the heap.
+    for( i = 0; i < sizeof( bigBuffer ); i++ )
+    {
+        bigBuffer[ i ] = (RU8)i;
+    }
+    CU_ASSERT_TRUE( rSequence_addBUFFER( seq, 42, bigBuffer, sizeof( bigBuffer ) ) );
+    CU_ASSERT_TRUE( rSequence_getBUFFER( seq, 42, &tmpBuffer, &tmpSize ) );
+    CU_ASSERT_EQUAL( tmpSize, sizeof( bigBuffer ) );
+    CU_ASSERT_TRUE( 0 == rpal_memory_memcmp( tmpBuffer, bigBuffer, sizeof( bigBuffer ) ) );
+
+    // Duplicates, like the ones queued for subscribers, are on the heap.
+    dup = rSequence_duplicate( seq );
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( dup, NULL );
+    CU_ASSERT_FALSE( rpal_memory_isFromArena( dup ) );
+
+    // Scopes nest, the arena is only reset by the outer one.
+    rpcm_transient_begin();
+    kept = rSequence_new();
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( kept, NULL );
+    CU_ASSERT_TRUE( rSequence_addRU32( kept, 1, 0xDEADBEEF ) );
+    rpcm_transient_end();
+    CU_ASSERT_TRUE( rpal_memory_isFromArena( kept ) );
+
+    rSequence_free( seq );
+    rpcm_transient_end();
+
+    seq = rSequence_new();
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( seq, NULL );
+    CU_ASSERT_FALSE( rpal_memory_isFromArena( seq ) );
+    rSequence_free( seq );
+
+    // A set outliving its scope stays valid and its chunk is not reused.
+    rpcm_transient_begin();
+    seq = rSequence_new();
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( seq, NULL );
+    CU_ASSERT_TRUE( rpal_memory_isFromArena( seq ) );
+    CU_ASSERT_PTR_NOT_EQUAL( seq, firstAddr );
+    CU_ASSERT_TRUE( rSequence_addRU32( seq, 1, 42 ) );
+    rpcm_transient_end();
+
+    CU_ASSERT_TRUE( rpal_memory_isValid( kept ) );
+    CU_ASSERT_TRUE( rSequence_getRU32( kept, 1, &tmp32 ) );
+    CU_ASSERT_EQUAL( tmp32, 0xDEADBEEF );
+    CU_ASSERT_TRUE( rSequence_getRU32( seq, 1, &tmp32 ) );
+    CU_ASSERT_EQUAL( tmp32, 42 );
+    rSequence_free( kept );
+    rSequence_free( seq );
+
+    // With nothing left alive the arena is rewound.
+    rpcm_transient_begin();
+    firstAddr = rSequence_new();
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( firstAddr, NULL );
+    rSequence_free( firstAddr );
+    rpcm_transient_end();
+
+    rpcm_transient_begin();
+    seq = rSequence_new();
+    CU_ASSERT_PTR_EQUAL( seq, firstAddr );
+    rSequence_free( seq );
+    rpcm_transient_end();
+
+    CU_ASSERT_TRUE( rSequence_getLIST( dup, 66, &list ) );
+    CU_ASSERT_TRUE( rSequence_getBUFFER( dup, 42, &tmpBuffer, &tmpSize ) );
+    CU_ASSERT_TRUE( 0 == rpal_memory_memcmp( tmpBuffer, bigBuffer, sizeof( bigBuffer ) ) );
+
+    // A set retained past the deinit keeps working.
+    rpcm_transient_begin();
+    kept = rSequence_new();
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL( kept, NULL );
+    tmpSeq = rSequence_new();
+    CU_ASSERT_TRUE( rSequence_addSEQUENCE( kept, 2, tmpSeq ) );
+    rpcm_transient_end();
+
+    rpcm_transient_deinit();
+
+    CU_ASSERT_TRUE( rSequence_addRU32( tmpSeq, 1, 7 ) );
+    rSequence_free( kept );
+    rSequence_free( dup );
+}
+
 int
     main
     (
@@ -506,6 +664,7 @@ int
                     NULL == CU_add_test( suite, "isEqual", test_isEqual ) ||
                     NULL == CU_add_test( suite, "complex", test_complex ) ||
                     NULL == CU_add_test( suite, "estimateSize", test_EstimateSize ) ||
+                    NULL == CU_add_test( suite, "transient", test_transient ) ||
                     NULL == CU_add_test( suite, "memoryLeaks", test_memoryLeaks ) )
                 {
                     rpal_debug_error( "%s", CU_get_error_msg() );
@@ -0,0 +1,472 @@
+# Copyright 2015 refractionPOINT
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Trains a preset deflate dictionary for HCP frames.
+#
+# The dictionary is compiled into every sensor, so it must never be trained on
+# anything that identifies a host or its users. By default it is trained on
+# synthetic frames generated here from generic values. Frames recorded from a
+# real sensor (built with HCP_RECORD_FRAMES defined, each uncompressed frame
+# written as a single file in ./hcp_frames/) can be used instead with --frames,
+# they are scrubbed again here before training, see scrubFrame().
+#
+# Usage: train_frame_dictionary.py version [--frames framesDir] [--synthetic nFrames] [--size dictSize]
+#
+# This generates sensor/lib/rpHostCommonPlatformLib/frameDictionary_v<version>.h
+# which then needs to be added to the dictionary table in beacon.c. A version
+# must never be changed once shipped, the cloud uses it to pick the dictionary.
+#
+# One frame in five is held out of the training and used to report the
+# compression ratio and speed with and without the dictionary (needs python 3).
+
+import os
+import sys
+import json
+import zlib
+import time
+import heapq
+import random
+import struct
+import argparse
+import collections
+
+rootDir = os.path.abspath( os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), '..' ) )
+
+# Deflate can only reference the last 32KB.
+MAX_DICT_SIZE = 32 * 1024
+KGRAM_SIZE = 8
+SEGMENT_SIZE = 64
+HOLD_OUT_EVERY = 5
+SYNTHETIC_SEED = 42
+DEFAULT_SYNTHETIC_FRAMES = 2000
+
+# rpcm wire format, see set_serialise() in librpcm.c.
+RPCM_RU8 = 0x01
+RPCM_RU16 = 0x02
+RPCM_RU32 = 0x03
+RPCM_RU64 = 0x04
+RPCM_STRINGA = 0x05
+RPCM_STRINGW = 0x06
+RPCM_BUFFER = 0x07
+RPCM_TIMESTAMP = 0x08
+RPCM_IPV4 = 0x09
+RPCM_IPV6 = 0x0A
+RPCM_POINTER_32 = 0x0B
+RPCM_POINTER_64 = 0x0C
+RPCM_TIMEDELTA = 0x0D
+RPCM_DOUBLE = 0x0E
+RPCM_SEQUENCE = 0x81
+RPCM_LIST = 0x82
+
+FIXED_SIZES = { RPCM_RU8 : 1, RPCM_RU16 : 2, RPCM_RU32 : 4, RPCM_RU64 : 8, RPCM_TIMESTAMP : 8,
+                RPCM_IPV4 : 4, RPCM_IPV6 : 16, RPCM_POINTER_32 : 4, RPCM_POINTER_64 : 8,
+                RPCM_TIMEDELTA : 8, RPCM_DOUBLE : 8 }
+FIXED_FORMATS = { 1 : '>B', 2 : '>H', 4 : '>I', 8 : '>Q' }
+VARIABLE_TYPES = ( RPCM_STRINGA, RPCM_STRINGW, RPCM_BUFFER )
+
+# Keep in sync with scrubRecordedSet() in beacon.c. Values of these tags are
+# blanked, as are all buffers, and any string is blanked from the first of
+# the path prefixes on.
+SCRUBBED_TAGS = ( 'HOST_NAME', 'COMMAND_LINE', 'USER_NAME', 'ENVIRONMENT_VARIABLE',
+                  'DOMAIN_NAME', 'CNAME', 'REMOTE_HOST', 'STRING' )
+SCRUBBED_PATH_PREFIXES = ( b'/home/', b'/root', b'/users/', b'\\users\\',
+                           b'\\documents and settings\\', b'/tmp/', b'/var/tmp/', b'\\temp\\' )
+SCRUB_FILLER = b'x'
+
+def loadTags():
+    with open( os.path.join( rootDir, 'meta_headers', 'rp_hcp_tags.json' ), 'r' ) as f:
+        definitions = json.load( f )
+    tags = {}
+    for group in definitions[ 'groups' ]:
+        for definition in group[ 'definitions' ]:
+            tags[ definition[ 'name' ] ] = definition[ 'value' ]
+    return tags
+
+TAGS = loadTags()
+
+# Elements are ( tag, type, value ) where a list's value is ( elemTag, elemType, elements ).
+def decodeSet( data, offset ):
+    nElements = struct.unpack_from( '>I', data, offset )[ 0 ]
+    offset += 4
+    elements = []
+    for i in range( nElements ):
+        tag, elemType = struct.unpack_from( '>IB', data, offset )
+        offset += 5
+        if elemType in FIXED_SIZES:
+            size = FIXED_SIZES[ elemType ]
+            if size in FIXED_FORMATS:
+                value = struct.unpack_from( FIXED_FORMATS[ size ], data, offset )[ 0 ]
+            else:
+                value = bytes( data[ offset : offset + size ] )
+            offset += size
+        elif elemType in VARIABLE_TYPES:
+            size = struct.unpack_from( '>I', data, offset )[ 0 ]
+            offset += 4
+            value = bytes( data[ offset : offset + size ] )
+            if len( value ) != size:
+                raise ValueError( 'truncated element' )
+            offset += size
+        elif RPCM_SEQUENCE == elemType:
+            value, offset = decodeSet( data, offset )
+        elif RPCM_LIST == elemType:
+            listTag, listType = struct.unpack_from( '>IB', data, offset )
+            offset += 5
+            listElements, offset = decodeSet( data, offset )
+            value = ( listTag, listType, listElements )
+        else:
+            raise ValueError( 'unknown type 0x%x' % elemType )
+        elements.append( ( tag, elemType, value ) )
+    return elements, offset
+
+def encodeSet( elements ):
+    out = [ struct.pack( '>I', len( elements ) ) ]
+    for tag, elemType, value in elements:
+        out.append( struct.pack( '>IB', tag, elemType ) )
+        if elemType in FIXED_SIZES:
+            size = FIXED_SIZES[ elemType ]
+            if size in FIXED_FORMATS:
+                out.append( struct.pack( FIXED_FORMATS[ size ], value ) )
+            else:
+                out.append( value )
+        elif elemType in VARIABLE_TYPES:
+            out.append( struct.pack( '>I', len( value ) ) )
+            out.append( value )
+        elif RPCM_SEQUENCE == elemType:
+            out.append( encodeSet( value ) )
+        elif RPCM_LIST == elemType:
+            out.append( struct.pack( '>IB', value[ 0 ], value[ 1 ] ) )
+            out.append( encodeSet( value[ 2 ] ) )
+    return b''.join( out )
+
+# A frame is the module id followed by the serialized list of messages.
+def decodeFrame( frame ):
+    moduleId = bytearray( frame[ 0 : 1 ] )[ 0 ]
+    listTag, listType = struct.unpack_from( '>IB', frame, 1 )
+    elements, offset = decodeSet( frame, 6 )
+    if offset != len( frame ):
+        raise ValueError( 'trailing data in frame' )
+    return moduleId, ( listTag, listType, elements )
+
+def encodeFrame( moduleId, messages ):
+    return struct.pack( '>BIB', moduleId, messages[ 0 ], messages[ 1 ] ) + encodeSet( messages[ 2 ] )
+
+def blank( value, start ):
+    # Strings keep their terminator so they still look like strings.
+    end = len( value ) - 1 if value.endswith( b'\x00' ) else len( value )
+    return value[ : start ] + SCRUB_FILLER * max( 0, end - start ) + value[ end : ]
+
+def scrubValue( tag, elemType, value, scrubbedTags ):
+    if RPCM_BUFFER == elemType or tag in scrubbedTags:
+        return blank( value, 0 )
+    lowered = value.lower()
+    starts = [ lowered.find( p ) for p in SCRUBBED_PATH_PREFIXES if -1 != lowered.find( p ) ]
+    if starts:
+        return blank( value, min( starts ) )
+    return value
+
+def scrubSet( elements, scrubbedTags ):
+    scrubbed = []
+    for tag, elemType, value in elements:
+        if elemType in VARIABLE_TYPES:
+            value = scrubValue( tag, elemType, value, scrubbedTags )
+        elif RPCM_SEQUENCE == elemType:
+            value = scrubSet( value, scrubbedTags )
+        elif RPCM_LIST == elemType:
+            value = ( value[ 0 ], value[ 1 ], scrubSet( value[ 2 ], scrubbedTags ) )
+        scrubbed.append( ( tag, elemType, value ) )
+    return scrubbed
+
+def scrubFrame( frame ):
+    scrubbedTags = set( TAGS[ name ] for name in SCRUBBED_TAGS )
+    moduleId, messages = decodeFrame( frame )
+    return encodeFrame( moduleId, ( messages[ 0 ], messages[ 1 ], scrubSet( messages[ 2 ], scrubbedTags ) ) )
+
+# Generic values only, nothing here may come from a real host.
+SYNTHETIC_PLATFORMS = [
+    { 'string' : RPCM_STRINGW,
+      'users' : [ ( 18, 'NT AUTHORITY\\SYSTEM' ), ( 19, 'NT AUTHORITY\\LOCAL SERVICE' ), ( 20, 'NT AUTHORITY\\NETWORK SERVICE' ) ],
+      'processes' : [ ( 'C:\\Windows\\System32\\svchost.exe', 'C:\\Windows\\system32\\svchost.exe -k netsvcs -p' ),
+                      ( 'C:\\Windows\\System32\\svchost.exe', 'C:\\Windows\\system32\\svchost.exe -k LocalServiceNetworkRestricted -p' ),
+                      ( 'C:\\Windows\\System32\\services.exe', 'C:\\Windows\\system32\\services.exe' ),
+                      ( 'C:\\Windows\\System32\\lsass.exe', 'C:\\Windows\\system32\\lsass.exe' ),
+                      ( 'C:\\Windows\\System32\\conhost.exe', '\\??\\C:\\Windows\\system32\\conhost.exe 0xffffffff -ForceV1' ),
+                      ( 'C:\\Windows\\System32\\cmd.exe', 'C:\\Windows\\system32\\cmd.exe /c ver' ),
+                      ( 'C:\\Windows\\System32\\WindowsPowerShell\\v1.0\\powershell.exe', 'powershell.exe -NoProfile -ExecutionPolicy Bypass' ),
+                      ( 'C:\\Windows\\System32\\taskhostw.exe', 'taskhostw.exe' ),
+                      ( 'C:\\Windows\\System32\\wbem\\WmiPrvSE.exe', 'C:\\Windows\\system32\\wbem\\wmiprvse.exe -secured -Embedding' ),
+                      ( 'C:\\Program Files\\Windows Defender\\MsMpEng.exe', '"C:\\Program Files\\Windows Defender\\MsMpEng.exe"' ),
+                      ( 'C:\\Windows\\explorer.exe', 'C:\\Windows\\Explorer.EXE' ) ],
+      'modules' : [ 'C:\\Windows\\System32\\ntdll.dll', 'C:\\Windows\\System32\\kernel32.dll', 'C:\\Windows\\System32\\KERNELBASE.dll',
+                    'C:\\Windows\\System32\\user32.dll', 'C:\\Windows\\System32\\advapi32.dll', 'C:\\Windows\\System32\\msvcrt.dll',
+                    'C:\\Windows\\System32\\sechost.dll', 'C:\\Windows\\System32\\rpcrt4.dll', 'C:\\Windows\\System32\\combase.dll',
+                    'C:\\Windows\\System32\\ws2_32.dll', 'C:\\Windows\\System32\\crypt32.dll', 'C:\\Windows\\System32\\ucrtbase.dll' ],
+      'files' : [ 'C:\\Windows\\Prefetch\\SVCHOST.EXE-%08X.pf', 'C:\\Windows\\Temp\\%08x.tmp', 'C:\\ProgramData\\Microsoft\\Windows\\WER\\Temp\\%08x.xml',
+                  'C:\\Windows\\System32\\LogFiles\\WMI\\RtBackup\\EtwRT.%08x.etl' ] },
+    { 'string' : RPCM_STRINGA,
+      'users' : [ ( 0, 'root' ), ( 33, 'www-data' ), ( 104, 'systemd-resolve' ), ( 1000, 'user' ) ],
+      'processes' : [ ( '/usr/sbin/sshd', '/usr/sbin/sshd -D' ),
+                      ( '/usr/sbin/cron', '/usr/sbin/cron -f' ),
+                      ( '/usr/lib/systemd/systemd-journald', '/lib/systemd/systemd-journald' ),
+                      ( '/usr/lib/systemd/systemd-resolved', '/lib/systemd/systemd-resolved' ),
+                      ( '/usr/sbin/nginx', 'nginx: worker process' ),
+                      ( '/usr/bin/bash', '-bash' ),
+                      ( '/usr/bin/python3.10', '/usr/bin/python3 /usr/bin/unattended-upgrade' ),
+                      ( '/usr/bin/dash', '/bin/sh -c run-parts --report /etc/cron.daily' ),
+                      ( '/usr/bin/apt-get', 'apt-get update' ),
+                      ( '/usr/sbin/rsyslogd', '/usr/sbin/rsyslogd -n -iNONE' ) ],
+      'modules' : [ '/usr/lib/x86_64-linux-gnu/libc.so.6', '/usr/lib/x86_64-linux-gnu/ld-linux-x86-64.so.2',
+                    '/usr/lib/x86_64-linux-gnu/libpthread.so.0', '/usr/lib/x86_64-linux-gnu/libm.so.6',
+                    '/usr/lib/x86_64-linux-gnu/libdl.so.2', '/usr/lib/x86_64-linux-gnu/libz.so.1.2.11',
+                    '/usr/lib/x86_64-linux-gnu/libssl.so.3', '/usr/lib/x86_64-linux-gnu/libcrypto.so.3',
+                    '/usr/lib/x86_64-linux-gnu/libsystemd.so.0', '/usr/lib/x86_64-linux-gnu/libselinux.so.1' ],
+      'files' : [ '/var/log/syslog', '/var/lib/apt/lists/partial/%08x', '/run/systemd/journal/streams/8:%d',
+                  '/var/cache/apt/pkgcache.bin.%06x', '/var/lib/dpkg/updates/%04d' ] },
+    { 'string' : RPCM_STRINGA,
+      'users' : [ ( 0, 'root' ), ( 501, 'user' ), ( 65, '_mdnsresponder' ) ],
+      'processes' : [ ( '/usr/libexec/trustd', '/usr/libexec/trustd' ),
+                      ( '/usr/sbin/mDNSResponder', '/usr/sbin/mDNSResponder' ),
+                      ( '/System/Library/CoreServices/launchservicesd', '/System/Library/CoreServices/launchservicesd' ),
+                      ( '/usr/libexec/xpcproxy', 'xpcproxy com.apple.mdworker.shared' ),
+                      ( '/bin/zsh', '-zsh' ) ],
+      'modules' : [ '/usr/lib/libSystem.B.dylib', '/usr/lib/libobjc.A.dylib', '/usr/lib/libc++.1.dylib',
+                    '/System/Library/Frameworks/CoreFoundation.framework/Versions/A/CoreFoundation',
+                    '/System/Library/Frameworks/Security.framework/Versions/A/Security',
+                    '/System/Library/Frameworks/Foundation.framework/Versions/C/Foundation' ],
+      'files' : [ '/private/var/db/diagnostics/Persist/%016X.tracev3', '/private/var/folders/zz/zyxvpxvq6csfxvn_n0000000000000/C/%08x' ] } ]
+
+SYNTHETIC_DOMAINS = [ 'www.example.com', 'api.example.com', 'cdn.example.net', 'update.example.org',
+                      'time.example.com', 'mail.example.net', 'login.example.com', 'static.example.org' ]
+
+def syntheticString( platform, value ):
+    return ( platform[ 'string' ], value.encode( 'utf-8' ) + b'\x00' )
+
+def syntheticEvent( rng, platform, now ):
+    t = TAGS
+    atom = lambda: bytes( bytearray( rng.getrandbits( 8 ) for i in range( 16 ) ) )
+    common = [ ( t[ 'TIMESTAMP' ], RPCM_TIMESTAMP, now ),
+               ( t[ 'THIS_ATOM' ], RPCM_BUFFER, atom() ),
+               ( t[ 'PARENT_ATOM' ], RPCM_BUFFER, atom() ) ]
+    pid = rng.randint( 300, 65000 )
+    kind = rng.random()
+
+    if kind < 0.45:
+        userId, userName = rng.choice( platform[ 'users' ] )
+        filePath, commandLine = rng.choice( platform[ 'processes' ] )
+        stringType, filePath = syntheticString( platform, filePath )
+        stringType, commandLine = syntheticString( platform, commandLine )
+        stringType, userName = syntheticString( platform, userName )
+        info = [ ( t[ 'PROCESS_ID' ], RPCM_RU32, pid ),
+                 ( t[ 'PARENT_PROCESS_ID' ], RPCM_RU32, rng.randint( 1, 5000 ) ),
+                 ( t[ 'FILE_PATH' ], stringType, filePath ),
+                 ( t[ 'COMMAND_LINE' ], stringType, commandLine ),
+                 ( t[ 'USER_ID' ], RPCM_RU32, userId ),
+                 ( t[ 'USER_NAME' ], stringType, userName ),
+                 ( t[ 'THREADS' ], RPCM_RU32, rng.randint( 1, 64 ) ) ] + common
+        return ( rng.choice( ( t[ 'NEW_PROCESS' ], t[ 'TERMINATE_PROCESS' ] ) ), RPCM_SEQUENCE, info )
+    elif kind < 0.75:
+        stringType, modulePath = syntheticString( platform, rng.choice( platform[ 'modules' ] ) )
+        info = [ ( t[ 'PROCESS_ID' ], RPCM_RU32, pid ),
+                 ( t[ 'FILE_PATH' ], stringType, modulePath ),
+                 ( t[ 'BASE_ADDRESS' ], RPCM_POINTER_64, 0x7f0000000000 + rng.getrandbits( 24 ) * 0x1000 ),
+                 ( t[ 'MEMORY_SIZE' ], RPCM_RU64, rng.randint( 1, 512 ) * 0x1000 ) ] + common
+        return ( t[ 'MODULE_LOAD' ], RPCM_SEQUENCE, info )
+    elif kind < 0.85:
+        info = [ ( t[ 'DOMAIN_NAME' ], RPCM_STRINGA, rng.choice( SYNTHETIC_DOMAINS ).encode( 'utf-8' ) + b'\x00' ),
+                 ( t[ 'MESSAGE_ID' ], RPCM_RU16, rng.getrandbits( 16 ) ),
+                 ( t[ 'DNS_TYPE' ], RPCM_RU16, rng.choice( ( 1, 1, 5, 28 ) ) ),
+                 ( t[ 'IP_ADDRESS' ], RPCM_IPV4, 0xC0000200 + rng.randint( 1, 254 ) ),
+                 ( t[ 'PROCESS_ID' ], RPCM_RU32, pid ) ] + common
+        return ( t[ 'DNS_REQUEST' ], RPCM_SEQUENCE, info )
+    elif kind < 0.93:
+        endpoint = lambda ip, port: [ ( t[ 'IP_ADDRESS' ], RPCM_IPV4, ip ), ( t[ 'PORT' ], RPCM_RU16, port ) ]
+        info = [ ( t[ 'PROCESS_ID' ], RPCM_RU32, pid ),
+                 ( t[ 'IS_OUTGOING' ], RPCM_RU8, 1 ),
+                 ( t[ 'SOURCE' ], RPCM_SEQUENCE, endpoint( 0x0A000000 + rng.randint( 2, 254 ), rng.randint( 32768, 60999 ) ) ),
+                 ( t[ 'DESTINATION' ], RPCM_SEQUENCE, endpoint( 0xC6336400 + rng.randint( 1, 254 ), rng.choice( ( 443, 443, 80, 53, 22 ) ) ) ) ] + common
+        return ( t[ 'NEW_TCP4_CONNECTION' ], RPCM_SEQUENCE, info )
+    else:
+        fileTemplate = rng.choice( platform[ 'files' ] )
+        stringType, filePath = syntheticString( platform, fileTemplate % rng.getrandbits( 16 ) if '%' in fileTemplate else fileTemplate )
+        info = [ ( t[ 'FILE_PATH' ], stringType, filePath ),
+                 ( t[ 'PROCESS_ID' ], RPCM_RU32, pid ) ] + common
+        return ( rng.choice( ( t[ 'FILE_CREATE' ], t[ 'FILE_DELETE' ], t[ 'FILE_MODIFIED' ] ) ), RPCM_SEQUENCE, info )
+
+def syntheticFrames( nFrames, seed ):
+    rng = random.Random( seed )
+    now = 1500000000000
+    frames = []
+    for i in range( nFrames ):
+        platform = rng.choice( SYNTHETIC_PLATFORMS )
+        messages = []
+        for j in range( rng.randint( 1, 30 ) ):
+            now += rng.randint( 0, 2000 )
+            messages.append( ( TAGS[ 'MESSAGE' ], RPCM_SEQUENCE, [ syntheticEvent( rng, platform, now ) ] ) )
+        frames.append( encodeFrame( 2, ( TAGS[ 'MESSAGE' ], RPCM_SEQUENCE, messages ) ) )
+    return frames
+
+def kgrams( data ):
+    return set( data[ i : i + KGRAM_SIZE ] for i in range( len( data ) - KGRAM_SIZE + 1 ) )
+
+def train( samples, dictSize ):
+    # How many frames each k-gram appears in, content unique to a single
+    # frame is worthless in a dictionary.
+    frequencies = collections.Counter()
+    for sample in samples:
+        frequencies.update( kgrams( sample ) )
+
+    candidates = set()
+    for sample in samples:
+        for i in range( 0, max( 1, len( sample ) - SEGMENT_SIZE + 1 ), SEGMENT_SIZE // 2 ):
+            candidates.add( sample[ i : i + SEGMENT_SIZE ] )
+
+    covered = set()
+
+    def score( segment ):
+        return sum( frequencies[ g ] for g in kgrams( segment ) if g not in covered and 1 < frequencies[ g ] )
+
+    # Greedy selection, scores only go down as coverage grows so we can
+    # re-score lazily when a candidate reaches the top of the heap.
+    heap = [ ( -score( c ), c ) for c in candidates ]
+    heapq.heapify( heap )
+    selected = []
+    totalSize = 0
+    while heap and totalSize < dictSize:
+        negScore, segment = heapq.heappop( heap )
+        newScore = score( segment )
+        if 0 == newScore:
+            continue
+        if heap and newScore < -heap[ 0 ][ 0 ]:
+            heapq.heappush( heap, ( -newScore, segment ) )
+            continue
+        selected.append( segment )
+        covered.update( kgrams( segment ) )
+        totalSize += len( segment )
+
+    # Deflate encodes closer matches more cheaply, so the most valuable
+    # segments go at the end of the dictionary.
+    dictionary = b''.join( reversed( selected ) )
+    return dictionary[ -dictSize : ]
+
+def benchmark( samples, dictionary ):
+    try:
+        zlib.compressobj( zdict = dictionary )
+    except TypeError:
+        print( 'python 3 is required to benchmark with a dictionary' )
+        return
+
+    rawSize = sum( len( s ) for s in samples )
+    if 0 == rawSize:
+        return
+
+    for name, zdict in ( ( 'no dictionary', None ), ( 'dictionary', dictionary ) ):
+        compressedSize = 0
+        start = time.time()
+        for sample in samples:
+            if zdict is None:
+                c = zlib.compressobj()
+            else:
+                c = zlib.compressobj( zdict = zdict )
+            compressedSize += len( c.compress( sample ) + c.flush() )
+        elapsed = max( time.time() - start, 0.000001 )
+        print( '%s: %d -> %d bytes, ratio %.2f, %.1f ms per MB' % ( name,
+                                                                   rawSize,
+                                                                   compressedSize,
+                                                                   float( rawSize ) / compressedSize,
+                                                                   elapsed * 1000 / ( float( rawSize ) / ( 1024 * 1024 ) ) ) )
+
+def writeHeader( dictionary, version, source ):
+    lines = []
+    for i in range( 0, len( dictionary ), 12 ):
+        lines.append( '    ' + ' '.join( '0x%02x,' % b for b in bytearray( dictionary[ i : i + 12 ] ) ) )
+    lines[ -1 ] = lines[ -1 ].rstrip( ',' )
+
+    content = '''/* This file was automatically generated by tools/train_frame_dictionary.py. */
+/* Trained on %(source)s. */
+
+#ifndef _HCP_FRAME_DICTIONARY_V%(version)d_H
+#define _HCP_FRAME_DICTIONARY_V%(version)d_H
+
+#include <rpal/rpal.h>
+
+static RU8 g_hcpFrameDictionaryV%(version)d[] = {
+%(data)s };
+
+#endif
+''' % { 'version' : version, 'source' : source, 'data' : '\n'.join( lines ) }
+
+    outPath = os.path.join( rootDir,
+                            'sensor',
+                            'lib',
+                            'rpHostCommonPlatformLib',
+                            'frameDictionary_v%d.h' % version )
+    with open( outPath, 'w' ) as f:
+        f.write( content )
+    print( 'dictionary of %d bytes written to %s' % ( len( dictionary ), outPath ) )
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser( description = 'train a preset deflate dictionary for HCP frames' )
+    parser.add_argument( 'version',
+                         type = int,
+                         help = 'version of the dictionary to generate, never reuse a shipped one' )
+    parser.add_argument( '--frames',
+                         type = str,
+                         default = None,
+                         help = 'directory of frames recorded with HCP_RECORD_FRAMES, scrubbed before training' )
+    parser.add_argument( '--synthetic',
+                         type = int,
+                         default = DEFAULT_SYNTHETIC_FRAMES,
+                         help = 'number of synthetic frames to train on when no frames are given' )
+    parser.add_argument( '--size',
+                         type = int,
+                         default = MAX_DICT_SIZE,
+                         help = 'maximum size of the dictionary' )
+    args = parser.parse_args()
+
+    if 0 == args.version:
+        print( 'version 0 means no dictionary' )
+        sys.exit( 1 )
+
+    dictSize = min( args.size, MAX_DICT_SIZE )
+
+    if args.frames is None:
+        frames = syntheticFrames( args.synthetic, SYNTHETIC_SEED )
+        source = '%d synthetic frames, seed %d' % ( len( frames ), SYNTHETIC_SEED )
+        print( 'generated %s' % source )
+    else:
+        frames = []
+        for fileName in sorted( os.listdir( args.frames ) ):
+            with open( os.path.join( args.frames, fileName ), 'rb' ) as f:
+                frame = f.read()
+            try:
+                frames.append( scrubFrame( frame ) )
+            except ( ValueError, struct.error ) as e:
+                print( 'skipping %s, not a valid frame: %s' % ( fileName, e ) )
+        source = '%d scrubbed recorded frames' % len( frames )
+
+    trainSet = []
+    testSet = []
+    for i, frame in enumerate( frames ):
+        if 0 == ( i + 1 ) % HOLD_OUT_EVERY:
+            testSet.append( frame )
+        else:
+            trainSet.append( frame )
+
+    if 0 == len( trainSet ):
+        print( 'no frames to train on' )
+        sys.exit( 1 )
+
+    print( 'training on %d frames, %d held out' % ( len( trainSet ), len( testSet ) ) )
+    dictionary = train( trainSet, dictSize )
+    benchmark( testSet, dictionary )
+    writeHeader( dictionary, args.version, source )